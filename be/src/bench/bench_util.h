@@ -12,14 +12,33 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <cmath>
 #include <random>
 #include <string>
 #include <vector>
 
+#include "column/chunk.h"
 #include "column/column_helper.h"
+#include "column/nullable_column.h"
 
 namespace starrocks {
 
+// Spec of a synthetic chunk stream. The values of each column are drawn from `ndv` distinct values following
+// a zipf distribution with exponent `skew` (0 means uniform), and `null_ratio` of them are null.
+struct ChunkStreamSpec {
+    // TYPE_INT, TYPE_BIGINT or TYPE_VARCHAR
+    LogicalType type = TYPE_BIGINT;
+    size_t num_columns = 1;
+    size_t num_rows = 1 << 20;
+    size_t chunk_size = 4096;
+    size_t ndv = 1024;
+    double skew = 0;
+    double null_ratio = 0;
+    // the slot ids of the columns are first_slot_id, first_slot_id + 1, ...
+    SlotId first_slot_id = 0;
+    uint64_t seed = 0;
+};
+
 class BenchUtil {
 public:
     template <typename T>
@@ -117,6 +136,53 @@ public:
         return column;
     }
 
+    static std::vector<ChunkPtr> create_chunk_stream(const ChunkStreamSpec& spec) {
+        std::mt19937_64 rng(spec.seed);
+        std::uniform_int_distribution<size_t> uniform_dist(0, spec.ndv - 1);
+        std::discrete_distribution<size_t> zipf_dist;
+        if (spec.skew > 0) {
+            std::vector<double> weights(spec.ndv);
+            for (size_t i = 0; i < spec.ndv; i++) {
+                weights[i] = 1.0 / std::pow(i + 1, spec.skew);
+            }
+            zipf_dist = std::discrete_distribution<size_t>(weights.begin(), weights.end());
+        }
+        std::bernoulli_distribution null_dist(spec.null_ratio);
+        const bool nullable = spec.null_ratio > 0;
+        const TypeDescriptor type_desc = spec.type == TYPE_VARCHAR ? TypeDescriptor::create_varchar_type(64)
+                                                                    : TypeDescriptor::from_logical_type(spec.type);
+
+        std::vector<ChunkPtr> chunks;
+        for (size_t start = 0; start < spec.num_rows; start += spec.chunk_size) {
+            size_t num_rows = std::min(spec.chunk_size, spec.num_rows - start);
+            auto chunk = std::make_shared<Chunk>();
+            for (size_t col = 0; col < spec.num_columns; col++) {
+                auto column = ColumnHelper::create_column(type_desc, nullable);
+                column->reserve(num_rows);
+                for (size_t i = 0; i < num_rows; i++) {
+                    if (nullable && null_dist(rng)) {
+                        column->append_nulls(1);
+                        continue;
+                    }
+                    // scramble the value ids, so that the hot values are not adjacent
+                    uint64_t id = spec.skew > 0 ? zipf_dist(rng) : uniform_dist(rng);
+                    uint64_t value = (id + 1) * 0x9E3779B97F4A7C15ULL;
+                    if (spec.type == TYPE_INT) {
+                        column->append_datum(Datum(static_cast<int32_t>(value >> 32)));
+                    } else if (spec.type == TYPE_BIGINT) {
+                        column->append_datum(Datum(static_cast<int64_t>(value)));
+                    } else {
+                        std::string str = "value_" + std::to_string(value);
+                        column->append_datum(Datum(Slice(str)));
+                    }
+                }
+                chunk->append_column(std::move(column), spec.first_slot_id + col);
+            }
+            chunks.emplace_back(std::move(chunk));
+        }
+        return chunks;
+    }
+
     static ColumnPtr create_random_string_column(int num_rows, int min_length) {
         std::vector<string> elements = create_random_string(num_rows, min_length, 60);
         TypeDescriptor type_desc = TypeDescriptor(TYPE_VARCHAR);
@@ -0,0 +1,131 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+#include <glog/logging.h>
+
+#include <random>
+#include <vector>
+
+#include "exec/join_hash_map.h"
+
+namespace starrocks {
+
+// Compare the probe of the bucket-chained join hash table with and without group prefetching.
+// The build side is a bigint key column, the probe side looks up random existing keys.
+class JoinHashMapBench {
+public:
+    JoinHashMapBench(size_t build_rows, size_t probe_rows) : _build_rows(build_rows), _probe_rows(probe_rows) {}
+
+    void SetUp();
+
+    uint32_t probe(JoinHashTableItems* table_items);
+
+    JoinHashTableItems* table_items() { return &_table_items; }
+
+private:
+    static constexpr uint32_t kChunkSize = 4096;
+
+    size_t _build_rows;
+    size_t _probe_rows;
+
+    Buffer<int64_t> _build_keys;
+    Buffer<int64_t> _probe_keys;
+    JoinHashTableItems _table_items;
+};
+
+void JoinHashMapBench::SetUp() {
+    std::mt19937_64 rng(0);
+
+    // the first row is a padding row, same as the build chunk of hash join
+    _build_keys.resize(_build_rows + 1);
+    _build_keys[0] = 0;
+    for (size_t i = 1; i <= _build_rows; i++) {
+        _build_keys[i] = rng();
+    }
+
+    _table_items.row_count = _build_rows;
+    _table_items.bucket_size = JoinHashMapHelper::calc_bucket_size(_build_rows + 1);
+    _table_items.log_bucket_size = __builtin_ctz(_table_items.bucket_size);
+    _table_items.first.resize(_table_items.bucket_size, 0);
+    _table_items.next.resize(_build_rows + 1, 0);
+    for (uint32_t i = 1; i <= _build_rows; i++) {
+        uint32_t bucket = JoinHashMapHelper::calc_bucket_num<int64_t>(_build_keys[i], _table_items.bucket_size,
+                                                                      _table_items.log_bucket_size);
+        _table_items.next[i] = _table_items.first[bucket];
+        _table_items.first[bucket] = i;
+    }
+
+    std::uniform_int_distribution<size_t> index_gen(1, _build_rows);
+    _probe_keys.resize(_probe_rows);
+    for (size_t i = 0; i < _probe_rows; i++) {
+        _probe_keys[i] = _build_keys[index_gen(rng)];
+    }
+}
+
+uint32_t JoinHashMapBench::probe(JoinHashTableItems* table_items) {
+    Buffer<uint32_t> buckets(kChunkSize);
+    Buffer<uint32_t> nexts(kChunkSize);
+    uint32_t matched = 0;
+
+    for (size_t start = 0; start < _probe_rows; start += kChunkSize) {
+        uint32_t count = std::min<size_t>(kChunkSize, _probe_rows - start);
+        JoinHashMapHelper::calc_bucket_nums<int64_t>(_probe_keys, table_items->bucket_size,
+                                                     table_items->log_bucket_size, &buckets, start, count);
+        JoinHashMapHelper::lookup_first(*table_items, buckets.data(), nullptr, nexts.data(), count);
+
+        for (uint32_t i = 0; i < count; i++) {
+            if (table_items->ht_cache_miss_serious()) {
+                JoinHashMapHelper::prefetch_build_key<int64_t>(*table_items, _build_keys, nexts.data(), i, count);
+            }
+            uint32_t build_index = nexts[i];
+            while (build_index != 0) {
+                if (_build_keys[build_index] == _probe_keys[start + i]) {
+                    matched++;
+                }
+                build_index = table_items->next[build_index];
+            }
+        }
+    }
+    return matched;
+}
+
+static void BM_JoinHashMap_Probe(benchmark::State& state) {
+    size_t build_rows = state.range(0);
+    bool enable_prefetch = state.range(1);
+
+    JoinHashMapBench bench(build_rows, 1 << 20);
+    bench.SetUp();
+    // cache_miss_serious is the switch of the prefetching probe path
+    bench.table_items()->cache_miss_serious = enable_prefetch;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(bench.probe(bench.table_items()));
+    }
+    state.SetItemsProcessed(state.iterations() * (1 << 20));
+}
+
+static void BM_JoinHashMap_Probe_Args(benchmark::internal::Benchmark* b) {
+    for (int64_t build_rows : {1 << 16, 1 << 20, 1 << 24, 1 << 26}) {
+        b->Args({build_rows, false});
+        b->Args({build_rows, true});
+    }
+    b->Unit(benchmark::kMillisecond);
+}
+
+BENCHMARK(BM_JoinHashMap_Probe)->Apply(BM_JoinHashMap_Probe_Args);
+
+} // namespace starrocks
+
+BENCHMARK_MAIN();
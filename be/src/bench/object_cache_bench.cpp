@@ -29,9 +29,16 @@
 
 namespace starrocks {
 
-enum class CacheType { LRU, STAR };
-
-enum class TestMode { INSERT, QUERY_ALL_HIT, QUERY_50_PERCENT_HIT, QUERY_MULTI_THREAD, INSERT_MULTI_THREAD };
+enum class CacheType { LRU, STAR, LRU_TINYLFU };
+
+enum class TestMode {
+    INSERT,
+    QUERY_ALL_HIT,
+    QUERY_50_PERCENT_HIT,
+    QUERY_MULTI_THREAD,
+    INSERT_MULTI_THREAD,
+    QUERY_WITH_SCAN
+};
 
 /* test result (touch rate 100%)
  |mode|LRU|Star|
@@ -65,6 +72,9 @@ public:
     void random_query(benchmark::State& state, CacheType cache_type, size_t ratio, int64_t iter_count, int64_t count);
     void random_query_multi_threads_test(benchmark::State& state, CacheType cache_type, size_t ratio, int64_t count);
     void insert_cache_multi_threads_test(benchmark::State& state, CacheType cache_type, int64_t count);
+    // Lookups of a hot key set interleaved with a one-pass scan of new keys, every miss is inserted.
+    // The capacity is just enough for the hot keys, reports the hit ratio of the hot keys.
+    void query_with_scan_test(benchmark::State& state, CacheType cache_type, int64_t iter_count, int64_t count);
 
 private:
     MemPool _mem_pool;
@@ -98,13 +108,15 @@ void ObjectCacheBench::init_env() {
 std::string ObjectCacheBench::get_cache_type_str(CacheType type) {
     if (type == CacheType::LRU) {
         return "LRU";
+    } else if (type == CacheType::LRU_TINYLFU) {
+        return "LRU_TINYLFU";
     } else {
         return "STAR";
     }
 }
 
 ObjectCache* ObjectCacheBench::get_object_cache(CacheType type) {
-    if (type == CacheType::LRU) {
+    if (type == CacheType::LRU || type == CacheType::LRU_TINYLFU) {
         return _lru_cache.get();
     } else {
         return _star_cache.get();
@@ -112,8 +124,9 @@ ObjectCache* ObjectCacheBench::get_object_cache(CacheType type) {
 }
 
 void ObjectCacheBench::init_cache(CacheType cache_type) {
-    if (cache_type == CacheType::LRU) {
-        _shared_lru_cache = std::make_shared<ShardedLRUCache>(_capacity);
+    if (cache_type == CacheType::LRU || cache_type == CacheType::LRU_TINYLFU) {
+        auto admission = cache_type == CacheType::LRU_TINYLFU ? CacheAdmission::TINY_LFU : CacheAdmission::ALWAYS;
+        _shared_lru_cache = std::make_shared<ShardedLRUCache>(_capacity, admission);
         _lru_cache = std::make_shared<LRUCacheModule>(_shared_lru_cache);
         LOG(ERROR) << "init lru cache success";
     } else {
@@ -320,6 +333,44 @@ void ObjectCacheBench::insert_cache_multi_threads_test(benchmark::State& state,
     state.ResumeTiming();
 }
 
+void ObjectCacheBench::query_with_scan_test(benchmark::State& state, CacheType cache_type, int64_t iter_count,
+                                            int64_t count) {
+    _capacity = count * (_page_size + 128);
+    init_cache(cache_type);
+    ObjectCache* cache = get_object_cache(cache_type);
+
+    std::mt19937 gen(0);
+    std::uniform_int_distribution<int64_t> dis(0, count - 1);
+    auto deleter = [](const starrocks::CacheKey& key, void* value) { free(value); };
+    auto access = [&](const std::string& key) {
+        ObjectCacheHandlePtr handle = nullptr;
+        Status st = cache->lookup(key, &handle, nullptr);
+        if (st.ok()) {
+            cache->release(handle);
+            return true;
+        }
+        void* ptr = malloc(_page_size);
+        *(int*)ptr = 1;
+        ObjectCacheWriteOptions options;
+        st = cache->insert(key, ptr, _page_size, deleter, &handle, &options);
+        if (st.ok()) {
+            cache->release(handle);
+        }
+        return false;
+    };
+
+    state.ResumeTiming();
+    int64_t hot_hits = 0;
+    for (int64_t i = 0; i < iter_count; i++) {
+        hot_hits += access("hot:" + std::to_string(dis(gen)));
+        access("scan:" + std::to_string(i));
+    }
+    state.PauseTiming();
+
+    LOG(INFO) << "query with scan: type=" << get_cache_type_str(cache_type)
+              << ", hot hit ratio=" << static_cast<double>(hot_hits) / iter_count;
+}
+
 static void bench_func(benchmark::State& state) {
     ObjectCacheBench::init_env();
     CacheType type = static_cast<CacheType>(state.range(0));
@@ -345,6 +396,9 @@ static void bench_func(benchmark::State& state) {
     case TestMode::INSERT_MULTI_THREAD:
         perf.insert_cache_multi_threads_test(state, type, count);
         break;
+    case TestMode::QUERY_WITH_SCAN:
+        perf.query_with_scan_test(state, type, iter_count, count);
+        break;
     default:
         break;
     }
@@ -371,6 +425,10 @@ static void process_args(benchmark::internal::Benchmark* b) {
     // multi thread insert
     b->Args({0, 4, 1000000, 5000000})->Iterations(1);
     b->Args({1, 4, 1000000, 5000000})->Iterations(1);
+
+    // one thread hot query interleaved with scan, plain LRU and TinyLFU admission
+    b->Args({0, 5, 10000000, 100000})->Iterations(1);
+    b->Args({2, 5, 10000000, 100000})->Iterations(1);
 }
 
 BENCHMARK(bench_func)->Apply(process_args);
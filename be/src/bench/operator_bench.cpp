@@ -0,0 +1,269 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+#include <glog/logging.h>
+
+#include <memory>
+#include <vector>
+
+#include "bench/bench_util.h"
+#include "column/chunk.h"
+#include "common/config.h"
+#include "common/object_pool.h"
+#include "exec/aggregate/agg_hash_variant.h"
+#include "exec/chunks_sorter_full_sort.h"
+#include "exec/join_hash_map.h"
+#include "exprs/column_ref.h"
+#include "exprs/expr_context.h"
+#include "runtime/descriptor_helper.h"
+#include "runtime/descriptors.h"
+#include "runtime/mem_pool.h"
+#include "runtime/runtime_state.h"
+#include "serde/protobuf_serde.h"
+#include "util/runtime_profile.h"
+
+namespace starrocks {
+
+// End-to-end benchmarks of the cores of the hot pipeline operators over synthetic chunk streams:
+// - hash join: the JoinHashTable built by HashJoinBuildOperator and probed by HashJoinProbeOperator
+// - hash aggregation: the one-number-key hash map of AggregateBlockingSinkOperator
+// - sort: the ChunksSorterFullSort used by PartitionSortSinkOperator
+// - exchange: the chunk serialization of ExchangeSinkOperator
+// All of them take the arguments {ndv, skew * 100, null_ratio * 100} of the bigint key columns.
+// Use --benchmark_format=json (or --benchmark_out=<file> --benchmark_out_format=json) to track the results.
+class OperatorBench {
+public:
+    static constexpr size_t kNumRows = 1 << 20;
+
+    OperatorBench(const benchmark::State& state) {
+        config::vector_chunk_size = 4096;
+        _spec.type = TYPE_BIGINT;
+        _spec.num_rows = kNumRows;
+        _spec.chunk_size = config::vector_chunk_size;
+        _spec.ndv = state.range(0);
+        _spec.skew = state.range(1) / 100.0;
+        _spec.null_ratio = state.range(2) / 100.0;
+
+        TUniqueId fragment_id;
+        TQueryOptions query_options;
+        query_options.batch_size = config::vector_chunk_size;
+        TQueryGlobals query_globals;
+        _runtime_state = std::make_shared<RuntimeState>(fragment_id, query_options, query_globals, nullptr);
+        _runtime_state->init_instance_mem_tracker();
+    }
+
+    // Chunks of `num_columns` bigint columns with slot ids from `first_slot_id`.
+    std::vector<ChunkPtr> create_chunks(size_t num_columns, SlotId first_slot_id, uint64_t seed) const {
+        ChunkStreamSpec spec = _spec;
+        spec.num_columns = num_columns;
+        spec.first_slot_id = first_slot_id;
+        spec.seed = seed;
+        return BenchUtil::create_chunk_stream(spec);
+    }
+
+    // The probe side is tuple 0 with slots {0, 1}, and the build side is tuple 1 with slots {2, 3}.
+    void create_join_row_desc() {
+        TDescriptorTableBuilder desc_builder;
+        for (int tuple = 0; tuple < 2; tuple++) {
+            TTupleDescriptorBuilder tuple_builder;
+            for (int i = 0; i < 2; i++) {
+                tuple_builder.add_slot(TSlotDescriptorBuilder()
+                                               .type(TYPE_BIGINT)
+                                               .column_name("c" + std::to_string(i))
+                                               .column_pos(i)
+                                               .nullable(_spec.null_ratio > 0)
+                                               .build());
+            }
+            tuple_builder.build(&desc_builder);
+        }
+        DescriptorTbl* tbl = nullptr;
+        CHECK(DescriptorTbl::create(_runtime_state.get(), &_pool, desc_builder.desc_tbl(), &tbl,
+                                    config::vector_chunk_size)
+                      .ok());
+        _probe_row_desc = std::make_unique<RowDescriptor>(*tbl, std::vector<TTupleId>{0});
+        _build_row_desc = std::make_unique<RowDescriptor>(*tbl, std::vector<TTupleId>{1});
+    }
+
+    HashTableParam create_join_param(RuntimeProfile* profile) {
+        HashTableParam param;
+        param.with_other_conjunct = false;
+        param.join_type = TJoinOp::INNER_JOIN;
+        param.search_ht_timer = ADD_TIMER(profile, "SearchHashTableTime");
+        param.output_build_column_timer = ADD_TIMER(profile, "OutputBuildColumnTime");
+        param.output_probe_column_timer = ADD_TIMER(profile, "OutputProbeColumnTime");
+        for (SlotId slot = 0; slot < 4; slot++) {
+            param.probe_output_slots.emplace(slot);
+            param.build_output_slots.emplace(slot);
+        }
+        param.join_keys.emplace_back(JoinKeyDesc{&_bigint_type, false, nullptr});
+        param.probe_row_desc = _probe_row_desc.get();
+        param.build_row_desc = _build_row_desc.get();
+        return param;
+    }
+
+    RuntimeState* runtime_state() const { return _runtime_state.get(); }
+    ObjectPool* pool() { return &_pool; }
+
+private:
+    ChunkStreamSpec _spec;
+    ObjectPool _pool;
+    std::shared_ptr<RuntimeState> _runtime_state;
+    TypeDescriptor _bigint_type = TypeDescriptor::from_logical_type(TYPE_BIGINT);
+    std::unique_ptr<RowDescriptor> _probe_row_desc;
+    std::unique_ptr<RowDescriptor> _build_row_desc;
+};
+
+static void BM_HashJoin(benchmark::State& state) {
+    OperatorBench bench(state);
+    bench.create_join_row_desc();
+    auto build_chunks = bench.create_chunks(2, 2, 1);
+    auto probe_chunks = bench.create_chunks(2, 0, 2);
+
+    int64_t output_rows = 0;
+    for (auto _ : state) {
+        RuntimeProfile profile("HashJoin");
+        JoinHashTable hash_table;
+        hash_table.create(bench.create_join_param(&profile));
+        for (const auto& chunk : build_chunks) {
+            hash_table.append_chunk(chunk, {chunk->get_column_by_slot_id(2)});
+        }
+        CHECK(hash_table.build(bench.runtime_state()).ok());
+
+        for (const auto& chunk : probe_chunks) {
+            ChunkPtr probe_chunk = chunk;
+            Columns key_columns{chunk->get_column_by_slot_id(0)};
+            bool has_remain = false;
+            do {
+                ChunkPtr result_chunk = std::make_shared<Chunk>();
+                CHECK(hash_table.probe(bench.runtime_state(), key_columns, &probe_chunk, &result_chunk, &has_remain)
+                              .ok());
+                output_rows += result_chunk->num_rows();
+            } while (has_remain);
+        }
+        hash_table.close();
+    }
+    state.SetItemsProcessed(state.iterations() * OperatorBench::kNumRows * 2);
+    state.counters["output_rows"] = benchmark::Counter(output_rows, benchmark::Counter::kAvgIterations);
+}
+
+template <typename HashMapWithKey>
+static void hash_agg(benchmark::State& state, const std::vector<ChunkPtr>& chunks) {
+    int64_t num_groups = 0;
+    for (auto _ : state) {
+        RuntimeProfile profile("HashAgg");
+        AggStatistics agg_stat(&profile);
+        MemPool pool;
+        HashMapWithKey hash_map_with_key(config::vector_chunk_size, &agg_stat);
+        Buffer<AggDataPtr> agg_states(config::vector_chunk_size);
+        // a count state per group
+        auto allocate_func = [&](auto&&) {
+            auto* state = pool.allocate(sizeof(int64_t));
+            *reinterpret_cast<int64_t*>(state) = 0;
+            return state;
+        };
+        for (const auto& chunk : chunks) {
+            size_t num_rows = chunk->num_rows();
+            hash_map_with_key.build_hash_map(num_rows, {chunk->get_column_by_slot_id(0)}, &pool, allocate_func,
+                                             &agg_states);
+            for (size_t i = 0; i < num_rows; i++) {
+                (*reinterpret_cast<int64_t*>(agg_states[i]))++;
+            }
+        }
+        num_groups = hash_map_with_key.hash_map.size();
+    }
+    state.SetItemsProcessed(state.iterations() * OperatorBench::kNumRows);
+    state.counters["groups"] = num_groups;
+}
+
+static void BM_HashAgg(benchmark::State& state) {
+    OperatorBench bench(state);
+    auto chunks = bench.create_chunks(1, 0, 1);
+    if (state.range(2) > 0) {
+        hash_agg<NullInt64AggHashMapWithOneNumberKey<PhmapSeed1>>(state, chunks);
+    } else {
+        hash_agg<Int64AggHashMapWithOneNumberKey<PhmapSeed1>>(state, chunks);
+    }
+}
+
+static void BM_FullSort(benchmark::State& state) {
+    OperatorBench bench(state);
+    auto chunks = bench.create_chunks(2, 0, 1);
+    auto* runtime_state = bench.runtime_state();
+
+    TypeDescriptor type_desc = TypeDescriptor::from_logical_type(TYPE_BIGINT);
+    auto* sort_expr = bench.pool()->add(new ExprContext(bench.pool()->add(new ColumnRef(type_desc, 0))));
+    CHECK(sort_expr->prepare(runtime_state).ok());
+    CHECK(sort_expr->open(runtime_state).ok());
+    std::vector<ExprContext*> sort_exprs{sort_expr};
+    std::vector<bool> is_asc{true};
+    std::vector<bool> is_null_first{true};
+    const std::vector<SlotId> early_materialized_slots;
+
+    for (auto _ : state) {
+        RuntimeProfile profile("FullSort");
+        ChunksSorterFullSort sorter(runtime_state, &sort_exprs, &is_asc, &is_null_first, "", 1024 * 1024,
+                                    256 * 1024 * 1024, early_materialized_slots);
+        sorter.setup_runtime(runtime_state, &profile, runtime_state->instance_mem_tracker());
+        for (const auto& chunk : chunks) {
+            CHECK(sorter.update(runtime_state, chunk->clone_unique()).ok());
+        }
+        CHECK(sorter.done(runtime_state).ok());
+        bool eos = false;
+        while (!eos) {
+            ChunkPtr page;
+            CHECK(sorter.get_next(&page, &eos).ok());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * OperatorBench::kNumRows);
+}
+
+static void BM_ExchangeSerialize(benchmark::State& state) {
+    OperatorBench bench(state);
+    auto chunks = bench.create_chunks(2, 0, 1);
+
+    int64_t serialized_bytes = 0;
+    for (auto _ : state) {
+        serialized_bytes = 0;
+        for (const auto& chunk : chunks) {
+            auto chunk_pb = serde::ProtobufChunkSerde::serialize(*chunk);
+            CHECK(chunk_pb.ok());
+            serialized_bytes += chunk_pb.value().data().size();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * OperatorBench::kNumRows);
+    state.SetBytesProcessed(state.iterations() * serialized_bytes);
+}
+
+// {ndv, skew * 100, null_ratio * 100}
+static void operator_bench_args(benchmark::internal::Benchmark* b) {
+    for (int64_t ndv : {1 << 10, 1 << 16, 1 << 20}) {
+        for (int64_t skew : {0, 120}) {
+            for (int64_t null_ratio : {0, 10}) {
+                b->Args({ndv, skew, null_ratio});
+            }
+        }
+    }
+    b->ArgNames({"ndv", "skew_pct", "null_pct"});
+    b->Unit(benchmark::kMillisecond);
+}
+
+BENCHMARK(BM_HashJoin)->Apply(operator_bench_args);
+BENCHMARK(BM_HashAgg)->Apply(operator_bench_args);
+BENCHMARK(BM_FullSort)->Apply(operator_bench_args);
+BENCHMARK(BM_ExchangeSerialize)->Apply(operator_bench_args);
+
+} // namespace starrocks
+
+BENCHMARK_MAIN();
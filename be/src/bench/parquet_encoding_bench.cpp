@@ -20,8 +20,12 @@
 
 #include "bench/bench_util.h"
 #include "formats/parquet/encoding.h"
+#include "formats/parquet/level_codec.h"
 #include "formats/parquet/types.h"
+#include "util/bit_util.h"
 #include "util/compression/block_compression.h"
+#include "util/faststring.h"
+#include "util/rle_encoding.h"
 
 namespace starrocks::parquet {
 
@@ -343,6 +347,54 @@ BENCHMARK_TEMPLATE(BMTestString, tparquet::Type::FIXED_LEN_BYTE_ARRAY, SKIP)->Ap
 BENCHMARK_TEMPLATE(BMTestString, tparquet::Type::FIXED_LEN_BYTE_ARRAY, LOWCARD)->Apply(CustomArgsLowcardString);
 BENCHMARK_TEMPLATE(BMTestString, tparquet::Type::FIXED_LEN_BYTE_ARRAY, PREFIX)->Apply(CustomArgsLowcardString);
 
+// Decode RLE/bit-packed definition levels the way the stored column readers do.
+// range(0): max def level, range(1): num levels, range(2): average run length, 1 means random levels.
+static void BMTestLevel(benchmark::State& state) {
+    level_t max_level = state.range(0);
+    int64_t num_levels = state.range(1);
+    int64_t run_length = state.range(2);
+    int bit_width = BitUtil::log2(max_level + 1);
+
+    std::vector<int64_t> values = BenchUtil::create_random_values<int64_t>(num_levels, 0, max_level);
+    faststring buffer;
+    RleEncoder<level_t> encoder(&buffer, bit_width);
+    for (int64_t i = 0; i < num_levels; i++) {
+        encoder.Put(values[i / run_length * run_length]);
+    }
+    encoder.Flush();
+    state.SetLabel(fmt::format("max_level={},levels={},run={},sz={}", max_level, num_levels, run_length,
+                               buffer.size()));
+
+    int64_t timer = 0;
+    for (auto _ : state) {
+        LevelDecoder decoder(&timer);
+        Slice slice(buffer.data(), buffer.size());
+        (void)decoder.parse_v2(buffer.size(), max_level, num_levels, &slice);
+        int64_t parsed = 0;
+        while (parsed < num_levels) {
+            level_t* levels = nullptr;
+            size_t batch = std::min<int64_t>(kTestChunkSize, num_levels - parsed);
+            size_t avail = decoder.get_avail_levels(batch, &levels);
+            benchmark::DoNotOptimize(levels);
+            batch = std::min(batch, avail);
+            decoder.consume_levels(batch);
+            decoder.reset();
+            parsed += batch;
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * num_levels);
+}
+
+static void CustomArgsLevel(benchmark::internal::Benchmark* b) {
+    for (int64_t max_level : {1, 3, 7}) {
+        for (int64_t run_length : {1, 8, 64}) {
+            b->Args({max_level, 1 << 20, run_length});
+        }
+    }
+}
+
+BENCHMARK(BMTestLevel)->Apply(CustomArgsLevel);
+
 } // namespace starrocks::parquet
 
 BENCHMARK_MAIN();
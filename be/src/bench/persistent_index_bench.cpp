@@ -15,6 +15,7 @@
 #include <benchmark/benchmark.h>
 
 #include <cstdlib>
+#include <random>
 
 #include "fs/fs_util.h"
 #include "storage/chunk_helper.h"
@@ -25,9 +26,12 @@
 namespace starrocks {
 
 struct BenchParams {
+    // 0 means variable length string keys, otherwise fixed length integer keys of key_size bytes
     size_t key_size;
     uint64_t total_record;
     uint64_t each_upsert_record;
+    // after loading all the records, upsert so many batches of existing keys picked randomly, like CDC updates
+    uint64_t update_steps;
 };
 
 #define ASSERT_CHECK(stmt)      \
@@ -75,6 +79,15 @@ public:
     void do_bench(benchmark::State& state);
     void do_verify();
 
+    Key gen_key(uint64_t i) const {
+        if (_params.key_size == 0) {
+            return "persistent_index_bench_" + std::to_string(i);
+        }
+        Key key(_params.key_size, '\0');
+        memcpy(key.data(), &i, std::min(sizeof(i), _params.key_size));
+        return key;
+    }
+
 private:
     PersistentIndexMetaPB _index_meta;
     std::string _index_dir;
@@ -93,7 +106,7 @@ void PersistentIndexBenchTest::do_verify() {
     vector<Slice> key_slices(_params.total_record);
     vector<IndexValue> values(_params.total_record);
     for (int i = 0; i < _params.total_record; i++) {
-        keys[i] = "persistent_index_bench_" + std::to_string(i);
+        keys[i] = gen_key(i);
         values[i] = i;
         key_slices[i] = keys[i];
     }
@@ -113,7 +126,7 @@ void PersistentIndexBenchTest::do_bench(benchmark::State& state) {
     vector<IndexValue> values(_params.each_upsert_record);
     auto incre_key = [&](int step) {
         for (int i = 0; i < _params.each_upsert_record; i++) {
-            keys[i] = "persistent_index_bench_" + std::to_string(i + step * _params.each_upsert_record);
+            keys[i] = gen_key(i + step * _params.each_upsert_record);
             values[i] = i + step * _params.each_upsert_record;
             key_slices[i] = keys[i];
         }
@@ -146,6 +159,28 @@ void PersistentIndexBenchTest::do_bench(benchmark::State& state) {
         _long_tail_stat = std::max(tail, _long_tail_stat);
     }
 
+    // upsert batches of existing keys with the same values, every key is looked up in all levels
+    std::mt19937_64 rng(0);
+    uint64_t update_cost = 0;
+    for (int i = 0; i < _params.update_steps; i++) {
+        for (int j = 0; j < _params.each_upsert_record; j++) {
+            uint64_t id = rng() % _params.total_record;
+            keys[j] = gen_key(id);
+            values[j] = id;
+            key_slices[j] = keys[j];
+        }
+        IOStat stat;
+        std::vector<IndexValue> old_values(_params.each_upsert_record, IndexValue(NullIndexValue));
+        ASSERT_CHECK(_index->prepare(EditVersion(_cur_version++, 0), _params.each_upsert_record));
+        MonotonicStopWatch watch;
+        watch.start();
+        ASSERT_CHECK(
+                _index->upsert(_params.each_upsert_record, key_slices.data(), values.data(), old_values.data(), &stat));
+        update_cost += watch.elapsed_time();
+        ASSERT_CHECK(_index->commit(&_index_meta, &stat));
+        ASSERT_CHECK(_index->on_commited());
+    }
+
     // print result
     LOG(INFO) << fmt::format(
             "PersistentIndexBench result, l0_write_cost: {} l1_l2_read_cost: {} flush_or_wal_cost: {} compaction_cost: "
@@ -153,15 +188,20 @@ void PersistentIndexBenchTest::do_bench(benchmark::State& state) {
             _total_stat.l0_write_cost / total_step, _total_stat.l1_l2_read_cost / total_step,
             _total_stat.flush_or_wal_cost / total_step, _total_stat.compaction_cost / total_step,
             _total_stat.reload_meta_cost / total_step, _long_tail_stat);
+    if (_params.update_steps > 0) {
+        LOG(INFO) << fmt::format("PersistentIndexBench update result, upsert_cost_per_batch: {}",
+                                 update_cost / _params.update_steps);
+    }
     // verify
     do_verify();
 }
 
 static void bench_func(benchmark::State& state) {
     BenchParams params;
-    params.key_size = 0;
     params.total_record = state.range(0);
     params.each_upsert_record = state.range(1);
+    params.key_size = state.range(2);
+    params.update_steps = state.range(3);
 
     PersistentIndexBenchTest perf(params);
     perf.do_bench(state);
@@ -177,7 +217,13 @@ static void process_args(benchmark::internal::Benchmark* b) {
     config::enable_pindex_minor_compaction = true;
     config::max_allow_pindex_l2_num = 5;
     config::pindex_major_compaction_num_threads = 2;
-    b->Args({10000000, 5000, 1})->Iterations(1);
+    // {total_record, each_upsert_record, key_size, update_steps}
+    b->Args({10000000, 5000, 0, 0})->Iterations(1);
+    // batch upsert of existing keys
+    b->Args({10000000, 5000, 0, 200})->Iterations(1);
+    b->Args({10000000, 50000, 0, 20})->Iterations(1);
+    b->Args({10000000, 5000, 8, 200})->Iterations(1);
+    b->Args({10000000, 50000, 8, 20})->Iterations(1);
 }
 
 BENCHMARK(bench_func)->Apply(process_args);
@@ -113,6 +113,53 @@ static void process_args(benchmark::internal::Benchmark* b) {
 
 BENCHMARK(bench_func)->Apply(process_args);
 
+// Union `bitmap_count` bitmaps of `value_count` random values in [0, end), which is what
+// bitmap_union/bitmap_union_count do for a group.
+static std::vector<BitmapValue> gen_bitmaps(size_t bitmap_count, size_t value_count, size_t end) {
+    Random rand(0);
+    std::vector<BitmapValue> bitmaps(bitmap_count);
+    for (auto& bitmap : bitmaps) {
+        for (size_t i = 0; i < value_count; i++) {
+            bitmap.add(rand.Next64() % end);
+        }
+    }
+    return bitmaps;
+}
+
+static void bench_union_one_by_one(benchmark::State& state) {
+    auto bitmaps = gen_bitmaps(state.range(0), state.range(1), state.range(2));
+    for (auto _ : state) {
+        BitmapValue result;
+        for (const auto& bitmap : bitmaps) {
+            result |= bitmap;
+        }
+        benchmark::DoNotOptimize(result.cardinality());
+    }
+}
+
+static void bench_fast_union(benchmark::State& state) {
+    auto bitmaps = gen_bitmaps(state.range(0), state.range(1), state.range(2));
+    std::vector<const BitmapValue*> values;
+    for (const auto& bitmap : bitmaps) {
+        values.push_back(&bitmap);
+    }
+    for (auto _ : state) {
+        BitmapValue result;
+        result.fast_union(values);
+        benchmark::DoNotOptimize(result.cardinality());
+    }
+}
+
+static void union_args(benchmark::internal::Benchmark* b) {
+    b->Args({4096, 100, 10000000});
+    b->Args({4096, 1000, 10000000});
+    b->Args({1024, 10000, 100000000});
+    b->Args({256, 100000, 5000000000});
+}
+
+BENCHMARK(bench_union_one_by_one)->Apply(union_args);
+BENCHMARK(bench_fast_union)->Apply(union_args);
+
 } // namespace starrocks
 
 BENCHMARK_MAIN();
\ No newline at end of file
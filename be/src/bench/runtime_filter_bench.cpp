@@ -16,6 +16,8 @@
 #include <glog/logging.h>
 #include <gtest/gtest.h>
 
+#include <random>
+
 #include "bench_util.h"
 #include "column/column_helper.h"
 #include "exprs/runtime_filter.h"
@@ -163,6 +165,54 @@ static void Benchmark_RuntimeFilter_Eval(benchmark::State& state) {
 
 BENCHMARK(Benchmark_RuntimeFilter_Eval)->Apply(RuntimeFilterArg1);
 
+// Lookup a bloom filter of 1/8/64 MB, one hash at a time or by test_hash_batch.
+// Half of the probe hashes are inserted into the filter.
+static void Benchmark_SimdBlockFilter_Lookup(benchmark::State& state) {
+    const size_t filter_bytes = state.range(0) << 20;
+    const bool use_batch = state.range(1);
+    constexpr size_t num_probes = 1 << 20;
+    constexpr size_t chunk_size = 4096;
+
+    SimdBlockFilter bf;
+    // one element takes one byte of the filter, see SimdBlockFilter::init
+    bf.init(filter_bytes);
+    std::mt19937_64 rng(0);
+    std::vector<uint64_t> hashes(num_probes);
+    for (size_t i = 0; i < num_probes; i++) {
+        hashes[i] = rng();
+        if (i % 2 == 0) {
+            bf.insert_hash(hashes[i]);
+        }
+    }
+
+    std::vector<uint8_t> selection(chunk_size);
+    for (auto _ : state) {
+        size_t hit = 0;
+        for (size_t start = 0; start < num_probes; start += chunk_size) {
+            std::fill(selection.begin(), selection.end(), 1);
+            if (use_batch) {
+                bf.test_hash_batch(hashes.data() + start, chunk_size, selection.data());
+            } else {
+                for (size_t i = 0; i < chunk_size; i++) {
+                    selection[i] = bf.test_hash(hashes[start + i]);
+                }
+            }
+            hit += SIMD::count_nonzero(selection.data(), chunk_size);
+        }
+        benchmark::DoNotOptimize(hit);
+    }
+    state.SetItemsProcessed(state.iterations() * num_probes);
+}
+
+static void SimdBlockFilterLookupArgs(benchmark::internal::Benchmark* b) {
+    for (int64_t filter_mb : {1, 8, 64}) {
+        b->Args({filter_mb, false});
+        b->Args({filter_mb, true});
+    }
+}
+
+BENCHMARK(Benchmark_SimdBlockFilter_Lookup)->Apply(SimdBlockFilterLookupArgs);
+
 } // namespace starrocks
 
 BENCHMARK_MAIN();
@@ -21,6 +21,7 @@
 #include "column/chunk.h"
 #include "column/column_helper.h"
 #include "column/vectorized_fwd.h"
+#include "exec/pipeline/exchange/shuffler.h"
 #include "runtime/types.h"
 #include "storage/chunk_helper.h"
 #include "types/logical_type.h"
@@ -63,6 +64,7 @@ private:
     std::vector<ChunkPtr> _dest_chunks;
     std::vector<uint32_t> _shuffle_idxs;
     std::vector<uint32_t> _select_idxs;
+    std::vector<uint32_t> _start_points;
 };
 
 void ShuffleChunkPerf::init_types() {
@@ -152,20 +154,23 @@ void ShuffleChunkPerf::do_hash(const ColumnPtr& col) {
 }
 
 void ShuffleChunkPerf::do_shuffle(const Chunk& src_chunk) {
+    _select_idxs.resize(_shuffle_idxs.size());
+    pipeline::Shuffler::partition_row_indexes(_shuffle_idxs.data(), _shuffle_idxs.size(), _node_count,
+                                              _start_points.data(), _select_idxs.data());
     for (int n = 0; n < _node_count; n++) {
-        _select_idxs.resize(0);
-        for (int i = 0; i < _shuffle_idxs.size(); i++) {
-            if (_shuffle_idxs[i] == n) {
-                _select_idxs.emplace_back(i);
-            }
+        uint32_t from = _start_points[n];
+        uint32_t size = _start_points[n + 1] - from;
+        if (size == 0) {
+            continue;
         }
-        _dest_chunks[n]->append_selective(src_chunk, _select_idxs.data(), 0, _select_idxs.size());
+        _dest_chunks[n]->append_selective(src_chunk, _select_idxs.data(), from, size);
     }
 }
 
 void ShuffleChunkPerf::do_bench(benchmark::State& state) {
     init_types();
     _dest_chunks.resize(_node_count, nullptr);
+    _start_points.resize(_node_count + 1);
 
     state.ResumeTiming();
 
@@ -0,0 +1,341 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+#include <glog/logging.h>
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "cache/datacache.h"
+#include "cache/object_cache/lrucache_module.h"
+#include "cache/object_cache/page_cache.h"
+#include "column/chunk.h"
+#include "common/config.h"
+#include "fs/fs_memory.h"
+#include "gen_cpp/olap_file.pb.h"
+#include "storage/chunk_helper.h"
+#include "storage/chunk_iterator.h"
+#include "storage/column_predicate.h"
+#include "storage/olap_common.h"
+#include "storage/predicate_tree/predicate_tree.hpp"
+#include "storage/rowset/segment.h"
+#include "storage/rowset/segment_options.h"
+#include "storage/rowset/segment_writer.h"
+#include "storage/tablet_schema.h"
+#include "types/logical_type.h"
+#include "util/lru_cache.h"
+
+namespace starrocks {
+
+// Scan benchmarks of SegmentIterator over synthetic segments written by SegmentWriter.
+// The segment is a duplicate key table of
+// - c0 INT key: the row id, filtered by the zone map and the short key index
+// - c1 INT: values in [0, 2 * ndv) of even numbers only, with a bitmap index and a bloom filter,
+//   written with the encoding given by the benchmark
+// - c2 VARCHAR: 64 distinct strings, dict encoded, filtered on the dict codes
+// - c3 BIGINT: a random payload, only read by late materialization
+// Use --benchmark_format=json (or --benchmark_out=<file> --benchmark_out_format=json) to track the results.
+class StorageScanBench {
+public:
+    static constexpr size_t kNumRows = 1 << 20;
+    static constexpr int32_t kNdv = 4096;
+    static constexpr size_t kNumStrings = 64;
+
+    // How the page cache is used by a scan.
+    enum PageCacheMode { PAGE_CACHE_OFF = 0, PAGE_CACHE_MISS = 1, PAGE_CACHE_HIT = 2 };
+
+    static StorageScanBench* instance() {
+        static StorageScanBench bench;
+        return &bench;
+    }
+
+    // The segment whose c1 is written with `encoding`, it's shared by the benchmarks.
+    std::shared_ptr<Segment> segment(EncodingTypePB encoding) {
+        auto iter = _segments.find(encoding);
+        if (iter == _segments.end()) {
+            iter = _segments.emplace(encoding, _write_segment(encoding)).first;
+        }
+        return iter->second;
+    }
+
+    const TabletSchemaCSPtr& tablet_schema() const { return _tablet_schema; }
+
+    static std::string c2_value(size_t i) { return "string_value_" + std::to_string(i % kNumStrings); }
+
+    // Scans `column_ids` of the segment with the predicates, returns the number of rows read.
+    size_t scan(const std::shared_ptr<Segment>& segment, const std::vector<ColumnId>& column_ids,
+                const std::vector<ColumnPredicate*>& predicates, PageCacheMode page_cache_mode,
+                OlapReaderStatistics* stats) {
+        auto schema = ChunkHelper::convert_schema(_tablet_schema, column_ids);
+        SegmentReadOptions seg_opts;
+        seg_opts.fs = _fs;
+        seg_opts.stats = stats;
+        seg_opts.tablet_schema = _tablet_schema;
+        seg_opts.use_page_cache = page_cache_mode != PAGE_CACHE_OFF;
+        seg_opts.chunk_size = config::vector_chunk_size;
+        PredicateAndNode pred_root;
+        for (auto* predicate : predicates) {
+            pred_root.add_child(PredicateColumnNode{predicate});
+        }
+        seg_opts.pred_tree = PredicateTree::create(std::move(pred_root));
+        seg_opts.pred_tree_for_zone_map = seg_opts.pred_tree;
+
+        auto chunk_iter = segment->new_iterator(schema, seg_opts);
+        if (chunk_iter.status().is_end_of_file()) {
+            // the whole segment is filtered by the zone map
+            return 0;
+        }
+        CHECK(chunk_iter.ok()) << chunk_iter.status();
+        auto chunk = ChunkHelper::new_chunk(schema, config::vector_chunk_size);
+        size_t num_rows = 0;
+        while (true) {
+            chunk->reset();
+            auto st = (*chunk_iter)->get_next(chunk.get());
+            if (st.is_end_of_file()) {
+                break;
+            }
+            CHECK(st.ok()) << st;
+            num_rows += chunk->num_rows();
+        }
+        (*chunk_iter)->close();
+        return num_rows;
+    }
+
+private:
+    StorageScanBench() {
+        config::vector_chunk_size = 4096;
+        _fs = std::make_shared<MemoryFileSystem>();
+        CHECK(_fs->create_dir(kSegmentDir).ok());
+
+        // big enough to keep all the pages of the segments
+        _lru_cache = std::make_shared<ShardedLRUCache>(4L * 1024 * 1024 * 1024);
+        _obj_cache = std::make_shared<LRUCacheModule>(_lru_cache);
+        _page_cache = std::make_shared<StoragePageCache>(_obj_cache.get());
+        DataCache::GetInstance()->set_page_cache(_page_cache);
+
+        TabletSchemaPB schema_pb;
+        schema_pb.set_keys_type(DUP_KEYS);
+        schema_pb.set_num_short_key_columns(1);
+        _add_column(&schema_pb, 0, "INT", 4, true, false);
+        _add_column(&schema_pb, 1, "INT", 4, false, true);
+        _add_column(&schema_pb, 2, "VARCHAR", 64, false, false);
+        _add_column(&schema_pb, 3, "BIGINT", 8, false, false);
+        _tablet_schema = TabletSchema::create(schema_pb);
+    }
+
+    static void _add_column(TabletSchemaPB* schema_pb, int32_t id, const std::string& type, int32_t length,
+                            bool is_key, bool with_indexes) {
+        ColumnPB* column = schema_pb->add_column();
+        column->set_unique_id(id);
+        column->set_name("c" + std::to_string(id));
+        column->set_type(type);
+        column->set_is_key(is_key);
+        column->set_is_nullable(false);
+        column->set_length(length);
+        column->set_index_length(std::min(length, 16));
+        column->set_aggregation("NONE");
+        column->set_is_bf_column(with_indexes);
+        column->set_has_bitmap_index(with_indexes);
+    }
+
+    std::shared_ptr<Segment> _write_segment(EncodingTypePB encoding) {
+        std::string file_name = kSegmentDir + "/" + EncodingTypePB_Name(encoding) + ".dat";
+        auto wfile = _fs->new_writable_file(file_name);
+        CHECK(wfile.ok()) << wfile.status();
+        SegmentWriterOptions opts;
+        opts.num_rows_per_block = 1024;
+        if (encoding != DEFAULT_ENCODING) {
+            opts.column_encodings[1] = encoding;
+        }
+        SegmentWriter writer(std::move(wfile).value(), 0, _tablet_schema, opts);
+        CHECK(writer.init().ok());
+
+        std::vector<std::string> strings;
+        for (size_t i = 0; i < kNumStrings; i++) {
+            strings.emplace_back(c2_value(i));
+        }
+        std::mt19937_64 rng(0);
+        std::uniform_int_distribution<int32_t> c1_dist(0, kNdv - 1);
+        auto schema = ChunkHelper::convert_schema(_tablet_schema);
+        auto chunk = ChunkHelper::new_chunk(schema, config::vector_chunk_size);
+        for (size_t start = 0; start < kNumRows; start += config::vector_chunk_size) {
+            chunk->reset();
+            auto& columns = chunk->columns();
+            size_t num_rows = std::min<size_t>(config::vector_chunk_size, kNumRows - start);
+            for (size_t i = 0; i < num_rows; i++) {
+                columns[0]->append_datum(Datum(static_cast<int32_t>(start + i)));
+                columns[1]->append_datum(Datum(c1_dist(rng) * 2));
+                columns[2]->append_datum(Datum(Slice(strings[rng() % kNumStrings])));
+                columns[3]->append_datum(Datum(static_cast<int64_t>(rng())));
+            }
+            CHECK(writer.append_chunk(*chunk).ok());
+        }
+        uint64_t file_size = 0;
+        uint64_t index_size = 0;
+        uint64_t footer_position = 0;
+        CHECK(writer.finalize(&file_size, &index_size, &footer_position).ok());
+
+        auto segment = Segment::open(_fs, FileInfo{file_name}, 0, _tablet_schema);
+        CHECK(segment.ok()) << segment.status();
+        return std::move(segment).value();
+    }
+
+    const std::string kSegmentDir = "/storage_scan_bench";
+    std::shared_ptr<MemoryFileSystem> _fs;
+    std::shared_ptr<ShardedLRUCache> _lru_cache;
+    std::shared_ptr<LRUCacheModule> _obj_cache;
+    std::shared_ptr<StoragePageCache> _page_cache;
+    TabletSchemaCSPtr _tablet_schema;
+    std::map<EncodingTypePB, std::shared_ptr<Segment>> _segments;
+};
+
+static void report(benchmark::State& state, const OlapReaderStatistics& stats, int64_t output_rows) {
+    state.SetItemsProcessed(state.iterations() * StorageScanBench::kNumRows);
+    state.SetBytesProcessed(stats.uncompressed_bytes_read);
+    state.counters["output_rows"] = benchmark::Counter(output_rows, benchmark::Counter::kAvgIterations);
+    state.counters["pages"] = benchmark::Counter(stats.total_pages_num, benchmark::Counter::kAvgIterations);
+    state.counters["cached_pages"] = benchmark::Counter(stats.cached_pages_num, benchmark::Counter::kAvgIterations);
+    state.counters["rows_stats_filtered"] =
+            benchmark::Counter(stats.rows_stats_filtered, benchmark::Counter::kAvgIterations);
+    state.counters["rows_bf_filtered"] = benchmark::Counter(stats.rows_bf_filtered, benchmark::Counter::kAvgIterations);
+    state.counters["rows_bitmap_index_filtered"] =
+            benchmark::Counter(stats.rows_bitmap_index_filtered, benchmark::Counter::kAvgIterations);
+    state.counters["rows_vec_cond_filtered"] =
+            benchmark::Counter(stats.rows_vec_cond_filtered, benchmark::Counter::kAvgIterations);
+}
+
+// Full scan of all columns, args: {c1 encoding, page cache mode}
+static void BM_FullScan(benchmark::State& state) {
+    auto* bench = StorageScanBench::instance();
+    auto segment = bench->segment(static_cast<EncodingTypePB>(state.range(0)));
+    auto page_cache_mode = static_cast<StorageScanBench::PageCacheMode>(state.range(1));
+
+    OlapReaderStatistics stats;
+    int64_t output_rows = 0;
+    for (auto _ : state) {
+        if (page_cache_mode == StorageScanBench::PAGE_CACHE_MISS) {
+            state.PauseTiming();
+            StoragePageCache::instance()->prune();
+            state.ResumeTiming();
+        }
+        output_rows += bench->scan(segment, {0, 1, 2, 3}, {}, page_cache_mode, &stats);
+    }
+    report(state, stats, output_rows);
+}
+
+// Vectorized filter on c1 with the late materialization of c2 and c3, args: {c1 encoding, selectivity in percent,
+// page cache mode}
+static void BM_FilteredScan(benchmark::State& state) {
+    auto* bench = StorageScanBench::instance();
+    auto segment = bench->segment(static_cast<EncodingTypePB>(state.range(0)));
+    auto page_cache_mode = static_cast<StorageScanBench::PageCacheMode>(state.range(2));
+    std::string operand = std::to_string(2 * StorageScanBench::kNdv * state.range(1) / 100);
+    std::unique_ptr<ColumnPredicate> predicate(new_column_lt_predicate(get_type_info(TYPE_INT), 1, operand));
+
+    OlapReaderStatistics stats;
+    int64_t output_rows = 0;
+    for (auto _ : state) {
+        output_rows += bench->scan(segment, {1, 2, 3}, {predicate.get()}, page_cache_mode, &stats);
+    }
+    report(state, stats, output_rows);
+}
+
+// Range filter on the sorted key c0 which is mostly resolved by the zone map, args: {selectivity in percent}
+static void BM_ZoneMapScan(benchmark::State& state) {
+    auto* bench = StorageScanBench::instance();
+    auto segment = bench->segment(DEFAULT_ENCODING);
+    std::string operand = std::to_string(StorageScanBench::kNumRows * state.range(0) / 100);
+    std::unique_ptr<ColumnPredicate> predicate(new_column_lt_predicate(get_type_info(TYPE_INT), 0, operand));
+
+    OlapReaderStatistics stats;
+    int64_t output_rows = 0;
+    for (auto _ : state) {
+        output_rows += bench->scan(segment, {0, 3}, {predicate.get()}, StorageScanBench::PAGE_CACHE_HIT, &stats);
+    }
+    report(state, stats, output_rows);
+}
+
+// Point filter on c1 resolved by the bitmap index, the value is present in the segment.
+static void BM_BitmapIndexScan(benchmark::State& state) {
+    auto* bench = StorageScanBench::instance();
+    auto segment = bench->segment(DEFAULT_ENCODING);
+    std::unique_ptr<ColumnPredicate> predicate(new_column_eq_predicate(get_type_info(TYPE_INT), 1, "1024"));
+
+    OlapReaderStatistics stats;
+    int64_t output_rows = 0;
+    for (auto _ : state) {
+        output_rows += bench->scan(segment, {1, 3}, {predicate.get()}, StorageScanBench::PAGE_CACHE_HIT, &stats);
+    }
+    report(state, stats, output_rows);
+}
+
+// Point filter on c1 of an absent value within the zone maps, so that the pages are pruned by the bloom filter.
+static void BM_BloomFilterScan(benchmark::State& state) {
+    auto* bench = StorageScanBench::instance();
+    auto segment = bench->segment(DEFAULT_ENCODING);
+    std::unique_ptr<ColumnPredicate> predicate(new_column_eq_predicate(get_type_info(TYPE_INT), 1, "1025"));
+
+    OlapReaderStatistics stats;
+    int64_t output_rows = 0;
+    for (auto _ : state) {
+        output_rows += bench->scan(segment, {1, 3}, {predicate.get()}, StorageScanBench::PAGE_CACHE_HIT, &stats);
+    }
+    report(state, stats, output_rows);
+}
+
+// Filter on the dict encoded c2, it's evaluated on the dict codes, args: {number of values in the IN list}
+static void BM_DictCodeScan(benchmark::State& state) {
+    auto* bench = StorageScanBench::instance();
+    auto segment = bench->segment(DEFAULT_ENCODING);
+    std::vector<std::string> values;
+    for (int64_t i = 0; i < state.range(0); i++) {
+        values.emplace_back(StorageScanBench::c2_value(i));
+    }
+    std::unique_ptr<ColumnPredicate> predicate(new_column_in_predicate(get_type_info(TYPE_VARCHAR), 2, values));
+
+    OlapReaderStatistics stats;
+    int64_t output_rows = 0;
+    for (auto _ : state) {
+        output_rows += bench->scan(segment, {2, 3}, {predicate.get()}, StorageScanBench::PAGE_CACHE_HIT, &stats);
+    }
+    report(state, stats, output_rows);
+}
+
+static const std::vector<int64_t> kEncodings = {DEFAULT_ENCODING, PLAIN_ENCODING, BIT_SHUFFLE, FOR_ENCODING,
+                                                DICT_ENCODING};
+static const std::vector<int64_t> kPageCacheModes = {StorageScanBench::PAGE_CACHE_OFF,
+                                                     StorageScanBench::PAGE_CACHE_MISS,
+                                                     StorageScanBench::PAGE_CACHE_HIT};
+
+BENCHMARK(BM_FullScan)
+        ->ArgsProduct({kEncodings, kPageCacheModes})
+        ->ArgNames({"encoding", "page_cache"})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_FilteredScan)
+        ->ArgsProduct({kEncodings, {1, 10, 50, 90}, {StorageScanBench::PAGE_CACHE_HIT}})
+        ->ArgNames({"encoding", "selectivity_pct", "page_cache"})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ZoneMapScan)->Arg(1)->Arg(10)->Arg(50)->ArgNames({"selectivity_pct"})->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_BitmapIndexScan)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_BloomFilterScan)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_DictCodeScan)->Arg(1)->Arg(8)->Arg(32)->ArgNames({"in_values"})->Unit(benchmark::kMillisecond);
+
+} // namespace starrocks
+
+BENCHMARK_MAIN();
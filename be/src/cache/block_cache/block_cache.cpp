@@ -122,13 +122,16 @@ Status BlockCache::read_buffer_from_remote_cache(const std::string& cache_key, s
     if (size == 0) {
         return Status::OK();
     }
+    if (_remote_cache == nullptr) {
+        return Status::NotSupported("no remote cache");
+    }
 
     return _remote_cache->read(cache_key, offset, size, buffer, options);
 }
 
 void BlockCache::record_read_remote_storage(size_t size, int64_t latency_us, bool local_only) {
     _local_cache->record_read_remote(size, latency_us);
-    if (!local_only) {
+    if (!local_only && _remote_cache != nullptr) {
         _remote_cache->record_read_remote(size, latency_us);
     }
 }
@@ -138,7 +141,9 @@ void BlockCache::record_read_local_cache(size_t size, int64_t latency_us) {
 }
 
 void BlockCache::record_read_remote_cache(size_t size, int64_t latency_us) {
-    _remote_cache->record_read_cache(size, latency_us);
+    if (_remote_cache != nullptr) {
+        _remote_cache->record_read_cache(size, latency_us);
+    }
 }
 
 Status BlockCache::shutdown() {
@@ -16,6 +16,7 @@
 
 #include "cache/datacache_utils.h"
 #include "cache/disk_space_monitor.h"
+#include "cache/lrucache_engine.h"
 #include "cache/mem_space_monitor.h"
 #include "cache/object_cache/lrucache_module.h"
 #include "cache/object_cache/page_cache.h"
@@ -42,14 +43,15 @@ Status DataCache::init(const std::vector<StorePath>& store_paths) {
     _global_env = GlobalEnv::GetInstance();
     _store_paths = store_paths;
 
-#if defined(WITH_STARCACHE)
+#if !defined(WITH_STARCACHE)
+    // only the memory only engine is available without starcache
+    if (config::datacache_engine != "lrucache") {
+        config::datacache_enable = false;
+    }
+#endif
     if (!config::datacache_enable) {
         config::block_cache_enable = false;
     }
-#else
-    config::datacache_enable = false;
-    config::block_cache_enable = false;
-#endif
 
     RETURN_IF_ERROR(_init_datacache());
     RETURN_IF_ERROR(_init_starcache_based_object_cache());
@@ -75,6 +77,8 @@ void DataCache::destroy() {
     }
 
     _page_cache.reset();
+    _compressed_page_object_cache.reset();
+    _compressed_page_lru_cache.reset();
     LOG(INFO) << "pagecache shutdown successfully";
 
     _lru_based_object_cache.reset();
@@ -105,7 +109,8 @@ size_t DataCache::get_mem_capacity() const {
 
 Status DataCache::_init_starcache_based_object_cache() {
 #ifdef WITH_STARCACHE
-    if (_local_cache != nullptr && _local_cache->is_initialized()) {
+    if (_local_cache != nullptr && _local_cache->is_initialized() &&
+        _local_cache->engine_type() == DataCacheEngineType::STARCACHE) {
         auto* starcache = reinterpret_cast<StarCacheWrapper*>(_local_cache.get());
         _starcache_based_object_cache = std::make_shared<StarCacheModule>(starcache->starcache_instance());
     }
@@ -117,7 +122,11 @@ Status DataCache::_init_lru_base_object_cache() {
     ASSIGN_OR_RETURN(int64_t storage_cache_limit, get_storage_page_cache_limit());
     storage_cache_limit = check_storage_page_cache_limit(storage_cache_limit);
 
-    _lru_cache = std::make_shared<ShardedLRUCache>(storage_cache_limit);
+    auto admission = config::storage_page_cache_enable_tinylfu_admission ? CacheAdmission::TINY_LFU
+                                                                          : CacheAdmission::ALWAYS;
+    auto eviction =
+            config::storage_page_cache_enable_clock_eviction ? CacheEviction::CLOCK : CacheEviction::LRU;
+    _lru_cache = std::make_shared<ShardedLRUCache>(storage_cache_limit, admission, eviction);
     _lru_based_object_cache = std::make_shared<LRUCacheModule>(_lru_cache);
     LOG(INFO) << "object cache init successfully";
     return Status::OK();
@@ -126,6 +135,14 @@ Status DataCache::_init_lru_base_object_cache() {
 Status DataCache::_init_page_cache() {
     _page_cache = std::make_shared<StoragePageCache>(_lru_based_object_cache.get());
     _page_cache->init_metrics();
+    if (config::storage_page_cache_compressed_tier_limit > 0) {
+        _compressed_page_lru_cache =
+                std::make_shared<ShardedLRUCache>(config::storage_page_cache_compressed_tier_limit);
+        _compressed_page_object_cache = std::make_shared<LRUCacheModule>(_compressed_page_lru_cache);
+        _page_cache->set_compressed_tier(_compressed_page_object_cache.get());
+        LOG(INFO) << "storage page cache compressed tier init successfully, capacity: "
+                  << config::storage_page_cache_compressed_tier_limit;
+    }
     LOG(INFO) << "storage page cache init successfully";
     return Status::OK();
 }
@@ -134,6 +151,21 @@ Status DataCache::_init_datacache() {
     _block_cache = std::make_shared<BlockCache>();
 
     if (config::datacache_enable) {
+        if (config::datacache_engine == "lrucache") {
+            // The memory only engine has no disk spaces to prepare and monitor, and no peer cache.
+            CacheOptions cache_options;
+            RETURN_IF_ERROR(DataCacheUtils::parse_conf_datacache_mem_size(
+                    config::datacache_mem_size, _global_env->process_mem_limit(), &cache_options.mem_space_size));
+            cache_options.block_size = config::datacache_block_size;
+            cache_options.engine = config::datacache_engine;
+            _local_cache = std::make_shared<LRUCacheEngine>();
+            RETURN_IF_ERROR(_local_cache->init(cache_options));
+            if (config::block_cache_enable) {
+                RETURN_IF_ERROR(_block_cache->init(cache_options, _local_cache, nullptr));
+            }
+            LOG(INFO) << "datacache init successfully with lrucache engine";
+            return Status::OK();
+        }
 #if defined(WITH_STARCACHE)
         ASSIGN_OR_RETURN(auto cache_options, _init_cache_options());
 
@@ -77,6 +77,9 @@ private:
     std::shared_ptr<ObjectCache> _starcache_based_object_cache;
     std::shared_ptr<ObjectCache> _lru_based_object_cache;
     std::shared_ptr<StoragePageCache> _page_cache;
+    // the compressed tier of the page cache, only created when storage_page_cache_compressed_tier_limit > 0
+    std::shared_ptr<Cache> _compressed_page_lru_cache;
+    std::shared_ptr<ObjectCache> _compressed_page_object_cache;
 
     std::shared_ptr<DiskSpaceMonitor> _disk_space_monitor;
     std::shared_ptr<MemSpaceMonitor> _mem_space_monitor;
@@ -20,7 +20,7 @@
 
 namespace starrocks {
 
-enum class DataCacheEngineType { STARCACHE };
+enum class DataCacheEngineType { STARCACHE, LRUCACHE };
 
 class LocalCache {
 public:
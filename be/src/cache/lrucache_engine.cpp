@@ -0,0 +1,127 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "cache/lrucache_engine.h"
+
+#include <fmt/format.h>
+
+#include "common/logging.h"
+#include "runtime/current_thread.h"
+
+namespace starrocks {
+
+Status LRUCacheEngine::init(const CacheOptions& options) {
+    _cache = std::make_unique<ShardedLRUCache>(options.mem_space_size);
+    _initialized.store(true, std::memory_order_relaxed);
+    LOG(INFO) << "init lrucache engine, mem_space_size: " << options.mem_space_size
+              << ", disk spaces are ignored by the memory only engine";
+    return Status::OK();
+}
+
+void LRUCacheEngine::_deleter(const CacheKey& key, void* value) {
+    delete reinterpret_cast<IOBuffer*>(value);
+}
+
+Status LRUCacheEngine::write(const std::string& key, const IOBuffer& buffer, WriteCacheOptions* options) {
+    if (options == nullptr || !options->overwrite) {
+        auto* handle = _cache->lookup(key);
+        if (handle != nullptr) {
+            _cache->release(handle);
+            return Status::AlreadyExist("the cache item already exists");
+        }
+    }
+
+    // The cached memory is released by whichever thread evicts the item or drops the last reader,
+    // so it is not charged to the current query, the same as the starcache engine.
+    SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(nullptr);
+    // The buffer may reference the memory of the caller (zero copy writes), copy it into memory
+    // owned by the cache item.
+    const size_t size = buffer.size();
+    char* data = new char[size];
+    buffer.copy_to(data, size);
+    auto* value = new IOBuffer();
+    value->append_user_data(data, size, [](void* p) { delete[] static_cast<char*>(p); });
+
+    CachePriority priority = (options != nullptr && options->priority > 0) ? CachePriority::DURABLE
+                                                                           : CachePriority::NORMAL;
+    _cache->release(_cache->insert(key, value, size, &LRUCacheEngine::_deleter, priority));
+    if (options != nullptr) {
+        options->stats.write_mem_bytes = size;
+    }
+    return Status::OK();
+}
+
+Status LRUCacheEngine::read(const std::string& key, size_t off, size_t size, IOBuffer* buffer,
+                            ReadCacheOptions* options) {
+    auto* handle = _cache->lookup(key);
+    if (handle == nullptr) {
+        return Status::NotFound("not found in lrucache");
+    }
+    auto* value = reinterpret_cast<IOBuffer*>(_cache->value(handle));
+    Status st;
+    if (off + size > value->size()) {
+        st = Status::InvalidArgument(
+                fmt::format("read range [{}, {}) exceeds the cache item size {}", off, off + size, value->size()));
+    } else {
+        // share the blocks of the cached item, they stay alive after the item is evicted
+        value->const_raw_buf().append_to(&buffer->raw_buf(), size, off);
+        if (options != nullptr) {
+            options->stats.read_mem_bytes = size;
+        }
+    }
+    _cache->release(handle);
+    return st;
+}
+
+bool LRUCacheEngine::exist(const std::string& key) const {
+    auto* handle = _cache->lookup(key);
+    if (handle == nullptr) {
+        return false;
+    }
+    _cache->release(handle);
+    return true;
+}
+
+Status LRUCacheEngine::remove(const std::string& key) {
+    _cache->erase(key);
+    return Status::OK();
+}
+
+Status LRUCacheEngine::update_mem_quota(size_t quota_bytes, bool flush_to_disk) {
+    _cache->set_capacity(quota_bytes);
+    return Status::OK();
+}
+
+Status LRUCacheEngine::update_disk_spaces(const std::vector<DirSpace>& spaces) {
+    return Status::NotSupported("lrucache engine does not support disk cache");
+}
+
+const DataCacheMetrics LRUCacheEngine::cache_metrics(int level) const {
+    DataCacheMetrics metrics;
+    metrics.status = DataCacheStatus::NORMAL;
+    metrics.mem_quota_bytes = _cache->get_capacity();
+    metrics.mem_used_bytes = _cache->get_memory_usage();
+    metrics.disk_quota_bytes = 0;
+    metrics.disk_used_bytes = 0;
+    return metrics;
+}
+
+Status LRUCacheEngine::shutdown() {
+    _initialized.store(false, std::memory_order_relaxed);
+    _cache->prune();
+    return Status::OK();
+}
+
+} // namespace starrocks
@@ -102,8 +102,31 @@ bool StoragePageCache::lookup(const std::string& key, PageCacheHandle* handle) {
     return true;
 }
 
+bool StoragePageCache::lookup_compressed(const std::string& key, PageCacheHandle* handle) {
+    DCHECK(_compressed_cache != nullptr);
+    ObjectCacheHandle* obj_handle = nullptr;
+    Status st = _compressed_cache->lookup(key, &obj_handle);
+    if (!st.ok()) {
+        return false;
+    }
+    *handle = PageCacheHandle(_compressed_cache, obj_handle);
+    return true;
+}
+
 Status StoragePageCache::insert(const std::string& key, std::vector<uint8_t>* data, const ObjectCacheWriteOptions& opts,
                                 PageCacheHandle* handle) {
+    return _insert(_cache, key, data, opts, handle);
+}
+
+Status StoragePageCache::insert_compressed(const std::string& key, std::vector<uint8_t>* data,
+                                           PageCacheHandle* handle) {
+    DCHECK(_compressed_cache != nullptr);
+    ObjectCacheWriteOptions opts;
+    return _insert(_compressed_cache, key, data, opts, handle);
+}
+
+Status StoragePageCache::_insert(ObjectCache* cache, const std::string& key, std::vector<uint8_t>* data,
+                                 const ObjectCacheWriteOptions& opts, PageCacheHandle* handle) {
 #ifndef BE_TEST
     int64_t mem_size = malloc_usable_size(data->data()) + sizeof(*data);
     tls_thread_status.mem_release(mem_size);
@@ -121,9 +144,9 @@ Status StoragePageCache::insert(const std::string& key, std::vector<uint8_t>* da
     ObjectCacheHandle* obj_handle = nullptr;
     // Use mem size managed by memory allocator as this record charge size.
     // At the same time, we should record this record size for data fetching when lookup.
-    Status st = _cache->insert(key, (void*)data, mem_size, deleter, &obj_handle, opts);
+    Status st = cache->insert(key, (void*)data, mem_size, deleter, &obj_handle, opts);
     if (st.ok()) {
-        *handle = PageCacheHandle(_cache, obj_handle);
+        *handle = PageCacheHandle(cache, obj_handle);
     }
     return st;
 }
@@ -87,6 +87,16 @@ public:
     Status insert(const std::string& key, void* data, int64_t size, ObjectCacheDeleter deleter,
                   const ObjectCacheWriteOptions& opts, PageCacheHandle* handle);
 
+    // The optional tier of compressed pages, it has its own byte budget and is only consulted
+    // after a miss of the decompressed pages.
+    void set_compressed_tier(ObjectCache* compressed_cache) { _compressed_cache = compressed_cache; }
+
+    bool has_compressed_tier() const { return _compressed_cache != nullptr; }
+
+    bool lookup_compressed(const std::string& key, PageCacheHandle* handle);
+
+    Status insert_compressed(const std::string& key, std::vector<uint8_t>* data, PageCacheHandle* handle);
+
     size_t memory_usage() const { return _cache->usage(); }
 
     void set_capacity(size_t capacity);
@@ -102,7 +112,11 @@ public:
     void prune();
 
 private:
+    static Status _insert(ObjectCache* cache, const std::string& key, std::vector<uint8_t>* data,
+                          const ObjectCacheWriteOptions& opts, PageCacheHandle* handle);
+
     ObjectCache* _cache = nullptr;
+    ObjectCache* _compressed_cache = nullptr;
 };
 
 // A handle for StoragePageCache entry. This class make it easy to handle
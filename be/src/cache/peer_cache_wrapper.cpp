@@ -14,6 +14,7 @@
 
 #include "cache/peer_cache_wrapper.h"
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "gen_cpp/internal_service.pb.h"
 #include "runtime/exec_env.h"
@@ -44,7 +45,7 @@ Status PeerCacheWrapper::read(const std::string& key, size_t off, size_t size, I
     request.set_size(size);
 
     brpc::Controller cntl;
-    cntl.set_timeout_ms(1000);
+    cntl.set_timeout_ms(config::datacache_peer_cache_read_timeout_ms);
 
     auto begin_us = GetCurrentTimeMicros();
     Status st;
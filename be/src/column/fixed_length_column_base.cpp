@@ -241,12 +241,26 @@ void FixedLengthColumnBase<T>::fnv_hash_selective(uint32_t* hash, uint16_t* sel,
 }
 
 // Must same with RawValue::zlib_crc32
+// Date and datetime are hashed over their string form to stay compatible with the bucket
+// function. Format datetime into a stack buffer, its string does not fit into SSO.
+template <typename T>
+static inline uint32_t crc32_hash_date_or_datetime(const T& value, uint32_t seed) {
+    if constexpr (IsTimestamp<T>) {
+        char buf[32];
+        int len = value.to_string(buf, sizeof(buf));
+        DCHECK_GT(len, 0);
+        return HashUtil::zlib_crc_hash(buf, len, seed);
+    } else {
+        std::string str = value.to_string();
+        return HashUtil::zlib_crc_hash(str.data(), static_cast<int32_t>(str.size()), seed);
+    }
+}
+
 template <typename T>
 void FixedLengthColumnBase<T>::crc32_hash(uint32_t* hash, uint32_t from, uint32_t to) const {
     for (uint32_t i = from; i < to; ++i) {
         if constexpr (IsDate<T> || IsTimestamp<T>) {
-            std::string str = _data[i].to_string();
-            hash[i] = HashUtil::zlib_crc_hash(str.data(), static_cast<int32_t>(str.size()), hash[i]);
+            hash[i] = crc32_hash_date_or_datetime(_data[i], hash[i]);
         } else if constexpr (IsDecimal<T>) {
             int64_t int_val = _data[i].int_value();
             int32_t frac_val = _data[i].frac_value();
@@ -265,8 +279,7 @@ void FixedLengthColumnBase<T>::crc32_hash_with_selection(uint32_t* hash, uint8_t
             continue;
         }
         if constexpr (IsDate<T> || IsTimestamp<T>) {
-            std::string str = _data[i].to_string();
-            hash[i] = HashUtil::zlib_crc_hash(str.data(), static_cast<int32_t>(str.size()), hash[i]);
+            hash[i] = crc32_hash_date_or_datetime(_data[i], hash[i]);
         } else if constexpr (IsDecimal<T>) {
             int64_t int_val = _data[i].int_value();
             int32_t frac_val = _data[i].frac_value();
@@ -282,8 +295,7 @@ template <typename T>
 void FixedLengthColumnBase<T>::crc32_hash_selective(uint32_t* hash, uint16_t* sel, uint16_t sel_size) const {
     for (uint16_t i = 0; i < sel_size; i++) {
         if constexpr (IsDate<T> || IsTimestamp<T>) {
-            std::string str = _data[sel[i]].to_string();
-            hash[sel[i]] = HashUtil::zlib_crc_hash(str.data(), static_cast<int32_t>(str.size()), hash[sel[i]]);
+            hash[sel[i]] = crc32_hash_date_or_datetime(_data[sel[i]], hash[sel[i]]);
         } else if constexpr (IsDecimal<T>) {
             int64_t int_val = _data[sel[i]].int_value();
             int32_t frac_val = _data[sel[i]].frac_value();
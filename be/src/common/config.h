@@ -116,6 +116,9 @@ CONF_mInt32(transaction_apply_worker_count, "0");
 CONF_mInt32(get_pindex_worker_count, "0");
 CONF_mInt32(transaction_apply_thread_pool_num_min, "0");
 CONF_Int32(transaction_apply_worker_idle_time_ms, "500");
+// Build the new delvecs of a primary key apply on the get_pindex worker pool when the apply touches
+// at least this many segments, 0 means always build them in the apply thread.
+CONF_mInt32(pk_apply_parallel_delvec_min_segments, "16");
 
 // The count of thread to clear transaction task.
 CONF_Int32(clear_transaction_task_worker_count, "1");
@@ -127,6 +130,9 @@ CONF_Int32(delete_worker_count_high_priority, "1");
 CONF_mInt32(alter_tablet_worker_count, "3");
 // The count of parallel clone task per storage path
 CONF_mInt32(parallel_clone_task_per_path, "8");
+// The count of files of one clone task downloaded in parallel by the shared clone download thread pool.
+// The downloads of a clone task share max_download_speed_kbps evenly.
+CONF_mInt32(clone_download_parallelism, "1");
 // The count of thread to clone. Deprecated
 CONF_Int32(clone_worker_count, "3");
 // The count of thread to clone.
@@ -260,6 +266,11 @@ CONF_mInt32(max_pushdown_conditions_per_column, "1024");
 CONF_mInt32(exchg_node_buffer_size_bytes, "10485760");
 // The block_size every block allocate for sorter.
 CONF_Int32(sorter_block_size, "8388608");
+// Whether to sort multiple fixed-length sort keys by encoding them into memcmp-able normalized keys,
+// instead of sorting column by column.
+CONF_mBool(enable_sort_normalized_key, "false");
+// The max width in bytes of the normalized key of a row, fall back to column-wise sort if exceeds.
+CONF_mInt32(sort_normalized_key_max_width, "64");
 
 CONF_mInt64(column_dictionary_key_ratio_threshold, "0");
 CONF_mInt64(column_dictionary_key_size_threshold, "0");
@@ -303,12 +314,24 @@ CONF_Int32(data_page_size, "65536");
 CONF_mString(storage_page_cache_limit, "20%");
 // whether to disable page cache feature in storage
 CONF_mBool(disable_storage_page_cache, "false");
+// Whether a full storage page cache admits a new page only if it is accessed more frequently than the
+// page it would evict, which keeps large scans from flushing the hot pages out of the cache.
+CONF_Bool(storage_page_cache_enable_tinylfu_admission, "false");
+// Whether the storage page cache evicts in CLOCK order instead of LRU. A hit only marks the page as visited,
+// so concurrent lookups share the shard lock, at the cost of a less precise eviction order.
+CONF_Bool(storage_page_cache_enable_clock_eviction, "false");
+// The byte budget of a second storage page cache tier holding pages compressed as they are on disk.
+// A page evicted from the decompressed page cache is then decompressed from memory instead of read
+// from the file again. 0 means disabled.
+CONF_Int64(storage_page_cache_compressed_tier_limit, "0");
 // whether to enable the bitmap index memory cache
 CONF_mBool(enable_bitmap_index_memory_page_cache, "true");
 // whether to enable the zonemap index memory cache
 CONF_mBool(enable_zonemap_index_memory_page_cache, "true");
 // whether to enable the ordinal index memory cache
 CONF_mBool(enable_ordinal_index_memory_page_cache, "true");
+// whether to cache the result bitmaps of inverted index queries in the storage page cache
+CONF_mBool(enable_inverted_index_query_cache, "true");
 
 CONF_mInt32(base_compaction_check_interval_seconds, "60");
 CONF_mInt64(min_base_compaction_num_singleton_deltas, "5");
@@ -380,6 +403,9 @@ CONF_mBool(enable_rowset_verify, "false");
 // If the number of schema columns is greater than this,
 // the columns will be divided into groups for vertical compaction.
 CONF_Int64(vertical_compaction_max_columns_per_group, "5");
+// Read and merge the value column groups of vertical compaction on a separate thread, overlapping with
+// the encoding and writing of the previous chunk.
+CONF_mBool(enable_vertical_compaction_read_ahead, "true");
 
 CONF_Bool(enable_event_based_compaction_framework, "true");
 
@@ -390,6 +416,14 @@ CONF_mInt64(size_tiered_level_multiple, "5");
 CONF_mInt64(size_tiered_level_multiple_dupkey, "10");
 CONF_mInt64(size_tiered_level_num, "7");
 
+// Boost the compaction score of tablets whose recent queries read many segments, so the compaction
+// budget goes where queries actually pay the read amplification. A tablet not queried within
+// compaction_read_amp_hot_seconds keeps its original score. The boost is at most
+// compaction_read_amp_max_bonus times the score, reached when queries read 10+ segments on average.
+CONF_mBool(enable_compaction_read_amp_bonus, "true");
+CONF_mInt64(compaction_read_amp_hot_seconds, "600");
+CONF_mDouble(compaction_read_amp_max_bonus, "1.0");
+
 // random compaction strategy is only used for chaos test,
 // should never be true in prodution.
 CONF_mBool(chaos_test_enable_random_compaction_strategy, "false");
@@ -441,6 +475,11 @@ CONF_Int32(be_exit_after_disk_write_hang_second, "60");
 // set to 1 means always use dictionary encoding
 CONF_Double(dictionary_encoding_ratio, "0.7");
 
+// When a char/varchar column is not dictionary encoded, use prefix encoding instead of plain encoding
+// if the bytes shared with the previous value make up at least this fraction of the detected data,
+// e.g. URLs or file paths. Set to 0 to always fall back to plain encoding.
+CONF_mDouble(string_prefix_encoding_min_shared_ratio, "0");
+
 // Some data types use dictionary encoding, and this configuration is used to control
 // the size of dictionary pages. If you want a higher compression ratio, please increase
 // this configuration item, but be aware that excessively large values may lead to
@@ -449,6 +488,11 @@ CONF_Int32(dictionary_page_size, "1048576");
 
 CONF_Int32(small_dictionary_page_size, "4096");
 
+// A dictionary encoded column switches the following pages to its fallback encoding once a finished
+// data page added more than this fraction of its values to the dictionary, i.e. the data drifted to
+// high cardinality before the dictionary page is full. Set to 1 to fall back only on a full dictionary.
+CONF_mDouble(dictionary_page_fallback_new_value_ratio, "1");
+
 // Just like dictionary_encoding_ratio, dictionary_encoding_ratio_for_non_string_column is used for
 // no-string column.
 CONF_Double(dictionary_encoding_ratio_for_non_string_column, "0");
@@ -575,6 +619,9 @@ CONF_String(scratch_dirs, "/tmp");
 
 // Linux transparent huge page.
 CONF_Bool(madvise_huge_pages, "false");
+// Allocations of column buffers and memory chunks not smaller than this are advised to be backed by
+// transparent huge pages when madvise_huge_pages is true.
+CONF_mInt64(huge_page_min_alloc_bytes, "4194304");
 
 // Whether use mmap to allocate memory.
 CONF_Bool(mmap_buffers, "false");
@@ -587,6 +634,9 @@ CONF_Int32(memory_max_alignment, "16");
 
 // write buffer size before flush
 CONF_mInt64(write_buffer_size, "104857600");
+// Whether a memtable of duplicate, aggregate or unique keys table sorts the inserted rows into sorted runs
+// as they arrive and merges the runs at flush, instead of sorting all the buffered rows at flush.
+CONF_mBool(enable_memtable_incremental_sort, "false");
 
 // Following 2 configs limit the memory consumption of load process on a Backend.
 // eg: memory limit to 80% of mem limit config but up to 100GB(default)
@@ -667,6 +717,10 @@ CONF_mInt32(max_pulsar_consumer_num_per_group, "10");
 // kafka request timeout
 CONF_Int32(routine_load_kafka_timeout_second, "10");
 
+// Whether kafka consumer threads build the pipe buffers of json and avro messages themselves, so that
+// the payload copies run in parallel across partitions instead of in the thread feeding the pipe.
+CONF_mBool(routine_load_kafka_build_buffer_in_consumer, "true");
+
 // pulsar request timeout
 CONF_Int32(routine_load_pulsar_timeout_second, "10");
 
@@ -721,6 +775,10 @@ CONF_mDouble(storage_high_usage_disk_protect_ratio, "0.1"); // 10%
 // Number of thread for flushing memtable per store.
 CONF_mInt32(flush_thread_num_per_store, "2");
 
+// Whether the flush tasks of the tablets whose loads have sent eos run before the flush tasks of the
+// tablets still being loaded, so that small loads do not wait behind bulk loads to commit.
+CONF_mBool(enable_memtable_flush_eos_priority, "true");
+
 // Number of thread for flushing memtable per store in shared-data mode.
 // Default value is cpu cores * 2
 CONF_mInt32(lake_flush_thread_num_per_store, "0");
@@ -765,12 +823,22 @@ CONF_Int32(txn_shard_size, "1024");
 // Whether to continue to start be when load tablet from header failed.
 CONF_Bool(ignore_load_tablet_failure, "false");
 
+// The number of threads of each data dir to create tablets from the tablet metas in rocksdb when BE starts.
+// The metas are still scanned by one thread, only the tablet creation is parallel.
+// 1 means loading tablets in the scanning thread.
+CONF_Int32(load_tablet_meta_threads_per_data_dir, "4");
+
 // Whether to continue to start be when load tablet from header failed.
 CONF_Bool(ignore_rowset_stale_unconsistent_delete, "false");
 
 // The chunk size for vector query engine
 CONF_Int32(vector_chunk_size, "4096");
 
+// The cache budget of a chunk. When it's positive, the olap scan reads fewer rows than the chunk size per chunk
+// for wide rows, so that a chunk of the estimated row bytes fits the budget, and ChunkAccumulateOperator stops
+// coalescing chunks at the budget. Set to 0 to always use the chunk size of the query.
+CONF_mInt64(adaptive_chunk_cache_budget_bytes, "0");
+
 // Valid range: [0-1000].
 // `0` will disable late materialization.
 // `1000` will enable late materialization always.
@@ -789,6 +857,16 @@ CONF_Int64(max_transmit_batched_bytes, "262144");
 // a too small max_tablet_write_chunk_bytes may cause more frequent RPCs, which may affect performance.
 // In this case, we can try to increase the value to avoid the problem.
 CONF_mInt64(max_tablet_write_chunk_bytes, "536870912");
+// Whether the load sink sorts the rows of each tablet write request by the sort key of the target index
+// before sending, so that the memtables on the receivers can skip sorting. Not applied to primary keys tables.
+CONF_mBool(enable_load_sink_presort, "false");
+// A tablet write request of fewer bytes than min_tablet_write_chunk_bytes keeps coalescing rows beyond the chunk size,
+// up to max_tablet_write_chunk_coalesce_factor chunks, so loads spreading small batches over many tablets send fewer
+// and larger requests. 0 disables the coalescing.
+CONF_mInt64(min_tablet_write_chunk_bytes, "0");
+CONF_mInt32(max_tablet_write_chunk_coalesce_factor, "16");
+// The number of in-flight tablet write requests of each node channel when the load_dop session variable is not set.
+CONF_mInt32(tablet_sink_parallel_requests_per_node, "1");
 
 CONF_Int16(bitmap_max_filter_items, "30");
 
@@ -879,11 +957,41 @@ CONF_mBool(pipeline_print_profile, "false");
 // when the value of level_time_slice_base_ns is smaller and queue_ratio_of_adjacent_queue is larger.
 CONF_Int64(pipeline_driver_queue_level_time_slice_base_ns, "200000000");
 CONF_Double(pipeline_driver_queue_ratio_of_adjacent_queue, "1.2");
+// How long the pipeline poller waits, when none of its blocked drivers becomes ready after 640 rounds of polling.
+// Non-positive value means only yielding the thread, which is the default.
+CONF_mInt64(pipeline_poller_idle_wait_us, "0");
+// Whether each pipeline executor thread keeps a small local queue of the drivers it yields, and steals drivers
+// from the local queues of the other threads when idle, to reduce the contention on the global driver queue.
+CONF_Bool(pipeline_enable_driver_work_stealing, "false");
+// Whether a merging exchange always merges the sorted streams of the senders in parallel by merge path,
+// even if the planner doesn't enable parallel merge for it.
+CONF_mBool(pipeline_exchange_force_parallel_merge, "false");
+
+// Max bytes of freed column buffers cached by all the pipeline drivers of the process together, for reuse
+// by their following chunks. The cached buffers stay charged to the queries until the drivers finish.
+// Set to 0 to disable.
+CONF_mInt64(pipeline_column_buffer_cache_bytes, "0");
+// Sample the hardware counters (cycles, instructions, cache misses and branch misses) of pull_chunk and push_chunk
+// of the operators in one of every N executions of a pipeline driver, and add them to the operator profiles.
+// It requires perf events permitted by kernel.perf_event_paranoid. Set to 0 to disable.
+CONF_mInt32(pipeline_perf_event_sample_interval, "0");
+// Bytes of the chunks buffered per driver by the adaptive DOP (CollectStats) before deciding the DOP of the
+// following pipeline. Besides the rows, the decided DOP is not lower than the buffered bytes divided by it,
+// so that few but wide rows don't shrink a heavy pipeline to DOP 1. Set to 0 to only consider the rows.
+CONF_mInt64(pipeline_adaptive_dop_max_block_bytes_per_driver_seq, "67108864");
+// Max number of buckets executed at the same time by a colocate execution group. The hash tables and other
+// per-bucket states are released once a bucket finishes, so the peak memory of a large colocate join scales with
+// this number instead of the number of buckets. 0 means the DOP of the group.
+CONF_mInt32(pipeline_colocate_group_max_active_buckets, "0");
 
 CONF_Int32(pipeline_analytic_max_buffer_size, "128");
 CONF_Int32(pipeline_analytic_removable_chunk_num, "128");
 CONF_Bool(pipeline_analytic_enable_streaming_process, "true");
 CONF_mBool(pipeline_analytic_enable_removable_cumulative_process, "true");
+// Sliding ROWS frames of max/min with at least this many rows are evaluated with a segment tree built
+// once per partition, instead of recomputing the frame whenever the evicted row was the max/min.
+// The partition is materialized in that case. Set to 0 to disable.
+CONF_mInt64(pipeline_analytic_segment_tree_min_frame_size, "4096");
 CONF_Int32(pipline_limit_max_delivery, "4096");
 
 CONF_mBool(use_default_dop_when_shared_scan, "true");
@@ -899,6 +1007,10 @@ CONF_mInt64(tablet_internal_parallel_max_splitted_scan_bytes, "536870912");
 // Only when scan_dop is not less than min_scan_dop, this table can use tablet internal parallel,
 // where scan_dop = estimated_scan_rows / splitted_scan_rows.
 CONF_mInt64(tablet_internal_parallel_min_scan_dop, "4");
+// Whether the rowid ranges of the physical split morsels shrink as the rest rows of the segment shrink
+// (rest_rows / scan_dop, but not less than min_splitted_scan_rows), so that the tail of a large segment is
+// spread over the idle drivers instead of being scanned by a few drivers.
+CONF_mBool(tablet_internal_parallel_enable_guided_split, "true");
 
 // Only the num rows of lake tablet less than lake_tablet_rows_splitted_ratio * splitted_scan_rows, than the lake tablet can be splitted.
 CONF_mDouble(lake_tablet_rows_splitted_ratio, "1.5");
@@ -990,10 +1102,28 @@ CONF_mBool(parquet_cache_aware_dict_decoder_enable, "true");
 CONF_mBool(parquet_reader_enable_adpative_bloom_filter, "true");
 CONF_Double(parquet_page_cache_decompress_threshold, "1.5");
 CONF_mBool(enable_adjustment_page_cache_skip, "true");
+// Cache the parsed iceberg position delete files in the page cache, grouped by data file, so that the scan ranges
+// sharing the same delete files don't read and parse them again. Only used when the file meta cache is enabled.
+CONF_mBool(iceberg_delete_file_cache_enable, "true");
+
+// parquet writer
+// Encode the columns of a chunk in parallel on the parquet_encode thread pool when writing parquet files.
+CONF_mBool(parquet_writer_parallel_encode_enable, "false");
+// Only chunks with at least this many columns are encoded in parallel.
+CONF_mInt32(parquet_writer_parallel_encode_min_columns, "4");
+// The max thread num of the parquet_encode thread pool, 0 means the number of cpu cores.
+CONF_Int32(parquet_writer_encode_thread_num, "0");
 
 CONF_Int32(io_coalesce_read_max_buffer_size, "8388608");
 CONF_Int32(io_coalesce_read_max_distance_size, "1048576");
 CONF_mBool(io_coalesce_adaptive_lazy_active, "true");
+// The number of coalesced io buffers of external table files and lake segment columns read ahead
+// asynchronously once a buffer is read, 0 means disabled.
+CONF_mInt32(io_coalesce_prefetch_depth, "0");
+// The max bytes of the coalesced io buffers being read ahead of one file.
+CONF_mInt64(io_coalesce_prefetch_max_bytes, "67108864");
+// The thread number of the pool reading ahead the coalesced io buffers.
+CONF_Int32(io_coalesce_prefetch_thread_num, "64");
 CONF_Int32(io_tasks_per_scan_operator, "4");
 CONF_Int32(connector_io_tasks_per_scan_operator, "16");
 CONF_Int32(connector_io_tasks_min_size, "2");
@@ -1001,6 +1131,9 @@ CONF_Int32(connector_io_tasks_adjust_interval_ms, "50");
 CONF_Int32(connector_io_tasks_adjust_step, "1");
 CONF_Int32(connector_io_tasks_adjust_smooth, "4");
 CONF_Int32(connector_io_tasks_slow_io_latency_ms, "50");
+// IO requests slower than this are sampled with their tag, tablet and query id, and listed by
+// /pprof/ioprofile?mode=latency together with the per tag latency histograms. 0 disables the sampling.
+CONF_mInt32(io_profiler_slow_io_threshold_ms, "1000");
 CONF_mDouble(scan_use_query_mem_ratio, "0.25");
 CONF_Double(connector_scan_use_query_mem_ratio, "0.3");
 
@@ -1012,6 +1145,16 @@ CONF_Int32(hdfs_client_hedged_read_threadpool_size, "128");
 CONF_Int32(hdfs_client_hedged_read_threshold_millis, "2500");
 CONF_Int32(hdfs_client_max_cache_size, "64");
 CONF_Int32(hdfs_client_io_read_retry, "0");
+// hdfs short-circuit local read, dfs.client.read.shortcircuit and dfs.domain.socket.path.
+// It only works when the datanode runs on the same host and uses the same domain socket path.
+CONF_Bool(hdfs_client_enable_short_circuit_read, "false");
+CONF_String(hdfs_client_domain_socket_path, "");
+// The max number of idle read-only hdfs file handles kept for reuse by later readers of the same file.
+// 0 disables the cache. A cached handle may keep reading the old blocks if a file is overwritten in place,
+// so only enable it when files are never rewritten under the same path.
+CONF_mInt32(hdfs_client_file_handle_cache_size, "0");
+// Idle hdfs file handles older than this are closed.
+CONF_mInt32(hdfs_client_file_handle_cache_ttl_sec, "60");
 
 // Enable output trace logs in aws-sdk-cpp for diagnosis purpose.
 // Once logging is enabled in your application, the SDK will generate log files in your current working directory
@@ -1031,10 +1174,25 @@ CONF_Bool(aws_sdk_enable_compliant_rfc3986_encoding, "false");
 // use poco client to replace default curl client
 CONF_Bool(enable_poco_client_for_aws_sdk, "true");
 
+// Send a duplicate ranged GET when an S3 read has not finished after the observed tail latency of its bucket.
+// The first response wins, the other one is dropped. Only takes effect with the curl based AWS client
+// (enable_poco_client_for_aws_sdk=false), because the poco client can't abandon the slower request.
+CONF_mBool(s3_hedged_read_enable, "false");
+// The percentile of the per-bucket read latency after which a read is hedged.
+CONF_mInt32(s3_hedged_read_latency_percentile, "95");
+// Lower bound of the hedging delay, also used until enough latency samples are collected.
+CONF_mInt32(s3_hedged_read_min_delay_ms, "50");
+// At most this percent of the S3 reads can be hedged, so a slow store is not flooded with duplicate requests.
+CONF_mInt32(s3_hedged_read_budget_percent, "5");
+// The reads are counted per window of this length for the hedge budget, so it follows the recent read rate.
+CONF_mInt32(s3_hedged_read_budget_window_ms, "10000");
+
 // default: 16MB
 CONF_mInt64(experimental_s3_max_single_part_size, "16777216");
 // default: 16MB
 CONF_mInt64(experimental_s3_min_upload_part_size, "16777216");
+// The number of parts of a multipart upload that are uploaded concurrently by one S3 output stream.
+CONF_mInt32(experimental_s3_max_inflight_upload_parts, "4");
 
 CONF_Int64(max_load_dop, "16");
 
@@ -1134,6 +1292,8 @@ CONF_mInt64(experimental_lake_wait_per_delete_ms, "0");
 CONF_mBool(experimental_lake_ignore_pk_consistency_check, "false");
 CONF_mInt64(lake_publish_version_slow_log_ms, "1000");
 CONF_mBool(lake_enable_publish_version_trace_log, "false");
+// Load the txn logs of a batch publish concurrently on the load_segment thread pool instead of one after another.
+CONF_mBool(lake_enable_batch_publish_prefetch_txn_log, "true");
 CONF_mString(lake_vacuum_retry_pattern, "*request rate*");
 CONF_mInt64(lake_vacuum_retry_max_attempts, "5");
 CONF_mInt64(lake_vacuum_retry_min_delay_ms, "100");
@@ -1149,6 +1309,9 @@ CONF_mInt32(lake_pk_index_sst_max_compaction_versions, "100");
 // When the ratio of cumulative level to base level is greater than this config, use base merge.
 CONF_mDouble(lake_pk_index_cumulative_base_compaction_ratio, "0.1");
 CONF_Int32(lake_pk_index_block_cache_limit_percent, "10");
+// Bytes read from the tail of a pk index sstable in one IO when opening it, so that the footer, index,
+// metaindex and filter blocks do not each cost a round trip to remote storage. 0 disables it.
+CONF_mInt64(lake_pk_index_sst_open_prefetch_bytes, "262144");
 CONF_mBool(lake_clear_corrupted_cache, "true");
 // The maximum number of files which need to rebuilt in cloud native pk index.
 // If files which need to rebuilt larger than this, we will flush memtable immediately.
@@ -1198,6 +1361,9 @@ CONF_mInt32(spill_init_partition, "16");
 // make sure 2^spill_max_partition_level < spill_max_partition_size
 CONF_Int32(spill_max_partition_level, "7");
 CONF_Int32(spill_max_partition_size, "1024");
+// stop splitting a spilled partition after this many consecutive splits left almost all rows in one child,
+// the partition is skewed and splitting it again only rewrites the same data.
+CONF_mInt32(spill_max_ineffective_split_times, "2");
 
 // The maximum size of a single log block container file, this is not a hard limit.
 // If the file size exceeds this limit, a new file will be created to store the block.
@@ -1206,8 +1372,24 @@ CONF_Int64(spill_max_log_block_container_bytes, "10737418240"); // 10GB
 // be the same with storage path. Spill will return with error when used size has exceeded
 // the limit.
 CONF_mDouble(spill_max_dir_bytes_ratio, "0.8"); // 80%
+// The interval to check the available space of the disk of spill directories. A directory whose disk doesn't
+// have enough available space is skipped, and the spilled data goes to remote storage if it is enabled.
+// 0 disables the check.
+CONF_mInt64(spill_dir_space_check_interval_ms, "1000");
 // min bytes size of spill read buffer. if the buffer size is less than this value, we will disable buffer read
 CONF_Int64(spill_read_buffer_min_bytes, "1048576");
+// The max number of chunks read ahead for each spilled stream. The read ahead chunks of all the streams of
+// an operator are also bounded by the session variable max_spill_read_buffer_bytes_per_driver.
+CONF_mInt32(spill_read_ahead_chunks, "2");
+// Whether to compress the spilled chunks, the codec (none, LZ4 or ZSTD) is chosen adaptively by the compression
+// ratio of the sampled chunks.
+CONF_mBool(spill_enable_adaptive_compression, "false");
+// When the memory of the query pool exceeds this ratio of its limit, the query holding the most revocable memory
+// among the queries enabling spill is asked to spill, before the queries are cancelled for exceeding the limit.
+// A value not in (0, 1) disables it.
+CONF_mDouble(spill_arbitrate_query_pool_mem_ratio, "0");
+// The min interval between two memory arbitrations.
+CONF_mInt64(spill_arbitrate_interval_ms, "100");
 CONF_mInt64(mem_limited_chunk_queue_block_size, "8388608");
 
 CONF_Int32(internal_service_query_rpc_thread_num, "-1");
@@ -1218,6 +1400,10 @@ CONF_Int32(internal_service_datacache_rpc_thread_num, "-1");
 // the load job will be hang until timeout.
 CONF_mInt32(report_exec_rpc_request_retry_num, "10");
 
+// Whether to skip a periodic (not final) exec state report of a fragment instance when none of its
+// drivers has moved any chunk since the previous report, as its runtime profile has barely changed.
+CONF_mBool(skip_unchanged_runtime_profile_report, "true");
+
 /*
  * When compile with ENABLE_STATUS_FAILED, every use of RETURN_INJECT has probability of 1/cardinality_of_inject
  * to inject error through return random status(except ok).
@@ -1258,6 +1444,15 @@ CONF_Int64(datacache_max_flying_memory_mb, "2");
 CONF_Double(datacache_skip_read_factor, "1.0");
 // Whether to use block buffer to hold the datacache block data.
 CONF_Bool(datacache_block_buffer_enable, "true");
+// Whether a block read from the cache of the peer node that owns the scan range is also written
+// into the local cache. Disabling it keeps a single cached copy of each block in the cluster,
+// at the cost of a brpc round trip for every repeated read on this node.
+CONF_mBool(datacache_populate_peer_cache_blocks, "true");
+// Timeout of reading a block from the cache of a peer node.
+CONF_mInt32(datacache_peer_cache_read_timeout_ms, "1000");
+// If true, a block missed in the datacache is only populated when it is missed again recently,
+// so that one-time scans do not evict the hot data. The recent misses are tracked in a small lossy table.
+CONF_mBool(datacache_populate_on_second_access, "false");
 // To control how many threads will be created for datacache synchronous tasks.
 // For the default value, it means for every 8 cpu, one thread will be created.
 CONF_Double(datacache_scheduler_threads_per_cpu, "0.125");
@@ -1270,7 +1465,8 @@ CONF_Double(datacache_scheduler_threads_per_cpu, "0.125");
 CONF_Bool(datacache_tiered_cache_enable, "false");
 // Whether to persist cached data
 CONF_Bool(datacache_persistence_enable, "true");
-// DataCache engines, alternatives: starcache.
+// DataCache engines, alternatives: starcache, lrucache.
+// `lrucache` is a memory only engine, which ignores the disk spaces. It is available without starcache.
 // `cachelib` is not support now.
 // Set the default value empty to indicate whether it is manully configured by users.
 // If not, we need to adjust the default engine based on build switches like "WITH_STARCACHE".
@@ -1350,6 +1546,10 @@ CONF_mInt32(pindex_major_compaction_num_threads, "0");
 CONF_mInt32(pindex_major_compaction_limit_per_disk, "1");
 // control the persistent index schedule compaction interval
 CONF_mInt64(pindex_major_compaction_schedule_interval_seconds, "15");
+// Stop submitting new persistent index major compaction while the max disk io util reaches this percent,
+// so that index compaction backs off when rowset compaction and publish are competing for the disks.
+// 0 means no limit.
+CONF_mInt32(pindex_major_compaction_max_disk_io_util_percent, "90");
 // control the local persistent index in shared_data gc/evict interval
 CONF_mInt64(pindex_shared_data_gc_evict_interval_seconds, "18000"); // 5 hour
 // enable use bloom filter for pindex or not
@@ -1369,6 +1569,10 @@ CONF_mBool(enable_pindex_rebuild_in_compaction, "true");
 // enable read pindex by page
 CONF_mBool(enable_pindex_read_by_page, "true");
 
+// Map the local immutable pindex files (L1/L2) read-only and serve page reads from the mapping instead
+// of pread, so hot pages stay resident in the os page cache. Takes effect for indexes loaded afterwards.
+CONF_mBool(enable_pindex_mmap_read, "false");
+
 // check need to rebuild pindex or not
 CONF_mBool(enable_rebuild_pindex_check, "true");
 
@@ -1381,6 +1585,9 @@ CONF_mInt32(pindex_rebuild_load_wait_seconds, "20");
 
 // Used by query cache, cache entries are evicted when it exceeds its capacity(500MB in default)
 CONF_Int64(query_cache_capacity, "536870912");
+// Capacity of the second tier of query cache, which keeps LZ4 compressed copies of the cache entries and
+// serves the probes of entries evicted from the first tier. 0 disables it.
+CONF_Int64(query_cache_compressed_capacity, "0");
 
 // When query cache enabled, the operators in the drivers contains cache operator are multilane
 // operators, if the number of lanes is big, Fragment Instance would spend too much time to prepare
@@ -1427,6 +1634,9 @@ CONF_Int64(local_exchange_buffer_mem_limit_per_driver, "134217728"); // 128MB
 CONF_mInt64(streaming_agg_limited_memory_size, "134217728");
 // mem limit for partition hash join probe side buffer
 CONF_mInt64(partition_hash_join_probe_limit_size, "134217728");
+// max partition number of partition hash join. when the build side is too large to fit in cache,
+// the partitions will be split (up to this limit) instead of falling back to a single hash table.
+CONF_mInt32(partition_hash_join_max_partitions, "256");
 // pipeline streaming aggregate chunk buffer size
 CONF_mInt32(streaming_agg_chunk_buffer_size, "1024");
 CONF_mInt64(wait_apply_time, "6000"); // 6s
@@ -1454,6 +1664,11 @@ CONF_Int32(default_mv_resource_group_concurrency_limit, "0");
 CONF_Double(default_mv_resource_group_spill_mem_limit_threshold, "0.8");
 
 CONF_Bool(enable_resource_group_bind_cpus, "true");
+// Whether to bind each pipeline driver and scan thread to the cpus of only one NUMA node, instead of all the cpus
+// of its executors. It keeps the threads from migrating across sockets, and the memory first touched by them,
+// such as hash tables and chunks, is allocated on their local node.
+// Only take effect when enable_resource_group_bind_cpus is true.
+CONF_Bool(enable_pipeline_numa_aware_bind_cpus, "false");
 CONF_mBool(enable_resource_group_cpu_borrowing, "true");
 
 // Max size of key columns size of primary key table, default value is 128 bytes
@@ -1487,6 +1702,9 @@ CONF_mBool(enable_drop_tablet_if_unfinished_txn, "true");
 CONF_Int32(lake_service_max_concurrency, "0");
 
 CONF_mInt64(lake_vacuum_min_batch_delete_size, "100");
+// The max number of files per second deleted by all vacuum and delete tablet tasks of a BE, used to keep
+// vacuum under the request quota of the object storage. 0 means no limit.
+CONF_mInt64(lake_vacuum_max_deleted_files_per_second, "0");
 
 // TOPN RuntimeFilter parameters
 CONF_mInt32(desc_hint_split_range, "10");
@@ -1496,6 +1714,9 @@ CONF_mInt32(desc_hint_split_range, "10");
 CONF_mInt64(lake_local_pk_index_unused_threshold_seconds, "86400"); // 1 day
 
 CONF_mBool(lake_enable_vertical_compaction_fill_data_cache, "true");
+// Whether the input segments read by horizontal compaction fill the data cache. The inputs are
+// replaced by the compaction output, so disabling it keeps the cache for queries.
+CONF_mBool(lake_enable_horizontal_compaction_fill_data_cache, "true");
 
 CONF_mInt32(dictionary_cache_refresh_timeout_ms, "60000"); // 1 min
 CONF_mInt32(dictionary_cache_refresh_threadpool_size, "8");
@@ -1529,6 +1750,10 @@ CONF_mDouble(json_flat_sparsity_factor, "0.9");
 // the maximum number of extracted JSON sub-field
 CONF_mInt32(json_flat_column_max, "100");
 
+// The window of the json path access stats collected from queries. When a json column has more candidate paths
+// than json_flat_column_max, the paths queried in the last two windows are flattened first. 0 disables the stats.
+CONF_mInt32(json_flat_access_stats_window_sec, "86400");
+
 // for whitelist on flat json remain data, max set 1kb
 CONF_mInt32(json_flat_remain_filter_max_bytes, "1024");
 
@@ -1569,6 +1794,10 @@ CONF_mBool(apply_del_vec_after_all_index_filter, "true");
 CONF_mDouble(connector_sink_mem_high_watermark_ratio, "0.3");
 CONF_mDouble(connector_sink_mem_low_watermark_ratio, "0.1");
 CONF_mDouble(connector_sink_mem_urgent_space_ratio, "0.1");
+// Max number of files a connector sink (hive/iceberg/files) keeps open at the same time for different
+// partitions. The least recently written one is committed when the limit is reached. Best used with input
+// clustered by partition so that each partition still gets a single file. <= 0 means no limit.
+CONF_mInt32(connector_sink_max_open_writers, "0");
 
 // .crm file can be removed after 1day.
 CONF_mInt32(unused_crm_file_threshold_second, "86400" /** 1day **/);
@@ -1653,6 +1882,12 @@ CONF_mInt32(apply_version_slow_log_sec, "30");
 CONF_mInt32(merge_commit_stream_load_pipe_block_wait_us, "500");
 // The maximum number of bytes that the merge commit stream load pipe can buffer.
 CONF_mInt64(merge_commit_stream_load_pipe_max_buffered_bytes, "1073741824");
+// Close the merge window of a pipe early once it has received this many bytes, so that the window
+// adapts to the arrival rate: a busy table commits smaller batches more often. 0 means only time bounded
+CONF_mInt64(merge_commit_pipe_max_window_bytes, "0");
+// Request the load of the next batch from FE when the active pipe has less than this many milliseconds
+// left in its merge window, so that the next batch accepts data while the previous one commits. 0 disables it
+CONF_mInt32(merge_commit_pipe_prefetch_ms, "0");
 CONF_Int32(merge_commit_thread_pool_num_min, "0");
 CONF_Int32(merge_commit_thread_pool_num_max, "512");
 CONF_Int32(merge_commit_thread_pool_queue_size, "4096");
@@ -1676,6 +1911,11 @@ CONF_mInt64(load_spill_max_merge_bytes, "1073741824");
 CONF_mInt64(load_spill_merge_memory_limit_percent, "30");
 // Upper bound of spill merge thread count
 CONF_mInt64(load_spill_merge_max_thread, "16");
+// Merge the spilled blocks of a duplicate key table column group by column group when the table has
+// at least this many columns, so that only the writers of one group are in memory. 0 means never.
+CONF_mInt64(load_spill_vertical_merge_min_columns, "0");
+// Max columns of a non-key column group when merging spilled blocks vertically
+CONF_mInt64(load_spill_vertical_merge_max_columns_per_group, "200");
 // Do lazy load when PK column larger than this threshold. Default is 300MB.
 CONF_mInt64(pk_column_lazy_load_threshold_bytes, "314572800");
 
@@ -1703,6 +1943,11 @@ CONF_mInt64(split_exchanger_buffer_chunk_num, "1000");
 
 // when to split hashmap/hashset into two level hashmap/hashset, negative number means use default value
 CONF_mInt64(two_level_memory_threshold, "-1");
+// when the number of groups in hashmap/hashset exceeds it, split it into two level hashmap/hashset,
+// non-positive number (the default) means only use two_level_memory_threshold
+CONF_mInt64(two_level_distinct_threshold, "0");
+// whether the finalize phase of a group by aggregation starts with two level hashmap/hashset
+CONF_mBool(enable_agg_finalize_two_level_hash_table, "false");
 
 CONF_mInt32(max_update_tablet_version_internal_ms, "5000");
 } // namespace starrocks::config
@@ -14,7 +14,10 @@
 
 #include "connector_chunk_sink.h"
 
+#include <limits>
+
 #include "column/chunk.h"
+#include "common/config.h"
 #include "common/status.h"
 #include "connector/sink_memory_manager.h"
 #include "formats/file_writer.h"
@@ -72,6 +75,7 @@ Status ConnectorChunkSink::write_partition_chunk(const std::string& partition,
             RETURN_IF_ERROR(writer->write(chunk));
         }
     } else {
+        _close_least_recently_written_writer_if_needed();
         auto path = !_partition_column_names.empty() ? _location_provider->get(partition) : _location_provider->get();
         ASSIGN_OR_RETURN(auto new_writer_and_stream, _file_writer_factory->create(path));
         std::unique_ptr<Writer> new_writer = std::move(new_writer_and_stream.writer);
@@ -82,9 +86,37 @@ Status ConnectorChunkSink::write_partition_chunk(const std::string& partition,
                 std::make_pair(std::move(new_writer), new_stream.get());
         _io_poller->enqueue(std::move(new_stream));
     }
+    _writer_last_write_seq[std::make_pair(partition, partition_field_null_list)] = ++_write_seq;
     return Status::OK();
 }
 
+void ConnectorChunkSink::_close_least_recently_written_writer_if_needed() {
+    if (config::connector_sink_max_open_writers <= 0 ||
+        _writer_stream_pairs.size() < static_cast<size_t>(config::connector_sink_max_open_writers)) {
+        return;
+    }
+    // When the input is clustered by partition, the least recently written partition has
+    // received all of its rows, so closing it does not split the partition into more files.
+    auto victim = _writer_stream_pairs.end();
+    int64_t victim_seq = std::numeric_limits<int64_t>::max();
+    for (auto it = _writer_stream_pairs.begin(); it != _writer_stream_pairs.end(); ++it) {
+        auto seq_it = _writer_last_write_seq.find(it->first);
+        int64_t seq = seq_it != _writer_last_write_seq.end() ? seq_it->second : 0;
+        if (seq < victim_seq) {
+            victim = it;
+            victim_seq = seq;
+        }
+    }
+    DCHECK(victim != _writer_stream_pairs.end());
+    const auto& partition_field_null_list = victim->first.second;
+    string null_fingerprint(partition_field_null_list.size(), '0');
+    std::transform(partition_field_null_list.begin(), partition_field_null_list.end(), null_fingerprint.begin(),
+                   [](int8_t b) { return b + '0'; });
+    callback_on_commit(victim->second.first->commit().set_extra_data(null_fingerprint));
+    _writer_last_write_seq.erase(victim->first);
+    _writer_stream_pairs.erase(victim);
+}
+
 Status ConnectorChunkSink::add(Chunk* chunk) {
     std::string partition = DEFAULT_PARTITION;
     bool partitioned = !_partition_column_names.empty();
@@ -65,6 +65,10 @@ public:
                                  Chunk* chunk);
 
 protected:
+    // Commit the writer of the least recently written partition if the number of open writers
+    // reaches `connector_sink_max_open_writers`.
+    void _close_least_recently_written_writer_if_needed();
+
     AsyncFlushStreamPoller* _io_poller = nullptr;
     SinkOperatorMemoryManager* _op_mem_mgr = nullptr;
 
@@ -78,6 +82,9 @@ protected:
     std::vector<std::function<void()>> _rollback_actions;
 
     std::map<PartitionKey, WriterStreamPair> _writer_stream_pairs;
+    // partition -> sequence number of the last write to its writer
+    std::map<PartitionKey, int64_t> _writer_last_write_seq;
+    int64_t _write_seq = 0;
     inline static std::string DEFAULT_PARTITION = "__DEFAULT_PARTITION__";
 };
 
@@ -38,6 +38,9 @@ public:
     void add_value(uint64_t val);
     uint64_t get_cardinality() const;
     void to_array(std::vector<uint64_t>& array) const;
+    // Add all the values of `other` into this bitmap.
+    void merge(const DeletionBitmap& other);
+    size_t size_in_bytes() const;
 
 private:
     static const uint64_t kBatchSize = 256;
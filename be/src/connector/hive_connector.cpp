@@ -525,6 +525,11 @@ void HiveDataSource::_init_counter(RuntimeState* state) {
         _profile.shared_buffered_direct_io_count =
                 ADD_CHILD_COUNTER(_runtime_profile, "DirectIOCount", TUnit::UNIT, prefix);
         _profile.shared_buffered_direct_io_timer = ADD_CHILD_TIMER(_runtime_profile, "DirectIOTime", prefix);
+        _profile.shared_buffered_prefetch_io_bytes =
+                ADD_CHILD_COUNTER(_runtime_profile, "PrefetchIOBytes", TUnit::BYTES, prefix);
+        _profile.shared_buffered_prefetch_io_count =
+                ADD_CHILD_COUNTER(_runtime_profile, "PrefetchIOCount", TUnit::UNIT, prefix);
+        _profile.shared_buffered_prefetch_wait_timer = ADD_CHILD_TIMER(_runtime_profile, "PrefetchWaitTime", prefix);
     }
 
     if (_datacache_options.enable_datacache) {
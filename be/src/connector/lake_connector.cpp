@@ -597,6 +597,12 @@ void LakeDataSource::init_counter(RuntimeState* state) {
     _prefetch_hit_counter = ADD_CHILD_COUNTER(_runtime_profile, "PrefetchHitCount", TUnit::UNIT, io_statistics_name);
     _prefetch_wait_finish_timer = ADD_CHILD_TIMER(_runtime_profile, "PrefetchWaitFinishTime", io_statistics_name);
     _prefetch_pending_timer = ADD_CHILD_TIMER(_runtime_profile, "PrefetchPendingTime", io_statistics_name);
+    _io_coalesce_prefetch_count_counter =
+            ADD_CHILD_COUNTER(_runtime_profile, "CoalescePrefetchIOCount", TUnit::UNIT, io_statistics_name);
+    _io_coalesce_prefetch_bytes_counter =
+            ADD_CHILD_COUNTER(_runtime_profile, "CoalescePrefetchIOBytes", TUnit::BYTES, io_statistics_name);
+    _io_coalesce_prefetch_wait_timer =
+            ADD_CHILD_TIMER(_runtime_profile, "CoalescePrefetchWaitTime", io_statistics_name);
 }
 
 void LakeDataSource::update_realtime_counter(Chunk* chunk) {
@@ -711,6 +717,9 @@ void LakeDataSource::update_counter() {
     COUNTER_UPDATE(_prefetch_hit_counter, _reader->stats().prefetch_hit_count);
     COUNTER_UPDATE(_prefetch_wait_finish_timer, _reader->stats().prefetch_wait_finish_ns);
     COUNTER_UPDATE(_prefetch_pending_timer, _reader->stats().prefetch_pending_ns);
+    COUNTER_UPDATE(_io_coalesce_prefetch_count_counter, _reader->stats().io_coalesce_prefetch_count);
+    COUNTER_UPDATE(_io_coalesce_prefetch_bytes_counter, _reader->stats().io_coalesce_prefetch_bytes);
+    COUNTER_UPDATE(_io_coalesce_prefetch_wait_timer, _reader->stats().io_coalesce_prefetch_wait_ns);
 
     // update cache related info for CACHE SELECT
     if (_runtime_state->query_options().__isset.query_type &&
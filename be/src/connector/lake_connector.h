@@ -179,6 +179,9 @@ private:
     RuntimeProfile::Counter* _prefetch_hit_counter = nullptr;
     RuntimeProfile::Counter* _prefetch_wait_finish_timer = nullptr;
     RuntimeProfile::Counter* _prefetch_pending_timer = nullptr;
+    RuntimeProfile::Counter* _io_coalesce_prefetch_count_counter = nullptr;
+    RuntimeProfile::Counter* _io_coalesce_prefetch_bytes_counter = nullptr;
+    RuntimeProfile::Counter* _io_coalesce_prefetch_wait_timer = nullptr;
 
     RuntimeProfile::Counter* _pushdown_access_paths_counter = nullptr;
     RuntimeProfile::Counter* _access_path_hits_counter = nullptr;
@@ -105,6 +105,10 @@ void AggrAutoContext::update_continuous_limit() {
     continuous_limit = continuous_limit * 2 > ContinuousUpperLimit ? ContinuousUpperLimit : continuous_limit * 2;
 }
 
+void AggrAutoContext::reset_continuous_limit() {
+    continuous_limit = InitContinuousLimit;
+}
+
 size_t AggrAutoContext::get_continuous_limit() {
     return continuous_limit;
 }
@@ -218,6 +222,7 @@ void AggregatorParams::init() {
 
 Aggregator::Aggregator(AggregatorParamsPtr params) : _params(std::move(params)) {
     _allocator = std::make_unique<CountingAllocatorWithHook>();
+    _agg_state_block_cache = std::make_unique<AggStateBlockCache>(_allocator.get());
 }
 
 Status Aggregator::open(RuntimeState* state) {
@@ -616,7 +621,7 @@ Status Aggregator::reset_state(starrocks::RuntimeState* state, const std::vector
 }
 
 Status Aggregator::_reset_state(RuntimeState* state, bool reset_sink_complete) {
-    SCOPED_THREAD_LOCAL_STATE_ALLOCATOR_SETTER(_allocator.get());
+    SCOPED_THREAD_LOCAL_STATE_ALLOCATOR_SETTER(_allocator.get(), _agg_state_block_cache.get());
     _is_ht_eos = false;
     _num_input_rows = 0;
     _is_prepared = false;
@@ -643,6 +648,7 @@ Status Aggregator::_reset_state(RuntimeState* state, bool reset_sink_complete) {
     } else if (!_is_only_group_by_columns) {
         _release_agg_memory();
     }
+    _agg_state_block_cache->release();
 
     for (int i = 0; i < _agg_functions.size(); i++) {
         if (_agg_fn_ctxs[i]) {
@@ -711,13 +717,14 @@ void Aggregator::close(RuntimeState* state) {
         if (_mem_pool != nullptr) {
             // Note: we must free agg_states object before _mem_pool free_all;
             if (_single_agg_state != nullptr) {
-                SCOPED_THREAD_LOCAL_STATE_ALLOCATOR_SETTER(_allocator.get());
+                SCOPED_THREAD_LOCAL_STATE_ALLOCATOR_SETTER(_allocator.get(), _agg_state_block_cache.get());
                 for (int i = 0; i < _agg_functions.size(); i++) {
                     _agg_functions[i]->destroy(_agg_fn_ctxs[i], _single_agg_state + _agg_states_offsets[i]);
                 }
             } else if (!_is_only_group_by_columns) {
                 _release_agg_memory();
             }
+            _agg_state_block_cache->release();
 
             _mem_pool->free_all();
         }
@@ -838,7 +845,7 @@ Status Aggregator::compute_single_agg_state(Chunk* chunk, size_t chunk_size) {
     for (size_t i = 0; i < _agg_fn_ctxs.size(); i++) {
         // evaluate arguments at i-th agg function
         RETURN_IF_ERROR(evaluate_agg_input_column(chunk, agg_expr_ctxs[i], i));
-        SCOPED_THREAD_LOCAL_STATE_ALLOCATOR_SETTER(_allocator.get());
+        SCOPED_THREAD_LOCAL_STATE_ALLOCATOR_SETTER(_allocator.get(), _agg_state_block_cache.get());
         // batch call update or merge for singe stage
         if (!_is_merge_funcs[i] && !use_intermediate) {
             _agg_functions[i]->update_batch_single_state_exception_safe(_agg_fn_ctxs[i], chunk_size,
@@ -863,7 +870,7 @@ Status Aggregator::compute_batch_agg_states(Chunk* chunk, size_t chunk_size) {
     for (size_t i = 0; i < _agg_fn_ctxs.size(); i++) {
         // evaluate arguments at i-th agg function
         RETURN_IF_ERROR(evaluate_agg_input_column(chunk, agg_expr_ctxs[i], i));
-        SCOPED_THREAD_LOCAL_STATE_ALLOCATOR_SETTER(_allocator.get());
+        SCOPED_THREAD_LOCAL_STATE_ALLOCATOR_SETTER(_allocator.get(), _agg_state_block_cache.get());
         // batch call update or merge
         if (!_is_merge_funcs[i] && !use_intermediate) {
             _agg_functions[i]->update_batch_exception_safe(_agg_fn_ctxs[i], chunk_size, _agg_states_offsets[i],
@@ -886,7 +893,7 @@ Status Aggregator::compute_batch_agg_states_with_selection(Chunk* chunk, size_t
 
     for (size_t i = 0; i < _agg_fn_ctxs.size(); i++) {
         RETURN_IF_ERROR(evaluate_agg_input_column(chunk, agg_expr_ctxs[i], i));
-        SCOPED_THREAD_LOCAL_STATE_ALLOCATOR_SETTER(_allocator.get());
+        SCOPED_THREAD_LOCAL_STATE_ALLOCATOR_SETTER(_allocator.get(), _agg_state_block_cache.get());
         if (!_is_merge_funcs[i] && !use_intermediate) {
             _agg_functions[i]->update_batch_selectively_exception_safe(
                     _agg_fn_ctxs[i], chunk_size, _agg_states_offsets[i], _agg_input_raw_columns[i].data(),
@@ -926,7 +933,7 @@ Status Aggregator::convert_to_chunk_no_groupby(ChunkPtr* chunk) {
     // TODO(kks): we should approve memory allocate here
     auto use_intermediate = _use_intermediate_as_output();
     Columns agg_result_column = _create_agg_result_columns(1, use_intermediate);
-    SCOPED_THREAD_LOCAL_STATE_ALLOCATOR_SETTER(_allocator.get());
+    SCOPED_THREAD_LOCAL_STATE_ALLOCATOR_SETTER(_allocator.get(), _agg_state_block_cache.get());
     if (!use_intermediate) {
         TRY_CATCH_BAD_ALLOC(_finalize_to_chunk(_single_agg_state, agg_result_column));
     } else {
@@ -1042,7 +1049,7 @@ Status Aggregator::output_chunk_by_streaming(Chunk* input_chunk, ChunkPtr* chunk
                 result_chunk->append_column(std::move(_agg_input_columns[i][0]), slot_id);
             } else {
                 {
-                    SCOPED_THREAD_LOCAL_STATE_ALLOCATOR_SETTER(_allocator.get());
+                    SCOPED_THREAD_LOCAL_STATE_ALLOCATOR_SETTER(_allocator.get(), _agg_state_block_cache.get());
                     _agg_functions[i]->convert_to_serialize_format(_agg_fn_ctxs[i], _agg_input_columns[i],
                                                                    result_chunk->num_rows(), &agg_result_column[i]);
                 }
@@ -1131,14 +1138,14 @@ Status Aggregator::output_chunk_by_streaming_with_selection(Chunk* input_chunk,
 
 void Aggregator::try_convert_to_two_level_map() {
     auto current_size = _hash_map_variant.reserved_memory_usage(mem_pool());
-    if (current_size > get_two_level_threahold()) {
+    if (current_size > get_two_level_threahold() || _hash_map_variant.size() > get_two_level_distinct_threshold()) {
         _hash_map_variant.convert_to_two_level(_state);
     }
 }
 
 void Aggregator::try_convert_to_two_level_set() {
     auto current_size = _hash_set_variant.reserved_memory_usage(mem_pool());
-    if (current_size > get_two_level_threahold()) {
+    if (current_size > get_two_level_threahold() || _hash_set_variant.size() > get_two_level_distinct_threshold()) {
         _hash_set_variant.convert_to_two_level(_state);
     }
 }
@@ -1200,7 +1207,7 @@ void Aggregator::_finalize_to_chunk(ConstAggDataPtr __restrict state, Columns& a
 }
 
 void Aggregator::_destroy_state(AggDataPtr __restrict state) {
-    SCOPED_THREAD_LOCAL_STATE_ALLOCATOR_SETTER(_allocator.get());
+    SCOPED_THREAD_LOCAL_STATE_ALLOCATOR_SETTER(_allocator.get(), _agg_state_block_cache.get());
     for (size_t i = 0; i < _agg_fn_ctxs.size(); i++) {
         _agg_functions[i]->destroy(_agg_fn_ctxs[i], state + _agg_states_offsets[i]);
     }
@@ -1352,6 +1359,13 @@ void Aggregator::_init_agg_hash_variant(HashVariantType& hash_variant) {
             variant->fixed_byte_size = fixed_byte_size;
         }
     });
+
+    // The input of the finalize phase is already shuffled across drivers by the group by keys, start with the
+    // two level table so that each driver's groups are further split into sub tables by the high bits of the hash,
+    // instead of growing a single table for all of them.
+    if (_aggr_phase == AggrPhase2 && _needs_finalize && config::enable_agg_finalize_two_level_hash_table) {
+        hash_variant.convert_to_two_level(_state);
+    }
 }
 
 void Aggregator::build_hash_map(size_t chunk_size, bool agg_group_by_with_limit) {
@@ -1457,7 +1471,7 @@ Status Aggregator::convert_hash_map_to_chunk(int32_t chunk_size, ChunkPtr* chunk
 
             {
                 SCOPED_TIMER(_agg_stat->agg_append_timer);
-                SCOPED_THREAD_LOCAL_STATE_ALLOCATOR_SETTER(_allocator.get());
+                SCOPED_THREAD_LOCAL_STATE_ALLOCATOR_SETTER(_allocator.get(), _agg_state_block_cache.get());
                 if (!use_intermediate) {
                     for (size_t i = 0; i < _agg_fn_ctxs.size(); i++) {
                         TRY_CATCH_BAD_ALLOC(_agg_functions[i]->batch_finalize(_agg_fn_ctxs[i], read_index,
@@ -1486,7 +1500,7 @@ Status Aggregator::convert_hash_map_to_chunk(int32_t chunk_size, ChunkPtr* chunk
                     DCHECK(group_by_columns.size() == 1);
                     DCHECK(group_by_columns[0]->is_nullable());
                     group_by_columns[0]->append_default();
-                    SCOPED_THREAD_LOCAL_STATE_ALLOCATOR_SETTER(_allocator.get());
+                    SCOPED_THREAD_LOCAL_STATE_ALLOCATOR_SETTER(_allocator.get(), _agg_state_block_cache.get());
                     if (!use_intermediate) {
                         TRY_CATCH_BAD_ALLOC(_finalize_to_chunk(hash_map_with_key.null_key_data, agg_result_columns));
                     } else {
@@ -1595,7 +1609,7 @@ void Aggregator::_release_agg_memory() {
     // If all function states are of POD type,
     // then we don't have to traverse the hash table to call destroy method.
     //
-    SCOPED_THREAD_LOCAL_STATE_ALLOCATOR_SETTER(_allocator.get());
+    SCOPED_THREAD_LOCAL_STATE_ALLOCATOR_SETTER(_allocator.get(), _agg_state_block_cache.get());
     _hash_map_variant.visit([&](auto& hash_map_with_key) {
         bool skip_destroy = std::all_of(_agg_functions.begin(), _agg_functions.end(),
                                         [](auto* func) { return func->is_pod_state(); });
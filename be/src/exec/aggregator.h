@@ -18,6 +18,7 @@
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <limits>
 #include <memory>
 #include <mutex>
 #include <new>
@@ -38,6 +39,7 @@
 #include "exec/pipeline/schedule/observer.h"
 #include "exec/pipeline/spill_process_channel.h"
 #include "exprs/agg/aggregate_factory.h"
+#include "exprs/agg/aggregate_state_allocator.h"
 #include "exprs/expr.h"
 #include "gen_cpp/QueryPlanExtra_types.h"
 #include "gutil/strings/substitute.h"
@@ -178,9 +180,13 @@ struct AggrAutoContext {
     static constexpr double HighReduction = 0.9;
     static constexpr size_t MaxHtSize = 64 * 1024 * 1024; // 64 MB
     static constexpr int StableLimit = 5;
+    static constexpr size_t InitContinuousLimit = 100;
     std::string get_auto_state_string(const AggrAutoState& state);
     size_t get_continuous_limit();
+    // backoff of the re-probe interval, while probes keep confirming pass-through/selective pre-aggregation
     void update_continuous_limit();
+    // a probe found high reduction, the data has changed, so probe often again next time
+    void reset_continuous_limit();
     bool is_high_reduction(const size_t agg_count, const size_t chunk_size);
     bool is_low_reduction(const size_t agg_count, const size_t chunk_size);
     size_t init_preagg_count = 0;
@@ -189,7 +195,7 @@ struct AggrAutoContext {
     size_t force_preagg_count = 0;
     size_t preagg_count = 0;
     size_t selective_preagg_count = 0;
-    size_t continuous_limit = 100;
+    size_t continuous_limit = InitContinuousLimit;
 };
 
 struct StreamingHtMinReductionEntry {
@@ -435,6 +441,8 @@ protected:
     std::unique_ptr<MemPool> _mem_pool;
     // used to count heap memory usage of agg states
     std::unique_ptr<CountingAllocatorWithHook> _allocator;
+    // recycles the small blocks of containers inside agg states, must be destroyed before _allocator
+    std::unique_ptr<AggStateBlockCache> _agg_state_block_cache;
     // The open phase still relies on the TFunction object for some initialization operations
     std::vector<TFunction> _fns;
 
@@ -613,6 +621,15 @@ protected:
         return config::two_level_memory_threshold;
     }
 
+    // narrow keys can hold many groups before reaching the memory threshold, a single level table with that
+    // many groups is mostly paying for rehashing the whole table on every expansion.
+    size_t get_two_level_distinct_threshold() {
+        if (config::two_level_distinct_threshold <= 0) {
+            return std::numeric_limits<size_t>::max();
+        }
+        return config::two_level_distinct_threshold;
+    }
+
     template <class HashMapWithKey>
     friend struct AllocateState;
 };
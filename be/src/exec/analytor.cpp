@@ -262,6 +262,25 @@ Status Analytor::prepare(RuntimeState* state, ObjectPool* pool, RuntimeProfile*
         _is_lead_lag_functions[i] = (_agg_functions[i]->get_name() == "lead-lag");
     }
 
+    // Removable cumulative process of max/min has to recompute the whole frame whenever the evicted row is
+    // the current max/min, which is O(frame size) per row in the worst case. Large frames use the segment tree.
+    const TAnalyticWindow& window = analytic_node.window;
+    const int64_t min_segment_tree_frame_size = config::pipeline_analytic_segment_tree_min_frame_size;
+    if (min_segment_tree_frame_size > 0 && !_is_merge_funcs && analytic_node.__isset.window &&
+        window.type == TAnalyticWindowType::ROWS && window.__isset.window_start && window.__isset.window_end &&
+        _rows_end_offset - _rows_start_offset + 1 >= min_segment_tree_frame_size) {
+        _use_segment_tree_process = std::all_of(
+                analytic_node.analytic_functions.begin(), analytic_node.analytic_functions.end(),
+                [](const TExpr& desc) {
+                    const auto& fname = desc.nodes[0].fn.name.function_name;
+                    return fname == "max" || fname == "min";
+                });
+    }
+    if (_use_segment_tree_process) {
+        _use_removable_cumulative_process = false;
+        _need_partition_materializing = true;
+    }
+
     // Compute agg state total size and offsets.
     for (int i = 0; i < agg_size; ++i) {
         _agg_states_offsets[i] = _agg_states_total_size;
@@ -446,8 +465,12 @@ Status Analytor::_prepare_processing_mode(RuntimeState* state, RuntimeProfile* r
     _process_impl = &Analytor::_materializing_process;
     std::stringstream process_mode;
     process_mode << (_need_partition_materializing ? "Materializing/" : "Streaming/");
-    process_mode << (_use_removable_cumulative_process ? "RemovableCumulative"
-                                                       : (_is_unbounded_preceding ? "Cumulative" : "ByDefinition"));
+    if (_use_segment_tree_process) {
+        process_mode << "SegmentTree";
+    } else {
+        process_mode << (_use_removable_cumulative_process ? "RemovableCumulative"
+                                                           : (_is_unbounded_preceding ? "Cumulative" : "ByDefinition"));
+    }
     runtime_profile->add_info_string("ProcessMode", process_mode.str());
     if (!_tnode.analytic_node.__isset.window) {
         _materializing_process_impl = &Analytor::_materializing_process_for_unbounded_frame;
@@ -928,6 +951,19 @@ void Analytor::_materializing_process_for_sliding_frame(RuntimeState* state) {
         while (_current_row_position < _partition.end && !_is_current_chunk_finished_eval()) {
             _update_window_batch_removable_cumulatively();
 
+            _get_window_function_result(_window_result_position(), _window_result_position() + 1);
+            _update_current_row_position(1);
+        }
+    } else if (_use_segment_tree_process) {
+        // The partition is complete here, and its rows won't be removed until it's finished.
+        if (_segment_tree_partition_start != _get_global_position(_partition.start)) {
+            _build_segment_tree();
+        }
+        while (_current_row_position < _partition.end && !_is_current_chunk_finished_eval()) {
+            _reset_window_state();
+            const FrameRange range = _get_frame_range();
+            _update_window_batch_by_segment_tree(range.start, range.end);
+
             _get_window_function_result(_window_result_position(), _window_result_position() + 1);
             _update_current_row_position(1);
         }
@@ -991,6 +1027,85 @@ void Analytor::_update_window_batch_removable_cumulatively() {
     }
 }
 
+void Analytor::_build_segment_tree() {
+    SCOPED_THREAD_LOCAL_AGG_STATE_ALLOCATOR_SETTER(_allocator.get());
+    const int64_t partition_size = _partition.end - _partition.start;
+    _segment_tree_partition_start = _get_global_position(_partition.start);
+    _segment_tree_nodes.assign(_agg_fn_ctxs.size(), Columns());
+    for (size_t i = 0; i < _agg_fn_ctxs.size(); i++) {
+        size_t column_size = _agg_intput_columns[i].size();
+        const Column* data_columns[column_size];
+        for (size_t j = 0; j < column_size; j++) {
+            data_columns[j] = _agg_intput_columns[i][j].get();
+        }
+        auto* state = _managed_fn_states[0]->mutable_data() + _agg_states_offsets[i];
+        auto& levels = _segment_tree_nodes[i];
+
+        // Only full nodes are built, a frame never covers a partial node at the end of the partition.
+        for (int64_t level = kSegmentTreeLeafLevel; (int64_t{1} << level) <= partition_size; ++level) {
+            const int64_t node_rows = int64_t{1} << level;
+            const int64_t num_nodes = partition_size >> level;
+            // max/min use the result type as the intermediate type.
+            auto nodes = ColumnHelper::create_column(_agg_fn_types[i].result_type, _agg_fn_types[i].has_nullable_child);
+            nodes->reserve(num_nodes);
+            for (int64_t j = 0; j < num_nodes; ++j) {
+                _agg_functions[i]->reset(_agg_fn_ctxs[i], _agg_intput_columns[i], state);
+                if (level == kSegmentTreeLeafLevel) {
+                    const int64_t start = _partition.start + j * node_rows;
+                    _agg_functions[i]->update_batch_single_state_with_frame(_agg_fn_ctxs[i], state, data_columns,
+                                                                            _partition.start, _partition.end, start,
+                                                                            start + node_rows);
+                } else {
+                    const Column* children = levels.back().get();
+                    _agg_functions[i]->merge(_agg_fn_ctxs[i], children, state, 2 * j);
+                    _agg_functions[i]->merge(_agg_fn_ctxs[i], children, state, 2 * j + 1);
+                }
+                _agg_functions[i]->serialize_to_column(_agg_fn_ctxs[i], state, nodes.get());
+            }
+            levels.emplace_back(std::move(nodes));
+        }
+        _agg_functions[i]->reset(_agg_fn_ctxs[i], _agg_intput_columns[i], state);
+    }
+}
+
+void Analytor::_update_window_batch_by_segment_tree(int64_t frame_start, int64_t frame_end) {
+    SCOPED_THREAD_LOCAL_AGG_STATE_ALLOCATOR_SETTER(_allocator.get());
+    constexpr int64_t leaf_rows = int64_t{1} << kSegmentTreeLeafLevel;
+    // Positions are relative to the partition start from here.
+    const int64_t end = std::min<int64_t>(frame_end, _partition.end) - _partition.start;
+    for (size_t i = 0; i < _agg_fn_ctxs.size(); i++) {
+        size_t column_size = _agg_intput_columns[i].size();
+        const Column* data_columns[column_size];
+        for (size_t j = 0; j < column_size; j++) {
+            data_columns[j] = _agg_intput_columns[i][j].get();
+        }
+        auto* state = _managed_fn_states[0]->mutable_data() + _agg_states_offsets[i];
+        const auto& levels = _segment_tree_nodes[i];
+
+        int64_t pos = std::max<int64_t>(frame_start, _partition.start) - _partition.start;
+        while (pos < end) {
+            if ((pos & (leaf_rows - 1)) != 0 || pos + leaf_rows > end) {
+                // Update the rows directly until the next leaf boundary.
+                const int64_t next = std::min<int64_t>(end, (pos | (leaf_rows - 1)) + 1);
+                _agg_functions[i]->update_batch_single_state_with_frame(
+                        _agg_fn_ctxs[i], state, data_columns, _partition.start, _partition.end,
+                        _partition.start + pos, _partition.start + next);
+                pos = next;
+                continue;
+            }
+            // Pick the highest node which starts at pos and lies in the frame.
+            size_t level = 0;
+            while (level + 1 < levels.size() && (pos & ((leaf_rows << (level + 1)) - 1)) == 0 &&
+                   pos + (leaf_rows << (level + 1)) <= end) {
+                ++level;
+            }
+            _agg_functions[i]->merge(_agg_fn_ctxs[i], levels[level].get(), state,
+                                     pos >> (level + kSegmentTreeLeafLevel));
+            pos += leaf_rows << level;
+        }
+    }
+}
+
 Status Analytor::_output_result_chunk(ChunkPtr* chunk) {
     ChunkPtr output_chunk = std::move(_input_chunks[_output_chunk_index]);
     for (size_t i = 0; i < _result_window_columns.size(); i++) {
@@ -1018,6 +1133,7 @@ void Analytor::_reset_state_for_next_partition() {
 
     _partition.start = _partition.end;
     _current_row_position = _partition.start;
+    _segment_tree_nodes.clear();
     _reset_window_state();
     DCHECK_GE(_current_row_position, 0);
 }
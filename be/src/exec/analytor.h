@@ -213,6 +213,9 @@ private:
 
     void _update_window_batch(int64_t partition_start, int64_t partition_end, int64_t frame_start, int64_t frame_end);
     void _update_window_batch_removable_cumulatively();
+    // Build the segment tree of the current partition, and evaluate a frame with it.
+    void _build_segment_tree();
+    void _update_window_batch_by_segment_tree(int64_t frame_start, int64_t frame_end);
 
     Status _output_result_chunk(ChunkPtr* chunk);
 
@@ -310,6 +313,15 @@ private:
     // Any of these conditions is satisfied, the materializing processing is required.
     bool _need_partition_materializing = false;
     bool _use_removable_cumulative_process = false;
+    // For large sliding frames of non-invertible functions (max/min), the frame is evaluated by a segment
+    // tree over the partition. A node of level k covers 2^k rows from the partition start, only the levels
+    // from kSegmentTreeLeafLevel are materialized as serialized states, rows below that are updated directly.
+    static constexpr int64_t kSegmentTreeLeafLevel = 4;
+    bool _use_segment_tree_process = false;
+    // Global position of the partition start which the segment tree is built for.
+    int64_t _segment_tree_partition_start = -1;
+    // _segment_tree_nodes[i][k] is the serialized states of the i-th function at level k + kSegmentTreeLeafLevel.
+    std::vector<Columns> _segment_tree_nodes;
     // When calculating window functions such as CUME_DIST and PERCENT_RANK,
     // it's necessary to specify the size of the partition.
     bool _should_set_partition_size = false;
@@ -55,6 +55,13 @@ public:
         return std::max<size_t>(tunning_buffered_chunks(rows_to_sort), rows_to_sort / 4069);
     }
 
+    // Partition-wise topn keeps one sorter alive for every partition, so the rows buffered by each of them
+    // before a partial sort have to stay small, otherwise the memory grows with the number of partitions.
+    // The partial sort also builds the baseline which filters out the following input of that partition.
+    static constexpr size_t partition_max_buffered_rows(size_t rows_to_sort) {
+        return std::max<size_t>(rows_to_sort * 4, 4096);
+    }
+
     /**
      * Constructor.
      * @param sort_exprs     The order-by columns or columns with expression. This sorter will use but not own the object.
@@ -36,7 +36,8 @@ void ExceptHashSet<HashSet>::build_set(RuntimeState* state, const ChunkPtr& chun
     size_t chunk_size = chunk->num_rows();
     buffer_state->slice_sizes.assign(state->chunk_size(), 0);
 
-    size_t cur_max_one_row_size = _get_max_serialize_size(chunk, exprs);
+    Columns key_columns = _evaluate_key_columns(chunk, exprs);
+    size_t cur_max_one_row_size = _get_max_serialize_size(key_columns);
     if (UNLIKELY(cur_max_one_row_size > buffer_state->max_one_row_size)) {
         buffer_state->max_one_row_size = cur_max_one_row_size;
         buffer_state->mem_pool.clear();
@@ -44,7 +45,7 @@ void ExceptHashSet<HashSet>::build_set(RuntimeState* state, const ChunkPtr& chun
                                                                SLICE_MEMEQUAL_OVERFLOW_PADDING);
     }
 
-    _serialize_columns(chunk, exprs, chunk_size, buffer_state);
+    _serialize_columns(key_columns, chunk_size, buffer_state);
 
     for (size_t i = 0; i < chunk_size; ++i) {
         ExceptSliceFlag key(buffer_state->buffer + i * buffer_state->max_one_row_size, buffer_state->slice_sizes[i]);
@@ -68,7 +69,8 @@ Status ExceptHashSet<HashSet>::erase_duplicate_row(RuntimeState* state, const Ch
     size_t chunk_size = chunk->num_rows();
     buffer_state->slice_sizes.assign(state->chunk_size(), 0);
 
-    size_t cur_max_one_row_size = _get_max_serialize_size(chunk, exprs);
+    Columns key_columns = _evaluate_key_columns(chunk, exprs);
+    size_t cur_max_one_row_size = _get_max_serialize_size(key_columns);
     if (UNLIKELY(cur_max_one_row_size > buffer_state->max_one_row_size)) {
         buffer_state->max_one_row_size = cur_max_one_row_size;
         buffer_state->mem_pool.clear();
@@ -79,7 +81,7 @@ Status ExceptHashSet<HashSet>::erase_duplicate_row(RuntimeState* state, const Ch
         RETURN_IF_LIMIT_EXCEEDED(state, "Except, while probe hash table.");
     }
 
-    _serialize_columns(chunk, exprs, chunk_size, buffer_state);
+    _serialize_columns(key_columns, chunk_size, buffer_state);
 
     for (size_t i = 0; i < chunk_size; ++i) {
         ExceptSliceFlag key(buffer_state->buffer + i * buffer_state->max_one_row_size, buffer_state->slice_sizes[i]);
@@ -123,10 +125,19 @@ int64_t ExceptHashSet<HashSet>::mem_usage(BufferState* buffer_state) {
 }
 
 template <typename HashSet>
-size_t ExceptHashSet<HashSet>::_get_max_serialize_size(const ChunkPtr& chunk, const std::vector<ExprContext*>& exprs) {
-    size_t max_size = 0;
+Columns ExceptHashSet<HashSet>::_evaluate_key_columns(const ChunkPtr& chunk, const std::vector<ExprContext*>& exprs) {
+    Columns key_columns;
+    key_columns.reserve(exprs.size());
     for (auto expr : exprs) {
-        ColumnPtr key_column = EVALUATE_NULL_IF_ERROR(expr, expr->root(), chunk.get());
+        key_columns.emplace_back(EVALUATE_NULL_IF_ERROR(expr, expr->root(), chunk.get()));
+    }
+    return key_columns;
+}
+
+template <typename HashSet>
+size_t ExceptHashSet<HashSet>::_get_max_serialize_size(const Columns& key_columns) {
+    size_t max_size = 0;
+    for (const auto& key_column : key_columns) {
         max_size += key_column->max_one_element_serialize_size();
         if (!key_column->is_nullable()) {
             max_size += sizeof(bool);
@@ -136,11 +147,9 @@ size_t ExceptHashSet<HashSet>::_get_max_serialize_size(const ChunkPtr& chunk, co
 }
 
 template <typename HashSet>
-void ExceptHashSet<HashSet>::_serialize_columns(const ChunkPtr& chunk, const std::vector<ExprContext*>& exprs,
-                                                size_t chunk_size, BufferState* buffer_state) {
-    for (auto expr : exprs) {
-        ColumnPtr key_column = EVALUATE_NULL_IF_ERROR(expr, expr->root(), chunk.get());
-
+void ExceptHashSet<HashSet>::_serialize_columns(const Columns& key_columns, size_t chunk_size,
+                                                BufferState* buffer_state) {
+    for (const auto& key_column : key_columns) {
         // The serialized buffer is always nullable.
         if (key_column->is_nullable()) {
             key_column->serialize_batch(buffer_state->buffer, buffer_state->slice_sizes, chunk_size,
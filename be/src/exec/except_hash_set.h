@@ -89,9 +89,10 @@ public:
     int64_t mem_usage(BufferState* buffer_state);
 
 private:
-    size_t _get_max_serialize_size(const ChunkPtr& chunk, const std::vector<ExprContext*>& exprs);
-    void _serialize_columns(const ChunkPtr& chunk, const std::vector<ExprContext*>& exprs, size_t chunk_size,
-                            BufferState* buffer_state);
+    // Evaluate the key exprs once, both the serialize size and the serialization are computed from the result.
+    Columns _evaluate_key_columns(const ChunkPtr& chunk, const std::vector<ExprContext*>& exprs);
+    size_t _get_max_serialize_size(const Columns& key_columns);
+    void _serialize_columns(const Columns& key_columns, size_t chunk_size, BufferState* buffer_state);
 
 private:
     std::unique_ptr<HashSet> _hash_set;
@@ -29,6 +29,7 @@
 #include "gutil/casts.h"
 #include "runtime/descriptors.h"
 #include "runtime/mem_tracker.h"
+#include "util/bit_util.h"
 #include "util/cpu_info.h"
 #include "util/runtime_profile.h"
 
@@ -442,13 +443,17 @@ private:
     void _adjust_partition_rows(size_t build_row_size);
 
     void _init_partition_nums(const HashTableParam& param);
+    bool _can_expand_partitions() const;
+    Status _expand_partitions();
     Status _convert_to_single_partition();
     Status _append_chunk_to_partitions(const ChunkPtr& chunk);
 
 private:
     std::vector<std::unique_ptr<SingleHashJoinBuilder>> _builders;
+    HashTableParam _param;
 
     size_t _partition_num = 0;
+    size_t _max_partition_num = 0;
     size_t _partition_join_min_rows = 0;
     size_t _partition_join_max_rows = 0;
 
@@ -556,6 +561,9 @@ void AdaptivePartitionHashJoinBuilder::_adjust_partition_rows(size_t build_row_s
 
 void AdaptivePartitionHashJoinBuilder::_init_partition_nums(const HashTableParam& param) {
     _partition_num = 16;
+    // partition ids are taken from the low bits of the hash, so the upper bound must be a power of two
+    size_t max_partitions = std::max<int32_t>(1, config::partition_hash_join_max_partitions);
+    _max_partition_num = std::max<size_t>(_partition_num, 1UL << BitUtil::Log2FloorNonZero64(max_partitions));
 
     size_t estimated_bytes_each_row = _estimated_row_size(param);
 
@@ -567,6 +575,7 @@ void AdaptivePartitionHashJoinBuilder::_init_partition_nums(const HashTableParam
 }
 
 void AdaptivePartitionHashJoinBuilder::create(const HashTableParam& param) {
+    _param = param;
     _init_partition_nums(param);
     for (size_t i = 0; i < _partition_num; ++i) {
         _builders.emplace_back(std::make_unique<SingleHashJoinBuilder>(_hash_joiner));
@@ -580,6 +589,7 @@ void AdaptivePartitionHashJoinBuilder::close() {
     }
     _builders.clear();
     _partition_num = 0;
+    _max_partition_num = 0;
     _partition_join_min_rows = 0;
     _partition_join_max_rows = 0;
     _probe_estimated_costs = 0;
@@ -625,6 +635,53 @@ int64_t AdaptivePartitionHashJoinBuilder::ht_mem_usage() const {
                            [](int64_t sum, const auto& builder) { return sum + builder->ht_mem_usage(); });
 }
 
+bool AdaptivePartitionHashJoinBuilder::_can_expand_partitions() const {
+    if (_partition_num * 2 > _max_partition_num) {
+        return false;
+    }
+    // rows of a column view can't be redistributed cheaply, keep the old behavior for them.
+    for (const auto& builder : _builders) {
+        for (const auto& column : builder->hash_table().get_build_chunk()->columns()) {
+            if (column->is_view()) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// Double the number of partitions instead of falling back to a single huge hash table.
+// Partition ids are the low bits of the same fmix32 hash used by the prober, so rows of
+// partition i are split into partition i and i + old_partition_num.
+Status AdaptivePartitionHashJoinBuilder::_expand_partitions() {
+    auto old_builders = std::move(_builders);
+    _partition_num *= 2;
+    _builders.clear();
+    for (size_t i = 0; i < _partition_num; ++i) {
+        _builders.emplace_back(std::make_unique<SingleHashJoinBuilder>(_hash_joiner));
+        _builders.back()->create(_param);
+    }
+
+    for (auto& old_builder : old_builders) {
+        const auto& build_chunk = old_builder->hash_table().get_build_chunk();
+        // the first row of build chunk is a padding row
+        size_t num_rows = build_chunk->num_rows() - 1;
+        if (num_rows > 0) {
+            ChunkPtr chunk = build_chunk->clone_empty(num_rows);
+            chunk->append(*build_chunk, 1, num_rows);
+            // release the old partition before redistributing, so only one partition is duplicated at a time
+            old_builder->close();
+            RETURN_IF_ERROR(_append_chunk_to_partitions(chunk));
+        }
+        old_builder.reset();
+    }
+
+    _partition_join_max_rows = _fit_L3_cache_max_rows * _partition_num;
+    VLOG_OPERATOR << "TRACE: expand partition hash join to partition_num=" << _partition_num
+                  << " partition_join_max_rows=" << _partition_join_max_rows;
+    return Status::OK();
+}
+
 Status AdaptivePartitionHashJoinBuilder::_convert_to_single_partition() {
     // merge all partition data to the first partition
     for (size_t i = 1; i < _builders.size(); ++i) {
@@ -695,8 +752,14 @@ Status AdaptivePartitionHashJoinBuilder::_append_chunk_to_partitions(const Chunk
 }
 
 Status AdaptivePartitionHashJoinBuilder::do_append_chunk(const ChunkPtr& chunk) {
-    if (_partition_num > 1 && hash_table_row_count() > _partition_join_max_rows) {
-        RETURN_IF_ERROR(_convert_to_single_partition());
+    // Build side keeps growing: radix split the partitions so that each sub hash table still fits
+    // in the cache, and only fall back to a single hash table when the partition limit is reached.
+    while (_partition_num > 1 && hash_table_row_count() > _partition_join_max_rows) {
+        if (_can_expand_partitions()) {
+            RETURN_IF_ERROR(_expand_partitions());
+        } else {
+            RETURN_IF_ERROR(_convert_to_single_partition());
+        }
     }
 
     if (_partition_num > 1 && ++_pushed_chunks % 8 == 0) {
@@ -730,6 +793,7 @@ Status AdaptivePartitionHashJoinBuilder::build(RuntimeState* state) {
     for (auto& builder : _builders) {
         RETURN_IF_ERROR(builder->build(state));
     }
+    COUNTER_SET(_hash_joiner.build_metrics().partition_nums, (int64_t)_partition_num);
     _ready = true;
     return Status::OK();
 }
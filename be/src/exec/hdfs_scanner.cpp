@@ -23,6 +23,7 @@
 #include "io/compressed_input_stream.h"
 #include "io/shared_buffered_input_stream.h"
 #include "pipeline/fragment_context.h"
+#include "runtime/exec_env.h"
 #include "runtime/global_dict/parser.h"
 #include "storage/predicate_parser.h"
 #include "storage/runtime_range_pruner.hpp"
@@ -269,6 +270,11 @@ StatusOr<std::unique_ptr<RandomAccessFile>> HdfsScanner::create_random_access_fi
             .max_dist_size = config::io_coalesce_read_max_distance_size,
             .max_buffer_size = config::io_coalesce_read_max_buffer_size};
     shared_buffered_input_stream->set_coalesce_options(shared_options);
+    if (config::io_coalesce_prefetch_depth > 0 && ExecEnv::GetInstance()->io_coalesce_prefetch_pool() != nullptr) {
+        shared_buffered_input_stream->set_prefetch_options(ExecEnv::GetInstance()->io_coalesce_prefetch_pool(),
+                                                           config::io_coalesce_prefetch_depth,
+                                                           config::io_coalesce_prefetch_max_bytes);
+    }
     input_stream = shared_buffered_input_stream;
 
     // input_stream = CacheInputStream(input_stream)
@@ -488,6 +494,10 @@ void HdfsScanner::update_counter() {
         COUNTER_UPDATE(profile->shared_buffered_direct_io_count, _shared_buffered_input_stream->direct_io_count());
         COUNTER_UPDATE(profile->shared_buffered_direct_io_bytes, _shared_buffered_input_stream->direct_io_bytes());
         COUNTER_UPDATE(profile->shared_buffered_direct_io_timer, _shared_buffered_input_stream->direct_io_timer());
+        COUNTER_UPDATE(profile->shared_buffered_prefetch_io_count, _shared_buffered_input_stream->prefetch_io_count());
+        COUNTER_UPDATE(profile->shared_buffered_prefetch_io_bytes, _shared_buffered_input_stream->prefetch_io_bytes());
+        COUNTER_UPDATE(profile->shared_buffered_prefetch_wait_timer,
+                       _shared_buffered_input_stream->prefetch_wait_timer());
     }
 
     {
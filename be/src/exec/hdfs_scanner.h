@@ -187,6 +187,9 @@ struct HdfsScanProfile {
     RuntimeProfile::Counter* shared_buffered_direct_io_count = nullptr;
     RuntimeProfile::Counter* shared_buffered_direct_io_bytes = nullptr;
     RuntimeProfile::Counter* shared_buffered_direct_io_timer = nullptr;
+    RuntimeProfile::Counter* shared_buffered_prefetch_io_count = nullptr;
+    RuntimeProfile::Counter* shared_buffered_prefetch_io_bytes = nullptr;
+    RuntimeProfile::Counter* shared_buffered_prefetch_wait_timer = nullptr;
 
     RuntimeProfile::Counter* app_io_bytes_read_counter = nullptr;
     RuntimeProfile::Counter* app_io_timer = nullptr;
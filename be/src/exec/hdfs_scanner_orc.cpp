@@ -19,6 +19,8 @@
 #include "exec/exec_node.h"
 #include "exec/iceberg/iceberg_delete_builder.h"
 #include "exec/paimon/paimon_delete_file_builder.h"
+#include "exprs/runtime_filter.h"
+#include "exprs/runtime_filter_bank.h"
 #include "formats/orc/orc_chunk_reader.h"
 #include "formats/orc/orc_input_stream.h"
 #include "formats/orc/orc_memory_pool.h"
@@ -50,6 +52,9 @@ public:
                               const std::map<uint32_t, orc::BloomFilterIndex>& bloomFilters) override;
     bool filterMinMax(size_t rowGroupIdx, const std::unordered_map<uint64_t, orc::proto::RowIndex>& rowIndexes,
                       const std::map<uint32_t, orc::BloomFilterIndex>& bloomFilter);
+    // Check the runtime filters arrived so far against the row index statistics, the filters that arrive
+    // after the search argument is built are only applied here.
+    bool filterRuntimeFilter(size_t rowGroupIdx, const std::unordered_map<uint64_t, orc::proto::RowIndex>& rowIndexes);
     bool filterOnPickStringDictionary(const std::unordered_map<uint64_t, orc::StringDictionary*>& sdicts) override;
 
     bool is_slot_evaluated(SlotId id) { return _dict_filter_eval_cache.find(id) != _dict_filter_eval_cache.end(); }
@@ -184,6 +189,84 @@ bool OrcRowReaderFilter::filterMinMax(size_t rowGroupIdx,
     }
     return false;
 }
+
+template <LogicalType LT>
+static bool is_out_of_runtime_filter_range(const RuntimeFilter* rf, const ColumnPtr& min_col,
+                                           const ColumnPtr& max_col) {
+    const auto* filter = dynamic_cast<const MinMaxRuntimeFilter<LT>*>(rf->get_min_max_filter());
+    if (filter == nullptr) {
+        return false;
+    }
+    if (filter->is_empty_range()) {
+        return true;
+    }
+    const auto& min_data = GetContainer<LT>::get_data(down_cast<const NullableColumn*>(min_col.get())->data_column());
+    const auto& max_data = GetContainer<LT>::get_data(down_cast<const NullableColumn*>(max_col.get())->data_column());
+    return max_data[0] < filter->min_value(nullptr) || filter->max_value(nullptr) < min_data[0];
+}
+
+bool OrcRowReaderFilter::filterRuntimeFilter(size_t rowGroupIdx,
+                                             const std::unordered_map<uint64_t, orc::proto::RowIndex>& rowIndexes) {
+    for (const auto& [filter_id, rf_desc] : _scanner_ctx.runtime_filter_collector->descriptors()) {
+        const RuntimeFilter* rf = rf_desc->runtime_filter(-1);
+        SlotId slot_id;
+        if (rf == nullptr || rf->has_null() || rf->get_min_max_filter() == nullptr ||
+            !rf_desc->is_probe_slot_ref(&slot_id)) {
+            continue;
+        }
+        SlotDescriptor* slot = nullptr;
+        for (const auto& col : _scanner_ctx.materialized_columns) {
+            if (col.slot_desc->id() == slot_id) {
+                slot = col.slot_desc;
+                break;
+            }
+        }
+        const orc::Type* orc_type = slot == nullptr ? nullptr : _reader->get_orc_type_by_slot_id(slot_id);
+        if (orc_type == nullptr) {
+            continue;
+        }
+        const auto& row_idx_iter = rowIndexes.find(orc_type->getColumnId());
+        if (row_idx_iter == rowIndexes.end()) {
+            continue;
+        }
+
+        const orc::proto::ColumnStatistics& stats = row_idx_iter->second.entry(rowGroupIdx).statistics();
+        ColumnPtr min_col = ColumnHelper::create_column(slot->type(), true);
+        ColumnPtr max_col = ColumnHelper::create_column(slot->type(), true);
+        int64_t tz_offset_in_seconds = _reader->tzoffset_in_seconds() - _writer_tzoffset_in_seconds;
+        Status st = OrcMinMaxDecoder::decode(slot, orc_type, stats, min_col, max_col, tz_offset_in_seconds);
+        if (!st.ok() || min_col->size() != 1 || min_col->is_null(0) || max_col->is_null(0)) {
+            continue;
+        }
+
+        bool filtered = false;
+        switch (slot->type().type) {
+#define M(LT)                                                                  \
+    case LT:                                                                   \
+        filtered = is_out_of_runtime_filter_range<LT>(rf, min_col, max_col); \
+        break;
+            M(TYPE_TINYINT)
+            M(TYPE_SMALLINT)
+            M(TYPE_INT)
+            M(TYPE_BIGINT)
+            M(TYPE_DATE)
+            M(TYPE_DATETIME)
+            M(TYPE_DECIMAL32)
+            M(TYPE_DECIMAL64)
+            M(TYPE_DECIMAL128)
+#undef M
+        default:
+            break;
+        }
+        if (filtered) {
+            VLOG_FILE << "OrcRowReaderFilter: skip row group " << rowGroupIdx << ", stripe " << _current_stripe_index
+                      << " by runtime filter " << filter_id;
+            return true;
+        }
+    }
+    return false;
+}
+
 bool OrcRowReaderFilter::filterOnPickRowGroup(size_t rowGroupIdx,
                                               const std::unordered_map<uint64_t, orc::proto::RowIndex>& rowIndexes,
                                               const std::map<uint32_t, orc::BloomFilterIndex>& bloomFilters) {
@@ -193,6 +276,9 @@ bool OrcRowReaderFilter::filterOnPickRowGroup(size_t rowGroupIdx,
             return true;
         }
     }
+    if (_scanner_ctx.runtime_filter_collector != nullptr && filterRuntimeFilter(rowGroupIdx, rowIndexes)) {
+        return true;
+    }
     return false;
 }
 
@@ -332,7 +418,7 @@ Status HdfsOrcScanner::build_iceberg_delete_builder() {
             const auto s = strings::Substitute("Unsupported iceberg file content: $0 in the scanner thread",
                                                delete_file->file_content);
             LOG(WARNING) << s;
-            return Status::InternalError(s);
+            return Status::NotSupported(s);
         }
     }
 
@@ -38,7 +38,7 @@ Status HdfsParquetScanner::do_init(RuntimeState* runtime_state, const HdfsScanne
                 const auto s = strings::Substitute("Unsupported iceberg file content: $0 in the scanner thread",
                                                    delete_file->file_content);
                 LOG(WARNING) << s;
-                return Status::InternalError(s);
+                return Status::NotSupported(s);
             }
         }
         _app_stats.iceberg_delete_files_per_scan += scanner_params.deletes.size();
@@ -16,6 +16,7 @@
 
 #include <storage/chunk_helper.h>
 
+#include "cache/object_cache/page_cache.h"
 #include "column/vectorized_fwd.h"
 #include "exec/iceberg/iceberg_delete_file_iterator.h"
 #include "formats/orc/orc_chunk_reader.h"
@@ -74,7 +75,86 @@ Status IcebergDeleteBuilder::fill_skip_rowids(const ChunkPtr& chunk) const {
     return Status::OK();
 }
 
+Status IcebergDeleteBuilder::fill_delete_index(const ChunkPtr& chunk, IcebergPositionDeleteIndex* index) {
+    const ColumnPtr& file_path = chunk->get_column_by_slot_id(k_delete_file_path.id);
+    const ColumnPtr& pos = chunk->get_column_by_slot_id(k_delete_file_pos.id);
+    // position delete files are sorted by file path, so the bitmap of the previous row is usually reused.
+    Slice last_path;
+    DeletionBitmap* bitmap = nullptr;
+    for (int i = 0; i < chunk->num_rows(); i++) {
+        Slice path = file_path->get(i).get_slice();
+        if (bitmap == nullptr || path != last_path) {
+            auto& entry = (*index)[path.to_string()];
+            if (entry == nullptr) {
+                entry = std::make_shared<DeletionBitmap>(roaring64_bitmap_create());
+            }
+            bitmap = entry.get();
+            last_path = path;
+        }
+        bitmap->add_value(pos->get(i).get_int64());
+    }
+    return Status::OK();
+}
+
+bool IcebergDeleteBuilder::use_delete_file_cache() const {
+    return config::iceberg_delete_file_cache_enable && _params.use_file_metacache &&
+           DataCache::GetInstance()->page_cache() != nullptr;
+}
+
+std::string IcebergDeleteBuilder::delete_file_cache_key(const TIcebergDeleteFile& delete_file) {
+    // delete files are immutable, the path and length identify the content.
+    return fmt::format("iceberg_pos_delete:{}:{}", delete_file.full_path, delete_file.length);
+}
+
+bool IcebergDeleteBuilder::lookup_delete_index(const TIcebergDeleteFile& delete_file) const {
+    if (!use_delete_file_cache()) {
+        return false;
+    }
+    PageCacheHandle cache_handle;
+    if (!DataCache::GetInstance()->page_cache()->lookup(delete_file_cache_key(delete_file), &cache_handle)) {
+        return false;
+    }
+    const auto& index = *(reinterpret_cast<const IcebergPositionDeleteIndexPtr*>(cache_handle.data()));
+    apply_delete_index(*index);
+    RuntimeProfile* parent_profile = _params.profile->runtime_profile;
+    ADD_COUNTER(parent_profile, "ICEBERG_V2_MOR", TUnit::NONE);
+    RuntimeProfile::Counter* cache_hit_counter =
+            ADD_CHILD_COUNTER(parent_profile, "MOR_DeleteFileCacheHitCount", TUnit::UNIT, "ICEBERG_V2_MOR");
+    COUNTER_UPDATE(cache_hit_counter, 1);
+    return true;
+}
+
+void IcebergDeleteBuilder::cache_delete_index(const TIcebergDeleteFile& delete_file,
+                                              const IcebergPositionDeleteIndexPtr& index) const {
+    size_t charge = sizeof(IcebergPositionDeleteIndex);
+    for (const auto& [path, bitmap] : *index) {
+        charge += path.size() + sizeof(DeletionBitmap) + bitmap->size_in_bytes();
+    }
+    auto deleter = [](const starrocks::CacheKey& key, void* value) { delete (IcebergPositionDeleteIndexPtr*)value; };
+    ObjectCacheWriteOptions options;
+    options.evict_probability = _params.datacache_options.datacache_evict_probability;
+    auto capture = std::make_unique<IcebergPositionDeleteIndexPtr>(index);
+    PageCacheHandle cache_handle;
+    Status st = DataCache::GetInstance()->page_cache()->insert(delete_file_cache_key(delete_file),
+                                                               (void*)(capture.get()), charge, deleter, options,
+                                                               &cache_handle);
+    if (st.ok()) {
+        capture.release();
+    }
+}
+
+void IcebergDeleteBuilder::apply_delete_index(const IcebergPositionDeleteIndex& index) const {
+    auto iter = index.find(_params.path);
+    if (iter != index.end()) {
+        _deletion_bitmap->merge(*iter->second);
+    }
+    _skip_rows_ctx->deletion_bitmap = _deletion_bitmap;
+}
+
 Status IcebergDeleteBuilder::build_parquet(const TIcebergDeleteFile& delete_file) const {
+    if (lookup_delete_index(delete_file)) {
+        return Status::OK();
+    }
     HdfsScanStats app_scan_stats;
     HdfsScanStats fs_scan_stats;
     std::shared_ptr<io::SharedBufferedInputStream> shared_buffered_input_stream = nullptr;
@@ -137,6 +217,7 @@ Status IcebergDeleteBuilder::build_parquet(const TIcebergDeleteFile& delete_file
     scanner_ctx->stats = &app_scan_stats;
     RETURN_IF_ERROR(reader->init(scanner_ctx.get()));
 
+    auto index = use_delete_file_cache() ? std::make_shared<IcebergPositionDeleteIndex>() : nullptr;
     while (true) {
         ChunkPtr chunk = ChunkHelper::new_chunk(slot_descriptors, _runtime_state->chunk_size());
         Status status = reader->get_next(&chunk);
@@ -145,7 +226,11 @@ Status IcebergDeleteBuilder::build_parquet(const TIcebergDeleteFile& delete_file
         }
 
         RETURN_IF_ERROR(status);
-        RETURN_IF_ERROR(fill_skip_rowids(chunk));
+        RETURN_IF_ERROR(index != nullptr ? fill_delete_index(chunk, index.get()) : fill_skip_rowids(chunk));
+    }
+    if (index != nullptr) {
+        apply_delete_index(*index);
+        cache_delete_index(delete_file, index);
     }
     _skip_rows_ctx->deletion_bitmap = _deletion_bitmap;
     update_delete_file_io_counter(_params.profile->runtime_profile, app_scan_stats, fs_scan_stats, cache_input_stream,
@@ -154,6 +239,9 @@ Status IcebergDeleteBuilder::build_parquet(const TIcebergDeleteFile& delete_file
 }
 
 Status IcebergDeleteBuilder::build_orc(const TIcebergDeleteFile& delete_file) const {
+    if (lookup_delete_index(delete_file)) {
+        return Status::OK();
+    }
     std::vector slot_descriptors{&(IcebergDeleteFileMeta::get_delete_file_path_slot()),
                                  &(IcebergDeleteFileMeta::get_delete_file_pos_slot())};
 
@@ -185,6 +273,7 @@ Status IcebergDeleteBuilder::build_orc(const TIcebergDeleteFile& delete_file) co
 
     orc::RowReader::ReadPosition position;
     Status s;
+    auto index = use_delete_file_cache() ? std::make_shared<IcebergPositionDeleteIndex>() : nullptr;
 
     while (true) {
         s = orc_reader->read_next(&position);
@@ -198,7 +287,12 @@ Status IcebergDeleteBuilder::build_orc(const TIcebergDeleteFile& delete_file) co
         if (!ret.ok()) {
             return ret.status();
         }
-        RETURN_IF_ERROR(fill_skip_rowids(ret.value()));
+        RETURN_IF_ERROR(index != nullptr ? fill_delete_index(ret.value(), index.get())
+                                         : fill_skip_rowids(ret.value()));
+    }
+    if (index != nullptr) {
+        apply_delete_index(*index);
+        cache_delete_index(delete_file, index);
     }
     _skip_rows_ctx->deletion_bitmap = _deletion_bitmap;
     update_delete_file_io_counter(_params.profile->runtime_profile, app_scan_stats, fs_scan_stats, cache_input_stream,
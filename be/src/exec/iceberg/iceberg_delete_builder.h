@@ -14,6 +14,9 @@
 
 #pragma once
 
+#include <string>
+#include <unordered_map>
+
 #include "common/status.h"
 #include "exec/hdfs_scanner.h"
 #include "runtime/descriptors.h"
@@ -21,6 +24,10 @@
 namespace starrocks {
 struct IcebergColumnMeta;
 
+// The positions deleted by a position delete file, grouped by the path of the data file they belong to.
+using IcebergPositionDeleteIndex = std::unordered_map<std::string, DeletionBitmapPtr>;
+using IcebergPositionDeleteIndexPtr = std::shared_ptr<IcebergPositionDeleteIndex>;
+
 class IcebergDeleteBuilder {
 public:
     IcebergDeleteBuilder(SkipRowsContextPtr skip_rows_ctx, RuntimeState* state, const HdfsScannerParams& scanner_params)
@@ -46,6 +53,14 @@ private:
             const std::shared_ptr<io::CacheInputStream>& cache_input_stream,
             const std::shared_ptr<io::SharedBufferedInputStream>& shared_buffered_input_stream);
     Status fill_skip_rowids(const ChunkPtr& chunk) const;
+    static Status fill_delete_index(const ChunkPtr& chunk, IcebergPositionDeleteIndex* index);
+
+    // The parsed delete files are shared through the page cache across scan ranges and queries.
+    bool use_delete_file_cache() const;
+    static std::string delete_file_cache_key(const TIcebergDeleteFile& delete_file);
+    bool lookup_delete_index(const TIcebergDeleteFile& delete_file) const;
+    void cache_delete_index(const TIcebergDeleteFile& delete_file, const IcebergPositionDeleteIndexPtr& index) const;
+    void apply_delete_index(const IcebergPositionDeleteIndex& index) const;
 
     SkipRowsContextPtr _skip_rows_ctx;
     const HdfsScannerParams& _params;
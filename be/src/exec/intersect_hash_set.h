@@ -75,9 +75,12 @@ public:
     int64_t mem_usage() const;
 
 private:
-    void _serialize_columns(const ChunkPtr& chunkPtr, const std::vector<ExprContext*>& exprs, size_t chunk_size);
+    // Evaluate the key exprs once, both the serialize size and the serialization are computed from the result.
+    Columns _evaluate_key_columns(const ChunkPtr& chunkPtr, const std::vector<ExprContext*>& exprs);
 
-    size_t _get_max_serialize_size(const ChunkPtr& chunkPtr, const std::vector<ExprContext*>& exprs);
+    void _serialize_columns(const Columns& key_columns, size_t chunk_size);
+
+    size_t _get_max_serialize_size(const Columns& key_columns);
 
     std::unique_ptr<HashSet> _hash_set;
 
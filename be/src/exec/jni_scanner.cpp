@@ -23,6 +23,7 @@
 #include "fmt/core.h"
 #include "udf/java/java_udf.h"
 #include "util/defer_op.h"
+#include "util/raw_container.h"
 
 namespace starrocks {
 
@@ -172,8 +173,9 @@ Status JniScanner::_append_string_data(const FillColumnArgs& args) {
     Offsets& offsets = runtime_column->get_offset();
 
     int total_length = offset_ptr[args.num_rows];
-    bytes.resize(total_length);
-    offsets.resize(args.num_rows + 1);
+    // both are overwritten by the off-heap data right away, skip zero-filling them.
+    raw::stl_vector_resize_uninitialized(&bytes, total_length);
+    raw::stl_vector_resize_uninitialized(&offsets, args.num_rows + 1);
 
     memcpy(offsets.data(), offset_ptr, (args.num_rows + 1) * sizeof(uint32_t));
     memcpy(bytes.data(), column_ptr, total_length);
@@ -287,7 +289,7 @@ Status JniScanner::_fill_column(FillColumnArgs* pargs) {
         auto* nullable_column = down_cast<NullableColumn*>(args.column);
 
         NullData& null_data = nullable_column->null_column_data();
-        null_data.resize(args.num_rows);
+        raw::stl_vector_resize_uninitialized(&null_data, args.num_rows);
         memcpy(null_data.data(), null_column_ptr, args.num_rows);
         nullable_column->update_has_null();
 
@@ -229,9 +229,8 @@ void SerializedJoinProbeFunc::_probe_column(const JoinHashTableItems& table_item
 
     probe_state->null_array = nullptr;
 
-    for (uint32_t i = 0; i < row_count; i++) {
-        probe_state->next[i] = table_items.first[probe_state->buckets[i]];
-    }
+    JoinHashMapHelper::lookup_first(table_items, probe_state->buckets.data(), nullptr, probe_state->next.data(),
+                                    row_count);
 }
 
 void SerializedJoinProbeFunc::_probe_nullable_column(const JoinHashTableItems& table_items,
@@ -260,11 +259,13 @@ void SerializedJoinProbeFunc::_probe_nullable_column(const JoinHashTableItems& t
         if (probe_state->is_nulls[i] == 0) {
             probe_state->buckets[i] = JoinHashMapHelper::calc_bucket_num<Slice>(
                     probe_state->probe_slice[i], table_items.bucket_size, table_items.log_bucket_size);
-            probe_state->next[i] = table_items.first[probe_state->buckets[i]];
         } else {
-            probe_state->next[i] = 0;
+            probe_state->buckets[i] = 0;
         }
     }
+
+    JoinHashMapHelper::lookup_first(table_items, probe_state->buckets.data(), probe_state->is_nulls.data(),
+                                    probe_state->next.data(), row_count);
 }
 
 template <LogicalType LT, class BuildFunc, class ProbeFunc>
@@ -228,6 +228,8 @@ struct HashTableProbeState {
     };
     uint32_t match_count = 0;
     int active_coroutines = 0;
+    // whether the probe loops prefetch the build keys ahead, see JoinHashMapHelper::prefetch_build_key
+    bool prefetch_build_keys = false;
     // used to adaptively detect time locality
     size_t probe_chunks = 0;
     uint32_t detect_step = 1;
@@ -375,6 +377,54 @@ public:
         }
     }
 
+    // How many probe rows ahead the memory of the hash table is prefetched.
+    static constexpr uint32_t PROBE_PREFETCH_DISTANCE = 16;
+
+    // nexts[i] = first[buckets[i]], rows with is_nulls[i] != 0 get 0.
+    // When the hash table doesn't fit in cache, the loads of `first` are issued a window of rows ahead,
+    // so the cache misses of the window overlap instead of stalling one by one.
+    static void lookup_first(const JoinHashTableItems& table_items, const uint32_t* buckets, const uint8_t* is_nulls,
+                             uint32_t* nexts, uint32_t row_count) {
+        const uint32_t* firsts = table_items.first.data();
+        if (!table_items.ht_cache_miss_serious()) {
+            for (uint32_t i = 0; i < row_count; i++) {
+                nexts[i] = (is_nulls == nullptr || is_nulls[i] == 0) ? firsts[buckets[i]] : 0;
+            }
+            return;
+        }
+
+        const uint32_t prefetch_end = row_count > PROBE_PREFETCH_DISTANCE ? row_count - PROBE_PREFETCH_DISTANCE : 0;
+        for (uint32_t i = 0; i < std::min(row_count, PROBE_PREFETCH_DISTANCE); i++) {
+            __builtin_prefetch(firsts + buckets[i]);
+        }
+        for (uint32_t i = 0; i < row_count; i++) {
+            if (i < prefetch_end) {
+                __builtin_prefetch(firsts + buckets[i + PROBE_PREFETCH_DISTANCE]);
+            }
+            nexts[i] = (is_nulls == nullptr || is_nulls[i] == 0) ? firsts[buckets[i]] : 0;
+        }
+    }
+
+    // Called by the probe loop at `row`: prefetch the build key and the chain link that the probe row
+    // PROBE_PREFETCH_DISTANCE rows ahead is going to compare first, so they arrive while the rows in between
+    // are probed. For slice keys the Slice is prefetched two windows ahead and its bytes one window ahead,
+    // after the Slice itself has arrived.
+    template <typename CppType>
+    static void prefetch_build_key(const JoinHashTableItems& table_items, const Buffer<CppType>& build_data,
+                                   const uint32_t* nexts, size_t row, size_t row_count) {
+        constexpr size_t distance =
+                std::is_same_v<CppType, Slice> ? 2 * PROBE_PREFETCH_DISTANCE : PROBE_PREFETCH_DISTANCE;
+        if (row + distance < row_count && nexts[row + distance] != 0) {
+            __builtin_prefetch(&build_data[nexts[row + distance]]);
+            __builtin_prefetch(table_items.next.data() + nexts[row + distance]);
+        }
+        if constexpr (std::is_same_v<CppType, Slice>) {
+            if (row + PROBE_PREFETCH_DISTANCE < row_count && nexts[row + PROBE_PREFETCH_DISTANCE] != 0) {
+                __builtin_prefetch(build_data[nexts[row + PROBE_PREFETCH_DISTANCE]].data);
+            }
+        }
+    }
+
     static Slice get_hash_key(const Columns& key_columns, size_t row_idx, uint8_t* buffer) {
         size_t byte_size = 0;
         for (const auto& key_column : key_columns) {
@@ -726,6 +776,13 @@ private:
     template <bool first_probe>
     void _probe_coroutine(RuntimeState* state, const Buffer<CppType>& build_data, const Buffer<CppType>& probe_data);
 
+    void _prefetch_build_key(const Buffer<CppType>& build_data, size_t row) {
+        if (_probe_state->prefetch_build_keys) {
+            JoinHashMapHelper::prefetch_build_key<CppType>(*_table_items, build_data, _probe_state->next.data(), row,
+                                                           _probe_state->probe_row_count);
+        }
+    }
+
     // for one key left outer join
     template <bool first_probe>
     void _probe_from_ht_for_left_outer_join(RuntimeState* state, const Buffer<CppType>& build_data,
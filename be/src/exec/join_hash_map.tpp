@@ -365,9 +365,8 @@ void FixedSizeJoinProbeFunc<LT>::_probe_column(const JoinHashTableItems& table_i
     JoinHashMapHelper::calc_bucket_nums<CppType>(data, table_items.bucket_size, table_items.log_bucket_size,
                                                  &probe_state->buckets, 0, row_count);
     probe_state->null_array = nullptr;
-    for (uint32_t i = 0; i < row_count; i++) {
-        probe_state->next[i] = table_items.first[probe_state->buckets[i]];
-    }
+    JoinHashMapHelper::lookup_first(table_items, probe_state->buckets.data(), nullptr, probe_state->next.data(),
+                                    row_count);
 }
 
 template <LogicalType LT>
@@ -392,13 +391,8 @@ void FixedSizeJoinProbeFunc<LT>::_probe_nullable_column(const JoinHashTableItems
     JoinHashMapHelper::calc_bucket_nums<CppType>(data, table_items.bucket_size, table_items.log_bucket_size,
                                                  &probe_state->buckets, 0, row_count);
 
-    for (uint32_t i = 0; i < row_count; i++) {
-        if (probe_state->is_nulls[i] == 0) {
-            probe_state->next[i] = table_items.first[probe_state->buckets[i]];
-        } else {
-            probe_state->next[i] = 0;
-        }
-    }
+    JoinHashMapHelper::lookup_first(table_items, probe_state->buckets.data(), probe_state->is_nulls.data(),
+                                    probe_state->next.data(), row_count);
 }
 
 template <LogicalType LT, class BuildFunc, class ProbeFunc>
@@ -764,6 +758,8 @@ void JoinHashMap<LT, BuildFunc, ProbeFunc>::_search_ht(RuntimeState* state, Chun
         if (state->query_options().interleaving_group_size > 0 && !_table_items->ht_cache_miss_serious()) {
             _probe_state->active_coroutines = 0;
         }
+        _probe_state->prefetch_build_keys =
+                _table_items->ht_cache_miss_serious() && _probe_state->active_coroutines == 0;
         ProbeFunc().lookup_init(*_table_items, _probe_state);
 
         auto& build_data = BuildFunc().get_key_data(*_table_items);
@@ -1082,6 +1078,7 @@ void JoinHashMap<LT, BuildFunc, ProbeFunc>::_do_probe_from_ht(RuntimeState* stat
     uint32_t cur_row_match_count = _probe_state->cur_row_match_count;
 
     for (; i < probe_row_count; i++) {
+        _prefetch_build_key(build_data, i);
         uint32_t build_index = probe_buckets[i];
 
         if (build_index == 0) {
@@ -1238,6 +1235,7 @@ void JoinHashMap<LT, BuildFunc, ProbeFunc>::_probe_from_ht_for_left_outer_join(R
 
     size_t probe_row_count = _probe_state->probe_row_count;
     for (; i < probe_row_count; i++) {
+        _prefetch_build_key(build_data, i);
         size_t build_index = _probe_state->next[i];
         if (build_index == 0) {
             _probe_state->probe_index[match_count] = i;
@@ -1316,6 +1314,7 @@ void JoinHashMap<LT, BuildFunc, ProbeFunc>::_probe_from_ht_for_left_semi_join(Ru
     size_t match_count = 0;
     size_t probe_row_count = _probe_state->probe_row_count;
     for (size_t i = 0; i < probe_row_count; i++) {
+        _prefetch_build_key(build_data, i);
         size_t index = _probe_state->next[i];
         if (index == 0) {
             continue;
@@ -1346,6 +1345,7 @@ void JoinHashMap<LT, BuildFunc, ProbeFunc>::_probe_from_ht_for_left_anti_join(Ru
     if (_table_items->join_type == TJoinOp::NULL_AWARE_LEFT_ANTI_JOIN && _probe_state->null_array != nullptr) {
         // process left anti join from not in
         for (size_t i = 0; i < probe_row_count; i++) {
+            _prefetch_build_key(build_data, i);
             size_t index = _probe_state->next[i];
             if ((*_probe_state->null_array).at(i) == 1) {
                 continue;
@@ -1372,6 +1372,7 @@ void JoinHashMap<LT, BuildFunc, ProbeFunc>::_probe_from_ht_for_left_anti_join(Ru
         }
     } else {
         for (size_t i = 0; i < probe_row_count; i++) {
+            _prefetch_build_key(build_data, i);
             size_t index = _probe_state->next[i];
             if (index == 0) {
                 _probe_state->probe_index[match_count] = i;
@@ -1481,6 +1482,7 @@ void JoinHashMap<LT, BuildFunc, ProbeFunc>::_probe_from_ht_for_right_outer_join(
 
     size_t probe_row_count = _probe_state->probe_row_count;
     for (; i < probe_row_count; i++) {
+        _prefetch_build_key(build_data, i);
         size_t build_index = _probe_state->next[i];
         if (build_index == 0) {
             continue;
@@ -1550,6 +1552,7 @@ void JoinHashMap<LT, BuildFunc, ProbeFunc>::_probe_from_ht_for_right_semi_join(R
 
     size_t probe_row_count = _probe_state->probe_row_count;
     for (; i < probe_row_count; i++) {
+        _prefetch_build_key(build_data, i);
         size_t build_index = _probe_state->next[i];
         if (build_index == 0) {
             continue;
@@ -1611,6 +1614,7 @@ void JoinHashMap<LT, BuildFunc, ProbeFunc>::_probe_from_ht_for_right_anti_join(R
                                                                                const Buffer<CppType>& probe_data) {
     size_t probe_row_count = _probe_state->probe_row_count;
     for (size_t i = 0; i < probe_row_count; i++) {
+        _prefetch_build_key(build_data, i);
         size_t index = _probe_state->next[i];
         if (index == 0) {
             continue;
@@ -1669,6 +1673,7 @@ void JoinHashMap<LT, BuildFunc, ProbeFunc>::_probe_from_ht_for_full_outer_join(R
 
     size_t probe_row_count = _probe_state->probe_row_count;
     for (; i < probe_row_count; i++) {
+        _prefetch_build_key(build_data, i);
         size_t build_index = _probe_state->next[i];
         if (build_index == 0) {
             _probe_state->probe_index[match_count] = i;
@@ -1761,6 +1766,7 @@ void JoinHashMap<LT, BuildFunc, ProbeFunc>::_probe_from_ht_for_left_semi_join_wi
 
     size_t probe_row_count = _probe_state->probe_row_count;
     for (; i < probe_row_count; i++) {
+        _prefetch_build_key(build_data, i);
         size_t build_index = _probe_state->next[i];
         if (build_index == 0) {
             continue;
@@ -1836,6 +1842,7 @@ void JoinHashMap<LT, BuildFunc, ProbeFunc>::_probe_from_ht_for_null_aware_anti_j
 
     size_t probe_row_count = _probe_state->probe_row_count;
     for (; i < probe_row_count; i++) {
+        _prefetch_build_key(build_data, i);
         size_t build_index = _probe_state->next[i];
         if (_probe_state->null_array != nullptr && (*_probe_state->null_array).at(i) == 1) {
             // when left table col value is null needs match all rows in right table
@@ -1893,6 +1900,7 @@ void JoinHashMap<LT, BuildFunc, ProbeFunc>::
 
     size_t probe_row_count = _probe_state->probe_row_count;
     for (; i < probe_row_count; i++) {
+        _prefetch_build_key(build_data, i);
         size_t build_index = _probe_state->next[i];
         if (build_index == 0) {
             continue;
@@ -1937,6 +1945,7 @@ void JoinHashMap<LT, BuildFunc, ProbeFunc>::_probe_from_ht_for_left_outer_left_a
 
     size_t probe_row_count = _probe_state->probe_row_count;
     for (; i < probe_row_count; i++) {
+        _prefetch_build_key(build_data, i);
         size_t build_index = _probe_state->next[i];
         if (build_index == 0) {
             _probe_state->probe_index[match_count] = i;
@@ -329,6 +329,7 @@ JsonReader::JsonReader(starrocks::RuntimeState* state, starrocks::ScannerCounter
           _op_col_index(-1),
           _range_desc(range_desc) {
     int index = 0;
+    _slot_column_indexes.assign(_slot_descs.size(), -1);
     for (size_t i = 0; i < _slot_descs.size(); ++i) {
         const auto& desc = _slot_descs[i];
         if (desc == nullptr) {
@@ -337,6 +338,8 @@ JsonReader::JsonReader(starrocks::RuntimeState* state, starrocks::ScannerCounter
         if (UNLIKELY(desc->col_name() == "__op")) {
             _op_col_index = index;
         }
+        // The source chunk appends one column for each non-null slot, in slot order.
+        _slot_column_indexes[i] = index;
         index++;
         _slot_desc_dict.emplace(desc->col_name(), desc);
         _type_desc_dict.emplace(desc->col_name(), _type_descs[i]);
@@ -344,6 +347,14 @@ JsonReader::JsonReader(starrocks::RuntimeState* state, starrocks::ScannerCounter
 }
 
 Status JsonReader::open() {
+    // The json paths are the same for all the rows of the load, resolve whether each of them refers to
+    // the whole object once here instead of comparing the path for every row.
+    _whole_row_paths.assign(_scanner->_json_paths.size(), false);
+    for (size_t i = 0; i < _scanner->_json_paths.size(); i++) {
+        const auto& path = _scanner->_json_paths[i];
+        _whole_row_paths[i] = path.size() == 1 && path[0].key == "$";
+    }
+
     Status st = _read_and_parse_json();
     if (!st.ok()) {
         _append_error_msg("", st.to_string());
@@ -629,12 +640,13 @@ Status JsonReader::_construct_row_with_jsonpath(simdjson::ondemand::object* row,
         if (_slot_descs[i] == nullptr) {
             continue;
         }
-        const char* column_name = _slot_descs[i]->col_name().c_str();
+        const int column_index = _slot_column_indexes[i];
+        const bool is_op_column = column_index == _op_col_index;
 
         // The columns in JsonReader's chunk are all in NullableColumn type;
-        auto column = down_cast<NullableColumn*>(chunk->get_column_by_slot_id(_slot_descs[i]->id()).get());
+        auto column = down_cast<NullableColumn*>(chunk->get_column_by_index(column_index).get());
         if (i >= jsonpath_size) {
-            if (strcmp(column_name, "__op") == 0) {
+            if (is_op_column) {
                 // special treatment for __op column, fill default value '0' rather than null
                 if (column->is_binary()) {
                     Slice s{"0"};
@@ -653,7 +665,7 @@ Status JsonReader::_construct_row_with_jsonpath(simdjson::ondemand::object* row,
         // simdjson's api is limited, which coult not convert ondemand::object to ondemand::value.
         // As a workaround, extract procedure is duplicated, for both ondemand::object and ondemand::value
         // TODO(mofei) make it more elegant
-        if (_scanner->_json_paths[i].size() == 1 && _scanner->_json_paths[i][0].key == "$") {
+        if (_whole_row_paths[i]) {
             // add_nullable_column may invoke a for-range iterating to the row.
             // If the for-range iterating is invoked after field access, or a second for-range iterating is invoked,
             // it would get an error "Objects and arrays can only be iterated when they are first encountered",
@@ -667,7 +679,7 @@ Status JsonReader::_construct_row_with_jsonpath(simdjson::ondemand::object* row,
             if (st.ok()) {
                 RETURN_IF_ERROR(_construct_column(val, column, _slot_descs[i]->type(), _slot_descs[i]->col_name()));
             } else if (st.is_not_found()) {
-                if (strcmp(column_name, "__op") == 0) {
+                if (is_op_column) {
                     // special treatment for __op column, fill default value '0' rather than null
                     if (column->is_binary()) {
                         Slice s{"0"};
@@ -161,6 +161,10 @@ private:
     std::vector<uint8_t> _parsed_columns;
     // record the "__op" column's index
     int _op_col_index;
+    // chunk column index of each slot in _slot_descs, -1 for the null slots
+    std::vector<int> _slot_column_indexes;
+    // whether the json path of each slot is "$", which extracts the whole json object
+    std::vector<uint8_t> _whole_row_paths;
 
     ByteBufferPtr _file_stream_buffer;
 
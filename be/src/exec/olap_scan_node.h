@@ -85,6 +85,7 @@ public:
     const TOlapScanNode& thrift_olap_scan_node() const { return _olap_scan_node; }
 
     int estimated_max_concurrent_chunks() const;
+    size_t estimated_scan_row_bytes() const { return _estimated_scan_row_bytes; }
 
     static StatusOr<TabletSharedPtr> get_tablet(const TInternalScanRange* scan_range);
     static StatusOr<std::vector<RowsetSharedPtr>> capture_tablet_rowsets(const TabletSharedPtr& tablet,
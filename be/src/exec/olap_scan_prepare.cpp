@@ -820,6 +820,12 @@ Status ChunkPredicateBuilder<E, Type>::normalize_join_runtime_filter(const SlotD
                         *range, rf, _opts.obj_pool, nullptr);
             }
         }
+
+        // TopN runtime filter keeps tightening while the heap is being built, so it's also handed to the
+        // runtime range pruner to re-prune the segments and pages by zone map once a newer version arrives.
+        if (desc->is_stream_build_filter()) {
+            rt_ranger_params.add_unarrived_rf(desc, &slot, _opts.driver_sequence);
+        }
     }
 
     return Status::OK();
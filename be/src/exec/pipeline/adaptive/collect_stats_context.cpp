@@ -35,12 +35,22 @@ bool BlockState::need_input(int32_t driver_seq) const {
 
 Status BlockState::push_chunk(int32_t driver_seq, ChunkPtr chunk) {
     size_t num_chunk_rows = chunk->num_rows();
+    size_t num_chunk_bytes = _max_block_bytes_per_driver_seq > 0 ? chunk->bytes_usage() : 0;
     _ctx->_buffer_chunk_queue(driver_seq).emplace(std::move(chunk));
     size_t prev_num_rows = _num_rows.fetch_add(num_chunk_rows);
+    size_t prev_num_bytes = _num_bytes.fetch_add(num_chunk_bytes);
 
-    // It receives _max_buffer_rows rows after this push_chunk, so transform to PASSTHROUGH state.
+    // It receives _max_buffer_rows rows or _max_buffer_bytes bytes after this push_chunk, so transform to PASSTHROUGH
+    // state. Both thresholds can be reached by the concurrent drivers, and only the first one transforms.
+    const char* reason = nullptr;
     if (prev_num_rows < _max_buffer_rows && prev_num_rows + num_chunk_rows >= _max_buffer_rows) {
-        _ctx->_transform_state(CollectStatsStateEnum::PASSTHROUGH, _ctx->_upstream_dop);
+        reason = "PassthroughByRows";
+    } else if (_max_buffer_bytes > 0 && prev_num_bytes < _max_buffer_bytes &&
+               prev_num_bytes + num_chunk_bytes >= _max_buffer_bytes) {
+        reason = "PassthroughByBytes";
+    }
+    if (reason != nullptr && !_passthrough.exchange(true)) {
+        _ctx->_transform_state(CollectStatsStateEnum::PASSTHROUGH, _ctx->_upstream_dop, reason);
     }
     return Status::OK();
 }
@@ -61,12 +71,21 @@ Status BlockState::set_finishing(int32_t driver_seq) {
 
     size_t num_partial_rows = _ctx->_max_block_rows_per_driver_seq;
     size_t adjusted_dop = _num_rows / num_partial_rows;
+    std::string reason = "RoundRobinByRows";
+    if (_max_block_bytes_per_driver_seq > 0) {
+        // Few but wide rows still need enough drivers to process them.
+        size_t dop_by_bytes = _num_bytes / _max_block_bytes_per_driver_seq;
+        if (dop_by_bytes > adjusted_dop) {
+            adjusted_dop = dop_by_bytes;
+            reason = "RoundRobinByBytes";
+        }
+    }
 
     adjusted_dop = compute_max_le_power2(adjusted_dop);
     adjusted_dop = std::max<size_t>(1, adjusted_dop);
     adjusted_dop = std::min<size_t>(adjusted_dop, _ctx->_upstream_dop);
 
-    _ctx->_transform_state(CollectStatsStateEnum::ROUND_ROBIN, adjusted_dop);
+    _ctx->_transform_state(CollectStatsStateEnum::ROUND_ROBIN, adjusted_dop, std::move(reason));
 
     return Status::OK();
 }
@@ -295,9 +314,11 @@ CollectStatsStateRawPtr CollectStatsContext::_state_ref() const {
 void CollectStatsContext::_set_state(CollectStatsStateEnum state_enum) {
     _state = _get_state(state_enum);
 }
-void CollectStatsContext::_transform_state(CollectStatsStateEnum state_enum, size_t downstream_dop) {
+void CollectStatsContext::_transform_state(CollectStatsStateEnum state_enum, size_t downstream_dop,
+                                           std::string reason) {
     auto* next_state = _get_state(state_enum);
     _downstream_dop = downstream_dop;
+    _dop_reason = std::move(reason);
     _state = next_state;
 
     _blocking_event->finish(_runtime_state);
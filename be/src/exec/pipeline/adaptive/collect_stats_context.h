@@ -15,6 +15,7 @@
 #pragma once
 
 #include "column/vectorized_fwd.h"
+#include "common/config.h"
 #include "exec/pipeline/adaptive/adaptive_fwd.h"
 #include "exec/pipeline/context_with_dependency.h"
 #include "storage/chunk_helper.h"
@@ -44,12 +45,14 @@ enum class CollectStatsStateEnum { BLOCK = 0, PASSTHROUGH, ROUND_ROBIN };
 /// CsSink starts from BlockState and transforms to PassthroughState or RoundRobinState conditionally.
 /// - BlockState blocks the input data and doesn't push it to NextOp.
 /// - PassthroughState is transformed to,
-///   when BlockState receives max_block_rows_per_driver_seq*DOP rows and SourceOp hasn't been not EOS.
+///   when BlockState receives max_block_rows_per_driver_seq*DOP rows (or
+///   pipeline_adaptive_dop_max_block_bytes_per_driver_seq*DOP bytes) and SourceOp hasn't been not EOS.
 ///   - It doesn't adjust DOP of pipeline#2,
 ///   - and passes chunks from the i-th pipeline#1 driver to the i-th pipeline#2 driver.
 /// - RoundRobinState is transformed to,
 ///   when SourceOp has been EOS before BlockState receives max_block_rows_per_driver_seq*DOP rows.
 ///   - It adjust DOP of pipeline#2 to compute_max_le_power2(num_rows/max_block_rows_per_driver_seq),
+///     or to compute_max_le_power2(num_bytes/pipeline_adaptive_dop_max_block_bytes_per_driver_seq) if it is larger,
 ///   - and passes chunks from the i-th pipeline#1 driver to the j-th pipeline#2 driver, where j=i%new_dop.
 class CollectStatsContext final : public ContextWithDependency {
 public:
@@ -74,6 +77,9 @@ public:
     size_t upstream_dop() const { return _upstream_dop; }
     size_t downstream_dop() const { return _downstream_dop; }
     void set_downstream_dop(size_t downstream_dop) { _downstream_dop = downstream_dop; }
+    // The reason of the decided downstream DOP, which is shown in the profile.
+    const std::string& dop_reason() const { return _dop_reason; }
+    void set_dop_reason(std::string reason) { _dop_reason = std::move(reason); }
     void incr_sinker() { ++_upstream_dop; }
 
     const int64_t max_output_amplification_factor() const { return _max_output_amplification_factor; }
@@ -86,7 +92,7 @@ private:
     CollectStatsStateRawPtr _get_state(CollectStatsStateEnum state) const;
     CollectStatsStateRawPtr _state_ref() const;
     void _set_state(CollectStatsStateEnum state_enum);
-    void _transform_state(CollectStatsStateEnum state_enum, size_t downstream_dop);
+    void _transform_state(CollectStatsStateEnum state_enum, size_t downstream_dop, std::string reason);
     BufferChunkQueue& _buffer_chunk_queue(int32_t driver_seq);
 
 private:
@@ -102,6 +108,7 @@ private:
     const size_t _max_dop;
     size_t _upstream_dop = 0;
     size_t _downstream_dop = 0;
+    std::string _dop_reason;
 
     const size_t _max_block_rows_per_driver_seq;
     const int64_t _max_output_amplification_factor;
@@ -138,7 +145,10 @@ protected:
 class BlockState final : public CollectStatsState {
 public:
     BlockState(CollectStatsContext* const ctx)
-            : CollectStatsState(ctx), _max_buffer_rows(ctx->_max_block_rows_per_driver_seq * ctx->_max_dop) {}
+            : CollectStatsState(ctx),
+              _max_buffer_rows(ctx->_max_block_rows_per_driver_seq * ctx->_max_dop),
+              _max_block_bytes_per_driver_seq(config::pipeline_adaptive_dop_max_block_bytes_per_driver_seq),
+              _max_buffer_bytes(_max_block_bytes_per_driver_seq * ctx->_max_dop) {}
     ~BlockState() override = default;
 
     std::string name() const override;
@@ -155,7 +165,12 @@ public:
 private:
     std::atomic<int> _num_finished_seqs = 0;
     std::atomic<size_t> _num_rows = 0;
+    std::atomic<size_t> _num_bytes = 0;
+    std::atomic<bool> _passthrough = false;
     const size_t _max_buffer_rows;
+    // 0 means the buffered bytes are not considered.
+    const int64_t _max_block_bytes_per_driver_seq;
+    const int64_t _max_buffer_bytes;
 };
 
 class PassthroughState final : public CollectStatsState {
@@ -30,6 +30,9 @@ void CollectStatsSourceOperator::close(RuntimeState* state) {
     Operator::close(state);
 
     _unique_metrics->add_info_string("State", _ctx->readable_state());
+    _unique_metrics->add_info_string("UpstreamDop", std::to_string(_ctx->upstream_dop()));
+    _unique_metrics->add_info_string("DownstreamDop", std::to_string(_ctx->downstream_dop()));
+    _unique_metrics->add_info_string("DopReason", _ctx->dop_reason());
 }
 
 bool CollectStatsSourceOperator::need_input() const {
@@ -109,6 +112,11 @@ void CollectStatsSourceOperatorFactory::adjust_dop() {
     if (_degree_of_parallelism == upstream_dop) {
         return;
     }
+    DeferOp reason_defer([this, downstream_dop] {
+        if (_degree_of_parallelism > downstream_dop) {
+            _ctx->set_dop_reason(_ctx->dop_reason() + ",IncreasedByDependentPipelines");
+        }
+    });
 
     // 2. DOP should be >= max_dependent_dop.
     size_t max_dependent_dop = 1;
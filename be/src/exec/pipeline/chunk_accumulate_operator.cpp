@@ -14,6 +14,7 @@
 
 #include "exec/pipeline/chunk_accumulate_operator.h"
 
+#include "common/config.h"
 #include "runtime/runtime_state.h"
 
 namespace starrocks::pipeline {
@@ -21,6 +22,11 @@ namespace starrocks::pipeline {
 Status ChunkAccumulateOperator::prepare(RuntimeState* state) {
     RETURN_IF_ERROR(Operator::prepare(state));
     _acc.set_max_size(state->chunk_size());
+    if (config::adaptive_chunk_cache_budget_bytes > 0) {
+        _acc.set_bytes_budget(config::adaptive_chunk_cache_budget_bytes);
+    }
+    _coalesced_chunks_counter = ADD_COUNTER(_unique_metrics, "CoalescedChunks", TUnit::UNIT);
+    _budget_limited_chunks_counter = ADD_COUNTER(_unique_metrics, "BudgetLimitedChunks", TUnit::UNIT);
     return Status::OK();
 }
 
@@ -38,6 +44,12 @@ Status ChunkAccumulateOperator::set_finishing(RuntimeState* state) {
     return Status::OK();
 }
 
+void ChunkAccumulateOperator::close(RuntimeState* state) {
+    COUNTER_SET(_coalesced_chunks_counter, static_cast<int64_t>(_acc.num_coalesced_chunks()));
+    COUNTER_SET(_budget_limited_chunks_counter, static_cast<int64_t>(_acc.num_budget_limited_chunks()));
+    Operator::close(state);
+}
+
 Status ChunkAccumulateOperator::set_finished(RuntimeState*) {
     _acc.reset();
     _acc.finalize();
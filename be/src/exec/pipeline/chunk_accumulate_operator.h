@@ -31,6 +31,7 @@ public:
 
     ~ChunkAccumulateOperator() override = default;
     Status prepare(RuntimeState* state) override;
+    void close(RuntimeState* state) override;
 
     Status push_chunk(RuntimeState* state, const ChunkPtr& chunk) override;
     StatusOr<ChunkPtr> pull_chunk(RuntimeState* state) override;
@@ -49,6 +50,8 @@ public:
 
 private:
     ChunkPipelineAccumulator _acc;
+    RuntimeProfile::Counter* _coalesced_chunks_counter = nullptr;
+    RuntimeProfile::Counter* _budget_limited_chunks_counter = nullptr;
 };
 
 class ChunkAccumulateOperatorFactory final : public OperatorFactory {
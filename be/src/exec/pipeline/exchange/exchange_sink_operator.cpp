@@ -590,22 +590,10 @@ Status ExchangeSinkOperator::push_chunk(RuntimeState* state, const ChunkPtr& chu
             }
 
             // Compute row indexes for each channel's each shuffle
-            _channel_row_idx_start_points.assign(_num_shuffles + 1, 0);
+            _channel_row_idx_start_points.resize(_num_shuffles + 1);
             _shuffler->exchange_shuffle(_shuffle_channel_ids, _hash_values, num_rows);
-
-            for (size_t i = 0; i < num_rows; ++i) {
-                _channel_row_idx_start_points[_shuffle_channel_ids[i]]++;
-            }
-            // NOTE:
-            // we make the last item equal with number of rows of this chunk
-            for (int32_t i = 1; i <= _num_shuffles; ++i) {
-                _channel_row_idx_start_points[i] += _channel_row_idx_start_points[i - 1];
-            }
-
-            for (int32_t i = num_rows - 1; i >= 0; --i) {
-                _row_indexes[_channel_row_idx_start_points[_shuffle_channel_ids[i]] - 1] = i;
-                _channel_row_idx_start_points[_shuffle_channel_ids[i]]--;
-            }
+            Shuffler::partition_row_indexes(_shuffle_channel_ids.data(), num_rows, _num_shuffles,
+                                            _channel_row_idx_start_points.data(), _row_indexes.data());
         }
 
         for (int32_t channel_id : _channel_indices) {
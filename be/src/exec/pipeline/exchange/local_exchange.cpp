@@ -34,21 +34,14 @@ Status Partitioner::partition_chunk(const ChunkPtr& chunk, int32_t num_partition
 
     // step2: shuffle chunk into dest partitions.
     {
-        _partition_row_indexes_start_points.assign(num_partitions + 1, 0);
+        _partition_row_indexes_start_points.resize(num_partitions + 1);
+        Shuffler::partition_row_indexes(_shuffle_channel_id.data(), num_rows, num_partitions,
+                                        _partition_row_indexes_start_points.data(), partition_row_indexes.data());
+
         _partition_memory_usage.assign(num_partitions, 0);
         for (size_t i = 0; i < num_rows; ++i) {
-            _partition_row_indexes_start_points[_shuffle_channel_id[i]]++;
             _partition_memory_usage[_shuffle_channel_id[i]] += chunk->bytes_usage(i, 1);
         }
-        // We make the last item equal with number of rows of this chunk.
-        for (int32_t i = 1; i <= num_partitions; ++i) {
-            _partition_row_indexes_start_points[i] += _partition_row_indexes_start_points[i - 1];
-        }
-
-        for (int32_t i = num_rows - 1; i >= 0; --i) {
-            partition_row_indexes[_partition_row_indexes_start_points[_shuffle_channel_id[i]] - 1] = i;
-            _partition_row_indexes_start_points[_shuffle_channel_id[i]]--;
-        }
     }
     return Status::OK();
 }
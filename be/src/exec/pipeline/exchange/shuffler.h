@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstdint>
 #include <vector>
 
@@ -59,6 +60,27 @@ public:
         (this->*_local_exchange_shuffle)(shuffle_channel_ids, hash_values, num_rows);
     }
 
+    // Counting sort of row indexes by shuffle id. After return, the rows of shuffle `i` are
+    // row_indexes[start_points[i], start_points[i + 1]), kept in their original order.
+    // `start_points` must hold num_shuffles + 1 entries and `row_indexes` at least num_rows entries.
+    template <typename OffsetType>
+    static void partition_row_indexes(const uint32_t* shuffle_ids, size_t num_rows, size_t num_shuffles,
+                                      OffsetType* start_points, uint32_t* row_indexes) {
+        std::fill(start_points, start_points + num_shuffles + 1, 0);
+        for (size_t i = 0; i < num_rows; ++i) {
+            start_points[shuffle_ids[i]]++;
+        }
+        // NOTE: the last item equals the number of rows
+        for (size_t i = 1; i <= num_shuffles; ++i) {
+            start_points[i] += start_points[i - 1];
+        }
+        // Scatter backwards so that each end point is decremented to the start point of its shuffle.
+        for (size_t i = num_rows; i > 0; --i) {
+            uint32_t shuffle_id = shuffle_ids[i - 1];
+            row_indexes[--start_points[shuffle_id]] = i - 1;
+        }
+    }
+
 private:
     void (Shuffler::*_exchange_shuffle)(std::vector<uint32_t>& shuffle_channel_ids,
                                         const std::vector<uint32_t>& hash_values, size_t num_rows) = nullptr;
@@ -155,6 +155,7 @@ void SinkBuffer::update_profile(RuntimeProfile* profile) {
     auto* rpc_count = ADD_COUNTER(profile, "RpcCount", TUnit::UNIT);
     auto* rpc_avg_timer = ADD_TIMER(profile, "RpcAvgTime");
     auto* network_timer = ADD_TIMER(profile, "NetworkTime");
+    auto* max_rpc_network_timer = ADD_TIMER(profile, "MaxRpcNetworkTime");
     auto* wait_timer = ADD_TIMER(profile, "WaitTime");
     auto* overall_timer = ADD_TIMER(profile, "OverallTime");
 
@@ -162,6 +163,7 @@ void SinkBuffer::update_profile(RuntimeProfile* profile) {
     COUNTER_SET(rpc_avg_timer, _rpc_cumulative_time / std::max(_rpc_count.load(), static_cast<int64_t>(1)));
 
     COUNTER_SET(network_timer, _network_time());
+    COUNTER_SET(max_rpc_network_timer, _max_rpc_network_time());
     COUNTER_SET(overall_timer, _last_receive_time - _first_send_time);
 
     // WaitTime consists two parts
@@ -209,6 +211,14 @@ int64_t SinkBuffer::_network_time() {
     return max;
 }
 
+int64_t SinkBuffer::_max_rpc_network_time() {
+    int64_t max = 0;
+    for (auto& [_, context] : _sink_ctxs) {
+        max = std::max(max, context->network_time.max_time);
+    }
+    return max;
+}
+
 void SinkBuffer::cancel_one_sinker(RuntimeState* const state) {
     auto notify = this->defer_notify();
     if (--_num_uncancelled_sinkers == 0) {
@@ -67,15 +67,19 @@ struct TransmitChunkInfo {
 // So we can get the average time of each direction by
 // `average_concurrency = accumulated_concurrency / times`
 // `average_time = accumulated_time / average_concurrency`
+// max_time keeps the slowest single sample, which exposes a slow receiver
+// that the averaged time hides.
 struct TimeTrace {
     int32_t times = 0;
     int64_t accumulated_time = 0;
     int32_t accumulated_concurrency = 0;
+    int64_t max_time = 0;
 
     void update(int64_t time, int32_t concurrency) {
         times++;
         accumulated_time += time;
         accumulated_concurrency += concurrency;
+        max_time = std::max(max_time, time);
     }
 };
 
@@ -136,6 +140,8 @@ private:
     // `accumulated_network_time / average_concurrency`
     // And we just pick the maximum accumulated_network_time among all destination
     int64_t _network_time();
+    // The network time of the slowest single rpc among all destinations
+    int64_t _max_rpc_network_time();
 
     FragmentContext* _fragment_ctx;
     MemTracker* const _mem_tracker;
@@ -169,6 +169,18 @@ void FragmentContext::report_exec_state_if_necessary() {
         normalized_report_ns = last_report_ns + interval_ns;
     }
     if (_last_report_exec_state_ns.compare_exchange_strong(last_report_ns, normalized_report_ns)) {
+        if (config::skip_unchanged_runtime_profile_report) {
+            // No driver has moved any chunk since the last report, so the profile is mostly unchanged.
+            int64_t effective_times = 0;
+            iterate_pipeline([&effective_times](const Pipeline* pipeline) {
+                for (const auto& driver : pipeline->drivers()) {
+                    effective_times += driver->driver_acct().get_schedule_effective_times();
+                }
+            });
+            if (_last_report_schedule_effective_times.exchange(effective_times) == effective_times) {
+                return;
+            }
+        }
         iterate_pipeline([](const Pipeline* pipeline) {
             for (const auto& driver : pipeline->drivers()) {
                 driver->runtime_report_action();
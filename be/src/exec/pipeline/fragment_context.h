@@ -250,6 +250,8 @@ private:
     size_t _expired_log_count = 0;
 
     std::atomic<int64_t> _last_report_exec_state_ns = MonotonicNanos();
+    // Total effective schedule times of all the drivers at the last periodic report, -1 if not reported yet.
+    std::atomic<int64_t> _last_report_schedule_effective_times = -1;
 
     RuntimeProfile::Counter* _jit_counter = nullptr;
     RuntimeProfile::Counter* _jit_timer = nullptr;
@@ -14,6 +14,7 @@
 
 #include "exec/pipeline/group_execution/execution_group.h"
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "exec/pipeline/pipeline_driver_executor.h"
 #include "exec/pipeline/pipeline_fwd.h"
@@ -105,11 +106,15 @@ Status ColocateExecutionGroup::prepare_drivers(RuntimeState* state) {
 
 void ColocateExecutionGroup::submit_active_drivers() {
     VLOG_QUERY << "submit_active_drivers:" << to_string();
+    size_t max_active_buckets = _physical_dop;
+    if (config::pipeline_colocate_group_max_active_buckets > 0) {
+        max_active_buckets = std::min<size_t>(max_active_buckets, config::pipeline_colocate_group_max_active_buckets);
+    }
     for (size_t i = 0; i < _pipelines.size(); ++i) {
         const auto& pipeline = _pipelines[i];
         DCHECK_EQ(pipeline->drivers().size(), pipeline->degree_of_parallelism());
         const auto& drivers = pipeline->drivers();
-        size_t init_submit_drivers = std::min(_physical_dop, drivers.size());
+        size_t init_submit_drivers = std::min(max_active_buckets, drivers.size());
         _submit_drivers[i] = init_submit_drivers;
         for (size_t i = 0; i < init_submit_drivers; ++i) {
             VLOG_QUERY << "submit_active_driver:" << i << ":" << drivers[i]->to_readable_string();
@@ -18,6 +18,7 @@
 #include <memory>
 #include <utility>
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "exec/exec_node.h"
 #include "exec/pipeline/query_context.h"
@@ -27,6 +28,7 @@
 #include "runtime/mem_tracker.h"
 #include "runtime/runtime_filter_cache.h"
 #include "runtime/runtime_state.h"
+#include "simd/simd.h"
 #include "util/failpoint/fail_point.h"
 #include "util/runtime_profile.h"
 
@@ -85,6 +87,11 @@ Status Operator::prepare(RuntimeState* state) {
     _pull_chunk_num_counter = ADD_COUNTER(_common_metrics, "PullChunkNum", TUnit::UNIT);
     _pull_row_num_counter = ADD_COUNTER(_common_metrics, "PullRowNum", TUnit::UNIT);
     _pull_chunk_bytes_counter = ADD_COUNTER(_common_metrics, "OutputChunkBytes", TUnit::UNIT);
+    if (config::pipeline_perf_event_sample_interval > 0) {
+        for (int i = 0; i < PerfEventCounters::NUM_EVENTS; ++i) {
+            _perf_event_counters[i] = ADD_COUNTER(_common_metrics, PerfEventCounters::kEventNames[i], TUnit::UNIT);
+        }
+    }
     if (state->query_ctx() && state->query_ctx()->spill_manager()) {
         _mem_resource_manager.prepare(this, state->query_ctx()->spill_manager());
     }
@@ -194,7 +201,8 @@ Status Operator::eval_conjuncts_and_in_filters(const std::vector<ExprContext*>&
         _conjuncts_input_counter->update(before);
         RETURN_IF_ERROR(
                 starrocks::ExecNode::eval_conjuncts(_cached_conjuncts_and_in_filters, chunk, filter, apply_filter));
-        auto after = chunk->num_rows();
+        auto after = (apply_filter || filter == nullptr || *filter == nullptr) ? chunk->num_rows()
+                                                                              : SIMD::count_nonzero(**filter);
         _conjuncts_output_counter->update(after);
     }
 
@@ -24,6 +24,7 @@
 #include "exprs/runtime_filter_bank.h"
 #include "gutil/strings/substitute.h"
 #include "runtime/mem_tracker.h"
+#include "util/perf_event_counters.h"
 #include "util/runtime_profile.h"
 
 namespace starrocks {
@@ -325,6 +326,9 @@ protected:
     RuntimeProfile::Counter* _conjuncts_timer = nullptr;
     RuntimeProfile::Counter* _conjuncts_input_counter = nullptr;
     RuntimeProfile::Counter* _conjuncts_output_counter = nullptr;
+    // Hardware counters of pull_chunk and push_chunk sampled by PipelineDriver,
+    // only created if config::pipeline_perf_event_sample_interval > 0.
+    RuntimeProfile::Counter* _perf_event_counters[PerfEventCounters::NUM_EVENTS] = {};
 
     // only used in spillable operator to record peak revocable memory bytes,
     // each operator should initialize it before use
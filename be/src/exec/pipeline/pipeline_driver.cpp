@@ -31,6 +31,7 @@
 #include "exec/query_cache/lane_arbiter.h"
 #include "exec/query_cache/multilane_operator.h"
 #include "exec/query_cache/ticket_checker.h"
+#include "exec/spill/memory_arbitrator.h"
 #include "exec/workgroup/work_group.h"
 #include "gen_cpp/InternalService_types.h"
 #include "gutil/casts.h"
@@ -114,6 +115,12 @@ Status PipelineDriver::prepare(RuntimeState* runtime_state) {
     _peak_driver_queue_size_counter = _runtime_profile->AddHighWaterMarkCounter(
             "PeakDriverQueueSize", TUnit::UNIT, RuntimeProfile::Counter::create_strategy(TUnit::UNIT));
 
+    if (config::pipeline_column_buffer_cache_bytes > 0) {
+        _column_buffer_recycler = std::make_unique<ColumnBufferRecycler>(config::pipeline_column_buffer_cache_bytes);
+        _column_buffer_reused_counter = ADD_COUNTER(_runtime_profile, "ColumnBufferReusedCount", TUnit::UNIT);
+        _peak_column_buffer_cache_bytes = ADD_COUNTER(_runtime_profile, "PeakColumnBufferCacheBytes", TUnit::BYTES);
+    }
+
     DCHECK(_state == DriverState::NOT_READY);
 
     auto* source_op = source_operator();
@@ -248,6 +255,7 @@ StatusOr<DriverState> PipelineDriver::process(RuntimeState* runtime_state, int w
     SCOPED_TIMER(_active_timer);
     QUERY_TRACE_SCOPED("process", _driver_name);
     set_driver_state(DriverState::RUNNING);
+    ThreadLocalColumnBufferRecyclerSetter column_buffer_recycler_setter(_column_buffer_recycler.get());
     size_t total_chunks_moved = 0;
     size_t total_rows_moved = 0;
     int64_t time_spent = 0;
@@ -264,6 +272,14 @@ StatusOr<DriverState> PipelineDriver::process(RuntimeState* runtime_state, int w
         scan->begin_driver_process();
     }
 
+    // Sample the hardware counters of the operators in one of every perf_event_sample_interval executions,
+    // the sampled values are scaled by the interval as an estimation of the total.
+    const int64_t perf_event_sample_interval = config::pipeline_perf_event_sample_interval;
+    const PerfEventCounters* perf_event_counters = nullptr;
+    if (perf_event_sample_interval > 0 && _schedule_counter->value() % perf_event_sample_interval == 0) {
+        perf_event_counters = PerfEventCounters::thread_local_instance();
+    }
+
     while (true) {
         RETURN_IF_LIMIT_EXCEEDED(runtime_state, "Pipeline");
 
@@ -322,6 +338,8 @@ StatusOr<DriverState> PipelineDriver::process(RuntimeState* runtime_state, int w
                 StatusOr<ChunkPtr> maybe_chunk;
                 {
                     SCOPED_TIMER(curr_op->_pull_timer);
+                    SCOPED_PERF_EVENT_COUNTERS(perf_event_counters, curr_op->_perf_event_counters,
+                                               perf_event_sample_interval);
                     QUERY_TRACE_SCOPED(curr_op->get_name(), "pull_chunk");
                     maybe_chunk = curr_op->pull_chunk(runtime_state);
                 }
@@ -370,6 +388,8 @@ StatusOr<DriverState> PipelineDriver::process(RuntimeState* runtime_state, int w
                             QUERY_TRACE_SCOPED(next_op->get_name(), "push_chunk");
                             _adjust_memory_usage(runtime_state, query_mem_tracker.get(), next_op, maybe_chunk.value());
                             RELEASE_RESERVED_GUARD();
+                            SCOPED_PERF_EVENT_COUNTERS(perf_event_counters, next_op->_perf_event_counters,
+                                                       perf_event_sample_interval);
                             return_status = next_op->push_chunk(runtime_state, maybe_chunk.value());
                         }
                         // ignore empty chunk generated by per-tablet computation when query cache enabled
@@ -623,6 +643,13 @@ void PipelineDriver::_adjust_memory_usage(RuntimeState* state, MemTracker* track
         return;
     }
 
+    // spill before the queries exceeding the limit are cancelled if the query pool is short of memory
+    mem_resource_mgr.update_revocable_bytes(op->revocable_mem_bytes());
+    spill::MemoryArbitrator::instance()->maybe_arbitrate();
+    if (op->revocable_mem_bytes() > state->spill_operator_min_bytes() && mem_resource_mgr.try_revoke_by_arbitrator()) {
+        return;
+    }
+
     // try to release buffer if memusage > mid level threhold
     _try_to_release_buffer(state, op);
 
@@ -706,6 +733,12 @@ void PipelineDriver::finalize(RuntimeState* runtime_state, DriverState state) {
     DCHECK(state == DriverState::FINISH || state == DriverState::CANCELED || state == DriverState::INTERNAL_ERROR);
     QUERY_TRACE_BEGIN("finalize", _driver_name);
     _close_operators(runtime_state);
+    if (_column_buffer_recycler != nullptr) {
+        COUNTER_SET(_column_buffer_reused_counter, static_cast<int64_t>(_column_buffer_recycler->num_reused()));
+        COUNTER_SET(_peak_column_buffer_cache_bytes,
+                    static_cast<int64_t>(_column_buffer_recycler->peak_cached_bytes()));
+        _column_buffer_recycler->release();
+    }
 
     set_driver_state(state);
 
@@ -36,6 +36,7 @@
 #include "exprs/runtime_filter_bank.h"
 #include "fmt/printf.h"
 #include "runtime/mem_tracker.h"
+#include "runtime/memory/column_allocator.h"
 #include "util/phmap/phmap.h"
 
 namespace starrocks {
@@ -599,6 +600,9 @@ protected:
 
     std::unique_ptr<PipelineTimerTask> _global_rf_timer;
 
+    // Column buffers freed while this driver is running, reused by its following chunks.
+    std::unique_ptr<ColumnBufferRecycler> _column_buffer_recycler;
+
     // metrics
     RuntimeProfile::Counter* _total_timer = nullptr;
     RuntimeProfile::Counter* _active_timer = nullptr;
@@ -631,6 +635,8 @@ protected:
     MonotonicStopWatch* _pending_finish_timer_sw = nullptr;
 
     RuntimeProfile::HighWaterMarkCounter* _peak_driver_queue_size_counter = nullptr;
+    RuntimeProfile::Counter* _column_buffer_reused_counter = nullptr;
+    RuntimeProfile::Counter* _peak_column_buffer_cache_bytes = nullptr;
 };
 
 } // namespace pipeline
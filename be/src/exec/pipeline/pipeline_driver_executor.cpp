@@ -37,10 +37,7 @@ GlobalDriverExecutor::GlobalDriverExecutor(const std::string& name, std::unique_
                                            bool enable_resource_group, const CpuUtil::CpuIds& cpuids,
                                            PipelineExecutorMetrics* metrics)
         : Base("pip_exec_" + name),
-          _driver_queue(enable_resource_group
-                                ? std::unique_ptr<DriverQueue>(
-                                          std::make_unique<WorkGroupDriverQueue>(metrics->get_driver_queue_metrics()))
-                                : std::make_unique<QuerySharedDriverQueue>(metrics->get_driver_queue_metrics())),
+          _driver_queue(_create_driver_queue(enable_resource_group, metrics->get_driver_queue_metrics())),
           _thread_pool(std::move(thread_pool)),
           _blocked_driver_poller(
                   new PipelineDriverPoller(name, _driver_queue.get(), cpuids, metrics->get_poller_metrics())),
@@ -48,6 +45,19 @@ GlobalDriverExecutor::GlobalDriverExecutor(const std::string& name, std::unique_
           _audit_statistics_reporter(new AuditStatisticsReporter()),
           _metrics(metrics->get_driver_executor_metrics()) {}
 
+DriverQueuePtr GlobalDriverExecutor::_create_driver_queue(bool enable_resource_group, DriverQueueMetrics* metrics) {
+    DriverQueuePtr queue;
+    if (enable_resource_group) {
+        queue = std::make_unique<WorkGroupDriverQueue>(metrics);
+    } else {
+        queue = std::make_unique<QuerySharedDriverQueue>(metrics);
+    }
+    if (config::pipeline_enable_driver_work_stealing) {
+        queue = std::make_unique<WorkStealingDriverQueue>(metrics, std::move(queue));
+    }
+    return queue;
+}
+
 void GlobalDriverExecutor::close() {
     _driver_queue->close();
     _thread_pool->wait();
@@ -83,6 +93,8 @@ void GlobalDriverExecutor::_worker_thread() {
     auto current_thread = Thread::current_thread();
     const int worker_id = _next_id++;
     std::queue<DriverRawPtr> local_driver_queue;
+    _driver_queue->attach_worker();
+    DeferOp detach_worker([this]() { _driver_queue->detach_worker(); });
     while (true) {
         if (local_driver_queue.empty() && _num_threads_setter.should_shrink()) {
             break;
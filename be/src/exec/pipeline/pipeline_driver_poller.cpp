@@ -16,6 +16,7 @@
 
 #include <chrono>
 
+#include "common/config.h"
 #include "exec/pipeline/pipeline_fwd.h"
 #include "exec/pipeline/pipeline_metrics.h"
 #include "runtime/exec_env.h"
@@ -182,7 +183,16 @@ void PipelineDriverPoller::run_internal() {
         }
         if (spin_count == 640) {
             spin_count = 0;
-            sched_yield();
+            // None of the blocked drivers has become ready for a long time, give up the core for a while instead
+            // of re-checking them in a tight loop. A newly added blocked driver still wakes up the poller at once.
+            if (const int64_t idle_wait_us = config::pipeline_poller_idle_wait_us; idle_wait_us > 0) {
+                std::unique_lock<std::mutex> lock(_global_mutex);
+                if (_blocked_drivers.empty() && !_is_shutdown.load(std::memory_order_acquire)) {
+                    _cond.wait_for(lock, std::chrono::microseconds(idle_wait_us));
+                }
+            } else {
+                sched_yield();
+            }
         }
     }
 }
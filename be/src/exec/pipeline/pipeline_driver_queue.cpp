@@ -14,10 +14,13 @@
 
 #include "exec/pipeline/pipeline_driver_queue.h"
 
+#include <algorithm>
+
 #include "exec/pipeline/pipeline_metrics.h"
 #include "exec/pipeline/source_operator.h"
 #include "exec/workgroup/work_group.h"
 #include "gutil/strings/substitute.h"
+#include "util/defer_op.h"
 
 namespace starrocks::pipeline {
 
@@ -428,4 +431,201 @@ int64_t WorkGroupDriverQueue::_ideal_runtime_ns(workgroup::WorkGroupDriverSchedE
     return SCHEDULE_PERIOD_PER_WG_NS * _wg_entities.size() * wg_entity->cpu_weight() / _sum_cpu_weight;
 }
 
+/// WorkStealingDriverQueue.
+thread_local WorkStealingDriverQueue* WorkStealingDriverQueue::_tls_owner = nullptr;
+thread_local WorkStealingDriverQueue::LocalQueue* WorkStealingDriverQueue::_tls_local_queue = nullptr;
+
+void WorkStealingDriverQueue::close() {
+    _is_closed = true;
+    _global_queue->close();
+}
+
+void WorkStealingDriverQueue::put_back(const DriverRawPtr driver) {
+    _global_queue->put_back(driver);
+}
+
+void WorkStealingDriverQueue::put_back(const std::vector<DriverRawPtr>& drivers) {
+    _global_queue->put_back(drivers);
+}
+
+void WorkStealingDriverQueue::put_back_from_executor(const DriverRawPtr driver) {
+    auto* local_queue = _current_local_queue();
+    if (local_queue == nullptr || local_queue->num_drivers >= LOCAL_QUEUE_CAPACITY || _num_waiting_threads > 0 ||
+        !_could_run_locally(driver)) {
+        _global_queue->put_back_from_executor(driver);
+        return;
+    }
+
+    {
+        std::lock_guard<SpinLock> l(local_queue->lock);
+        local_queue->drivers.emplace_back(driver);
+        ++local_queue->num_drivers;
+    }
+    ++_num_local_drivers;
+    _metrics->driver_queue_len.increment(1);
+
+    // A thread may start waiting in the global queue after the above check and miss this driver,
+    // so move a driver to the global queue to wake it up.
+    if (_num_waiting_threads > 0) {
+        if (auto* moved_driver = _pop_local(local_queue, false); moved_driver != nullptr) {
+            _global_queue->put_back_from_executor(moved_driver);
+        }
+    }
+}
+
+StatusOr<DriverRawPtr> WorkStealingDriverQueue::take(const bool block) {
+    if (_is_closed) {
+        return Status::Cancelled("Shutdown");
+    }
+
+    auto* local_queue = _current_local_queue();
+    if (local_queue != nullptr) {
+        if (++local_queue->num_takes % GLOBAL_QUEUE_CHECK_INTERVAL == 0) {
+            ASSIGN_OR_RETURN(auto* driver, _global_queue->take(false));
+            if (driver != nullptr) {
+                return driver;
+            }
+        }
+        if (auto* driver = _pop_local(local_queue, true); driver != nullptr) {
+            _metrics->driver_queue_local_take_count.increment(1);
+            return driver;
+        }
+    }
+
+    ASSIGN_OR_RETURN(auto* driver, _global_queue->take(false));
+    if (driver != nullptr) {
+        return driver;
+    }
+    driver = _steal(local_queue);
+    if (driver != nullptr || !block) {
+        return driver;
+    }
+
+    ++_num_waiting_threads;
+    DeferOp defer([this]() { --_num_waiting_threads; });
+    // Check the local deques again, since the drivers may be put to them before _num_waiting_threads is increased.
+    driver = _steal(local_queue);
+    if (driver != nullptr) {
+        return driver;
+    }
+    return _global_queue->take(true);
+}
+
+void WorkStealingDriverQueue::cancel(DriverRawPtr driver) {
+    // The drivers in local deques are not in ready state, and the executor thread will check
+    // whether the fragment is cancelled after taking them.
+    _global_queue->cancel(driver);
+}
+
+void WorkStealingDriverQueue::update_statistics(const DriverRawPtr driver) {
+    _global_queue->update_statistics(driver);
+}
+
+size_t WorkStealingDriverQueue::size() const {
+    return _global_queue->size() + _num_local_drivers;
+}
+
+bool WorkStealingDriverQueue::should_yield(const DriverRawPtr driver, int64_t unaccounted_runtime_ns) const {
+    return _global_queue->should_yield(driver, unaccounted_runtime_ns);
+}
+
+void WorkStealingDriverQueue::attach_worker() {
+    DCHECK(_tls_owner == nullptr);
+    auto local_queue = std::make_unique<LocalQueue>();
+    _tls_owner = this;
+    _tls_local_queue = local_queue.get();
+
+    std::unique_lock<std::shared_mutex> l(_local_queues_mutex);
+    _local_queues.emplace_back(std::move(local_queue));
+}
+
+void WorkStealingDriverQueue::detach_worker() {
+    auto* local_queue = _current_local_queue();
+    if (local_queue == nullptr) {
+        return;
+    }
+    _tls_owner = nullptr;
+    _tls_local_queue = nullptr;
+
+    std::unique_ptr<LocalQueue> detached_queue;
+    {
+        std::unique_lock<std::shared_mutex> l(_local_queues_mutex);
+        auto it = std::find_if(_local_queues.begin(), _local_queues.end(),
+                               [local_queue](const auto& queue) { return queue.get() == local_queue; });
+        DCHECK(it != _local_queues.end());
+        detached_queue = std::move(*it);
+        _local_queues.erase(it);
+    }
+
+    // Nobody can steal from the detached queue anymore, hand over the remaining drivers to the global queue.
+    while (auto* driver = _pop_local(detached_queue.get(), true)) {
+        _global_queue->put_back_from_executor(driver);
+    }
+}
+
+WorkStealingDriverQueue::LocalQueue* WorkStealingDriverQueue::_current_local_queue() const {
+    return _tls_owner == this ? _tls_local_queue : nullptr;
+}
+
+bool WorkStealingDriverQueue::_could_run_locally(const DriverRawPtr driver) const {
+    // Keep the drivers beyond the first level in the global queue, so that they are still scheduled
+    // by the multi-level feedback queue.
+    if (driver->driver_acct().get_accumulated_time_spent() >= config::pipeline_driver_queue_level_time_slice_base_ns) {
+        return false;
+    }
+    return !_global_queue->should_yield(driver, 0);
+}
+
+DriverRawPtr WorkStealingDriverQueue::_pop_local(LocalQueue* local_queue, bool front) {
+    if (local_queue->num_drivers == 0) {
+        return nullptr;
+    }
+
+    if (!local_queue->lock.try_lock()) {
+        _metrics->driver_queue_local_lock_contention_count.increment(1);
+        local_queue->lock.lock();
+    }
+    std::lock_guard<SpinLock> l(local_queue->lock, std::adopt_lock);
+    if (local_queue->drivers.empty()) {
+        return nullptr;
+    }
+    DriverRawPtr driver;
+    if (front) {
+        driver = local_queue->drivers.front();
+        local_queue->drivers.pop_front();
+    } else {
+        driver = local_queue->drivers.back();
+        local_queue->drivers.pop_back();
+    }
+    --local_queue->num_drivers;
+    --_num_local_drivers;
+    _metrics->driver_queue_len.increment(-1);
+    return driver;
+}
+
+DriverRawPtr WorkStealingDriverQueue::_steal(const LocalQueue* self) {
+    if (_num_local_drivers == 0) {
+        return nullptr;
+    }
+
+    std::shared_lock<std::shared_mutex> l(_local_queues_mutex);
+    const size_t num_queues = _local_queues.size();
+    if (num_queues == 0) {
+        return nullptr;
+    }
+    // Start from a different victim for each steal, to spread the stealers.
+    const size_t start = _steal_cursor.fetch_add(1);
+    for (size_t i = 0; i < num_queues; ++i) {
+        auto* victim = _local_queues[(start + i) % num_queues].get();
+        if (victim == self) {
+            continue;
+        }
+        if (auto* driver = _pop_local(victim, false); driver != nullptr) {
+            _metrics->driver_queue_steal_count.increment(1);
+            return driver;
+        }
+    }
+    return nullptr;
+}
+
 } // namespace starrocks::pipeline
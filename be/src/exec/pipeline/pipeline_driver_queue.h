@@ -15,11 +15,13 @@
 #pragma once
 
 #include <queue>
+#include <shared_mutex>
 
 #include "exec/pipeline/pipeline_driver.h"
 #include "exec/workgroup/work_group_fwd.h"
 #include "util/factory_method.h"
 #include "util/moodycamel/concurrentqueue.h"
+#include "util/spinlock.h"
 
 namespace starrocks::pipeline {
 
@@ -50,6 +52,11 @@ public:
 
     virtual bool should_yield(const DriverRawPtr driver, int64_t unaccounted_runtime_ns) const = 0;
 
+    // The executor thread calls attach_worker() before taking any driver from the queue,
+    // and detach_worker() before it stops taking drivers.
+    virtual void attach_worker() {}
+    virtual void detach_worker() {}
+
     DriverQueueMetrics* _metrics;
 };
 
@@ -226,4 +233,83 @@ private:
     std::atomic_int32_t _local_queue_cntl{};
 };
 
+// WorkStealingDriverQueue puts a small local deque of each executor thread in front of a global driver queue
+// (QuerySharedDriverQueue or WorkGroupDriverQueue), so that the drivers yielded by an executor thread are mostly
+// taken again by the same thread without the global mutex.
+//
+// The scheduling semantics of the global queue are kept by only running a driver locally, when
+// - it is still in the first level of the multi-level feedback queue, that is, its accumulated time is less than
+//   the time slice of the first level, and
+// - the global queue doesn't ask it to yield, that is, its workgroup still has the minimum vruntime and
+//   doesn't exceed its CPU limit.
+// Otherwise, the driver is put back to the global queue. The runtime of the drivers is always accounted
+// by the global queue through update_statistics().
+//
+// An executor thread takes the driver from the following places in order:
+// 1. its local deque, except that the global queue is checked first every GLOBAL_QUEUE_CHECK_INTERVAL takes,
+//    to avoid starving the drivers in the global queue.
+// 2. the global queue without blocking.
+// 3. the local deques of the other executor threads, from the tail.
+// 4. the global queue with blocking.
+// The drivers are not put to local deques, while there is any thread waiting in step 4, so the waiting threads
+// won't miss them.
+class WorkStealingDriverQueue : public FactoryMethod<DriverQueue, WorkStealingDriverQueue> {
+    friend class FactoryMethod<DriverQueue, WorkStealingDriverQueue>;
+
+public:
+    WorkStealingDriverQueue(DriverQueueMetrics* metrics, DriverQueuePtr global_queue)
+            : FactoryMethod(metrics), _global_queue(std::move(global_queue)) {}
+    ~WorkStealingDriverQueue() override = default;
+    void close() override;
+
+    void put_back(const DriverRawPtr driver) override;
+    void put_back(const std::vector<DriverRawPtr>& drivers) override;
+    void put_back_from_executor(const DriverRawPtr driver) override;
+
+    StatusOr<DriverRawPtr> take(const bool block) override;
+
+    void cancel(DriverRawPtr driver) override;
+
+    void update_statistics(const DriverRawPtr driver) override;
+
+    size_t size() const override;
+
+    bool should_yield(const DriverRawPtr driver, int64_t unaccounted_runtime_ns) const override;
+
+    void attach_worker() override;
+    void detach_worker() override;
+
+    static constexpr size_t LOCAL_QUEUE_CAPACITY = 8;
+    static constexpr size_t GLOBAL_QUEUE_CHECK_INTERVAL = 16;
+
+private:
+    struct LocalQueue {
+        // Only the owner thread pushes drivers, both the owner thread and the stealers pop drivers.
+        SpinLock lock;
+        std::deque<DriverRawPtr> drivers;
+        std::atomic<size_t> num_drivers = 0;
+        // Only accessed by the owner thread.
+        size_t num_takes = 0;
+    };
+
+    LocalQueue* _current_local_queue() const;
+    bool _could_run_locally(const DriverRawPtr driver) const;
+    DriverRawPtr _pop_local(LocalQueue* local_queue, bool front);
+    DriverRawPtr _steal(const LocalQueue* self);
+
+    static thread_local WorkStealingDriverQueue* _tls_owner;
+    static thread_local LocalQueue* _tls_local_queue;
+
+    DriverQueuePtr _global_queue;
+
+    mutable std::shared_mutex _local_queues_mutex;
+    std::vector<std::unique_ptr<LocalQueue>> _local_queues;
+
+    std::atomic<size_t> _num_local_drivers = 0;
+    // The number of threads blocking in the global queue.
+    std::atomic<int32_t> _num_waiting_threads = 0;
+    std::atomic<size_t> _steal_cursor = 0;
+    std::atomic<bool> _is_closed = false;
+};
+
 } // namespace starrocks::pipeline
@@ -31,6 +31,9 @@ void DriverQueueMetrics::register_all_metrics(MetricRegistry* registry) {
 #define REGISTER_DRIVER_QUEUE_METRIC(name) registry->register_metric("pipe_" #name, &name)
 
     REGISTER_DRIVER_QUEUE_METRIC(driver_queue_len);
+    REGISTER_DRIVER_QUEUE_METRIC(driver_queue_local_take_count);
+    REGISTER_DRIVER_QUEUE_METRIC(driver_queue_steal_count);
+    REGISTER_DRIVER_QUEUE_METRIC(driver_queue_local_lock_contention_count);
 }
 
 void PollerMetrics::register_all_metrics(MetricRegistry* registry) {
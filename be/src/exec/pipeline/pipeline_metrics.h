@@ -31,6 +31,10 @@ struct ScanExecutorMetrics {
 
 struct DriverQueueMetrics {
     METRIC_DEFINE_INT_CORE_LOCAL_GAUGE(driver_queue_len, MetricUnit::NOUNIT);
+    // The counters of WorkStealingDriverQueue.
+    METRIC_DEFINE_INT_COUNTER(driver_queue_local_take_count, MetricUnit::NOUNIT);
+    METRIC_DEFINE_INT_COUNTER(driver_queue_steal_count, MetricUnit::NOUNIT);
+    METRIC_DEFINE_INT_COUNTER(driver_queue_local_lock_contention_count, MetricUnit::NOUNIT);
     void register_all_metrics(MetricRegistry* registry);
 };
 
@@ -19,6 +19,7 @@
 #include <memory>
 #include <mutex>
 
+#include "common/config.h"
 #include "common/statusor.h"
 #include "exec/olap_utils.h"
 #include "storage/chunk_helper.h"
@@ -321,10 +322,11 @@ void PhysicalSplitMorselQueue::set_key_ranges(TabletReaderParams::RangeStartOper
 
 StatusOr<RowidRangeOptionPtr> PhysicalSplitMorselQueue::_try_get_split_from_single_tablet() {
     size_t num_taken_rows = 0;
+    int64_t split_rows = _splitted_scan_rows;
     RowidRangeOptionPtr rowid_range = nullptr;
     auto has_taken_from_tablet = [&rowid_range]() { return rowid_range != nullptr; };
 
-    while (num_taken_rows < _splitted_scan_rows) {
+    while (num_taken_rows < split_rows) {
         if (_tablet_idx >= _tablets.size()) {
             return rowid_range;
         }
@@ -355,12 +357,16 @@ StatusOr<RowidRangeOptionPtr> PhysicalSplitMorselQueue::_try_get_split_from_sing
             rowid_range = std::make_shared<RowidRangeOption>();
         }
 
+        if (num_taken_rows == 0) {
+            split_rows = _guided_split_rows();
+        }
+
         SparseRange<> taken_range;
-        _segment_range_iter.next_range(_splitted_scan_rows, &taken_range);
+        _segment_range_iter.next_range(split_rows, &taken_range);
         _num_segment_rest_rows -= taken_range.span_size();
-        if (_num_segment_rest_rows < _splitted_scan_rows) {
+        if (_num_segment_rest_rows < split_rows) {
             // If there are too few rows left in the segment, take them all this time.
-            _segment_range_iter.next_range(_splitted_scan_rows, &taken_range);
+            _segment_range_iter.next_range(split_rows, &taken_range);
             _num_segment_rest_rows = 0;
         }
 
@@ -384,6 +390,15 @@ StatusOr<RowidRangeOptionPtr> PhysicalSplitMorselQueue::_try_get_split_from_sing
     return rowid_range;
 }
 
+int64_t PhysicalSplitMorselQueue::_guided_split_rows() const {
+    if (!config::tablet_internal_parallel_enable_guided_split || _degree_of_parallelism <= 1) {
+        return _splitted_scan_rows;
+    }
+    int64_t guided_rows = _num_segment_rest_rows / _degree_of_parallelism;
+    int64_t min_rows = std::min(config::tablet_internal_parallel_min_splitted_scan_rows, _splitted_scan_rows);
+    return std::max(min_rows, std::min(guided_rows, _splitted_scan_rows));
+}
+
 StatusOr<MorselPtr> PhysicalSplitMorselQueue::try_get() {
     std::lock_guard<std::mutex> lock(_mutex);
     if (_unget_morsel != nullptr) {
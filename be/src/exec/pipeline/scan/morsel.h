@@ -496,6 +496,9 @@ private:
     // Obtain row id ranges from multiple segments of multiple rowsets within a single tablet,
     // until _splitted_scan_rows rows are retrieved.
     StatusOr<RowidRangeOptionPtr> _try_get_split_from_single_tablet();
+    // The number of rows of the next split. It is _splitted_scan_rows, or fewer rows when guided split is enabled
+    // and the rest rows of the current segment can't keep all the drivers busy.
+    int64_t _guided_split_rows() const;
 
 private:
     std::mutex _mutex;
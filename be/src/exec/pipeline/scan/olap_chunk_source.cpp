@@ -137,8 +137,11 @@ void OlapChunkSource::_init_counter(RuntimeState* state) {
     _read_uncompressed_counter = ADD_COUNTER(_runtime_profile, "UncompressedBytesRead", TUnit::BYTES);
 
     _raw_rows_counter = ADD_COUNTER(_runtime_profile, "RawRowsRead", TUnit::UNIT);
+    _chunk_size_counter =
+            ADD_COUNTER_SKIP_MERGE(_runtime_profile, "ChunkSize", TUnit::UNIT, TCounterMergeType::SKIP_ALL);
     _read_pages_num_counter = ADD_COUNTER(_runtime_profile, "ReadPagesNum", TUnit::UNIT);
     _cached_pages_num_counter = ADD_COUNTER(_runtime_profile, "CachedPagesNum", TUnit::UNIT);
+    _compressed_cached_pages_num_counter = ADD_COUNTER(_runtime_profile, "CompressedCachedPagesNum", TUnit::UNIT);
     _pushdown_predicates_counter =
             ADD_COUNTER_SKIP_MERGE(_runtime_profile, "PushdownPredicates", TUnit::UNIT, TCounterMergeType::SKIP_ALL);
     _pushdown_access_paths_counter =
@@ -224,8 +227,11 @@ void OlapChunkSource::_decide_chunk_size(bool has_predicate) {
         // Improve for select * from table limit x, x is small
         _params.chunk_size = _limit;
     } else {
-        _params.chunk_size = _runtime_state->chunk_size();
+        // read fewer rows per chunk for wide rows to keep a chunk within the cache budget
+        _params.chunk_size =
+                ChunkHelper::adaptive_chunk_size(_runtime_state->chunk_size(), _scan_node->estimated_scan_row_bytes());
     }
+    COUNTER_SET(_chunk_size_counter, static_cast<int64_t>(_params.chunk_size));
 }
 
 Status OlapChunkSource::_init_reader_params(const std::vector<std::unique_ptr<OlapScanRange>>& key_ranges,
@@ -549,7 +555,7 @@ Status OlapChunkSource::_init_olap_reader(RuntimeState* runtime_state) {
 }
 
 Status OlapChunkSource::_read_chunk(RuntimeState* state, ChunkPtr* chunk) {
-    chunk->reset(ChunkHelper::new_chunk_pooled(_prj_iter->output_schema(), _runtime_state->chunk_size()));
+    chunk->reset(ChunkHelper::new_chunk_pooled(_prj_iter->output_schema(), _params.chunk_size));
     auto scope = IOProfiler::scope(IOProfiler::TAG_QUERY, _tablet->tablet_id());
     return _read_chunk_from_storage(_runtime_state, (*chunk).get());
 }
@@ -695,6 +701,7 @@ void OlapChunkSource::_update_counter() {
 
     COUNTER_UPDATE(_read_pages_num_counter, _reader->stats().total_pages_num);
     COUNTER_UPDATE(_cached_pages_num_counter, _reader->stats().cached_pages_num);
+    COUNTER_UPDATE(_compressed_cached_pages_num_counter, _reader->stats().compressed_cached_pages_num);
 
     COUNTER_UPDATE(_bi_filtered_counter, _reader->stats().rows_bitmap_index_filtered);
     COUNTER_UPDATE(_bi_filter_timer, _reader->stats().bitmap_index_filter_timer);
@@ -133,9 +133,15 @@ Status SchemaChunkSource::_read_chunk(RuntimeState* state, ChunkPtr* chunk) {
 
     bool scanner_eos = false;
     int32_t row_num = 0;
+    // The appended rows can only be counted from the columns, without any column every call counts as one row.
+    const bool count_by_columns = chunk_src->num_columns() > 0;
 
     while (!scanner_eos && chunk_dst->is_empty()) {
         while (row_num < state->chunk_size()) {
+            size_t prev_rows = chunk_src->num_rows();
+            if (count_by_columns) {
+                _schema_scanner->set_batch_size(state->chunk_size() - row_num);
+            }
             RETURN_IF_ERROR(_schema_scanner->get_next(&chunk_src, &scanner_eos));
             if (scanner_eos) {
                 if (row_num == 0) {
@@ -143,7 +149,7 @@ Status SchemaChunkSource::_read_chunk(RuntimeState* state, ChunkPtr* chunk) {
                 }
                 break;
             }
-            row_num++;
+            row_num += count_by_columns ? chunk_src->num_rows() - prev_rows : 1;
         }
 
         for (size_t i = 0; i < dest_slot_descs.size(); ++i) {
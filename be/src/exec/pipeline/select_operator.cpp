@@ -17,6 +17,7 @@
 #include "column/chunk.h"
 #include "exprs/expr.h"
 #include "runtime/runtime_state.h"
+#include "simd/simd.h"
 
 namespace starrocks::pipeline {
 Status SelectOperator::prepare(RuntimeState* state) {
@@ -25,6 +26,7 @@ Status SelectOperator::prepare(RuntimeState* state) {
 
 void SelectOperator::close(RuntimeState* state) {
     _curr_chunk.reset();
+    _curr_filter.reset();
     _pre_output_chunk.reset();
     Operator::close(state);
 }
@@ -40,6 +42,7 @@ StatusOr<ChunkPtr> SelectOperator::pull_chunk(RuntimeState* state) {
      *      merge it into _pre_output_chunk.
      */
     if (!_pre_output_chunk) {
+        _materialize_curr_chunk();
         auto cur_size = _curr_chunk->num_rows();
         if (cur_size >= chunk_size / 2) {
             return std::move(_curr_chunk);
@@ -58,11 +61,29 @@ StatusOr<ChunkPtr> SelectOperator::pull_chunk(RuntimeState* state) {
              *  else
              *      merge input chunk into _pre_output_chunk.
              */
-            auto cur_size = _curr_chunk->num_rows();
+            auto cur_size = _curr_selected_rows();
             if (cur_size + _pre_output_chunk->num_rows() > chunk_size) {
                 auto output_chunk = _pre_output_chunk;
+                _materialize_curr_chunk();
                 _pre_output_chunk = std::move(_curr_chunk);
                 return output_chunk;
+            } else if (_curr_filter != nullptr) {
+                // copy the selected rows of the new read chunk to the reserved
+                std::vector<uint32_t> indexes;
+                indexes.reserve(cur_size);
+                const uint8_t* filter = _curr_filter->data();
+                for (uint32_t i = 0; i < _curr_filter->size(); i++) {
+                    if (filter[i]) {
+                        indexes.push_back(i);
+                    }
+                }
+                auto& dest_columns = _pre_output_chunk->columns();
+                auto& src_columns = _curr_chunk->columns();
+                for (size_t i = 0; i < dest_columns.size(); i++) {
+                    dest_columns[i]->append_selective(*src_columns[i], indexes.data(), 0, cur_size);
+                }
+                _curr_chunk = nullptr;
+                _curr_filter = nullptr;
             } else {
                 auto& dest_columns = _pre_output_chunk->columns();
                 auto& src_columns = _curr_chunk->columns();
@@ -86,6 +107,7 @@ bool SelectOperator::need_input() const {
 
 Status SelectOperator::push_chunk(RuntimeState* state, const ChunkPtr& chunk) {
     _curr_chunk = chunk;
+    _curr_filter = nullptr;
     if (!_common_exprs.empty()) {
         SCOPED_TIMER(_conjuncts_timer);
         for (const auto& [slot_id, expr] : _common_exprs) {
@@ -93,7 +115,13 @@ Status SelectOperator::push_chunk(RuntimeState* state, const ChunkPtr& chunk) {
             _curr_chunk->append_column(col, slot_id);
         }
     }
-    RETURN_IF_ERROR(eval_conjuncts_and_in_filters(_conjunct_ctxs, _curr_chunk.get()));
+    // Narrow chunks are pruned after each conjunct during evaluation, wide chunks defer the filter to
+    // pull_chunk, where it may be applied together with the merge into _pre_output_chunk.
+    if (_curr_chunk->num_columns() > kMaxEagerPruneColumns) {
+        RETURN_IF_ERROR(eval_conjuncts_and_in_filters(_conjunct_ctxs, _curr_chunk.get(), &_curr_filter, false));
+    } else {
+        RETURN_IF_ERROR(eval_conjuncts_and_in_filters(_conjunct_ctxs, _curr_chunk.get()));
+    }
     {
         // common_exprs' slots are only needed inside this operator, no need to pass it downsteam
         for (const auto& [slot_id, _] : _common_exprs) {
@@ -103,8 +131,20 @@ Status SelectOperator::push_chunk(RuntimeState* state, const ChunkPtr& chunk) {
     return Status::OK();
 }
 
+size_t SelectOperator::_curr_selected_rows() const {
+    return _curr_filter == nullptr ? _curr_chunk->num_rows() : SIMD::count_nonzero(*_curr_filter);
+}
+
+void SelectOperator::_materialize_curr_chunk() {
+    if (_curr_filter != nullptr) {
+        _curr_chunk->filter(*_curr_filter);
+        _curr_filter = nullptr;
+    }
+}
+
 Status SelectOperator::reset_state(starrocks::RuntimeState* state, const std::vector<ChunkPtr>& refill_chunks) {
     _curr_chunk.reset();
+    _curr_filter.reset();
     _pre_output_chunk.reset();
     _is_finished = false;
     return Status::OK();
@@ -49,10 +49,20 @@ public:
     Status reset_state(starrocks::RuntimeState* state, const std::vector<ChunkPtr>& refill_chunks) override;
 
 private:
+    // Same as the eager prune threshold of ExecNode::eval_conjuncts.
+    static constexpr size_t kMaxEagerPruneColumns = 5;
+
     // _curr_chunk used to receive input chunks, and apply predicate filtering.
     ChunkPtr _curr_chunk = nullptr;
     // _pre_output_chunk used to merge small _curr_chunk until it's big enough, then return as output.
     ChunkPtr _pre_output_chunk = nullptr;
+    // The filter of _curr_chunk which is not applied yet, nullptr means all rows are selected.
+    // A small _curr_chunk is appended into _pre_output_chunk with its selected rows directly, so that
+    // the selected rows are copied only once instead of being compacted and then copied again.
+    FilterPtr _curr_filter = nullptr;
+
+    size_t _curr_selected_rows() const;
+    void _materialize_curr_chunk();
 
     const std::vector<ExprContext*>& _conjunct_ctxs;
     const std::map<SlotId, ExprContext*>& _common_exprs;
@@ -205,6 +205,7 @@ void TableFunctionOperator::_copy_result(Columns& columns, uint32_t max_output_s
            _next_output_row < _table_function_result.second->get_data().back());
     DCHECK_LT(_next_output_row_offset, _table_function_result.second->size());
     uint32_t curr_output_size = columns[0]->size();
+    _outer_row_indexes.clear();
     const auto& fn_result_cols = _table_function_result.first;
     const auto& offsets_col = _table_function_result.second;
     while (curr_output_size < max_output_size && _next_output_row < offsets_col->get_data().back()) {
@@ -219,17 +220,9 @@ void TableFunctionOperator::_copy_result(Columns& columns, uint32_t max_output_s
                 << " _input_index_of_first_result=" << _input_index_of_first_result;
 
         if (copy_rows > 0) {
-            // Build outer data, repeat multiple times
-            for (size_t i = 0; i < _outer_slots.size(); ++i) {
-                ColumnPtr& input_column_ptr = _input_chunk->get_column_by_slot_id(_outer_slots[i]);
-                Datum value = input_column_ptr->get(_input_index_of_first_result + _next_output_row_offset);
-                if (value.is_null()) {
-                    DCHECK(columns[i]->is_nullable());
-                    down_cast<NullableColumn*>(columns[i].get())->append_nulls(copy_rows);
-                } else {
-                    columns[i]->append_value_multiple_times(&value, copy_rows);
-                }
-            }
+            // Record the outer row, it's replicated for all the copied rows below
+            _outer_row_indexes.resize(_outer_row_indexes.size() + copy_rows,
+                                      _input_index_of_first_result + _next_output_row_offset);
 
             // Build table function result
             if (_fn_result_required) {
@@ -246,5 +239,13 @@ void TableFunctionOperator::_copy_result(Columns& columns, uint32_t max_output_s
             _next_output_row_offset++;
         }
     }
+
+    // Build outer data, gather all the replicated rows of each column at once
+    if (!_outer_row_indexes.empty()) {
+        for (size_t i = 0; i < _outer_slots.size(); ++i) {
+            const ColumnPtr& input_column_ptr = _input_chunk->get_column_by_slot_id(_outer_slots[i]);
+            columns[i]->append_selective(*input_column_ptr, _outer_row_indexes);
+        }
+    }
 }
 } // namespace starrocks::pipeline
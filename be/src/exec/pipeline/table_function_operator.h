@@ -73,6 +73,9 @@ private:
     size_t _next_output_row_offset = 0;
     // table function result
     std::pair<Columns, UInt32Column::Ptr> _table_function_result;
+    // Indexes in "_input_chunk" of the outer rows to replicate, reused across output chunks so that
+    // the outer columns are gathered once per column instead of once per input row.
+    Buffer<uint32_t> _outer_row_indexes;
     bool _fn_result_required = true;
     // table function param and return offset
     TableFunctionState* _table_function_state = nullptr;
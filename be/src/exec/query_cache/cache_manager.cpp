@@ -14,25 +14,43 @@
 
 #include "exec/query_cache/cache_manager.h"
 
+#include "serde/column_array_serde.h"
+#include "util/compression/block_compression.h"
 #include "util/defer_op.h"
 namespace starrocks::query_cache {
 
-CacheManager::CacheManager(size_t capacity) : _cache(capacity) {}
+CacheManager::CacheManager(size_t capacity, size_t compressed_capacity) : _cache(capacity) {
+    if (compressed_capacity > 0) {
+        _compressed_cache = std::make_unique<ShardedLRUCache>(compressed_capacity);
+    }
+}
+
 static void delete_cache_entry(const CacheKey& key, void* value) {
     auto* cache_value = (CacheValue*)value;
     delete cache_value;
 }
 
+static void delete_compressed_cache_entry(const CacheKey& key, void* value) {
+    auto* cache_value = (CompressedCacheValue*)value;
+    delete cache_value;
+}
+
 void CacheManager::populate(const std::string& key, const CacheValue& value) {
     auto* cache_value = new CacheValue(value);
     size_t value_size = cache_value->size();
     auto* handle = _cache.insert(key, cache_value, value_size, &delete_cache_entry, CachePriority::NORMAL);
     _cache.release(handle);
+    if (_compressed_cache != nullptr) {
+        _populate_compressed(key, value);
+    }
 }
 
 StatusOr<CacheValue> CacheManager::probe(const std::string& key) {
     auto* handle = _cache.lookup(key);
     if (handle == nullptr) {
+        if (_compressed_cache != nullptr) {
+            return _probe_compressed(key);
+        }
         return Status::NotFound("CacheMiss");
     }
     DeferOp defer([this, handle]() { _cache.release(handle); });
@@ -40,6 +58,85 @@ StatusOr<CacheValue> CacheManager::probe(const std::string& key) {
     return cache_value;
 }
 
+void CacheManager::_populate_compressed(const std::string& key, const CacheValue& value) {
+    const BlockCompressionCodec* codec = nullptr;
+    if (!get_block_compression_codec(CompressionTypePB::LZ4, &codec).ok() || codec == nullptr) {
+        return;
+    }
+    auto compressed_value = std::make_unique<CompressedCacheValue>();
+    compressed_value->populate_time = value.populate_time;
+    compressed_value->version = value.version;
+    std::string serialized;
+    std::string compressed;
+    for (const auto& chunk : value.result) {
+        size_t max_size = 0;
+        for (const auto& column : chunk->columns()) {
+            int64_t column_size = serde::ColumnArraySerde::max_serialized_size(*column);
+            // the column can't be serialized, keep the entry in the first tier only
+            if (column_size <= 0) {
+                return;
+            }
+            max_size += column_size;
+        }
+        serialized.resize(max_size);
+        auto* cur = reinterpret_cast<uint8_t*>(serialized.data());
+        for (const auto& column : chunk->columns()) {
+            cur = serde::ColumnArraySerde::serialize(*column, cur);
+            if (cur == nullptr) {
+                return;
+            }
+        }
+        size_t serialized_size = cur - reinterpret_cast<uint8_t*>(serialized.data());
+        compressed.resize(codec->max_compressed_len(serialized_size));
+        Slice compressed_slice(compressed);
+        if (!codec->compress(Slice(serialized.data(), serialized_size), &compressed_slice).ok()) {
+            return;
+        }
+        compressed_value->templates.emplace_back(chunk->clone_empty());
+        compressed_value->serialized_sizes.emplace_back(serialized_size);
+        compressed_value->compressed_chunks.emplace_back(compressed_slice.data, compressed_slice.size);
+    }
+    size_t value_size = compressed_value->size();
+    auto* handle = _compressed_cache->insert(key, compressed_value.release(), value_size,
+                                             &delete_compressed_cache_entry, CachePriority::NORMAL);
+    _compressed_cache->release(handle);
+}
+
+StatusOr<CacheValue> CacheManager::_probe_compressed(const std::string& key) {
+    auto* handle = _compressed_cache->lookup(key);
+    if (handle == nullptr) {
+        return Status::NotFound("CacheMiss");
+    }
+    DeferOp defer([this, handle]() { _compressed_cache->release(handle); });
+    const auto* compressed_value = reinterpret_cast<CompressedCacheValue*>(_compressed_cache->value(handle));
+    const BlockCompressionCodec* codec = nullptr;
+    RETURN_IF_ERROR(get_block_compression_codec(CompressionTypePB::LZ4, &codec));
+    CacheResult result;
+    result.reserve(compressed_value->templates.size());
+    std::string serialized;
+    for (size_t i = 0; i < compressed_value->templates.size(); i++) {
+        serialized.resize(compressed_value->serialized_sizes[i]);
+        Slice serialized_slice(serialized);
+        RETURN_IF_ERROR(codec->decompress(Slice(compressed_value->compressed_chunks[i]), &serialized_slice));
+        ChunkPtr chunk = compressed_value->templates[i]->clone_empty();
+        const auto* cur = reinterpret_cast<const uint8_t*>(serialized.data());
+        for (auto& column : chunk->columns()) {
+            cur = serde::ColumnArraySerde::deserialize(cur, column.get());
+            if (cur == nullptr) {
+                return Status::Corruption("Fail to deserialize query cache entry");
+            }
+        }
+        result.emplace_back(std::move(chunk));
+    }
+    CacheValue cache_value(compressed_value->populate_time, compressed_value->version, std::move(result));
+    // promote the entry to the first tier for the following probes
+    auto* cache_value_copy = new CacheValue(cache_value);
+    auto* first_tier_handle = _cache.insert(key, cache_value_copy, cache_value_copy->size(), &delete_cache_entry,
+                                            CachePriority::NORMAL);
+    _cache.release(first_tier_handle);
+    return cache_value;
+}
+
 size_t CacheManager::memory_usage() {
     return _cache.get_memory_usage();
 }
@@ -56,11 +153,24 @@ size_t CacheManager::hit_count() {
     return _cache.get_hit_count();
 }
 
+size_t CacheManager::compressed_memory_usage() {
+    return _compressed_cache != nullptr ? _compressed_cache->get_memory_usage() : 0;
+}
+
+size_t CacheManager::compressed_hit_count() {
+    return _compressed_cache != nullptr ? _compressed_cache->get_hit_count() : 0;
+}
+
 void CacheManager::invalidate_all() {
     auto old_capacity = _cache.get_capacity();
     // set capacity of cache to zero, the cache shall prune all cache entries.
     _cache.set_capacity(0);
     _cache.set_capacity(old_capacity);
+    if (_compressed_cache != nullptr) {
+        auto old_compressed_capacity = _compressed_cache->get_capacity();
+        _compressed_cache->set_capacity(0);
+        _compressed_cache->set_capacity(old_compressed_capacity);
+    }
 }
 
 } // namespace starrocks::query_cache
@@ -60,9 +60,29 @@ struct CacheValue {
     }
 };
 
+// CompressedCacheValue keeps a CacheValue serialized and compressed, the chunks are rebuilt from
+// the empty templates which keep the columns and slots of the original chunks.
+struct CompressedCacheValue {
+    int64_t populate_time;
+    int64_t version;
+    std::vector<ChunkPtr> templates;
+    std::vector<size_t> serialized_sizes;
+    std::vector<std::string> compressed_chunks;
+
+    size_t size() const {
+        size_t value_size = sizeof(CompressedCacheValue);
+        for (size_t i = 0; i < templates.size(); i++) {
+            value_size += templates[i]->memory_usage() + compressed_chunks[i].size();
+        }
+        return value_size;
+    }
+};
+
 class CacheManager {
 public:
-    explicit CacheManager(size_t capacity);
+    // |compressed_capacity| is the capacity of the second tier keeping compressed copies of the cache
+    // entries, which serves the probes of entries evicted from the first tier. 0 disables it.
+    explicit CacheManager(size_t capacity, size_t compressed_capacity = 0);
     ~CacheManager() = default;
     void populate(const std::string& key, const CacheValue& value);
     StatusOr<CacheValue> probe(const std::string& key);
@@ -70,10 +90,16 @@ public:
     size_t capacity();
     size_t lookup_count();
     size_t hit_count();
+    size_t compressed_memory_usage();
+    size_t compressed_hit_count();
     // vacuum cache by invalidate all cache entries
     void invalidate_all();
 
 private:
+    void _populate_compressed(const std::string& key, const CacheValue& value);
+    StatusOr<CacheValue> _probe_compressed(const std::string& key);
+
     ShardedLRUCache _cache;
+    std::unique_ptr<ShardedLRUCache> _compressed_cache;
 };
 } // namespace starrocks::query_cache
@@ -284,7 +284,11 @@ void CacheOperator::_handle_stale_cache_value_for_non_pk(int64_t tablet_id, Cach
             max_version = std::max(max_version, rs->end_version());
         }
     } else {
-        all_rs_empty = base_rowsets.empty();
+        // lake tablets may get rowsets without any data file, e.g. from a load which wrote no rows to the tablet,
+        // such delta rowsets must not turn a total hit into a partial hit
+        for (const auto& rs : base_rowsets) {
+            all_rs_empty &= !rs->has_data_files();
+        }
         min_version = cache_value.version + 1;
         max_version = version;
     }
@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <string>
 
 #include "column/chunk.h"
@@ -102,7 +103,7 @@ public:
     virtual Status init(SchemaScannerParam* param, ObjectPool* pool);
     // Start to work
     virtual Status start(RuntimeState* state);
-    // Must only return one row at most each time
+    // Must only return `batch_size()` rows at most each time, one row unless the caller raised it
     virtual Status get_next(ChunkPtr* chunk, bool* eos);
     // factory function
     static std::unique_ptr<SchemaScanner> create(TSchemaTableType::type type);
@@ -115,6 +116,11 @@ public:
 
     Status init_schema_scanner_state(RuntimeState* state);
 
+    // Scanners answering from in-memory state may fill up to this many rows in one get_next(),
+    // the others keep returning a single row.
+    void set_batch_size(size_t batch_size) { _batch_size = std::max<size_t>(batch_size, 1); }
+    size_t batch_size() const { return _batch_size; }
+
 protected:
     Status _create_slot_descs(ObjectPool* pool);
 
@@ -134,6 +140,7 @@ protected:
 
     static StarRocksServer* _s_starrocks_server;
     RuntimeState* _runtime_state = nullptr;
+    size_t _batch_size = 1;
 };
 
 } // namespace starrocks
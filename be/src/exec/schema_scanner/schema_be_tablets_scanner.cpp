@@ -151,7 +151,7 @@ static const char* medium_type_to_string(TStorageMedium::type type) {
 
 Status SchemaBeTabletsScanner::fill_chunk(ChunkPtr* chunk) {
     const auto& slot_id_to_index_map = (*chunk)->get_slot_id_to_index_map();
-    auto end = _cur_idx + 1;
+    auto end = std::min(_cur_idx + batch_size(), _infos.size());
     for (; _cur_idx < end; _cur_idx++) {
         auto& info = _infos[_cur_idx];
         for (const auto& [slot_id, index] : slot_id_to_index_map) {
@@ -17,6 +17,8 @@
 
 #include "exec/short_circuit_hybrid.h"
 
+#include <numeric>
+
 #include "column/column_helper.h"
 #include "common/object_pool.h"
 #include "common/status.h"
@@ -187,19 +189,28 @@ Status ShortCircuitHybridScanNode::_process_value_chunk(std::vector<bool>& found
     std::vector<int> key_idx_to_value_idx(_num_rows, -1);
     int value_chunk_idx = 0;
 
-    for (int i = 0; i < _tablets.size(); ++i) {
+    // a primary key lives in only one tablet, so the keys found in a tablet are not probed in
+    // the following tablets, and each tablet looks up its pending keys in one batch.
+    std::vector<uint32_t> pending_key_idxs(_num_rows);
+    std::iota(pending_key_idxs.begin(), pending_key_idxs.end(), 0);
+    for (int i = 0; i < _tablets.size() && !pending_key_idxs.empty(); ++i) {
         LocalTableReaderParams params;
         params.version = std::stoi(_versions[i]);
         params.tablet_id = _tablets[i]->get_tablet_info().tablet_id;
         _table_reader = std::make_shared<TableReader>();
         RETURN_IF_ERROR(_table_reader->init(params));
 
-        auto current_chunk = ChunkHelper::new_chunk(*(value_schema), _num_rows);
-        // current tablet will return all key_chunk mapping whether has value
-        // true , means vector idx of key_chunk have value
+        ChunkPtr pending_key_chunk = _key_chunk;
+        if (pending_key_idxs.size() < _key_chunk->num_rows()) {
+            pending_key_chunk = _key_chunk->clone_empty(pending_key_idxs.size());
+            pending_key_chunk->append_selective(*_key_chunk, pending_key_idxs.data(), 0, pending_key_idxs.size());
+        }
+        auto current_chunk = ChunkHelper::new_chunk(*(value_schema), pending_key_idxs.size());
+        // current tablet will return all pending key mapping whether has value
+        // true , means vector idx of pending_key_chunk have value
         std::vector<bool> curent_found;
-        Status status =
-                _table_reader->multi_get(*(_key_chunk.get()), value_field_names, curent_found, *(current_chunk.get()));
+        Status status = _table_reader->multi_get(*(pending_key_chunk.get()), value_field_names, curent_found,
+                                                 *(current_chunk.get()));
         if (!status.ok()) {
             // todo retry
             LOG(WARNING) << "fail to execute multi get: " << status.detailed_message();
@@ -207,21 +218,20 @@ Status ShortCircuitHybridScanNode::_process_value_chunk(std::vector<bool>& found
 
         // merge all tablet result
         bool has_found_value = false;
-        for (int key_idx = 0; key_idx < curent_found.size(); ++key_idx) {
-            // 1 tablet will have many value hit predicate, so here need foreach end
-            if (curent_found[key_idx] && key_idx_to_value_idx[key_idx] == -1) {
+        std::vector<uint32_t> next_pending_key_idxs;
+        for (int pending_idx = 0; pending_idx < pending_key_idxs.size(); ++pending_idx) {
+            auto key_idx = pending_key_idxs[pending_idx];
+            if (pending_idx < curent_found.size() && curent_found[pending_idx]) {
                 // make sure found order is same between key_chunk and value_chunk
                 key_idx_to_value_idx[key_idx] = value_chunk_idx;
                 value_chunk_idx++;
-                if (UNLIKELY(found[key_idx])) {
-                    return Status::Corruption(
-                            fmt::format("one key can't be found twice in short circuit, tablet_id: {}, key_idx: {}",
-                                        params.tablet_id, key_idx));
-                }
                 found[key_idx] = true;
                 has_found_value = true;
+            } else {
+                next_pending_key_idxs.emplace_back(key_idx);
             }
         }
+        pending_key_idxs.swap(next_pending_key_idxs);
         if (has_found_value) {
             value_chunk->append(*(current_chunk.get()));
         }
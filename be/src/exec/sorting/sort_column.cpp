@@ -27,6 +27,7 @@
 #include "column/map_column.h"
 #include "column/nullable_column.h"
 #include "column/struct_column.h"
+#include "common/config.h"
 #include "exec/sorting/sort_helper.h"
 #include "exec/sorting/sort_permute.h"
 #include "exec/sorting/sorting.h"
@@ -170,12 +171,12 @@ public:
             DCHECK_GE(column.size(), _permutation.size());
         }
 
-        using ItemType = InlinePermuteItem<Slice>;
+        using ItemType = InlinePermuteItem<PrefixSlice>;
         auto cmp = [&](const ItemType& lhs, const ItemType& rhs) -> int {
             return lhs.inline_value.compare(rhs.inline_value);
         };
 
-        auto inlined = create_inline_permutation<Slice, IS_RANGES>(_permutation, column.get_proxy_data());
+        auto inlined = create_inline_permutation<PrefixSlice, IS_RANGES>(_permutation, column.get_proxy_data());
         RETURN_IF_ERROR(sort_and_tie_helper(_cancel, &column, _sort_desc.asc_order(), inlined, _tie, cmp,
                                             _range_or_ranges, _build_tie));
         restore_inline_permutation(inlined, _permutation);
@@ -283,7 +284,7 @@ public:
         using ColumnType = BinaryColumnBase<T>;
 
         if (_need_inline_value()) {
-            using ItemType = CompactChunkItem<Slice>;
+            using ItemType = CompactChunkItem<PrefixSlice>;
             using Container = typename BinaryColumnBase<T>::BinaryDataProxyContainer;
 
             auto cmp = [&](const ItemType& lhs, const ItemType& rhs) -> int {
@@ -296,7 +297,7 @@ public:
                 containers.push_back(&real->get_proxy_data());
             }
 
-            auto inlined = _create_inlined_permutation<Slice>(containers);
+            auto inlined = _create_inlined_permutation<PrefixSlice>(containers);
             RETURN_IF_ERROR(sort_and_tie_helper(_cancel, &column, _sort_desc.asc_order(), inlined, _tie, cmp, _range,
                                                 _build_tie, _limit, &_pruned_limit));
             _restore_inlined_permutation(inlined);
@@ -497,11 +498,190 @@ static Status sort_and_tie_column(const std::atomic<bool>& cancel, const Column*
     return column->accept(&column_sorter);
 }
 
+// Encode the sort keys of fixed-length columns into memcmp-able normalized keys, so that a multi-column sort
+// becomes a single pass over fixed-width byte strings instead of column-wise sorting with ties.
+// Each column takes (nullable ? 1 : 0) + sizeof(T) bytes of the key:
+//  - the null flag byte orders NULL before or after the non-null values according to null_first
+//  - the value is written in big-endian with the sign bit flipped, and all bytes are inverted for descending order
+// Only integral, date, datetime and decimal v3 columns are supported, other columns fall back to column-wise sort.
+// If `_keys` is nullptr, the encoder only accumulates the key width.
+class NormalizedKeyEncoder final : public ColumnVisitorAdapter<NormalizedKeyEncoder> {
+public:
+    NormalizedKeyEncoder(uint8_t* keys, size_t key_width, const SortDesc& sort_desc)
+            : ColumnVisitorAdapter(this), _keys(keys), _key_width(key_width), _sort_desc(sort_desc) {}
+
+    void set_sort_desc(const SortDesc& sort_desc) { _sort_desc = sort_desc; }
+    size_t offset() const { return _offset; }
+
+    Status do_visit(const NullableColumn& column) {
+        const size_t null_offset = _offset++;
+        RETURN_IF_ERROR(column.data_column_ref().accept(this));
+        if (_keys == nullptr) {
+            return Status::OK();
+        }
+        const size_t value_width = _offset - null_offset - 1;
+        const uint8_t null_flag = _sort_desc.is_null_first() ? 0 : 1;
+        const NullData& null_data = column.immutable_null_column_data();
+        for (size_t i = 0; i < column.size(); i++) {
+            uint8_t* key = _keys + i * _key_width + null_offset;
+            if (null_data[i]) {
+                key[0] = null_flag;
+                memset(key + 1, 0, value_width);
+            } else {
+                key[0] = 1 - null_flag;
+            }
+        }
+        return Status::OK();
+    }
+
+    template <typename T>
+    Status do_visit(const FixedLengthColumnBase<T>& column) {
+        if constexpr (std::is_integral_v<T> || std::is_same_v<T, int128_t> || std::is_same_v<T, DateValue> ||
+                      std::is_same_v<T, TimestampValue>) {
+            if (_keys != nullptr) {
+                const auto& data = column.get_data();
+                for (size_t i = 0; i < data.size(); i++) {
+                    encode_value(data[i], _keys + i * _key_width + _offset);
+                }
+            }
+            _offset += sizeof(T);
+            return Status::OK();
+        } else {
+            return Status::NotSupported("normalized key not support floating point and legacy decimal column");
+        }
+    }
+
+    Status do_visit(const ConstColumn& column) {
+        return Status::NotSupported("normalized key not support const column");
+    }
+    Status do_visit(const ArrayColumn& column) {
+        return Status::NotSupported("normalized key not support array column");
+    }
+    Status do_visit(const MapColumn& column) { return Status::NotSupported("normalized key not support map column"); }
+    Status do_visit(const StructColumn& column) {
+        return Status::NotSupported("normalized key not support struct column");
+    }
+    template <typename T>
+    Status do_visit(const BinaryColumnBase<T>& column) {
+        return Status::NotSupported("normalized key not support binary column");
+    }
+    template <typename T>
+    Status do_visit(const ObjectColumn<T>& column) {
+        return Status::NotSupported("normalized key not support object column");
+    }
+    Status do_visit(const JsonColumn& column) {
+        return Status::NotSupported("normalized key not support json column");
+    }
+
+private:
+    template <typename T>
+    void encode_value(const T& value, uint8_t* dst) const {
+        if constexpr (std::is_same_v<T, DateValue>) {
+            encode_value(value.julian(), dst);
+        } else if constexpr (std::is_same_v<T, TimestampValue>) {
+            encode_value(value.timestamp(), dst);
+        } else {
+            using UnsignedT = typename std::conditional_t<std::is_same_v<T, int128_t>,
+                                                          std::type_identity<unsigned __int128>,
+                                                          std::make_unsigned<T>>::type;
+            auto bits = static_cast<UnsignedT>(value);
+            if constexpr (std::is_same_v<T, int128_t> || std::is_signed_v<T>) {
+                bits ^= UnsignedT(1) << (sizeof(T) * 8 - 1);
+            }
+            if (!_sort_desc.asc_order()) {
+                bits = ~bits;
+            }
+            for (size_t i = 0; i < sizeof(T); i++) {
+                dst[i] = static_cast<uint8_t>(bits >> ((sizeof(T) - 1 - i) * 8));
+            }
+        }
+    }
+
+    uint8_t* _keys;
+    const size_t _key_width;
+    SortDesc _sort_desc;
+    size_t _offset = 0;
+};
+
+// Load the first sizeof(KeyT) bytes of a normalized key as an integer preserving the memcmp order
+template <typename KeyT>
+static KeyT load_normalized_key(const uint8_t* key, size_t key_width) {
+    KeyT value = 0;
+    for (size_t i = 0; i < sizeof(KeyT); i++) {
+        value <<= 8;
+        if (i < key_width) {
+            value |= key[i];
+        }
+    }
+    return value;
+}
+
+template <typename KeyT>
+static void sort_by_integer_normalized_keys(const std::vector<uint8_t>& keys, size_t key_width, size_t num_rows,
+                                            Permutation* permutation) {
+    std::vector<std::pair<KeyT, uint32_t>> items(num_rows);
+    for (uint32_t i = 0; i < num_rows; i++) {
+        items[i] = {load_normalized_key<KeyT>(keys.data() + i * key_width, key_width), i};
+    }
+    ::pdqsort(items.begin(), items.end(), [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+    permutation->resize(num_rows);
+    for (size_t i = 0; i < num_rows; i++) {
+        (*permutation)[i].index_in_chunk = items[i].second;
+    }
+}
+
+// Sort by normalized keys, return false if any of the columns could not be encoded
+static StatusOr<bool> sort_by_normalized_keys(const std::atomic<bool>& cancel, const Columns& columns,
+                                              const SortDescs& sort_desc, Permutation* permutation) {
+    size_t num_rows = columns[0]->size();
+    NormalizedKeyEncoder measure(nullptr, 0, sort_desc.get_column_desc(0));
+    for (const auto& column : columns) {
+        if (!column->accept(&measure).ok()) {
+            return false;
+        }
+    }
+    const size_t key_width = measure.offset();
+    if (key_width > static_cast<size_t>(config::sort_normalized_key_max_width)) {
+        return false;
+    }
+
+    std::vector<uint8_t> keys(num_rows * key_width);
+    NormalizedKeyEncoder encoder(keys.data(), key_width, sort_desc.get_column_desc(0));
+    for (int col_index = 0; col_index < columns.size(); col_index++) {
+        encoder.set_sort_desc(sort_desc.get_column_desc(col_index));
+        RETURN_IF_ERROR(columns[col_index]->accept(&encoder));
+    }
+    if (UNLIKELY(cancel.load(std::memory_order_acquire))) {
+        return Status::Cancelled("Sort cancelled");
+    }
+
+    if (key_width <= sizeof(uint64_t)) {
+        sort_by_integer_normalized_keys<uint64_t>(keys, key_width, num_rows, permutation);
+    } else if (key_width <= sizeof(unsigned __int128)) {
+        sort_by_integer_normalized_keys<unsigned __int128>(keys, key_width, num_rows, permutation);
+    } else {
+        SmallPermutation small_perm = create_small_permutation(num_rows);
+        const uint8_t* data = keys.data();
+        ::pdqsort(small_perm.begin(), small_perm.end(), [&](const SmallPermuteItem& lhs, const SmallPermuteItem& rhs) {
+            return memcmp(data + lhs.index_in_chunk * key_width, data + rhs.index_in_chunk * key_width, key_width) < 0;
+        });
+        restore_small_permutation(small_perm, *permutation);
+    }
+    return true;
+}
+
 Status sort_and_tie_columns(const std::atomic<bool>& cancel, const Columns& columns, const SortDescs& sort_desc,
                             Permutation* permutation) {
     if (columns.size() < 1) {
         return Status::OK();
     }
+    if (config::enable_sort_normalized_key && columns.size() > 1) {
+        ASSIGN_OR_RETURN(bool sorted, sort_by_normalized_keys(cancel, columns, sort_desc, permutation));
+        if (sorted) {
+            return Status::OK();
+        }
+    }
     size_t num_rows = columns[0]->size();
     Tie tie(num_rows, 1);
     std::pair<int, int> range{0, num_rows};
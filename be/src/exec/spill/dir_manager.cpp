@@ -14,6 +14,7 @@
 
 #include "exec/spill/dir_manager.h"
 
+#include <algorithm>
 #include <cstdlib>
 #include <regex>
 
@@ -21,9 +22,29 @@
 #include "storage/options.h"
 #include "storage/storage_engine.h"
 #include "storage/utils.h"
+#include "util/time.h"
 
 namespace starrocks::spill {
 
+int64_t Dir::get_available_size() {
+    int64_t quota = _max_size - _current_size.load();
+    const int64_t interval_ms = config::spill_dir_space_check_interval_ms;
+    if (interval_ms <= 0) {
+        return quota;
+    }
+    const int64_t now = MonotonicMillis();
+    int64_t last_check_time = _last_check_space_time_ms.load();
+    if (now - last_check_time >= interval_ms &&
+        _last_check_space_time_ms.compare_exchange_strong(last_check_time, now)) {
+        auto space_info = FileSystem::Default()->space(_dir);
+        // keep the last known value if the disk can't be checked
+        if (space_info.ok()) {
+            _disk_available_size = space_info.value().available;
+        }
+    }
+    return std::min(quota, _disk_available_size.load());
+}
+
 Status DirManager::init(const std::string& spill_dirs) {
     std::vector<starrocks::StorePath> spill_local_storage_paths;
     RETURN_IF_ERROR(parse_conf_store_paths(spill_dirs, &spill_local_storage_paths));
@@ -102,15 +123,26 @@ Status DirManager::init(const std::string& spill_dirs) {
 }
 
 StatusOr<DirPtr> DirManager::acquire_writable_dir(const AcquireDirOptions& opts) {
-    // for the case of multiple dirs, we randomly select one as the start
-    // and then try one by one until we find the first one that meets the capacity requirements.
+    // for the case of multiple dirs, we randomly select one as the start to break ties,
+    // and then prefer the dirs with the most available space, so that a nearly full disk is
+    // not chosen while the others still have room.
     size_t start_idx = 0;
     if (_dirs.size() > 1) {
         std::lock_guard l(_mutex);
         start_idx = _rand.Next() % _dirs.size();
     }
+    std::vector<std::pair<int64_t, size_t>> candidates;
+    candidates.reserve(_dirs.size());
     for (size_t i = 0; i < _dirs.size(); i++) {
         size_t idx = (start_idx + i) % _dirs.size();
+        int64_t available_size = _dirs[idx]->get_available_size();
+        if (available_size >= static_cast<int64_t>(opts.data_size)) {
+            candidates.emplace_back(available_size, idx);
+        }
+    }
+    std::stable_sort(candidates.begin(), candidates.end(),
+                     [](const auto& lhs, const auto& rhs) { return lhs.first > rhs.first; });
+    for (const auto& [_, idx] : candidates) {
         if (_dirs[idx]->inc_size(opts.data_size)) {
             return _dirs[idx];
         }
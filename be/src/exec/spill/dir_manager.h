@@ -55,6 +55,10 @@ public:
 
     int64_t get_max_size() const { return _max_size; }
 
+    // The bytes that can still be written into this dir. It is bounded by both the quota of the dir
+    // and the available space of the underlying disk, which may be consumed by other processes.
+    virtual int64_t get_available_size();
+
     virtual bool is_remote() const { return false; }
 
 protected:
@@ -62,6 +66,9 @@ protected:
     std::shared_ptr<FileSystem> _fs;
     int64_t _max_size;
     std::atomic<int64_t> _current_size = 0;
+    // the available space of the disk, refreshed every config::spill_dir_space_check_interval_ms
+    std::atomic<int64_t> _disk_available_size = INT64_MAX;
+    std::atomic<int64_t> _last_check_space_time_ms = 0;
 };
 using DirPtr = std::shared_ptr<Dir>;
 
@@ -72,6 +79,8 @@ public:
             : Dir(std::move(dir), std::move(fs), max_dir_size), _cloud_conf(std::move(cloud_conf)) {}
     ~RemoteDir() override = default;
 
+    int64_t get_available_size() override { return _max_size - _current_size.load(); }
+
     bool is_remote() const override { return true; }
 
 private:
@@ -34,8 +34,6 @@
 
 namespace starrocks::spill {
 
-static const int chunk_buffer_max_size = 2;
-
 Status YieldableRestoreTask::do_read(workgroup::YieldContext& yield_ctx, SerdeContext& context) {
     size_t num_eos = 0;
     yield_ctx.total_yield_point_cnt = _sub_stream.size();
@@ -168,19 +166,35 @@ InputStreamPtr SpillInputStream::as_stream(const std::vector<ChunkPtr>& chunks,
     return std::make_shared<RawChunkInputStream>(chunks, spiller);
 }
 
+// BufferedInputStream reads ahead up to `capacity` chunks of the underlying stream on the spill IO executor,
+// and stops early once the buffered chunks exceed `max_buffered_bytes`.
 class BufferedInputStream : public SpillInputStream {
 public:
-    BufferedInputStream(int capacity, InputStreamPtr stream, Spiller* spiller)
-            : _capacity(capacity), _input_stream(std::move(stream)), _spiller(spiller) {}
+    BufferedInputStream(int capacity, InputStreamPtr stream, Spiller* spiller,
+                        size_t max_buffered_bytes = std::numeric_limits<size_t>::max())
+            : _capacity(std::max(capacity, 1)),
+              _max_buffered_bytes(max_buffered_bytes),
+              _input_stream(std::move(stream)),
+              _spiller(spiller) {}
     ~BufferedInputStream() override = default;
 
-    bool is_buffer_full() { return _chunk_buffer.get_size() >= _capacity; }
+    // at least one chunk is always allowed to be buffered, otherwise the stream can't make progress
+    bool is_buffer_full() {
+        size_t size = _chunk_buffer.get_size();
+        return size >= _capacity || (size > 0 && _buffered_bytes >= _max_buffered_bytes);
+    }
     // The ChunkProvider in sort operator needs to use has_chunk to check whether the data is ready,
     // if the InputStream is in the eof state, it also needs to return true to driver ChunkSortCursor into the stage of obtaining data.
     bool has_chunk() { return !_chunk_buffer.empty() || eof(); }
 
     StatusOr<ChunkUniquePtr> get_next(workgroup::YieldContext& yield_ctx, SerdeContext& ctx) override;
-    bool is_ready() override { return has_chunk(); }
+    bool is_ready() override {
+        bool ready = has_chunk();
+        if (!ready) {
+            _is_stalled = true;
+        }
+        return ready;
+    }
     void close() override {}
 
     bool enable_prefetch() const override { return true; }
@@ -204,10 +218,14 @@ private:
     }
 
 private:
-    int _capacity;
+    const size_t _capacity;
+    const size_t _max_buffered_bytes;
     InputStreamPtr _input_stream;
     UnboundedBlockingQueue<ChunkUniquePtr> _chunk_buffer;
+    std::atomic<size_t> _buffered_bytes = 0;
     std::atomic_bool _is_prefetching = false;
+    // whether the reader has waited for the prefetching since the last chunk was read
+    std::atomic_bool _is_stalled = false;
     Spiller* _spiller = nullptr;
 };
 
@@ -218,7 +236,14 @@ StatusOr<ChunkUniquePtr> BufferedInputStream::read_from_buffer() {
     }
     ChunkUniquePtr res;
     CHECK(_chunk_buffer.try_get(&res));
-    COUNTER_ADD(_spiller->metrics().input_stream_peak_memory_usage, -res->memory_usage());
+    const size_t memory_usage = res->memory_usage();
+    _buffered_bytes -= memory_usage;
+    COUNTER_ADD(_spiller->metrics().input_stream_peak_memory_usage, -memory_usage);
+    if (_is_stalled.exchange(false)) {
+        COUNTER_UPDATE(_spiller->metrics().prefetch_stall_count, 1);
+    } else {
+        COUNTER_UPDATE(_spiller->metrics().prefetch_hit_count, 1);
+    }
     return res;
 }
 
@@ -242,16 +267,21 @@ Status BufferedInputStream::prefetch(workgroup::YieldContext& yield_ctx, SerdeCo
     }
     DeferOp defer([this]() { _release(); });
 
-    auto res = _input_stream->get_next(yield_ctx, ctx);
-    if (res.ok()) {
-        COUNTER_ADD(_spiller->metrics().input_stream_peak_memory_usage, res.value()->memory_usage());
-        _chunk_buffer.put(std::move(res.value()));
-        return Status::OK();
-    } else if (res.status().is_end_of_file()) {
-        mark_is_eof();
-        return Status::OK();
+    while (!is_buffer_full()) {
+        auto res = _input_stream->get_next(yield_ctx, ctx);
+        if (res.ok()) {
+            const size_t memory_usage = res.value()->memory_usage();
+            _buffered_bytes += memory_usage;
+            COUNTER_ADD(_spiller->metrics().input_stream_peak_memory_usage, memory_usage);
+            _chunk_buffer.put(std::move(res.value()));
+        } else if (res.status().is_end_of_file()) {
+            mark_is_eof();
+            return Status::OK();
+        } else {
+            return res.status();
+        }
     }
-    return res.status();
+    return Status::OK();
 }
 
 class SequenceInputStream : public SpillInputStream {
@@ -473,7 +503,8 @@ StatusOr<InputStreamPtr> BlockGroupSet::as_unordered_stream(const SerdePtr& serd
         blocks.insert(blocks.end(), group->blocks().begin(), group->blocks().end());
     }
     auto stream = std::make_shared<SequenceInputStream>(std::move(blocks), serde, read_options);
-    return std::make_shared<BufferedInputStream>(chunk_buffer_max_size, std::move(stream), spiller);
+    return std::make_shared<BufferedInputStream>(config::spill_read_ahead_chunks, std::move(stream), spiller,
+                                                 spiller->options().max_read_buffer_bytes);
 }
 
 StatusOr<InputStreamPtr> BlockGroupSet::as_ordered_stream(RuntimeState* state, const SerdePtr& serde, Spiller* spiller,
@@ -494,10 +525,16 @@ StatusOr<InputStreamPtr> BlockGroupSet::build_ordered_stream(std::vector<BlockGr
             read_options.max_buffer_bytes = max_buffer_bytes;
         }
     }
+    // the read ahead memory is shared by all the sorted runs being merged
+    size_t max_read_ahead_bytes = spiller->options().max_read_buffer_bytes;
+    if (!block_groups.empty()) {
+        max_read_ahead_bytes /= block_groups.size();
+    }
     std::vector<InputStreamPtr> streams;
     for (const auto& group : block_groups) {
         auto stream = std::make_shared<SequenceInputStream>(group->blocks(), serde, read_options);
-        streams.emplace_back(std::make_shared<BufferedInputStream>(chunk_buffer_max_size, stream, spiller));
+        streams.emplace_back(std::make_shared<BufferedInputStream>(config::spill_read_ahead_chunks, stream, spiller,
+                                                                   max_read_ahead_bytes));
     }
 
     InputStreamPtr res;
@@ -0,0 +1,101 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/spill/memory_arbitrator.h"
+
+#include <algorithm>
+
+#include "common/config.h"
+#include "common/logging.h"
+#include "exec/spill/query_spill_manager.h"
+#include "runtime/exec_env.h"
+#include "runtime/mem_tracker.h"
+#include "util/starrocks_metrics.h"
+#include "util/time.h"
+#include "util/uid_util.h"
+
+namespace starrocks::spill {
+
+MemoryArbitrator* MemoryArbitrator::instance() {
+    static MemoryArbitrator arbitrator;
+    return &arbitrator;
+}
+
+void MemoryArbitrator::register_query(QuerySpillManager* query) {
+    std::lock_guard<std::mutex> l(_mutex);
+    _queries.push_back(query);
+}
+
+void MemoryArbitrator::unregister_query(QuerySpillManager* query) {
+    std::lock_guard<std::mutex> l(_mutex);
+    auto iter = std::find(_queries.begin(), _queries.end(), query);
+    if (iter != _queries.end()) {
+        *iter = _queries.back();
+        _queries.pop_back();
+    }
+}
+
+size_t MemoryArbitrator::num_queries() const {
+    std::lock_guard<std::mutex> l(_mutex);
+    return _queries.size();
+}
+
+void MemoryArbitrator::maybe_arbitrate() {
+    double ratio = config::spill_arbitrate_query_pool_mem_ratio;
+    if (ratio <= 0 || ratio >= 1) {
+        return;
+    }
+    int64_t now = MonotonicMillis();
+    int64_t last = _last_arbitrate_ms.load(std::memory_order_relaxed);
+    if (now - last < config::spill_arbitrate_interval_ms ||
+        !_last_arbitrate_ms.compare_exchange_strong(last, now, std::memory_order_relaxed)) {
+        return;
+    }
+    auto* query_pool_mem_tracker = ExecEnv::GetInstance()->query_pool_mem_tracker();
+    if (query_pool_mem_tracker == nullptr) {
+        return;
+    }
+    arbitrate(query_pool_mem_tracker->consumption(), query_pool_mem_tracker->limit());
+}
+
+QuerySpillManager* MemoryArbitrator::arbitrate(int64_t consumption, int64_t limit) {
+    double ratio = config::spill_arbitrate_query_pool_mem_ratio;
+    if (limit <= 0 || ratio <= 0 || ratio >= 1 || consumption < limit * ratio) {
+        return nullptr;
+    }
+    std::lock_guard<std::mutex> l(_mutex);
+    auto* victim = _pick_victim();
+    if (victim != nullptr) {
+        victim->request_revoke();
+        StarRocksMetrics::instance()->spill_arbitrate_revoked_queries_total.increment(1);
+        LOG(INFO) << "revoke memory of query " << print_id(victim->query_id()) << " by spilling, revocable: "
+                  << victim->revocable_bytes() << ", query pool consumption: " << consumption << ", limit: " << limit;
+    }
+    return victim;
+}
+
+QuerySpillManager* MemoryArbitrator::_pick_victim() const {
+    QuerySpillManager* victim = nullptr;
+    for (auto* query : _queries) {
+        if (query->revoke_requested() || query->revocable_bytes() <= 0) {
+            continue;
+        }
+        if (victim == nullptr || query->revocable_bytes() > victim->revocable_bytes()) {
+            victim = query;
+        }
+    }
+    return victim;
+}
+
+} // namespace starrocks::spill
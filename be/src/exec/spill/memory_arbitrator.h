@@ -0,0 +1,57 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace starrocks::spill {
+class QuerySpillManager;
+
+// A BE-wide arbitrator of the revocable memory of the queries which enable spill.
+// Each query reports the revocable memory of its spillable operators through QuerySpillManager. When the
+// memory of the process is close to its limit, the arbitrator asks the query holding the most revocable memory
+// to spill, so the memory is released by spilling instead of cancelling the queries exceeding the limit.
+// It's thread-safe.
+class MemoryArbitrator {
+public:
+    static MemoryArbitrator* instance();
+
+    void register_query(QuerySpillManager* query);
+    void unregister_query(QuerySpillManager* query);
+
+    // Arbitrate by the memory of the query pool, at most once per config::spill_arbitrate_interval_ms.
+    // The caches are not in the query pool, so a warm cache alone never makes queries spill.
+    void maybe_arbitrate();
+
+    // Revoke the memory of a victim query if the consumption exceeds
+    // config::spill_arbitrate_query_pool_mem_ratio of the limit. Return the victim, or nullptr if nothing is revoked.
+    QuerySpillManager* arbitrate(int64_t consumption, int64_t limit);
+
+    size_t num_queries() const;
+
+private:
+    // The victim is the query with the most revocable memory which hasn't been asked to spill. Spilling it
+    // releases the most memory, and the query having less revocable memory loses less progress by going on.
+    QuerySpillManager* _pick_victim() const;
+
+    mutable std::mutex _mutex;
+    std::vector<QuerySpillManager*> _queries;
+    std::atomic<int64_t> _last_arbitrate_ms = 0;
+};
+
+} // namespace starrocks::spill
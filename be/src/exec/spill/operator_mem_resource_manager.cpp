@@ -15,6 +15,7 @@
 #include "exec/spill/operator_mem_resource_manager.h"
 
 #include "exec/pipeline/operator.h"
+#include "util/starrocks_metrics.h"
 
 namespace starrocks::spill {
 void OperatorMemoryResourceManager::prepare(OP* op, QuerySpillManager* query_spill_manager) {
@@ -50,7 +51,29 @@ size_t OperatorMemoryResourceManager::operator_avaliable_memory_bytes() {
     return avaliable;
 }
 
+void OperatorMemoryResourceManager::update_revocable_bytes(int64_t revocable_bytes) {
+    if (!_spillable || revocable_bytes == _reported_revocable_bytes) {
+        return;
+    }
+    _query_spill_manager->update_revocable_bytes(revocable_bytes - _reported_revocable_bytes);
+    _reported_revocable_bytes = revocable_bytes;
+}
+
+bool OperatorMemoryResourceManager::try_revoke_by_arbitrator() {
+    if (!_spillable || _performance_level >= MEM_RESOURCE_LOW_MEMORY || !_query_spill_manager->revoke_requested()) {
+        return false;
+    }
+    to_low_memory_mode();
+    _op->common_metrics()->add_info_string("SpillRevokedByArbitrator");
+    StarRocksMetrics::instance()->spill_arbitrate_revoked_operators_total.increment(1);
+    return true;
+}
+
 void OperatorMemoryResourceManager::close() {
+    if (_query_spill_manager != nullptr && _reported_revocable_bytes != 0) {
+        _query_spill_manager->update_revocable_bytes(-_reported_revocable_bytes);
+        _reported_revocable_bytes = 0;
+    }
     if (_performance_level == MEM_RESOURCE_LOW_MEMORY && _query_spill_manager != nullptr) {
         _query_spill_manager->decrease_spilling_operators();
         _query_spill_manager->decrease_spillable_operators();
@@ -47,6 +47,13 @@ public:
 
     QuerySpillManager* query_spill_manager() const { return _query_spill_manager; }
 
+    // Report the current revocable memory of the operator to the query.
+    void update_revocable_bytes(int64_t revocable_bytes);
+
+    // Turn to low memory mode if MemoryArbitrator has asked the query to spill.
+    // Return true if the operator is turned to low memory mode by this call.
+    bool try_revoke_by_arbitrator();
+
 private:
     // performance level. Determine the execution mode and whether memory can be freed early
     // A higher performance level will allow the operator to execute with less memory, which will reduce performance
@@ -56,5 +63,6 @@ private:
     OP* _op = nullptr;
     QuerySpillManager* _query_spill_manager = nullptr;
     bool _is_releasing = false;
+    int64_t _reported_revocable_bytes = 0;
 };
 } // namespace starrocks::spill
\ No newline at end of file
@@ -21,11 +21,20 @@
 #include "exec/spill/file_block_manager.h"
 #include "exec/spill/hybird_block_manager.h"
 #include "exec/spill/log_block_manager.h"
+#include "exec/spill/memory_arbitrator.h"
 #include "gen_cpp/InternalService_types.h"
 #include "runtime/exec_env.h"
 
 namespace starrocks::spill {
 
+QuerySpillManager::QuerySpillManager(const TUniqueId& uid) : _uid(uid) {
+    MemoryArbitrator::instance()->register_query(this);
+}
+
+QuerySpillManager::~QuerySpillManager() {
+    MemoryArbitrator::instance()->unregister_query(this);
+}
+
 Status QuerySpillManager::init_block_manager(const TQueryOptions& query_options) {
     const TSpillOptions& spill_options = query_options.spill_options;
     bool enable_spill_to_remote_storage =
@@ -27,7 +27,8 @@
 namespace starrocks::spill {
 class QuerySpillManager {
 public:
-    QuerySpillManager(const TUniqueId& uid) : _uid(uid) {}
+    QuerySpillManager(const TUniqueId& uid);
+    ~QuerySpillManager();
 
     Status init_block_manager(const TQueryOptions& query_options);
 
@@ -41,11 +42,24 @@ public:
 
     BlockManager* block_manager() const { return _block_manager.get(); }
 
+    const TUniqueId& query_id() const { return _uid; }
+
+    // The revocable memory of the spillable operators of this query, reported by OperatorMemoryResourceManager.
+    void update_revocable_bytes(int64_t delta) { _revocable_bytes.fetch_add(delta, std::memory_order_relaxed); }
+    int64_t revocable_bytes() const { return _revocable_bytes.load(std::memory_order_relaxed); }
+
+    // Set by MemoryArbitrator when the process is short of memory, then the spillable operators of this query
+    // turn to low memory mode and spill.
+    void request_revoke() { _revoke_requested.store(true, std::memory_order_relaxed); }
+    bool revoke_requested() const { return _revoke_requested.load(std::memory_order_relaxed); }
+
 private:
     TUniqueId _uid;
     std::unique_ptr<BlockManager> _block_manager;
     std::unique_ptr<DirManager> _remote_dir_manager;
     std::atomic_size_t _spilling_operators = 0;
     size_t _spillable_operators = 0;
+    std::atomic<int64_t> _revocable_bytes = 0;
+    std::atomic<bool> _revoke_requested = false;
 };
 } // namespace starrocks::spill
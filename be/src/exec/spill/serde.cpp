@@ -16,6 +16,7 @@
 
 #include <cstring>
 
+#include "common/config.h"
 #include "exec/spill/options.h"
 #include "exec/spill/spiller.h"
 #include "gen_cpp/types.pb.h"
@@ -23,10 +24,60 @@
 #include "runtime/runtime_state.h"
 #include "serde/column_array_serde.h"
 #include "serde/encode_context.h"
+#include "util/compression/block_compression.h"
 #include "util/raw_container.h"
 
 namespace starrocks::spill {
 
+// AdaptiveBlockCompression chooses the codec of the spilled chunks. It tries all the candidates on the first
+// SamplingNum chunks of every _frequency chunks, and then uses the one with the best trade-off for the rest:
+// no compression if none saves enough, ZSTD if it's clearly smaller than LZ4, otherwise LZ4.
+class AdaptiveBlockCompression {
+public:
+    static constexpr uint32_t SamplingNum = 5;
+    static constexpr double CompressRatioLimit = serde::EncodeRatioLimit;
+    // ZSTD is chosen only if its output is at least 20% smaller than LZ4, since it's much slower
+    static constexpr double ZstdPreferRatio = 0.8;
+
+    // return true if the current chunk is used for sampling
+    bool is_sampling() const { return _times % _frequency < SamplingNum; }
+
+    CompressionTypePB compress_type() const { return _compress_type; }
+
+    void update(size_t raw_bytes, size_t lz4_bytes, size_t zstd_bytes) {
+        _raw_bytes += raw_bytes;
+        _lz4_bytes += lz4_bytes;
+        _zstd_bytes += zstd_bytes;
+    }
+
+    // it must be called once after each chunk is serialized
+    void adjust() {
+        ++_times;
+        if (_times % _frequency != SamplingNum) {
+            return;
+        }
+        if (std::min(_lz4_bytes, _zstd_bytes) >= _raw_bytes * CompressRatioLimit) {
+            _compress_type = CompressionTypePB::NO_COMPRESSION;
+        } else if (_zstd_bytes < _lz4_bytes * ZstdPreferRatio) {
+            _compress_type = CompressionTypePB::ZSTD;
+        } else {
+            _compress_type = CompressionTypePB::LZ4;
+        }
+        VLOG_ROW << "spill compress type changed to " << _compress_type << ", raw bytes: " << _raw_bytes
+                 << ", lz4 bytes: " << _lz4_bytes << ", zstd bytes: " << _zstd_bytes;
+        _raw_bytes = _lz4_bytes = _zstd_bytes = 0;
+        _frequency = _frequency > 1000000000 ? _frequency : _frequency * 2;
+    }
+
+private:
+    uint64_t _times = 0;
+    uint64_t _frequency = 64;
+    uint64_t _raw_bytes = 0;
+    uint64_t _lz4_bytes = 0;
+    uint64_t _zstd_bytes = 0;
+    CompressionTypePB _compress_type = CompressionTypePB::NO_COMPRESSION;
+};
+
 class ColumnarSerde : public Serde {
 public:
     ColumnarSerde(Spiller* parent, ChunkBuilder chunk_builder)
@@ -51,14 +102,21 @@ private:
     // data format
     // header|encode levels|attachment...
     // header:
-    // i32 sequence_id|i64 attachment size
+    // i32 sequence_id|i64 attachment size|i32 compress type|i64 compressed size|i64 uncompressed size
+    // if the compress type is not NO_COMPRESSION, the encode levels and the attachment are compressed together.
     static constexpr int32_t SEQUENCE_OFFSET = 0;
     static constexpr int32_t ATTACHMENT_SIZE_OFFSET = SEQUENCE_OFFSET + sizeof(int32_t);
-    static constexpr int32_t HEADER_SIZE = ATTACHMENT_SIZE_OFFSET + sizeof(int64_t);
+    static constexpr int32_t COMPRESS_TYPE_OFFSET = ATTACHMENT_SIZE_OFFSET + sizeof(int64_t);
+    static constexpr int32_t COMPRESSED_SIZE_OFFSET = COMPRESS_TYPE_OFFSET + sizeof(int32_t);
+    static constexpr int32_t UNCOMPRESSED_SIZE_OFFSET = COMPRESSED_SIZE_OFFSET + sizeof(int64_t);
+    static constexpr int32_t HEADER_SIZE = UNCOMPRESSED_SIZE_OFFSET + sizeof(int64_t);
     static constexpr int32_t SEQUENCE_MAGIC_ID = 0xface;
 
     size_t _max_serialized_size(const ChunkPtr& chunk) const;
 
+    // compress the data in place if it's worthwhile, data_size is updated to the compressed size
+    Status _compress(SerdeContext& ctx, uint8_t* data, size_t* data_size, CompressionTypePB* compress_type);
+
     inline const std::vector<uint32_t>& _get_encode_levels() {
         DCHECK(_encode_context != nullptr);
         std::shared_lock l(_mutex);
@@ -80,9 +138,66 @@ private:
     // here a std::shared_mutex is used to ensure concurrency safety.
     std::shared_mutex _mutex;
     std::shared_ptr<serde::EncodeContext> _encode_context;
+    // guarded by _mutex
+    AdaptiveBlockCompression _adaptive_compression;
     DECLARE_RACE_DETECTOR(detect_prepare)
 };
 
+Status ColumnarSerde::_compress(SerdeContext& ctx, uint8_t* data, size_t* data_size, CompressionTypePB* compress_type) {
+    *compress_type = CompressionTypePB::NO_COMPRESSION;
+    const Slice input(data, *data_size);
+    auto try_compress = [&](CompressionTypePB type, size_t* compressed_size) -> Status {
+        const BlockCompressionCodec* codec = nullptr;
+        RETURN_IF_ERROR(get_block_compression_codec(type, &codec));
+        if (codec->exceed_max_input_size(input.size)) {
+            *compressed_size = input.size;
+            return Status::OK();
+        }
+        ctx.compress_buffer.resize(codec->max_compressed_len(input.size));
+        Slice output(ctx.compress_buffer.data(), ctx.compress_buffer.size());
+        RETURN_IF_ERROR(codec->compress(input, &output));
+        *compressed_size = output.size;
+        ctx.compress_buffer.resize(output.size);
+        return Status::OK();
+    };
+
+    bool is_sampling = false;
+    CompressionTypePB type = CompressionTypePB::NO_COMPRESSION;
+    {
+        std::shared_lock l(_mutex);
+        is_sampling = _adaptive_compression.is_sampling();
+        type = _adaptive_compression.compress_type();
+    }
+    size_t compressed_size = input.size;
+    if (is_sampling) {
+        size_t lz4_size = 0;
+        size_t zstd_size = 0;
+        RETURN_IF_ERROR(try_compress(CompressionTypePB::ZSTD, &zstd_size));
+        RETURN_IF_ERROR(try_compress(CompressionTypePB::LZ4, &lz4_size));
+        // keep the LZ4 result in compress_buffer
+        type = CompressionTypePB::LZ4;
+        compressed_size = lz4_size;
+        std::unique_lock l(_mutex);
+        _adaptive_compression.update(input.size, lz4_size, zstd_size);
+        _adaptive_compression.adjust();
+    } else {
+        {
+            std::unique_lock l(_mutex);
+            _adaptive_compression.adjust();
+        }
+        if (type != CompressionTypePB::NO_COMPRESSION) {
+            RETURN_IF_ERROR(try_compress(type, &compressed_size));
+        }
+    }
+
+    if (type != CompressionTypePB::NO_COMPRESSION && compressed_size < input.size) {
+        memcpy(data, ctx.compress_buffer.data(), compressed_size);
+        *data_size = compressed_size;
+        *compress_type = type;
+    }
+    return Status::OK();
+}
+
 size_t ColumnarSerde::_max_serialized_size(const ChunkPtr& chunk) const {
     size_t total_size = 0;
     const auto& columns = chunk->columns();
@@ -111,7 +226,8 @@ Status ColumnarSerde::serialize(RuntimeState* state, SerdeContext& ctx, const Ch
         ctx.serialize_buffer.clear();
         const auto& columns = chunk->columns();
         // header|attachment...
-        // i32 sequence_id|i64 chunk size|encode level|attachment(column data)...
+        // i32 sequence_id|i64 chunk size|i32 compress type|i64 compressed size|i64 uncompressed size|
+        // encode level|attachment(column data)...
         char header_buffer[HEADER_SIZE];
         UNALIGNED_STORE32(header_buffer + SEQUENCE_OFFSET, SEQUENCE_MAGIC_ID);
 
@@ -148,8 +264,24 @@ Status ColumnarSerde::serialize(RuntimeState* state, SerdeContext& ctx, const Ch
             }
         }
         _update_encode_stats(column_stats);
+
+        size_t uncompressed_size = buf - head - HEADER_SIZE;
+        size_t payload_size = uncompressed_size;
+        CompressionTypePB compress_type = CompressionTypePB::NO_COMPRESSION;
+        if (config::spill_enable_adaptive_compression) {
+            uint8_t* payload = reinterpret_cast<uint8_t*>(serialize_buffer.data()) + HEADER_SIZE;
+            RETURN_IF_ERROR(_compress(ctx, payload, &payload_size, &compress_type));
+            if (compress_type != CompressionTypePB::NO_COMPRESSION) {
+                // the padding is added when decompressing
+                padding_size = 0;
+            }
+        }
+        UNALIGNED_STORE32(header_buffer + COMPRESS_TYPE_OFFSET, compress_type);
+        UNALIGNED_STORE64(header_buffer + COMPRESSED_SIZE_OFFSET, payload_size);
+        UNALIGNED_STORE64(header_buffer + UNCOMPRESSED_SIZE_OFFSET, uncompressed_size);
+
         // total serialized size
-        size_t content_length = buf - head;
+        size_t content_length = HEADER_SIZE + payload_size;
         auto align_size = ALIGN_UP(content_length + padding_size, ALIGNED_SIZE);
         serialize_buffer.resize(align_size);
         UNALIGNED_STORE64(header_buffer + ATTACHMENT_SIZE_OFFSET, align_size - HEADER_SIZE);
@@ -167,6 +299,9 @@ StatusOr<ChunkUniquePtr> ColumnarSerde::deserialize(SerdeContext& ctx, BlockRead
 
     int32_t sequence_id = UNALIGNED_LOAD32(header_buffer + SEQUENCE_OFFSET);
     int32_t attachment_size = UNALIGNED_LOAD32(header_buffer + ATTACHMENT_SIZE_OFFSET);
+    auto compress_type = static_cast<CompressionTypePB>(UNALIGNED_LOAD32(header_buffer + COMPRESS_TYPE_OFFSET));
+    int64_t compressed_size = UNALIGNED_LOAD64(header_buffer + COMPRESSED_SIZE_OFFSET);
+    int64_t uncompressed_size = UNALIGNED_LOAD64(header_buffer + UNCOMPRESSED_SIZE_OFFSET);
     if (sequence_id != SEQUENCE_MAGIC_ID) {
         return Status::InternalError(fmt::format("sequence id mismatch {} vs {}", sequence_id, SEQUENCE_MAGIC_ID));
     }
@@ -184,9 +319,24 @@ StatusOr<ChunkUniquePtr> ColumnarSerde::deserialize(SerdeContext& ctx, BlockRead
         RETURN_IF_ERROR(st);
     }
 
+    if (compress_type != CompressionTypePB::NO_COMPRESSION) {
+        const BlockCompressionCodec* codec = nullptr;
+        RETURN_IF_ERROR(get_block_compression_codec(compress_type, &codec));
+        // streamvbyte may read up to STREAMVBYTE_PADDING_SIZE extra bytes from the input
+        ctx.compress_buffer.resize(uncompressed_size + serde::EncodeContext::STREAMVBYTE_PADDING_SIZE);
+        Slice output(ctx.compress_buffer.data(), uncompressed_size);
+        // the attachment may be padded for alignment, so only the compressed bytes are decompressed
+        RETURN_IF_ERROR(codec->decompress(Slice(buf, compressed_size), &output));
+        if (UNLIKELY(output.size != uncompressed_size)) {
+            return Status::InternalError(fmt::format("decompressed size mismatch {} vs {}", output.size,
+                                                     uncompressed_size));
+        }
+        buf = reinterpret_cast<uint8_t*>(ctx.compress_buffer.data());
+    }
+
     const uint32_t* encode_levels = nullptr;
     const uint8_t* read_cursor = buf;
-    encode_levels = reinterpret_cast<uint32_t*>(serialize_buffer.data());
+    encode_levels = reinterpret_cast<const uint32_t*>(buf);
 
     read_cursor += columns.size() * sizeof(uint32_t);
     SCOPED_TIMER(_parent->metrics().deserialize_timer);
@@ -85,6 +85,8 @@ private:
 
 struct SerdeContext {
     raw::RawString serialize_buffer;
+    // used to compress and decompress the serialized data
+    raw::RawString compress_buffer;
 };
 // Serde is used to serialize and deserialize spilled data.
 class Serde;
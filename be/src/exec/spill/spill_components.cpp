@@ -352,6 +352,7 @@ Status PartitionedSpillerWriter::_choose_partitions_to_flush(bool is_final_flush
             const auto& mem_table = partition->spill_writer->mem_table();
             // partition not in memory
             if (!partition->in_mem && partition->level < config::spill_max_partition_level &&
+                partition->ineffective_splits < config::spill_max_ineffective_split_times &&
                 mem_table->mem_usage() + partition->bytes > options().spill_mem_table_bytes_size) {
                 RETURN_IF_ERROR(mem_table->done());
                 partition->in_mem = false;
@@ -524,7 +525,6 @@ Status PartitionedSpillerWriter::_split_input_partitions(workgroup::YieldContext
     auto io_task = std::any_cast<SpillIOTaskContextPtr>(yield_ctx.task_context_data);
     auto& flush_ctx = std::static_pointer_cast<PartitionedFlushContext>(io_task)->split_stage_ctx;
 
-    // TODO: check skew data here
     for (; flush_ctx.spliting_idx < splitting_partitions.size(); flush_ctx.spliting_idx++) {
         // split stage
         auto partition = splitting_partitions[flush_ctx.spliting_idx];
@@ -567,6 +567,8 @@ Status PartitionedSpillerWriter::_split_input_partitions(workgroup::YieldContext
         DCHECK_EQ(flush_ctx.left->spill_writer->block_group_num_rows(), flush_ctx.left->num_rows);
         DCHECK_EQ(flush_ctx.right->spill_writer->block_group_num_rows(), flush_ctx.right->num_rows);
 
+        _mark_ineffective_split(partition, flush_ctx.left.get(), flush_ctx.right.get());
+
         _add_partition(std::move(flush_ctx.right));
         _add_partition(std::move(flush_ctx.left));
 
@@ -579,6 +581,20 @@ Status PartitionedSpillerWriter::_split_input_partitions(workgroup::YieldContext
     return Status::OK();
 }
 
+void PartitionedSpillerWriter::_mark_ineffective_split(const SpilledPartition* partition,
+                                                       SpilledPartition* left_partition,
+                                                       SpilledPartition* right_partition) {
+    // a split is ineffective if the larger child still holds more than 90% of the rows
+    SpilledPartition* larger = left_partition->num_rows >= right_partition->num_rows ? left_partition : right_partition;
+    if (partition->num_rows > 0 && larger->num_rows * 10 > partition->num_rows * 9) {
+        larger->ineffective_splits = partition->ineffective_splits + 1;
+        if (larger->ineffective_splits == config::spill_max_ineffective_split_times) {
+            COUNTER_UPDATE(_spiller->metrics().skewed_partition_count, 1);
+            TRACE_SPILL_LOG << "stop splitting skewed partition " << larger->debug_string();
+        }
+    }
+}
+
 Status PartitionedSpillerWriter::_split_partition(workgroup::YieldContext& yield_ctx, SerdeContext& spill_ctx,
                                                   SpillerReader* reader, SpilledPartition* partition,
                                                   SpilledPartition* left_partition, SpilledPartition* right_partition) {
@@ -217,11 +217,14 @@ struct SpilledPartition : public SpillPartitionInfo {
     }
 
     std::string debug_string() {
-        return fmt::format("[id={},bytes={},mem_size={},num_rows={},in_mem={},is_spliting={}]", partition_id, bytes,
-                           mem_size, num_rows, in_mem, is_spliting);
+        return fmt::format("[id={},bytes={},mem_size={},num_rows={},in_mem={},is_spliting={},ineffective_splits={}]",
+                           partition_id, bytes, mem_size, num_rows, in_mem, is_spliting, ineffective_splits);
     }
 
     bool is_spliting = false;
+    // the number of consecutive splits of its ancestors that left almost all rows in one child.
+    // a partition that keeps failing to split is skewed (e.g. a hot key) and splitting it again only rewrites it.
+    int32_t ineffective_splits = 0;
     std::unique_ptr<RawSpillerWriter> spill_writer;
     BlockGroupPtr block_group;
     SpillOutputDataStreamPtr spill_output_stream;
@@ -352,6 +355,10 @@ private:
     Status _split_input_partitions(workgroup::YieldContext& ctx, SerdeContext& context,
                                    const std::vector<SpilledPartition*>& splitting_partitions);
 
+    // record the split of `partition` didn't spread its rows, so a skewed child won't be split forever
+    void _mark_ineffective_split(const SpilledPartition* partition, SpilledPartition* left_partition,
+                                 SpilledPartition* right_partition);
+
     // split partition by hash
     // hash-based partitioning can have significant degradation in the case of heavily skewed data.
     // TODO:
@@ -77,11 +77,14 @@ SpillProcessMetrics::SpillProcessMetrics(RuntimeProfile* profile, std::atomic_in
             "MemTablePeakMemoryBytes", TUnit::BYTES, RuntimeProfile::Counter::create_strategy(TUnit::BYTES), parent);
     input_stream_peak_memory_usage = profile->AddHighWaterMarkCounter(
             "InputStreamPeakMemoryBytes", TUnit::BYTES, RuntimeProfile::Counter::create_strategy(TUnit::BYTES), parent);
+    prefetch_hit_count = ADD_CHILD_COUNTER(profile, "PrefetchHitCount", TUnit::UNIT, parent);
+    prefetch_stall_count = ADD_CHILD_COUNTER(profile, "PrefetchStallCount", TUnit::UNIT, parent);
 
     sort_chunk_timer = ADD_CHILD_TIMER(profile, "SortChunkTime", parent);
     materialize_chunk_timer = ADD_CHILD_TIMER(profile, "MaterializeChunkTime", parent);
     shuffle_timer = ADD_CHILD_TIMER(profile, "ShuffleTime", parent);
     split_partition_timer = ADD_CHILD_TIMER(profile, "SplitPartitionTime", parent);
+    skewed_partition_count = ADD_CHILD_COUNTER(profile, "SkewedPartitionCount", TUnit::UNIT, parent);
     restore_from_mem_table_rows = ADD_CHILD_COUNTER(profile, "RowsRestoreFromMemTable", TUnit::UNIT, parent);
     restore_from_mem_table_bytes = ADD_CHILD_COUNTER(profile, "BytesRestoreFromMemTable", TUnit::UNIT, parent);
     partition_writer_peak_memory_usage =
@@ -92,6 +92,10 @@ public:
     RuntimeProfile::HighWaterMarkCounter* mem_table_peak_memory_usage = nullptr;
     // peak memory usage of input stream
     RuntimeProfile::HighWaterMarkCounter* input_stream_peak_memory_usage = nullptr;
+    // the number of restored chunks that had been prefetched before the reader asked for them
+    RuntimeProfile::Counter* prefetch_hit_count = nullptr;
+    // the number of restored chunks that the reader had to wait for
+    RuntimeProfile::Counter* prefetch_stall_count = nullptr;
     // time spent to sort chunk before flush
     RuntimeProfile::Counter* sort_chunk_timer = nullptr;
     // time spent to materialize chunk by permutation
@@ -101,6 +105,8 @@ public:
     RuntimeProfile::Counter* shuffle_timer = nullptr;
     // time spent to split partitions, only used in join operator
     RuntimeProfile::Counter* split_partition_timer = nullptr;
+    // the number of partitions that stopped splitting because of data skew, only used in join operator
+    RuntimeProfile::Counter* skewed_partition_count = nullptr;
     // data bytes restored from mem table in memory, only used in join operator
     RuntimeProfile::Counter* restore_from_mem_table_bytes = nullptr;
     // the number of rows restored from mem table in memory, only used in join operator
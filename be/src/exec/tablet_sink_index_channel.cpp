@@ -23,6 +23,7 @@
 #include "common/tracer.h"
 #include "common/utils.h"
 #include "config.h"
+#include "exec/sorting/sorting.h"
 #include "exec/tablet_sink.h"
 #include "exprs/expr_context.h"
 #include "gutil/strings/fastmem.h"
@@ -119,6 +120,42 @@ Status NodeChannel::init(RuntimeState* state) {
     }
     _rpc_request.set_allocated_id(&_parent->_load_id);
 
+    if (config::enable_load_sink_presort && _parent->_keys_type != TKeysType::PRIMARY_KEYS &&
+        _index_tablets_map.size() == 1) {
+        int64_t index_id = _index_tablets_map.begin()->first;
+        for (const auto* index : _parent->_schema->indexes()) {
+            if (index->index_id != index_id) {
+                continue;
+            }
+            const auto& columns = index->column_param->columns;
+            const auto& sort_key_uid = index->column_param->sort_key_uid;
+            std::vector<size_t> sort_key_idxes;
+            if (sort_key_uid.empty()) {
+                for (size_t i = 0; i < columns.size(); ++i) {
+                    if (columns[i]->is_key()) {
+                        sort_key_idxes.push_back(i);
+                    }
+                }
+            } else {
+                for (int32_t uid : sort_key_uid) {
+                    for (size_t i = 0; i < columns.size(); ++i) {
+                        if (columns[i]->unique_id() == uid) {
+                            sort_key_idxes.push_back(i);
+                            break;
+                        }
+                    }
+                }
+            }
+            for (size_t idx : sort_key_idxes) {
+                if (idx >= index->slots.size()) {
+                    _presort_slot_ids.clear();
+                    break;
+                }
+                _presort_slot_ids.push_back(index->slots[idx]->id());
+            }
+        }
+    }
+
     if (state->query_options().__isset.load_transmission_compression_type) {
         _compress_type = CompressionUtils::to_compression_pb(state->query_options().load_transmission_compression_type);
     }
@@ -130,6 +167,9 @@ Status NodeChannel::init(RuntimeState* state) {
             _err_st = Status::InternalError(fmt::format("load_dop should between [1-{}]", config::max_load_dop));
             return _err_st;
         }
+    } else {
+        _max_parallel_request_size =
+                std::clamp<int64_t>(config::tablet_sink_parallel_requests_per_node, 1, config::max_load_dop);
     }
 
     // init add_chunk request closure
@@ -453,6 +493,55 @@ void NodeChannel::_append_data_to_cur_chunk(const Chunk& src, const uint32_t* in
     _cur_chunk_mem_usage += after_consumed_bytes - before_consumed_bytes;
 }
 
+bool NodeChannel::_is_cur_chunk_full() const {
+    size_t num_rows = _cur_chunk->num_rows();
+    if (num_rows == 0) {
+        return false;
+    }
+    if (_cur_chunk_mem_usage >= config::max_tablet_write_chunk_bytes) {
+        return true;
+    }
+    size_t chunk_size = _runtime_state->chunk_size();
+    if (num_rows < chunk_size) {
+        return false;
+    }
+    // coalesce the small rows of many tablets into fewer requests
+    size_t max_coalesce_rows = chunk_size * std::max(config::max_tablet_write_chunk_coalesce_factor, 1);
+    if (config::min_tablet_write_chunk_bytes > 0 && num_rows < max_coalesce_rows) {
+        return _cur_chunk->bytes_usage() >= config::min_tablet_write_chunk_bytes;
+    }
+    return true;
+}
+
+Status NodeChannel::_presort_cur_chunk() {
+    if (_presort_slot_ids.empty() || _cur_chunk == nullptr || _cur_chunk->num_rows() <= 1) {
+        return Status::OK();
+    }
+    size_t num_rows = _cur_chunk->num_rows();
+    Columns columns;
+    for (SlotId slot_id : _presort_slot_ids) {
+        columns.push_back(_cur_chunk->get_column_by_slot_id(slot_id));
+    }
+    // the same order as the memtable sorts its rows, so that the receiver can skip the sort
+    SmallPermutation perm = create_small_permutation(static_cast<uint32_t>(num_rows));
+    RETURN_IF_ERROR(
+            stable_sort_and_tie_columns(false, columns, SortDescs::asc_null_first(columns.size()), &perm));
+    std::vector<uint32_t> selective;
+    permutate_to_selective(perm, &selective);
+
+    auto sorted_chunk = _cur_chunk->clone_empty_with_slot(num_rows);
+    sorted_chunk->append_selective(*_cur_chunk, selective.data(), 0, num_rows);
+    _cur_chunk = std::move(sorted_chunk);
+
+    auto* req = _rpc_request.mutable_requests(0);
+    DCHECK_EQ(req->tablet_ids_size(), num_rows);
+    std::vector<int64_t> tablet_ids(req->tablet_ids().begin(), req->tablet_ids().end());
+    for (size_t i = 0; i < num_rows; ++i) {
+        req->set_tablet_ids(i, tablet_ids[selective[i]]);
+    }
+    return Status::OK();
+}
+
 Status NodeChannel::add_chunk(Chunk* input, const std::vector<int64_t>& tablet_ids,
                               const std::vector<uint32_t>& indexes, uint32_t from, uint32_t size) {
     if (_cancelled || _closed) {
@@ -491,8 +580,7 @@ Status NodeChannel::add_chunk(Chunk* input, const std::vector<int64_t>& tablet_i
         }
     }
 
-    if (_cur_chunk->num_rows() <= 0 || (_cur_chunk->num_rows() < _runtime_state->chunk_size() &&
-                                        _cur_chunk_mem_usage < config::max_tablet_write_chunk_bytes)) {
+    if (!_is_cur_chunk_full()) {
         // 2. chunk not full
         if (_request_queue.empty()) {
             return Status::OK();
@@ -500,6 +588,7 @@ Status NodeChannel::add_chunk(Chunk* input, const std::vector<int64_t>& tablet_i
         // passthrough: try to send data if queue not empty
     } else {
         // 3. chunk full push back to queue
+        RETURN_IF_ERROR(_presort_cur_chunk());
         _mem_tracker->consume(_cur_chunk->memory_usage());
         _request_queue.emplace_back(std::move(_cur_chunk), _rpc_request);
         _reset_cur_chunk(input);
@@ -544,8 +633,7 @@ Status NodeChannel::add_chunks(Chunk* input, const std::vector<std::vector<int64
         }
     }
 
-    if (_cur_chunk->num_rows() <= 0 || (_cur_chunk->num_rows() < _runtime_state->chunk_size() &&
-                                        _cur_chunk_mem_usage < config::max_tablet_write_chunk_bytes)) {
+    if (!_is_cur_chunk_full()) {
         // 2. chunk not full
         if (_request_queue.empty()) {
             return Status::OK();
@@ -636,6 +724,7 @@ Status NodeChannel::_send_request(bool eos, bool finished) {
             if (_cur_chunk.get() == nullptr) {
                 _cur_chunk = std::make_unique<Chunk>();
             }
+            RETURN_IF_ERROR(_presort_cur_chunk());
             _mem_tracker->consume(_cur_chunk->memory_usage());
             _request_queue.emplace_back(std::move(_cur_chunk), _rpc_request);
             _cur_chunk = nullptr;
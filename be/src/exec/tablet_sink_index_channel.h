@@ -189,6 +189,10 @@ private:
 
     void _reset_cur_chunk(Chunk* input);
     void _append_data_to_cur_chunk(const Chunk& src, const uint32_t* indexes, uint32_t from, uint32_t size);
+    // whether _cur_chunk should be queued as a request, see min_tablet_write_chunk_bytes
+    bool _is_cur_chunk_full() const;
+    // sort the rows of _cur_chunk and their tablet ids by the sort key of the index, see enable_load_sink_presort
+    Status _presort_cur_chunk();
 
     void _try_diagnose(const std::string& error_text);
     bool _is_diagnose_done();
@@ -248,6 +252,8 @@ private:
     std::vector<ReusableClosure<PTabletWriterAddBatchResult>*> _add_batch_closures;
     std::unique_ptr<Chunk> _cur_chunk;
     int64_t _cur_chunk_mem_usage = 0;
+    // slots of the sort key columns to sort _cur_chunk by before it is sent, empty if not pre-sorting
+    std::vector<SlotId> _presort_slot_ids;
 
     PTabletWriterAddChunksRequest _rpc_request;
     using AddMultiChunkReq = std::pair<std::unique_ptr<Chunk>, PTabletWriterAddChunksRequest>;
@@ -15,6 +15,7 @@
 
 #include <utility>
 
+#include "common/config.h"
 #include "exec/pipeline/pipeline.h"
 #include "exec/pipeline/pipeline_driver_executor.h"
 #include "exec/pipeline/pipeline_metrics.h"
@@ -98,6 +99,7 @@ Status PipelineExecutorSet::start() {
                             .set_idle_timeout(MonoDelta::FromMilliseconds(2000))
                             .set_cpuids(_cpuids)
                             .set_borrowed_cpuids(_borrowed_cpu_ids)
+                            .set_bind_numa_node(config::enable_pipeline_numa_aware_bind_cpus)
                             .build(&driver_executor_thread_pool));
     _driver_executor = std::make_unique<pipeline::GlobalDriverExecutor>(_name, std::move(driver_executor_thread_pool),
                                                                         true, _cpuids, _conf.metrics);
@@ -111,6 +113,7 @@ Status PipelineExecutorSet::start() {
                             .set_idle_timeout(MonoDelta::FromMilliseconds(2000))
                             .set_cpuids(_cpuids)
                             .set_borrowed_cpuids(_borrowed_cpu_ids)
+                            .set_bind_numa_node(config::enable_pipeline_numa_aware_bind_cpus)
                             .build(&scan_thread_pool));
     _scan_executor = std::make_unique<ScanExecutor>(std::move(scan_thread_pool),
                                                     std::make_unique<WorkGroupScanTaskQueue>(ScanSchedEntityType::OLAP),
@@ -125,6 +128,7 @@ Status PipelineExecutorSet::start() {
                             .set_idle_timeout(MonoDelta::FromMilliseconds(2000))
                             .set_cpuids(_cpuids)
                             .set_borrowed_cpuids(_borrowed_cpu_ids)
+                            .set_bind_numa_node(config::enable_pipeline_numa_aware_bind_cpus)
                             .build(&connector_scan_thread_pool));
     _connector_scan_executor =
             std::make_unique<ScanExecutor>(std::move(connector_scan_thread_pool),
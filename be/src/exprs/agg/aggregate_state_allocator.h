@@ -23,6 +23,84 @@ namespace starrocks {
 
 inline thread_local Allocator* tls_agg_state_allocator = nullptr;
 
+// Size-class free lists for the small blocks allocated by containers inside agg states (distinct sets,
+// array_agg/group_concat buffers...). With many groups these containers keep allocating and freeing small
+// buffers while they grow, the cache recycles them without going through malloc and the mem hook, and
+// returns them to the allocator in bulk by release().
+// Not thread safe, it is owned by one Aggregator.
+class AggStateBlockCache {
+public:
+    static constexpr size_t kClassSize = 16;
+    static constexpr size_t kMaxBlockSize = 512;
+    // beyond this the freed blocks go back to the allocator directly
+    static constexpr size_t kMaxCachedBytes = 16 * 1024 * 1024;
+
+    explicit AggStateBlockCache(Allocator* allocator) : _allocator(allocator) {}
+    ~AggStateBlockCache() { release(); }
+
+    AggStateBlockCache(const AggStateBlockCache&) = delete;
+    AggStateBlockCache& operator=(const AggStateBlockCache&) = delete;
+
+    // Small blocks are always rounded to their size class, so a block allocated without a cache can be
+    // recycled by one later.
+    static size_t block_size(size_t size) {
+        return size <= kMaxBlockSize ? (size + kClassSize - 1) / kClassSize * kClassSize : size;
+    }
+
+    static bool is_cached_size(size_t size) { return size > 0 && size <= kMaxBlockSize; }
+
+    // size must be a block_size() that is_cached_size()
+    void* allocate(size_t size) {
+        DCHECK(is_cached_size(size) && size % kClassSize == 0);
+        FreeBlock*& head = _free_lists[size / kClassSize - 1];
+        if (head != nullptr) {
+            FreeBlock* block = head;
+            head = block->next;
+            _cached_bytes -= size;
+            return block;
+        }
+        return _allocator->checked_alloc(size);
+    }
+
+    void deallocate(void* ptr, size_t size) {
+        DCHECK(is_cached_size(size) && size % kClassSize == 0);
+        if (_cached_bytes + size > kMaxCachedBytes) {
+            _allocator->free(ptr);
+            return;
+        }
+        auto* block = static_cast<FreeBlock*>(ptr);
+        FreeBlock*& head = _free_lists[size / kClassSize - 1];
+        block->next = head;
+        head = block;
+        _cached_bytes += size;
+    }
+
+    // Return all cached blocks to the allocator.
+    void release() {
+        for (auto& head : _free_lists) {
+            while (head != nullptr) {
+                FreeBlock* next = head->next;
+                _allocator->free(head);
+                head = next;
+            }
+        }
+        _cached_bytes = 0;
+    }
+
+    size_t cached_bytes() const { return _cached_bytes; }
+
+private:
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    Allocator* _allocator;
+    FreeBlock* _free_lists[kMaxBlockSize / kClassSize] = {};
+    size_t _cached_bytes = 0;
+};
+
+inline thread_local AggStateBlockCache* tls_agg_state_block_cache = nullptr;
+
 template <class T>
 class AggregateStateAllocator {
 public:
@@ -44,11 +122,20 @@ public:
 
     T* allocate(size_t n) {
         DCHECK(tls_agg_state_allocator != nullptr);
-        return static_cast<T*>(tls_agg_state_allocator->checked_alloc(n * sizeof(T)));
+        size_t size = AggStateBlockCache::block_size(n * sizeof(T));
+        if (tls_agg_state_block_cache != nullptr && AggStateBlockCache::is_cached_size(size)) {
+            return static_cast<T*>(tls_agg_state_block_cache->allocate(size));
+        }
+        return static_cast<T*>(tls_agg_state_allocator->checked_alloc(size));
     }
 
     void deallocate(T* ptr, size_t n) {
         DCHECK(tls_agg_state_allocator != nullptr);
+        size_t size = AggStateBlockCache::block_size(n * sizeof(T));
+        if (tls_agg_state_block_cache != nullptr && AggStateBlockCache::is_cached_size(size)) {
+            tls_agg_state_block_cache->deallocate(ptr, size);
+            return;
+        }
         tls_agg_state_allocator->free(ptr);
     }
 
@@ -72,17 +159,24 @@ void swap(AggregateStateAllocator<T>& lhs, AggregateStateAllocator<T>& rhs) {
 
 class ThreadLocalAggregateStateAllocatorSetter {
 public:
-    ThreadLocalAggregateStateAllocatorSetter(Allocator* allocator) {
+    // block_cache must allocate from allocator, it is reset for the scope when not given.
+    ThreadLocalAggregateStateAllocatorSetter(Allocator* allocator, AggStateBlockCache* block_cache = nullptr) {
         _prev = tls_agg_state_allocator;
+        _prev_block_cache = tls_agg_state_block_cache;
         tls_agg_state_allocator = allocator;
+        tls_agg_state_block_cache = block_cache;
+    }
+    ~ThreadLocalAggregateStateAllocatorSetter() {
+        tls_agg_state_allocator = _prev;
+        tls_agg_state_block_cache = _prev_block_cache;
     }
-    ~ThreadLocalAggregateStateAllocatorSetter() { tls_agg_state_allocator = _prev; }
 
 private:
     Allocator* _prev = nullptr;
+    AggStateBlockCache* _prev_block_cache = nullptr;
 };
-#define SCOPED_THREAD_LOCAL_AGG_STATE_ALLOCATOR_SETTER(allocator) \
-    auto VARNAME_LINENUM(alloc_setter) = ThreadLocalAggregateStateAllocatorSetter(allocator)
+#define SCOPED_THREAD_LOCAL_AGG_STATE_ALLOCATOR_SETTER(...) \
+    auto VARNAME_LINENUM(alloc_setter) = ThreadLocalAggregateStateAllocatorSetter(__VA_ARGS__)
 
 template <typename T>
 using HashSetWithAggStateAllocator =
@@ -100,8 +194,8 @@ using VectorWithAggStateAllocator = std::vector<T, AggregateStateAllocator<T>>;
 // Thread local aggregate state allocator setter with roaring allocator
 class ThreadLocalStateAllocatorSetter {
 public:
-    ThreadLocalStateAllocatorSetter(Allocator* allocator)
-            : _agg_state_allocator_setter(allocator), _roaring_allocator_setter(allocator) {}
+    ThreadLocalStateAllocatorSetter(Allocator* allocator, AggStateBlockCache* block_cache = nullptr)
+            : _agg_state_allocator_setter(allocator, block_cache), _roaring_allocator_setter(allocator) {}
     ~ThreadLocalStateAllocatorSetter() = default;
 
 private:
@@ -109,7 +203,7 @@ private:
     ThreadLocalRoaringAllocatorSetter _roaring_allocator_setter;
 };
 
-#define SCOPED_THREAD_LOCAL_STATE_ALLOCATOR_SETTER(allocator) \
-    auto VARNAME_LINENUM(alloc_setter) = ThreadLocalStateAllocatorSetter(allocator)
+#define SCOPED_THREAD_LOCAL_STATE_ALLOCATOR_SETTER(...) \
+    auto VARNAME_LINENUM(alloc_setter) = ThreadLocalStateAllocatorSetter(__VA_ARGS__)
 
 } // namespace starrocks
@@ -54,6 +54,16 @@ public:
         }
     }
 
+    void update_batch_single_state(FunctionContext* ctx, size_t chunk_size, const Column** columns,
+                                   AggDataPtr __restrict state) const override {
+        batch_intersect(down_cast<const BitmapColumn*>(columns[0]), 0, chunk_size, state);
+    }
+
+    void merge_batch_single_state(FunctionContext* ctx, AggDataPtr __restrict state, const Column* column, size_t start,
+                                  size_t size) const override {
+        batch_intersect(down_cast<const BitmapColumn*>(column), start, start + size, state);
+    }
+
     void serialize_to_column(FunctionContext* ctx, ConstAggDataPtr __restrict state, Column* to) const override {
         auto* col = down_cast<BitmapColumn*>(to);
         auto& bitmap = const_cast<BitmapValue&>(this->data(state).bitmap);
@@ -72,6 +82,24 @@ public:
     }
 
     std::string get_name() const override { return "bitmap_intersect"; }
+
+private:
+    void batch_intersect(const BitmapColumn* col, size_t start, size_t end, AggDataPtr __restrict state) const {
+        if (start >= end) {
+            return;
+        }
+        auto& packed = this->data(state);
+        if (!packed.initial) {
+            packed.bitmap |= *(col->get_object(start++));
+            packed.initial = true;
+        }
+        std::vector<const BitmapValue*> values;
+        values.reserve(end - start);
+        for (size_t i = start; i < end; ++i) {
+            values.push_back(col->get_object(i));
+        }
+        packed.bitmap.fast_intersect(values);
+    }
 };
 
 } // namespace starrocks
@@ -49,13 +49,20 @@ public:
         col->append(std::move(bitmap));
     }
 
+    void update_batch_single_state(FunctionContext* ctx, size_t chunk_size, const Column** columns,
+                                   AggDataPtr __restrict state) const override {
+        batch_union(down_cast<const BitmapColumn*>(columns[0]), 0, chunk_size, state);
+    }
+
+    void merge_batch_single_state(FunctionContext* ctx, AggDataPtr __restrict state, const Column* column, size_t start,
+                                  size_t size) const override {
+        batch_union(down_cast<const BitmapColumn*>(column), start, start + size, state);
+    }
+
     void update_batch_single_state_with_frame(FunctionContext* ctx, AggDataPtr __restrict state, const Column** columns,
                                               int64_t peer_group_start, int64_t peer_group_end, int64_t frame_start,
                                               int64_t frame_end) const override {
-        const auto* col = down_cast<const BitmapColumn*>(columns[0]);
-        for (size_t i = frame_start; i < frame_end; ++i) {
-            this->data(state) |= *(col->get_object(i));
-        }
+        batch_union(down_cast<const BitmapColumn*>(columns[0]), frame_start, frame_end, state);
     }
 
     void convert_to_serialize_format(FunctionContext* ctx, const Columns& src, size_t chunk_size,
@@ -78,6 +85,17 @@ public:
     }
 
     std::string get_name() const override { return "bitmap_union"; }
+
+private:
+    // Union the bitmaps of rows [start, end) at once instead of OR-ing them one by one.
+    void batch_union(const BitmapColumn* col, size_t start, size_t end, AggDataPtr __restrict state) const {
+        std::vector<const BitmapValue*> values;
+        values.reserve(end - start);
+        for (size_t i = start; i < end; ++i) {
+            values.push_back(col->get_object(i));
+        }
+        this->data(state).fast_union(values);
+    }
 };
 
 } // namespace starrocks
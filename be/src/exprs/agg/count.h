@@ -170,10 +170,12 @@ public:
             const auto* nullable_column = down_cast<const NullableColumn*>(columns[0]);
             const uint8_t* null_data = nullable_column->immutable_null_column_data().data();
             for (size_t i = 0; i < chunk_size; ++i) {
+                prefetch_agg_state(states, state_offset, i, chunk_size);
                 this->data(states[i] + state_offset).count += !null_data[i];
             }
         } else {
             for (size_t i = 0; i < chunk_size; ++i) {
+                prefetch_agg_state(states, state_offset, i, chunk_size);
                 this->data(states[i] + state_offset).count++;
             }
         }
@@ -84,6 +84,8 @@ struct DistinctAggregateState<LT, SumLT, FixedLengthLTGuard<LT>> {
         } else {
             MyHashSet set_src;
             [[maybe_unused]] auto err = set_src.load(input);
+            // merging a large partial set into a large one would otherwise resize several times on the way
+            set.reserve(old_size + set_src.size());
             set.merge(set_src);
         }
     }
@@ -313,7 +315,9 @@ struct DistinctAggregateStateV2<LT, SumLT, FixedLengthLTGuard<LT>> {
     void deserialize_and_merge(const uint8_t* src, size_t len) {
         size_t size = 0;
         memcpy(&size, src, sizeof(size));
-        set.rehash(set.size() + size);
+        // reserve() accounts for the max load factor, rehash(n) alone would still grow once more when the
+        // merged keys are mostly new
+        set.reserve(set.size() + size);
 
         src += sizeof(size);
         for (size_t i = 0; i < size; i++) {
@@ -66,32 +66,41 @@ public:
         }
     }
 
+    void update_batch_single_state(FunctionContext* ctx, size_t chunk_size, const Column** columns,
+                                   AggDataPtr __restrict state) const override {
+        update_state_range(ctx, state, columns[0], 0, chunk_size);
+    }
+
     void update_batch_single_state_with_frame(FunctionContext* ctx, AggDataPtr __restrict state, const Column** columns,
                                               int64_t peer_group_start, int64_t peer_group_end, int64_t frame_start,
                                               int64_t frame_end) const override {
-        const auto* column = down_cast<const ColumnType*>(columns[0]);
+        update_state_range(ctx, state, columns[0], frame_start, frame_end);
+    }
+
+    // Hash the rows [start, end) into a buffer first, then update the registers in one batch.
+    void update_state_range(FunctionContext* ctx, AggDataPtr __restrict state, const Column* input, size_t start,
+                            size_t end) const {
+        if (start >= end) {
+            return;
+        }
+        const auto* column = down_cast<const ColumnType*>(input);
+        std::vector<uint64_t> hash_values(end - start);
 
         if constexpr (lt_is_string<LT>) {
-            uint64_t value = 0;
-            for (size_t i = frame_start; i < frame_end; ++i) {
+            for (size_t i = start; i < end; ++i) {
                 Slice s = column->get_slice(i);
-                value = HashUtil::murmur_hash64A(s.data, s.size, HashUtil::MURMUR_SEED);
-
-                if (value != 0) {
-                    update_state(ctx, state, value);
-                }
+                hash_values[i - start] = HashUtil::murmur_hash64A(s.data, s.size, HashUtil::MURMUR_SEED);
             }
         } else {
-            uint64_t value = 0;
             const auto& v = column->get_data();
-            for (size_t i = frame_start; i < frame_end; ++i) {
-                value = HashUtil::murmur_hash64A(&v[i], sizeof(v[i]), HashUtil::MURMUR_SEED);
-
-                if (value != 0) {
-                    update_state(ctx, state, value);
-                }
+            for (size_t i = start; i < end; ++i) {
+                hash_values[i - start] = HashUtil::murmur_hash64A(&v[i], sizeof(v[i]), HashUtil::MURMUR_SEED);
             }
         }
+
+        int64_t prev_memory = this->data(state).mem_usage();
+        this->data(state).update_batch(hash_values.data(), hash_values.size());
+        ctx->add_mem_usage(this->data(state).mem_usage() - prev_memory);
     }
 
     void merge(FunctionContext* ctx, const Column* column, AggDataPtr __restrict state, size_t row_num) const override {
@@ -350,6 +350,7 @@ public:
             // all not null
             if (!columns[0]->has_null()) {
                 for (size_t i = 0; i < chunk_size; i++) {
+                    prefetch_agg_state(states, state_offset, i, chunk_size);
                     this->data(states[i] + state_offset).is_null = false;
                     this->nested_function->update(ctx, &data_column,
                                                   this->data(states[i] + state_offset).mutable_nest_state(), i);
@@ -457,6 +458,7 @@ public:
             }
         } else {
             for (size_t i = 0; i < chunk_size; ++i) {
+                prefetch_agg_state(states, state_offset, i, chunk_size);
                 this->data(states[i] + state_offset).is_null = false;
                 this->nested_function->update(ctx, columns, this->data(states[i] + state_offset).mutable_nest_state(),
                                               i);
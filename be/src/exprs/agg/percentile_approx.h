@@ -52,23 +52,26 @@ public:
         double quantile;
         memcpy(&quantile, src.data, sizeof(double));
 
-        PercentileApproxState src_percentile(get_compression_factor(ctx));
-        src_percentile.targetQuantile = quantile;
-        src_percentile.percentile->deserialize((char*)src.data + sizeof(double));
+        // deserialize restores the compression of the source, no need for a heap allocated state per row
+        PercentileValue src_percentile;
+        src_percentile.deserialize((char*)src.data + sizeof(double));
 
         int64_t prev_memory = data(state).percentile->mem_usage();
-        data(state).percentile->merge(src_percentile.percentile.get());
+        data(state).percentile->merge(&src_percentile);
         data(state).targetQuantile = quantile;
         ctx->add_mem_usage(data(state).percentile->mem_usage() - prev_memory);
     }
 
     void serialize_to_column(FunctionContext* ctx, ConstAggDataPtr __restrict state, Column* to) const override {
-        size_t size = data(state).percentile->serialize_size();
-        uint8_t result[size + sizeof(double)];
-        memcpy(result, &(data(state).targetQuantile), sizeof(double));
-        data(state).percentile->serialize(result + sizeof(double));
+        // a digest can take hundreds of KB, serialize it in place instead of through a stack buffer
         auto* column = down_cast<BinaryColumn*>(to);
-        column->append(Slice(result, size));
+        Bytes& bytes = column->get_bytes();
+        size_t old_size = bytes.size();
+        size_t new_size = old_size + sizeof(double) + data(state).percentile->serialize_size();
+        bytes.resize(new_size);
+        memcpy(bytes.data() + old_size, &(data(state).targetQuantile), sizeof(double));
+        data(state).percentile->serialize(bytes.data() + old_size + sizeof(double));
+        column->get_offset().emplace_back(new_size);
     }
 
     void finalize_to_column(FunctionContext* ctx, ConstAggDataPtr __restrict state, Column* to) const override {
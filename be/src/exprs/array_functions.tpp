@@ -97,15 +97,24 @@ private:
     static void _array_distinct_item(const ArrayColumn& column, size_t index, HashSet* hash_set,
                                      ArrayColumn* dest_column) {
         bool has_null = false;
-        // TODO: may be has performance problem, optimize later
-        Datum v = column.get(index);
-        const auto& items = v.get<DatumArray>();
+        // read the flattened elements directly instead of materializing a DatumArray per row
+        const auto* elements_column = column.elements_column().get();
+        const auto& offsets = column.offsets().get_data();
+        const NullColumn::ValueType* nulls = nullptr;
+        if (elements_column->is_nullable()) {
+            const auto* nullable_column = down_cast<const NullableColumn*>(elements_column);
+            if (nullable_column->has_null()) {
+                nulls = nullable_column->null_column()->get_data().data();
+            }
+            elements_column = nullable_column->data_column().get();
+        }
+        const auto& datas = GetContainer<LT>::get_data(elements_column);
 
         auto& dest_data_column = dest_column->elements_column();
         auto& dest_offsets = dest_column->offsets_column()->get_data();
 
-        for (const auto& item : items) {
-            if (item.is_null()) {
+        for (size_t i = offsets[index]; i < offsets[index + 1]; i++) {
+            if (nulls != nullptr && nulls[i]) {
                 if (!has_null) {
                     dest_data_column->append_nulls(1);
                     has_null = true;
@@ -113,9 +122,8 @@ private:
                 continue;
             }
 
-            const auto& tt = item.get<CppType>();
-            if (hash_set->count(tt) == 0) {
-                hash_set->emplace(tt);
+            const CppType& tt = datas[i];
+            if (hash_set->emplace(tt).second) {
                 dest_data_column->append_datum(tt);
             }
         }
@@ -79,6 +79,8 @@ struct DecimalBinaryFunction {
             rhs_datum = rhs_data[0];
         }
 
+        // overflows are recorded without branching inside the loop and reported once after it
+        [[maybe_unused]] bool any_overflow = false;
         for (auto i = 0; i < num_rows; ++i) {
             if constexpr (lhs_is_const && rhs_is_const) {
                 overflow = BinaryOperator::template apply<check_overflow<overflow_mode>, false, LhsCppType, RhsCppType,
@@ -98,15 +100,20 @@ struct DecimalBinaryFunction {
                                                                                      &result_data[i], scale_factor);
             }
             if constexpr (check_overflow<overflow_mode>) {
-                if (overflow) {
-                    if constexpr (error_if_overflow<overflow_mode>) {
-                        throw std::overflow_error(strings::Substitute(
-                                "The '$0' operation involving decimal values overflows", get_op_name<Op>()));
-                    } else {
-                        static_assert(null_if_overflow<overflow_mode>);
-                        *has_null = true;
-                        nulls[i] = DATUM_NULL;
-                    }
+                if constexpr (null_if_overflow<overflow_mode>) {
+                    nulls[i] = overflow ? DATUM_NULL : DATUM_NOT_NULL;
+                }
+                any_overflow |= overflow;
+            }
+        }
+        if constexpr (check_overflow<overflow_mode>) {
+            if (any_overflow) {
+                if constexpr (error_if_overflow<overflow_mode>) {
+                    throw std::overflow_error(strings::Substitute(
+                            "The '$0' operation involving decimal values overflows", get_op_name<Op>()));
+                } else {
+                    static_assert(null_if_overflow<overflow_mode>);
+                    *has_null = true;
                 }
             }
         }
@@ -359,6 +359,9 @@ StatusOr<ColumnPtr> GeoFunctions::st_contains(FunctionContext* context, const Co
 
     auto size = columns[0]->size();
     ColumnBuilder<TYPE_BOOLEAN> result(size);
+    // Points are the common non-constant argument (e.g. a polygon containing a column of points),
+    // decode them into reused objects instead of allocating a new shape for every row.
+    GeoPoint points[2];
     for (int row = 0; row < size; ++row) {
         if (lhs_viewer.is_null(row) || rhs_viewer.is_null(row)) {
             result.append_null();
@@ -375,6 +378,12 @@ StatusOr<ColumnPtr> GeoFunctions::st_contains(FunctionContext* context, const Co
         for (i = 0; i < 2; ++i) {
             if (state != nullptr && state->shapes[i] != nullptr) {
                 shapes[i] = state->shapes[i];
+            } else if (strs[i]->size >= 2 && strs[i]->data[1] == GEO_SHAPE_POINT) {
+                if (!points[i].decode_from(strs[i]->data, strs[i]->size)) {
+                    result.append_null();
+                    break;
+                }
+                shapes[i] = &points[i];
             } else {
                 shapes[i] = local_state.shapes[i] = GeoShape::from_encoded(strs[i]->data, strs[i]->size);
                 if (shapes[i] == nullptr) {
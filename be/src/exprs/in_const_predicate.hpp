@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <algorithm>
+
 #include "column/chunk.h"
 #include "column/column_builder.h"
 #include "column/column_helper.h"
@@ -76,6 +78,8 @@ public:
               _is_join_runtime_filter(other._is_join_runtime_filter),
               _eq_null(other._eq_null),
               _array_size(other._array_size),
+              _array_offset(other._array_offset),
+              _array_from_hash_set(other._array_from_hash_set),
               _array_buffer(other._array_buffer),
               _hash_set(other._hash_set),
               _string_values(other._string_values) {}
@@ -102,6 +106,7 @@ public:
     Status merge(Predicate* predicate) override {
         if (auto* that = dynamic_cast<typeof(this)>(predicate)) {
             const auto& hash_set = that->hash_set();
+            _reset_dense_array();
             _hash_set.insert(hash_set.begin(), hash_set.end());
             _null_in_set = _null_in_set || that->null_in_set();
             return Status::OK();
@@ -141,7 +146,7 @@ public:
                 }
             }
 
-            bool use_array = is_use_array();
+            bool use_array = is_use_array() && !_array_from_hash_set;
             for (int i = 1; i < _children.size(); ++i) {
                 if ((_children[0]->type().is_string_type() && _children[i]->type().is_string_type()) ||
                     (_children[0]->type().type == _children[i]->type().type) ||
@@ -178,6 +183,7 @@ public:
                     _hash_set.emplace(viewer.value(0));
                 }
             }
+            _try_build_dense_array();
         }
         return Status::OK();
     }
@@ -344,7 +350,7 @@ public:
                 values->append_datum(v);
             }
             if constexpr (can_use_array()) {
-                if (is_use_array()) {
+                if (is_use_array() && !_array_from_hash_set) {
                     for (size_t i = 0; i < _array_size; i++) {
                         if (_array_buffer[i]) {
                             values->append_datum(static_cast<ValueType>(i)); //NOLINT
@@ -360,9 +366,16 @@ public:
         return values;
     }
 
-    void insert(const ValueType& value) { _hash_set.emplace(value); }
+    void insert(const ValueType& value) {
+        _reset_dense_array();
+        _hash_set.emplace(value);
+    }
 
     void insert_array(const ValueType& value) {
+        if (UNLIKELY(_array_from_hash_set)) {
+            insert(value);
+            return;
+        }
         if constexpr (can_use_array()) {
             _set_array_index(value);
         }
@@ -405,8 +418,50 @@ private:
     // Since the bitmap size is quite small, we can use trade memory usage for performance
     // According to experiments, there is 20% performance gain.
 
-    void _set_array_index(int64_t index) { _array_buffer[index] = 1; }
-    uint8_t _get_array_index(int64_t index) const { return _array_buffer[index]; }
+    void _set_array_index(int64_t index) { _array_buffer[index - _array_offset] = 1; }
+    uint8_t _get_array_index(int64_t index) const {
+        // unsigned compare also rejects values below _array_offset
+        auto pos = static_cast<uint64_t>(index) - static_cast<uint64_t>(_array_offset);
+        return pos < static_cast<uint64_t>(_array_size) ? _array_buffer[pos] : 0;
+    }
+
+    // Constant integer lists whose values are dense enough are also kept as a byte array indexed by
+    // value - min, so a probe is a bounds check and a load instead of a hash lookup. _hash_set keeps the
+    // values, because storage pushdown and the connectors read them from there.
+    void _try_build_dense_array() {
+        if constexpr (can_use_array()) {
+            if (is_use_array() || _hash_set.empty()) {
+                return;
+            }
+            auto [min_it, max_it] = std::minmax_element(_hash_set.begin(), _hash_set.end());
+            auto min_value = static_cast<int64_t>(*min_it);
+            auto range = static_cast<uint64_t>(static_cast<int64_t>(*max_it)) - static_cast<uint64_t>(min_value) + 1;
+            if (range == 0 || range > kMaxDenseArraySize || range > _hash_set.size() * kMaxDenseArrayRatio) {
+                return;
+            }
+            _array_offset = min_value;
+            _array_size = static_cast<int>(range);
+            _array_from_hash_set = true;
+            _array_buffer.assign(_array_size, 0);
+            for (const auto& v : _hash_set) {
+                _set_array_index(v);
+            }
+        }
+    }
+
+    // Values added after the dense array was built only go to _hash_set, fall back to it.
+    void _reset_dense_array() {
+        if (UNLIKELY(_array_from_hash_set)) {
+            _array_from_hash_set = false;
+            _array_size = 0;
+            _array_offset = 0;
+            _array_buffer.clear();
+        }
+    }
+
+    static constexpr uint64_t kMaxDenseArraySize = 1 << 20;
+    // at least one of every kMaxDenseArrayRatio values in [min, max] must be in the set
+    static constexpr uint64_t kMaxDenseArrayRatio = 64;
 
     void _init_array_buffer() {
         if constexpr (can_use_array()) {
@@ -422,6 +477,9 @@ private:
     bool _is_join_runtime_filter = false;
     bool _eq_null = false;
     int _array_size = 0;
+    // smallest value of the set when the array is built by _try_build_dense_array, dict codes start from 0
+    int64_t _array_offset = 0;
+    bool _array_from_hash_set = false;
     std::vector<uint8_t> _array_buffer;
 
     in_const_pred_detail::LHashSetType<Type> _hash_set;
@@ -138,6 +138,9 @@ Status LikePredicate::like_prepare(FunctionContext* context, FunctionContext::Fu
         remove_escape_character(&search_string);
         state->set_search_string(search_string);
         state->function = &constant_substring_fn;
+    } else if (split_like_pattern_by_percent(pattern, state->escape_char, &state->like_pieces,
+                                             &state->like_anchor_start, &state->like_anchor_end)) {
+        state->function = &constant_pieces_fn;
     } else {
         auto re_pattern = LikePredicate::template convert_like_pattern<true>(context, pattern);
         RETURN_IF_ERROR(compile_with_hyperscan_or_re2<true>(re_pattern, state, context, pattern));
@@ -391,6 +394,146 @@ StatusOr<ColumnPtr> LikePredicate::constant_substring_fn(FunctionContext* contex
     return res;
 }
 
+bool LikePredicate::split_like_pattern_by_percent(const Slice& pattern, char escape_char,
+                                                  std::vector<std::string>* pieces, bool* anchor_start,
+                                                  bool* anchor_end) {
+    pieces->clear();
+    std::string piece;
+    for (size_t i = 0; i < pattern.size; i++) {
+        char c = pattern.data[i];
+        if (c == escape_char) {
+            if (i + 1 == pattern.size) {
+                return false;
+            }
+            piece.append(1, pattern.data[++i]);
+        } else if (c == '_') {
+            return false;
+        } else if (c == '%') {
+            // the first piece is empty if the pattern starts with '%'
+            if (!piece.empty() || pieces->empty()) {
+                pieces->emplace_back(std::move(piece));
+                piece.clear();
+            }
+        } else {
+            piece.append(1, c);
+        }
+    }
+    pieces->emplace_back(std::move(piece));
+    if (pieces->size() == 1) {
+        // no '%' at all, it's an equality check
+        return false;
+    }
+
+    *anchor_start = !pieces->front().empty();
+    *anchor_end = !pieces->back().empty();
+    if (!*anchor_start) {
+        pieces->erase(pieces->begin());
+    }
+    if (!pieces->empty() && !*anchor_end) {
+        pieces->pop_back();
+    }
+    return true;
+}
+
+// Match the value against the pieces from left to right. Taking the leftmost occurrence of each piece
+// is always right because '%' matches any sequence, it leaves the most room for the following pieces.
+static bool match_like_pieces(std::string_view value, const std::vector<std::string>& pieces, bool anchor_start,
+                              bool anchor_end) {
+    size_t first = 0;
+    size_t last = pieces.size();
+    size_t pos = 0;
+    size_t end = value.size();
+    if (anchor_start) {
+        const auto& prefix = pieces[first++];
+        if (value.substr(0, prefix.size()) != prefix) {
+            return false;
+        }
+        pos = prefix.size();
+    }
+    if (anchor_end && last > first) {
+        const auto& suffix = pieces[--last];
+        if (end < pos + suffix.size() || value.substr(end - suffix.size()) != suffix) {
+            return false;
+        }
+        end -= suffix.size();
+    }
+    for (size_t i = first; i < last; i++) {
+        auto found = value.substr(0, end).find(pieces[i], pos);
+        if (found == std::string_view::npos) {
+            return false;
+        }
+        pos = found + pieces[i].size();
+    }
+    return true;
+}
+
+StatusOr<ColumnPtr> LikePredicate::constant_pieces_fn(FunctionContext* context, const starrocks::Columns& columns) {
+    RETURN_IF_COLUMNS_ONLY_NULL(columns);
+    auto state = reinterpret_cast<LikePredicateState*>(context->get_function_state(FunctionContext::THREAD_LOCAL));
+    const auto& pieces = state->like_pieces;
+    const bool anchor_start = state->like_anchor_start;
+    const bool anchor_end = state->like_anchor_end;
+
+    if (columns[0]->is_constant()) {
+        Slice value = ColumnHelper::get_const_value<TYPE_VARCHAR>(columns[0]);
+        auto res = RunTimeColumnType<TYPE_BOOLEAN>::create();
+        res->append(match_like_pieces(std::string_view(value.data, value.size), pieces, anchor_start, anchor_end));
+        return ConstColumn::create(std::move(res), columns[0]->size());
+    }
+
+    BinaryColumn* haystack = nullptr;
+    NullColumnPtr res_null = nullptr;
+    if (columns[0]->is_nullable()) {
+        auto haystack_null = ColumnHelper::as_column<NullableColumn>(columns[0]);
+        haystack = ColumnHelper::as_raw_column<BinaryColumn>(haystack_null->data_column());
+        res_null = haystack_null->null_column();
+    } else {
+        haystack = ColumnHelper::as_raw_column<BinaryColumn>(columns[0]);
+    }
+
+    auto res = RunTimeColumnType<TYPE_BOOLEAN>::create();
+    res->resize(haystack->size());
+    auto& res_data = res->get_data();
+    const Buffer<uint32_t>& offsets = haystack->get_offset();
+    const char* begin = haystack->get_slice(0).data;
+    const char* end = begin + haystack->get_bytes().size();
+
+    // Prefilter with the longest piece: search it in all strings at once like constant_substring_fn, only
+    // the rows containing it are checked with the whole pattern.
+    size_t longest = 0;
+    for (size_t i = 1; i < pieces.size(); i++) {
+        if (pieces[i].size() > pieces[longest].size()) {
+            longest = i;
+        }
+    }
+    if (pieces.empty() || pieces[longest].empty()) {
+        for (size_t i = 0; i < haystack->size(); i++) {
+            res_data[i] = match_like_pieces(haystack->get_slice(i), pieces, anchor_start, anchor_end);
+        }
+    } else {
+        const auto& needle = pieces[longest];
+        memset(res->mutable_raw_data(), 0, res->size() * res->type_size());
+        auto searcher = VolnitskyUTF8(needle.data(), needle.size(), end - begin);
+        const char* pos = begin;
+        size_t i = 0;
+        while (pos < end && end != (pos = searcher.search(pos, end - pos))) {
+            while (begin + offsets[i + 1] <= pos) {
+                ++i;
+            }
+            if (pos + needle.size() <= begin + offsets[i + 1]) {
+                res_data[i] = match_like_pieces(haystack->get_slice(i), pieces, anchor_start, anchor_end);
+            }
+            pos = begin + offsets[i + 1];
+            ++i;
+        }
+    }
+
+    if (columns[0]->has_null()) {
+        return NullableColumn::create(std::move(res), std::move(res_null));
+    }
+    return res;
+}
+
 // regex_match
 StatusOr<ColumnPtr> LikePredicate::regex_match(FunctionContext* context, const starrocks::Columns& columns,
                                                bool is_like_pattern) {
@@ -129,6 +129,23 @@ private:
      */
     DEFINE_VECTORIZED_FN(constant_substring_fn);
 
+    /**
+     * use for:
+     *  a like "xx%yy%zz", '%' is the only wildcard in the pattern
+     *
+     * pattern from context
+     *
+     * @param: [string_value]
+     * @paramType: [BinaryColumn]
+     * @return: BooleanColumn
+     */
+    DEFINE_VECTORIZED_FN(constant_pieces_fn);
+
+    // Split a LIKE pattern by '%' into the literal pieces that must appear in order. Return false if the
+    // pattern has a '_' wildcard or ends with a dangling escape char, it must go through regex then.
+    static bool split_like_pattern_by_percent(const Slice& pattern, char escape_char, std::vector<std::string>* pieces,
+                                              bool* anchor_start, bool* anchor_end);
+
     /**
       * use for:
       *  regex match
@@ -192,6 +209,12 @@ private:
 
         ColumnPtr _search_string_column;
 
+        /// Used by constant_pieces_fn, the literal pieces of the pattern split by '%', and whether the
+        /// first/last piece must be at the start/end of the value.
+        std::vector<std::string> like_pieces;
+        bool like_anchor_start = false;
+        bool like_anchor_end = false;
+
         // a pointer to the generated database that responsible for parsed expression.
         hs_database_t* database = nullptr;
         // a type containing error details that is returned by the compile calls on failure.
@@ -1320,7 +1320,18 @@ StatusOr<ColumnPtr> MathFunctions::l2_distance(FunctionContext* context, const C
     for (size_t i = 0; i < target_size; i++) {
         CppType sum = 0;
         size_t dim_size = target_offset[i + 1] - target_offset[i];
-        for (size_t j = 0; j < dim_size; j++) {
+        size_t j = 0;
+#ifdef __AVX2__
+        if (std::is_same_v<CppType, float>) {
+            __m256 sum_vec = _mm256_setzero_ps();
+            for (; j + 7 < dim_size; j += 8) {
+                __m256 diff_vec = _mm256_sub_ps(_mm256_loadu_ps(base_data + j), _mm256_loadu_ps(target_data + j));
+                sum_vec = _mm256_add_ps(sum_vec, _mm256_mul_ps(diff_vec, diff_vec));
+            }
+            sum += sum_m256(sum_vec);
+        }
+#endif
+        for (; j < dim_size; j++) {
             CppType distance;
             distance = (base_data[j] - target_data[j]) * (base_data[j] - target_data[j]);
             sum += distance;
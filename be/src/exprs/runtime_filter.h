@@ -160,6 +160,48 @@ public:
 #endif
     }
 
+    // Test a batch of hashes, selection[i] is set to the result of hashes[i] if it's still selected.
+    // The buckets are prefetched some hashes ahead to hide the cache misses of large filters,
+    // and with AVX-512 two buckets are tested by one instruction sequence.
+    void test_hash_batch(const uint64_t* hashes, size_t num, uint8_t* selection) const noexcept {
+        if (UNLIKELY(_directory == nullptr)) {
+            DCHECK(false) << "unexpected test_hash_batch on cleared bf";
+            return;
+        }
+
+        size_t i = 0;
+#ifdef __AVX512F__
+        for (; i + 2 <= num; i += 2) {
+            if (i + PREFETCH_DISTANCE + 1 < num) {
+                __builtin_prefetch(&_directory[hashes[i + PREFETCH_DISTANCE] & _directory_mask]);
+                __builtin_prefetch(&_directory[hashes[i + PREFETCH_DISTANCE + 1] & _directory_mask]);
+            }
+            const __m512i mask = make_mask(hashes[i] >> _log_num_buckets, hashes[i + 1] >> _log_num_buckets);
+            const __m256i* directory = reinterpret_cast<const __m256i*>(_directory);
+            const __m512i buckets =
+                    _mm512_inserti64x4(_mm512_castsi256_si512(directory[hashes[i] & _directory_mask]),
+                                       directory[hashes[i + 1] & _directory_mask], 1);
+            // the lanes of 'mask' that have a one where 'bucket' has not
+            const __m512i missing = _mm512_andnot_si512(buckets, mask);
+            const __mmask16 missing_lanes = _mm512_test_epi32_mask(missing, missing);
+            if (selection[i]) {
+                selection[i] = (missing_lanes & 0xFF) == 0;
+            }
+            if (selection[i + 1]) {
+                selection[i + 1] = (missing_lanes >> 8) == 0;
+            }
+        }
+#endif
+        for (; i < num; i++) {
+            if (i + PREFETCH_DISTANCE < num) {
+                __builtin_prefetch(&_directory[hashes[i + PREFETCH_DISTANCE] & _directory_mask]);
+            }
+            if (selection[i]) {
+                selection[i] = test_hash(hashes[i]);
+            }
+        }
+    }
+
     size_t max_serialized_size() const;
     size_t serialize(uint8_t* data) const;
     size_t deserialize(const uint8_t* data);
@@ -218,6 +260,25 @@ private:
         return _mm256_sllv_epi32(ones, hash_data);
     }
 #endif
+
+#ifdef __AVX512F__
+    // Same as the AVX2 version, but make the masks of two hashes at once
+    __m512i make_mask(const uint32_t hash0, const uint32_t hash1) const noexcept {
+        __m512i hash_data =
+                _mm512_inserti64x4(_mm512_castsi256_si512(_mm256_set1_epi32(hash0)), _mm256_set1_epi32(hash1), 1);
+        const __m256i rehash8 = _mm256_setr_epi32(0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU, 0x705495c7U,
+                                                  0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U);
+        const __m512i rehash = _mm512_broadcast_i64x4(rehash8);
+        hash_data = _mm512_mullo_epi32(rehash, hash_data);
+        hash_data = _mm512_srli_epi32(hash_data, 27);
+        const __m512i ones = _mm512_set1_epi32(1);
+        return _mm512_sllv_epi32(ones, hash_data);
+    }
+#endif
+
+    // How many hashes ahead the buckets are prefetched in test_hash_batch
+    static constexpr size_t PREFETCH_DISTANCE = 16;
+
     // log2(number of bytes in a bucket):
     static constexpr int LOG_BUCKET_BYTE_SIZE = 5;
 
@@ -1352,6 +1413,28 @@ private:
         }
     }
 
+    template <bool hash_partition>
+    void _rf_test_data_batch(uint8_t* selection, const ContainerType& input_data, const HashValues& hash_values,
+                             size_t size) const {
+        if constexpr (hash_partition) {
+            for (size_t i = 0; i < size; ++i) {
+                _rf_test_data<hash_partition>(selection, input_data, hash_values, i);
+            }
+        } else {
+            // compute the hashes of a batch first, so that the probes of the batch could be prefetched
+            DCHECK(_bf.can_use());
+            constexpr size_t batch_size = 256;
+            uint64_t hashes[batch_size];
+            for (size_t start = 0; start < size; start += batch_size) {
+                const size_t num = std::min(batch_size, size - start);
+                for (size_t i = 0; i < num; ++i) {
+                    hashes[i] = compute_hash(input_data[start + i]);
+                }
+                _bf.test_hash_batch(hashes, num, selection + start);
+            }
+        }
+    }
+
     template <bool hash_partition>
     bool _rf_test_data(const CppType& data, const uint32_t hash_value) const {
         if constexpr (hash_partition) {
@@ -1406,17 +1489,13 @@ private:
                 }
             } else {
                 if constexpr (can_use_bf) {
-                    for (int i = 0; i < size; ++i) {
-                        _rf_test_data<multi_partition>(selection, input_data, hash_values, i);
-                    }
+                    _rf_test_data_batch<multi_partition>(selection, input_data, hash_values, size);
                 }
             }
         } else {
             const auto& input_data = GetContainer<Type>::get_data(input_column);
             if constexpr (can_use_bf) {
-                for (int i = 0; i < size; ++i) {
-                    _rf_test_data<multi_partition>(selection, input_data, hash_values, i);
-                }
+                _rf_test_data_batch<multi_partition>(selection, input_data, hash_values, size);
             }
         }
     }
@@ -1922,6 +1922,15 @@ DEFINE_UNARY_FN_WITH_IMPL(utf8LengthImpl, str) {
 }
 
 StatusOr<ColumnPtr> StringFunctions::utf8_length(FunctionContext* context, const starrocks::Columns& columns) {
+    if (!columns[0]->only_null()) {
+        // if all characters are ascii, the number of characters is the number of bytes, which can be
+        // taken from the offsets directly
+        const auto* src = ColumnHelper::get_binary_column(columns[0].get());
+        const Bytes& src_bytes = src->get_bytes();
+        if (validate_ascii_fast(reinterpret_cast<const char*>(src_bytes.data()), src_bytes.size())) {
+            return VectorizedStrictUnaryFunction<lengthImpl>::evaluate<TYPE_VARCHAR, TYPE_INT>(columns[0]);
+        }
+    }
     return VectorizedStrictUnaryFunction<utf8LengthImpl>::evaluate<TYPE_VARCHAR, TYPE_INT>(columns[0]);
 }
 
@@ -1946,7 +1955,7 @@ static inline void vectorized_toggle_case(const Bytes* src, Bytes* dst) {
     const auto z_plus1 = _mm_set1_epi8(CZ + 1);
     const auto flips = _mm_set1_epi8(32);
 
-    for (; src_ptr > sse2_end; src_ptr += SSE2_BYTES, dst_ptr += SSE2_BYTES) {
+    for (; src_ptr < sse2_end; src_ptr += SSE2_BYTES, dst_ptr += SSE2_BYTES) {
         auto bytes = _mm_loadu_si128((const __m128i*)src_ptr);
         // the i-th byte of masks is set to 0xff if the corresponding byte is
         // between a..z when computing upper function (A..Z when computing lower function),
@@ -2366,7 +2375,7 @@ struct AdaptiveTrimFunction {
         const auto num_rows = src->size();
         raw::make_room(&dst_offsets, num_rows + 1);
         dst_offsets[0] = 0;
-        dst_bytes.reserve(dst_bytes.size());
+        dst_bytes.reserve(src->get_bytes().size());
 
         size_t i = 0;
         const auto sample_num = std::min(num_rows, 100ul);
@@ -150,6 +150,12 @@ Status TimeFunctions::convert_tz_prepare(FunctionContext* context, FunctionConte
         return Status::OK();
     }
 
+    // The cached offsets between region zones are sampled at a single date and miss historical DST,
+    // so a constant offset is only used when both zones are fixed offsets from UTC.
+    if (TimezoneUtils::is_fixed_offset(ctc->from_tz) && TimezoneUtils::is_fixed_offset(ctc->to_tz)) {
+        ctc->has_fixed_offset = true;
+        ctc->offset = TimezoneUtils::to_utc_offset(ctc->to_tz) - TimezoneUtils::to_utc_offset(ctc->from_tz);
+    }
     ctc->is_valid = true;
     return Status::OK();
 }
@@ -235,24 +241,29 @@ StatusOr<ColumnPtr> TimeFunctions::convert_tz_const(FunctionContext* context, co
 
         int year, month, day, hour, minute, second, usec;
         datetime_value.to_timestamp(&year, &month, &day, &hour, &minute, &second, &usec);
-        DateTimeValue ts_value(TIME_DATETIME, year, month, day, hour, minute, second, usec);
 
-        int64_t timestamp;
-        // TODO find a better approach to replace datetime_value.unix_timestamp
-        if (!ts_value.unix_timestamp(&timestamp, from)) {
-            result.append_null();
-            continue;
-        }
-        DateTimeValue ts_value2;
-        // TODO find a better approach to replace datetime_value.from_unixtime
-        if (!ts_value2.from_unixtime(timestamp, ts_value.microsecond(), to)) {
+        // convert with cctz directly instead of a DateTimeValue round trip
+        const auto tp = cctz::convert(cctz::civil_second(year, month, day, hour, minute, second), from);
+        TimestampValue ts;
+        ts.from_unixtime(tp.time_since_epoch().count(), usec, to);
+        result.append(ts);
+    }
+
+    return result.build(ColumnHelper::is_all_const(columns));
+}
+
+StatusOr<ColumnPtr> TimeFunctions::convert_tz_fixed_offset(FunctionContext* context, const Columns& columns,
+                                                           int64_t offset) {
+    auto time_viewer = ColumnViewer<TYPE_DATETIME>(columns[0]);
+
+    auto size = columns[0]->size();
+    ColumnBuilder<TYPE_DATETIME> result(size);
+    for (int row = 0; row < size; ++row) {
+        if (time_viewer.is_null(row)) {
             result.append_null();
             continue;
         }
-        TimestampValue ts;
-        ts.from_timestamp(ts_value2.year(), ts_value2.month(), ts_value2.day(), ts_value2.hour(), ts_value2.minute(),
-                          ts_value2.second(), ts_value2.microsecond());
-        result.append(ts);
+        result.append(time_viewer.value(row).add<TimeUnit::SECOND>(offset));
     }
 
     return result.build(ColumnHelper::is_all_const(columns));
@@ -268,6 +279,9 @@ StatusOr<ColumnPtr> TimeFunctions::convert_tz(FunctionContext* context, const Co
         return ColumnHelper::create_const_null_column(columns[0]->size());
     }
 
+    if (ctc->has_fixed_offset) {
+        return convert_tz_fixed_offset(context, columns, ctc->offset);
+    }
     return convert_tz_const(context, columns, ctc->from_tz, ctc->to_tz);
 }
 
@@ -2152,6 +2166,177 @@ StatusOr<ColumnPtr> TimeFunctions::str2date(FunctionContext* context, const Colu
     return VectorizedStrictUnaryFunction<TimestampToDate>::evaluate<TYPE_DATETIME, TYPE_DATE>(datetime);
 }
 
+// Compile a date_format pattern into tokens, return false if it has a specifier that needs more than the
+// calendar fields (names, weeks, day of year), or its output may exceed the buffer of to_format_string.
+// The output of the supported specifiers is the same as DateTimeValue::to_format_string.
+static bool compile_date_format(const std::string& fmt, std::vector<TimeFunctions::FormatToken>* tokens) {
+    tokens->clear();
+    size_t max_len = 0;
+    auto append_literal = [&](char c) {
+        if (tokens->empty() || tokens->back().spec != 0) {
+            tokens->emplace_back();
+        }
+        tokens->back().literal.append(1, c);
+        max_len++;
+    };
+    for (size_t i = 0; i < fmt.size(); i++) {
+        if (fmt[i] != '%' || i + 1 == fmt.size()) {
+            append_literal(fmt[i]);
+            continue;
+        }
+        char ch = fmt[++i];
+        switch (ch) {
+        case 'Y':
+            max_len += 4;
+            break;
+        case 'f':
+            max_len += 6;
+            break;
+        case 'T':
+            max_len += 8;
+            break;
+        case 'c':
+        case 'd':
+        case 'e':
+        case 'h':
+        case 'I':
+        case 'H':
+        case 'i':
+        case 'k':
+        case 'l':
+        case 'm':
+        case 'p':
+        case 's':
+        case 'S':
+        case 'y':
+            max_len += 2;
+            break;
+        default:
+            if (std::isalpha(static_cast<unsigned char>(ch))) {
+                return false;
+            }
+            // e.g. "%%" is "%"
+            append_literal(ch);
+            continue;
+        }
+        tokens->emplace_back().spec = ch;
+    }
+    // to_format_string fails once the output reaches 127 bytes, keep far away from it
+    return max_len < 120;
+}
+
+static inline char* format_two_digits(int v, char* to) {
+    *to++ = static_cast<char>('0' + v / 10);
+    *to++ = static_cast<char>('0' + v % 10);
+    return to;
+}
+
+static inline char* format_min_one_digit(int v, char* to) {
+    if (v >= 10) {
+        *to++ = static_cast<char>('0' + v / 10);
+    }
+    *to++ = static_cast<char>('0' + v % 10);
+    return to;
+}
+
+static inline char* format_digits(int v, int width, char* to) {
+    for (int i = width - 1; i >= 0; i--) {
+        to[i] = static_cast<char>('0' + v % 10);
+        v /= 10;
+    }
+    return to + width;
+}
+
+// Format one row with a pattern compiled by compile_date_format, return the end of the output.
+static char* format_compiled_one_row(const std::vector<TimeFunctions::FormatToken>& tokens,
+                                     const TimestampValue& timestamp_value, char* to) {
+    int year, month, day, hour, minute, second, microsecond;
+    timestamp_value.to_timestamp(&year, &month, &day, &hour, &minute, &second, &microsecond);
+    const int hour12 = (hour % 24 + 11) % 12 + 1;
+    for (const auto& token : tokens) {
+        switch (token.spec) {
+        case 0:
+            memcpy(to, token.literal.data(), token.literal.size());
+            to += token.literal.size();
+            break;
+        case 'Y':
+            to = format_digits(year, 4, to);
+            break;
+        case 'y':
+            to = format_two_digits(year % 100, to);
+            break;
+        case 'm':
+            to = format_two_digits(month, to);
+            break;
+        case 'c':
+            to = format_min_one_digit(month, to);
+            break;
+        case 'd':
+            to = format_two_digits(day, to);
+            break;
+        case 'e':
+            to = format_min_one_digit(day, to);
+            break;
+        case 'H':
+            to = format_two_digits(hour, to);
+            break;
+        case 'k':
+            to = format_min_one_digit(hour, to);
+            break;
+        case 'h':
+        case 'I':
+            to = format_two_digits(hour12, to);
+            break;
+        case 'l':
+            to = format_min_one_digit(hour12, to);
+            break;
+        case 'i':
+            to = format_two_digits(minute, to);
+            break;
+        case 's':
+        case 'S':
+            to = format_two_digits(second, to);
+            break;
+        case 'f':
+            to = format_digits(microsecond, 6, to);
+            break;
+        case 'p':
+            memcpy(to, (hour % 24) >= 12 ? "PM" : "AM", 2);
+            to += 2;
+            break;
+        case 'T':
+            to = format_two_digits(hour % 24, to);
+            *to++ = ':';
+            to = format_two_digits(minute, to);
+            *to++ = ':';
+            to = format_two_digits(second, to);
+            break;
+        default:
+            DCHECK(false) << "unsupported compiled format spec: " << token.spec;
+            break;
+        }
+    }
+    return to;
+}
+
+template <LogicalType Type>
+ColumnPtr compiled_format(const std::vector<TimeFunctions::FormatToken>& tokens, const Columns& columns) {
+    auto ts_viewer = ColumnViewer<Type>(columns[0]);
+    size_t size = columns[0]->size();
+    ColumnBuilder<TYPE_VARCHAR> result(size);
+
+    char buf[128];
+    for (size_t i = 0; i < size; ++i) {
+        if (ts_viewer.is_null(i)) {
+            result.append_null();
+        } else {
+            char* end = format_compiled_one_row(tokens, (TimestampValue)ts_viewer.value(i), buf);
+            result.append(Slice(buf, end - buf));
+        }
+    }
+    return result.build(ColumnHelper::is_all_const(columns));
+}
+
 Status TimeFunctions::format_prepare(FunctionContext* context, FunctionContext::FunctionStateScope scope) {
     if (scope != FunctionContext::FRAGMENT_LOCAL) {
         return Status::OK();
@@ -2193,6 +2378,7 @@ Status TimeFunctions::format_prepare(FunctionContext* context, FunctionContext::
         fc->fmt_type = TimeFunctions::yyyy;
     } else {
         fc->fmt_type = TimeFunctions::None;
+        fc->is_compiled = compile_date_format(fc->fmt, &fc->compiled_fmt);
     }
 
     fc->is_valid = true;
@@ -2384,6 +2570,8 @@ StatusOr<ColumnPtr> do_format(const TimeFunctions::FormatCtx* ctx, const Columns
         return date_format_func<yyyyMMImpl, Type>(cols, 6);
     } else if (ctx->fmt_type == TimeFunctions::yyyy) {
         return date_format_func<yyyyImpl, Type>(cols, 4);
+    } else if (ctx->is_compiled) {
+        return compiled_format<Type>(ctx->compiled_fmt, cols);
     } else {
         return standard_format<Type>(ctx->fmt, 128, cols);
     }
@@ -854,6 +854,9 @@ private:
     static StatusOr<ColumnPtr> convert_tz_const(FunctionContext* context, const Columns& columns,
                                                 const cctz::time_zone& from, const cctz::time_zone& to);
 
+    static StatusOr<ColumnPtr> convert_tz_fixed_offset(FunctionContext* context, const Columns& columns,
+                                                       int64_t offset);
+
     static StatusOr<ColumnPtr> _last_day_with_format(FunctionContext* context, const Columns& columns);
     static StatusOr<ColumnPtr> _last_day_with_format_const(std::string& format_content, FunctionContext* context,
                                                            const Columns& columns);
@@ -878,11 +881,22 @@ public:
         None
     };
 
+    // One piece of a compiled date_format pattern: a literal string when spec is 0, otherwise the
+    // specifier letter after '%'.
+    struct FormatToken {
+        char spec = 0;
+        std::string literal;
+    };
+
     struct FormatCtx {
         bool is_valid = false;
         std::string fmt;
         int len;
         FormatType fmt_type;
+        // Set when fmt_type is None and every specifier of fmt only needs the calendar fields of the
+        // value, then rows are formatted from compiled_fmt instead of DateTimeValue::to_format_string.
+        bool is_compiled = false;
+        std::vector<FormatToken> compiled_fmt;
     };
 
     struct ParseJodaState {
@@ -906,6 +920,9 @@ private:
         bool is_valid = false;
         cctz::time_zone from_tz;
         cctz::time_zone to_tz;
+        // true if both timezones are fixed offsets from UTC, then `offset` converts from_tz to to_tz
+        bool has_fixed_offset = false;
+        int64_t offset = 0;
     };
 
     // fmt for string format like "%Y-%m-%d" and "%Y-%m-%d %H:%i:%s"
@@ -16,6 +16,10 @@
 
 #include <unordered_set>
 
+#ifdef __SSE2__
+#include <immintrin.h>
+#endif
+
 namespace starrocks {
 
 using Field = Slice;
@@ -555,15 +559,42 @@ void CSVReader::split_record(const Record& record, Fields* columns) const {
     const size_t size = record.size;
 
     if (_column_delimiter_length == 1) {
-        for (size_t i = 0; i < size; ++i, ++ptr) {
-            if (*ptr == _parse_options.column_delimiter[0]) {
-                if (_parse_options.trim_space) {
-                    std::pair<const char*, size_t> newPos = trim(value, ptr - value);
-                    columns->emplace_back(newPos.first, newPos.second);
-                } else {
-                    columns->emplace_back(value, ptr - value);
-                }
-                value = ptr + 1;
+        const char delimiter = _parse_options.column_delimiter[0];
+        const char* const end = record.data + size;
+        auto add_column = [&](const char* column_end) {
+            if (_parse_options.trim_space) {
+                std::pair<const char*, size_t> newPos = trim(value, column_end - value);
+                columns->emplace_back(newPos.first, newPos.second);
+            } else {
+                columns->emplace_back(value, column_end - value);
+            }
+            value = column_end + 1;
+        };
+        // Compare a whole vector of bytes against the delimiter at once, then walk the set bits of the mask.
+#if defined(__AVX2__)
+        const __m256i v_delimiter = _mm256_set1_epi8(delimiter);
+        for (; ptr + 32 <= end; ptr += 32) {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr));
+            auto mask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, v_delimiter)));
+            while (mask != 0) {
+                add_column(ptr + __builtin_ctz(mask));
+                mask &= mask - 1;
+            }
+        }
+#elif defined(__SSE2__)
+        const __m128i v_delimiter = _mm_set1_epi8(delimiter);
+        for (; ptr + 16 <= end; ptr += 16) {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr));
+            auto mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, v_delimiter)));
+            while (mask != 0) {
+                add_column(ptr + __builtin_ctz(mask));
+                mask &= mask - 1;
+            }
+        }
+#endif
+        for (; ptr < end; ++ptr) {
+            if (*ptr == delimiter) {
+                add_column(ptr);
             }
         }
     } else {
@@ -495,9 +495,21 @@ inline void Decimal32Or64Or128ColumnReader<DecimalType>::_fill_decimal_column_ge
 Status StringColumnReader::get_next(orc::ColumnVectorBatch* cvb, ColumnPtr& col, size_t from, size_t size) {
     auto* data = down_cast<orc::StringVectorBatch*>(cvb);
 
+    // Values of a direct encoded stripe are laid out back to back in the blob stream, in which case the whole
+    // range can be copied at once instead of value by value.
     size_t len = 0;
+    bool contiguous = _type.type != TYPE_CHAR;
+    const char* expected_pos = nullptr;
     for (size_t i = 0; i < size; ++i) {
-        len += data->length[from + i];
+        size_t cvb_pos = from + i;
+        if (cvb->hasNulls && !cvb->notNull[cvb_pos]) {
+            continue;
+        }
+        len += data->length[cvb_pos];
+        if (contiguous) {
+            contiguous = expected_pos == nullptr || data->data[cvb_pos] == expected_pos;
+            expected_pos = data->data[cvb_pos] + data->length[cvb_pos];
+        }
     }
     size_t col_start = col->size();
 
@@ -518,7 +530,16 @@ Status StringColumnReader::get_next(orc::ColumnVectorBatch* cvb, ColumnPtr& col,
     raw::stl_vector_resize_uninitialized(&vo, vo.size() + size);
 
     size_t write_pos = vb.size();
-    if (cvb->hasNulls) {
+    if (contiguous && expected_pos != nullptr) {
+        strings::memcpy_inlined(&vb[write_pos], expected_pos - len, len);
+        for (size_t i = col_start, cvb_pos = from; i < col_start + size; ++i, ++cvb_pos) {
+            if (!cvb->hasNulls || cvb->notNull[cvb_pos]) {
+                write_pos += data->length[cvb_pos];
+            }
+            // Need plus 1 for offset
+            vo[i + 1] = write_pos;
+        }
+    } else if (cvb->hasNulls) {
         if (_type.type == TYPE_CHAR) {
             // Possibly there are some zero padding characters in value, we have to strip them off.
             for (size_t i = col_start, cvb_pos = from; i < col_start + size; ++i, ++cvb_pos) {
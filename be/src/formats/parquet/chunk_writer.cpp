@@ -14,6 +14,8 @@
 
 #include "formats/parquet/chunk_writer.h"
 
+#include <fmt/format.h>
+#include <parquet/exception.h>
 #include <parquet/file_writer.h>
 #include <parquet/schema.h>
 
@@ -22,10 +24,14 @@
 #include <utility>
 
 #include "column/chunk.h"
+#include "common/config.h"
 #include "common/statusor.h"
 #include "exprs/function_context.h"
 #include "formats/parquet/column_chunk_writer.h"
 #include "formats/parquet/level_builder.h"
+#include "runtime/current_thread.h"
+#include "util/countdown_latch.h"
+#include "util/threadpool.h"
 
 namespace starrocks::parquet {
 
@@ -46,6 +52,11 @@ ChunkWriter::ChunkWriter(::parquet::RowGroupWriter* rg_writer, std::vector<TypeD
 }
 
 Status ChunkWriter::write(Chunk* chunk) {
+    if (_encode_pool != nullptr && _type_descs.size() > 1 &&
+        _type_descs.size() >= config::parquet_writer_parallel_encode_min_columns) {
+        return _write_parallel(chunk);
+    }
+
     LevelBuilderContext ctx(chunk->num_rows());
 
     // Writes out all leaf parquet columns to the RowGroupWriter. Each leaf column is written fully before
@@ -70,6 +81,73 @@ Status ChunkWriter::write(Chunk* chunk) {
     return Status::OK();
 }
 
+static int num_leaf_columns(const ::parquet::schema::NodePtr& node) {
+    if (node->is_primitive()) {
+        return 1;
+    }
+    const auto* group = static_cast<const ::parquet::schema::GroupNode*>(node.get());
+    int num_leaves = 0;
+    for (int i = 0; i < group->field_count(); i++) {
+        num_leaves += num_leaf_columns(group->field(i));
+    }
+    return num_leaves;
+}
+
+// Each top level column owns a disjoint range of leaf column writers of the buffered row group, so they can be
+// encoded and compressed concurrently. The column evaluators are not thread safe and still run in the caller.
+Status ChunkWriter::_write_parallel(Chunk* chunk) {
+    size_t num_columns = _type_descs.size();
+    LevelBuilderContext ctx(chunk->num_rows());
+    Columns columns(num_columns);
+    std::vector<int> first_leaf_indices(num_columns);
+    int leaf_column_idx = 0;
+    for (size_t i = 0; i < num_columns; i++) {
+        ASSIGN_OR_RETURN(columns[i], _eval_func(chunk, i));
+        first_leaf_indices[i] = leaf_column_idx;
+        leaf_column_idx += num_leaf_columns(_schema->field(i));
+    }
+
+    std::vector<Status> statuses(num_columns);
+    CountDownLatch latch(num_columns);
+    auto* mem_tracker = CurrentThread::mem_tracker();
+    for (size_t i = 0; i < num_columns; i++) {
+        auto task = [&, i]() {
+            SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(mem_tracker);
+            try {
+                statuses[i] = _write_column(ctx, columns[i], i, first_leaf_indices[i]);
+            } catch (const ::parquet::ParquetException& e) {
+                statuses[i] = Status::IOError(fmt::format("encode parquet column error: {}", e.what()));
+            }
+            latch.count_down();
+        };
+        // the last column is encoded by the caller itself rather than waiting idle
+        if (i + 1 == num_columns || !_encode_pool->submit_func(task).ok()) {
+            task();
+        }
+    }
+    latch.wait();
+
+    for (auto& st : statuses) {
+        RETURN_IF_ERROR(st);
+    }
+    return Status::OK();
+}
+
+Status ChunkWriter::_write_column(const LevelBuilderContext& ctx, const ColumnPtr& col, size_t col_idx,
+                                  int first_leaf_idx) {
+    int leaf_column_idx = first_leaf_idx;
+    auto write_leaf_column = [&](const LevelBuilderResult& result) {
+        auto leaf_column_writer = ColumnChunkWriter(_rg_writer->column(leaf_column_idx));
+        leaf_column_writer.write(result);
+        _estimated_buffered_bytes[leaf_column_idx] = leaf_column_writer.estimated_buffered_value_bytes();
+        ++leaf_column_idx;
+    };
+    auto level_builder = LevelBuilder(_type_descs[col_idx], _schema->field(col_idx), _timezone,
+                                      _use_legacy_decimal_encoding, _use_int96_timestamp_encoding);
+    RETURN_IF_ERROR(level_builder.init());
+    return level_builder.write(ctx, col, write_leaf_column);
+}
+
 void ChunkWriter::close() {
     _rg_writer->Close();
 }
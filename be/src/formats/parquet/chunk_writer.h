@@ -52,12 +52,15 @@ class GroupNode;
 } // namespace parquet
 namespace starrocks {
 class Chunk;
+class ThreadPool;
 template <typename T>
 class StatusOr;
 } // namespace starrocks
 
 namespace starrocks::parquet {
 
+class LevelBuilderContext;
+
 // Wraps parquet::RowGroupWriter.
 // Write chunks into buffer. Flush on closing.
 class ChunkWriter {
@@ -73,7 +76,14 @@ public:
 
     int64_t estimated_buffered_bytes() const;
 
+    // If set, the columns of a chunk are encoded in parallel on |pool|.
+    void set_encode_pool(ThreadPool* pool) { _encode_pool = pool; }
+
 private:
+    Status _write_parallel(Chunk* chunk);
+
+    Status _write_column(const LevelBuilderContext& ctx, const ColumnPtr& col, size_t col_idx, int first_leaf_idx);
+
     ::parquet::RowGroupWriter* _rg_writer;
     std::vector<TypeDescriptor> _type_descs;
     std::shared_ptr<::parquet::schema::GroupNode> _schema;
@@ -82,6 +92,7 @@ private:
     std::string _timezone;
     bool _use_legacy_decimal_encoding = false;
     bool _use_int96_timestamp_encoding = false;
+    ThreadPool* _encode_pool = nullptr;
 };
 
 } // namespace starrocks::parquet
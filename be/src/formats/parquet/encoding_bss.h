@@ -167,12 +167,9 @@ public:
         if (values_to_skip > num_valid_values_) {
             return Status::InvalidArgument("not enough values to skip");
         }
-        if constexpr (IS_FLBA) {
-            RETURN_IF_ERROR(Decode(nullptr, values_to_skip));
-        } else {
-            skip_buffer_.reserve(values_to_skip);
-            RETURN_IF_ERROR(Decode(skip_buffer_.data(), values_to_skip));
-        }
+        // the streams are addressed by data_ and stride_, skipping only needs to move the cursor.
+        data_ += values_to_skip;
+        num_valid_values_ -= values_to_skip;
         return Status::OK();
     }
 
@@ -182,7 +179,6 @@ private:
     int stride_ = 0;
     int num_valid_values_ = 0;
     faststring decode_buffer_;
-    std::vector<T> skip_buffer_;
 
     const uint8_t* data_ = nullptr;
     size_t len_ = 0;
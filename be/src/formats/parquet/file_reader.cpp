@@ -197,10 +197,17 @@ StatusOr<bool> FileReader::_update_rf_and_filter_group(const GroupReaderPtr& gro
                         pred_tree.add_child(PredicateColumnNode{pred});
                     }
                     auto real_tree = PredicateTree::create(std::move(pred_tree));
-                    auto visitor = PredicateFilterEvaluator{real_tree, group_reader.get(), false, false};
+                    auto visitor = PredicateFilterEvaluator{real_tree, group_reader.get(),
+                                                            _scanner_ctx->parquet_page_index_enable,
+                                                            _scanner_ctx->parquet_bloom_filter_enable};
                     auto res = real_tree.visit(visitor);
-                    if (res.ok() && res->has_value() && res->value().span_size() == 0) {
-                        filter = true;
+                    if (res.ok() && res->has_value()) {
+                        if (res->value().span_size() == 0) {
+                            filter = true;
+                        } else {
+                            // skip the pages filtered by page index, row group has not been prepared yet
+                            group_reader->get_range() &= res->value();
+                        }
                     }
                     this->_group_reader_param.stats->_optimzation_counter += visitor.counter;
                     return Status::OK();
@@ -504,14 +504,22 @@ Status FileMetaDataParser::_parse_footer(FileMetaDataPtr* file_metadata_ptr, int
     _scanner_ctx->stats->request_bytes_read += metadata_length + PARQUET_FOOTER_SIZE;
     _scanner_ctx->stats->request_bytes_read_uncompressed += metadata_length + PARQUET_FOOTER_SIZE;
 
-    if (footer_read_size < (metadata_length + PARQUET_FOOTER_SIZE)) {
-        // footer_buffer's size is not enough to read the whole metadata, we need to re-read for larger size
-        size_t re_read_size = metadata_length + PARQUET_FOOTER_SIZE;
-        footer_buffer.resize(re_read_size);
+    const uint64_t footer_size = metadata_length + PARQUET_FOOTER_SIZE;
+    if (footer_read_size < footer_size) {
+        // footer_buffer's size is not enough to read the whole metadata, only read the missing head of it
+        std::vector<char> full_footer_buffer(footer_size);
+        const size_t missing_size = footer_size - footer_read_size;
+        memcpy(full_footer_buffer.data() + missing_size, footer_buffer.data(), footer_read_size);
         {
             SCOPED_RAW_TIMER(&_scanner_ctx->stats->footer_read_ns);
-            RETURN_IF_ERROR(_file->read_at_fully(_file_size - re_read_size, footer_buffer.data(), re_read_size));
+            RETURN_IF_ERROR(_file->read_at_fully(_file_size - footer_size, full_footer_buffer.data(), missing_size));
         }
+        footer_buffer.swap(full_footer_buffer);
+        _footer_buffer_size_hint.store(static_cast<uint32_t>(std::min(footer_size, MAX_FOOTER_BUFFER_SIZE_HINT)),
+                                       std::memory_order_relaxed);
+    } else if (footer_read_size > DEFAULT_FOOTER_BUFFER_SIZE && footer_read_size > 4 * footer_size) {
+        // the hint is from files with much larger footers, stop over-reading
+        _footer_buffer_size_hint.store(0, std::memory_order_relaxed);
     }
 
     // NOTICE: When you need to modify the logic within this scope (including the subfuctions), you should be
@@ -543,7 +551,8 @@ StatusOr<uint32_t> FileMetaDataParser::_get_footer_read_size() const {
                 "Parquet file size is $0 bytes, smaller than the minimum parquet file footer ($1 bytes)", _file_size,
                 PARQUET_FOOTER_SIZE));
     }
-    return std::min(_file_size, DEFAULT_FOOTER_BUFFER_SIZE);
+    const uint64_t hint = _footer_buffer_size_hint.load(std::memory_order_relaxed);
+    return std::min(_file_size, std::max(DEFAULT_FOOTER_BUFFER_SIZE, hint));
 }
 
 StatusOr<uint32_t> FileMetaDataParser::_parse_metadata_length(const std::vector<char>& footer_buff) const {
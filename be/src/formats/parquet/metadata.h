@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <string>
 
 #include "common/status.h"
@@ -135,6 +136,11 @@ private:
     // contains magic number (4 bytes) and footer length (4 bytes)
     constexpr static const uint32_t PARQUET_FOOTER_SIZE = 8;
     constexpr static const uint64_t DEFAULT_FOOTER_BUFFER_SIZE = 48 * 1024;
+    // Upper bound of the footer size learned from previous files.
+    constexpr static const uint64_t MAX_FOOTER_BUFFER_SIZE_HINT = 4 * 1024 * 1024;
+    // Files of the same table usually have footers of similar size. When a footer did not fit in the
+    // first read, the next files start with a read of that size, saving the second round trip.
+    inline static std::atomic<uint32_t> _footer_buffer_size_hint{0};
     constexpr static const char* PARQUET_MAGIC_NUMBER = "PAR1";
     constexpr static const char* PARQUET_EMAIC_NUMBER = "PARE";
 };
@@ -28,6 +28,7 @@
 #include <ostream>
 #include <utility>
 
+#include "common/config.h"
 #include "formats/file_writer.h"
 #include "formats/parquet/arrow_memory_pool.h"
 #include "formats/parquet/chunk_writer.h"
@@ -35,6 +36,7 @@
 #include "formats/parquet/utils.h"
 #include "formats/utils.h"
 #include "fs/fs.h"
+#include "runtime/exec_env.h"
 #include "runtime/runtime_state.h"
 #include "types/logical_type.h"
 #include "util/debug_util.h"
@@ -51,6 +53,9 @@ Status ParquetFileWriter::write(Chunk* chunk) {
         _rowgroup_writer = std::make_unique<parquet::ChunkWriter>(
                 _writer->AppendBufferedRowGroup(), _type_descs, _schema, _eval_func, _writer_options->time_zone,
                 _writer_options->use_legacy_decimal_encoding, _writer_options->use_int96_timestamp_encoding);
+        if (config::parquet_writer_parallel_encode_enable) {
+            _rowgroup_writer->set_encode_pool(ExecEnv::GetInstance()->parquet_writer_encode_pool());
+        }
     }
 
     RETURN_IF_ERROR(_rowgroup_writer->write(chunk));
@@ -756,20 +756,31 @@ Status LowRowsColumnReader::fill_dst_column(ColumnPtr& dst, ColumnPtr& src) {
     auto* nullable_string_column = ColumnHelper::as_raw_column<NullableColumn>(readed_column);
     auto* binary_column = ColumnHelper::as_raw_column<BinaryColumn>(nullable_string_column->data_column());
     auto* dst_data_column = down_cast<LowCardDictColumn*>(ColumnHelper::get_data_column(dst.get()));
+    auto& dst_codes = dst_data_column->get_data();
+    const auto& null_data = nullable_string_column->immutable_null_column_data();
+    // Values of a low rows column chunk are often repeated in runs, only look up the dict when the value changes.
+    bool has_last = false;
+    Slice last_slice;
+    int32_t last_code = 0;
     for (size_t i = 0; i < src->size(); i++) {
-        if (src->is_null(i)) {
-            dst_data_column->get_data()[i] = 1;
+        if (null_data[i]) {
+            dst_codes[i] = 1;
             continue;
         }
-        const auto& slice = binary_column->get_slice(i);
-        auto res = _dict->find(slice);
-        if (res == _dict->end()) {
-            // error message format used to extract info, carefully
-            return Status::GlobalDictNotMatch(fmt::format("SlotId: {}, FileName: {} , file doesn't match global dict. ",
-                                                          _slot_id, _opts.file->filename()));
-        } else {
-            dst_data_column->get_data()[i] = res->second;
+        Slice slice = binary_column->get_slice(i);
+        if (!has_last || slice != last_slice) {
+            auto res = _dict->find(slice);
+            if (res == _dict->end()) {
+                // error message format used to extract info, carefully
+                return Status::GlobalDictNotMatch(
+                        fmt::format("SlotId: {}, FileName: {} , file doesn't match global dict. ", _slot_id,
+                                    _opts.file->filename()));
+            }
+            has_last = true;
+            last_slice = slice;
+            last_code = res->second;
         }
+        dst_codes[i] = last_code;
     }
 
     if (dst->is_nullable()) {
@@ -141,6 +141,7 @@ private:
     Status _lazy_skip_values(uint64_t begin) override;
     Status _read_values_on_levels(size_t num_values, starrocks::parquet::ColumnContentType content_type,
                                   starrocks::Column* dst, bool append_default, const FilterData* filter) override;
+    Status _skip_filtered_rows(size_t num_rows, starrocks::Column* dst);
 
     void _append_default_levels(size_t row_nums) override {
         if (_need_parse_levels) {
@@ -183,6 +184,7 @@ private:
     Status _lazy_skip_values(uint64_t begin) override;
     Status _read_values_on_levels(size_t num_values, starrocks::parquet::ColumnContentType content_type,
                                   starrocks::Column* dst, bool append_default, const FilterData* filter) override;
+    Status _skip_filtered_rows(size_t num_rows, starrocks::Column* dst);
     const ParquetField* _field = nullptr;
 };
 
@@ -426,6 +428,22 @@ Status RepeatedStoredColumnReader::_lazy_skip_values(uint64_t begin) {
     return _reader->skip_values(to_skip);
 }
 
+// Count the rows dropped by |filter| at the head and the tail of [0, num_rows), so that they can be skipped
+// in the decoder instead of being decoded and then filtered out.
+static void count_filtered_head_tail(const FilterData* filter, size_t num_rows, size_t* head, size_t* tail) {
+    *head = 0;
+    *tail = 0;
+    if (filter == nullptr) {
+        return;
+    }
+    while (*head < num_rows && !filter[*head]) {
+        (*head)++;
+    }
+    while (*tail < num_rows - *head && !filter[num_rows - 1 - *tail]) {
+        (*tail)++;
+    }
+}
+
 Status RequiredStoredColumnReader::_read_values_on_levels(size_t num_values,
                                                           starrocks::parquet::ColumnContentType content_type,
                                                           starrocks::Column* dst, bool append_default,
@@ -434,7 +452,26 @@ Status RequiredStoredColumnReader::_read_values_on_levels(size_t num_values,
         dst->append_default(num_values);
         return Status::OK();
     }
-    return _reader->decode_values(num_values, content_type, dst, filter);
+    size_t head = 0;
+    size_t tail = 0;
+    count_filtered_head_tail(filter, num_values, &head, &tail);
+    if (head + tail == 0) {
+        return _reader->decode_values(num_values, content_type, dst, filter);
+    }
+    RETURN_IF_ERROR(_skip_filtered_rows(head, dst));
+    if (head + tail < num_values) {
+        RETURN_IF_ERROR(_reader->decode_values(num_values - head - tail, content_type, dst, filter + head));
+    }
+    return _skip_filtered_rows(tail, dst);
+}
+
+Status RequiredStoredColumnReader::_skip_filtered_rows(size_t num_rows, starrocks::Column* dst) {
+    if (num_rows == 0) {
+        return Status::OK();
+    }
+    RETURN_IF_ERROR(_reader->skip_values(num_rows));
+    dst->append_default(num_rows);
+    return Status::OK();
 }
 
 static void assign_nulls(int16_t* __restrict levels, uint16_t def_level, size_t n, uint8_t* __restrict is_nulls,
@@ -466,22 +503,46 @@ Status OptionalStoredColumnReader::_read_values_on_levels(size_t num_values,
         _append_default_levels(num_values);
         dst->append_default(num_values);
         return Status::OK();
-    } else {
-        level_t* def_levels = nullptr;
-        size_t level_parsed = 0;
-        RETURN_IF_ERROR(_decode_levels(&num_values, &level_parsed, &def_levels));
-        DCHECK_EQ(num_values, level_parsed);
-        _null_infos.reset_with_capacity(num_values);
-        size_t num_ranges = 1;
-        size_t num_nulls{};
-        // decode def levels
-        level_t max_def_level = _field->max_def_level();
-        uint8_t* __restrict is_nulls = _null_infos.nulls_data();
-        assign_nulls(def_levels, max_def_level, num_values, is_nulls, &num_ranges, &num_nulls);
-        _null_infos.num_ranges = num_ranges;
-        _null_infos.num_nulls = num_nulls;
-        return _reader->decode_values(num_values, _null_infos, content_type, dst, filter);
     }
+    size_t head = 0;
+    size_t tail = 0;
+    count_filtered_head_tail(filter, num_values, &head, &tail);
+    if (head + tail > 0) {
+        RETURN_IF_ERROR(_skip_filtered_rows(head, dst));
+        if (head + tail < num_values) {
+            RETURN_IF_ERROR(
+                    _read_values_on_levels(num_values - head - tail, content_type, dst, false, filter + head));
+        }
+        return _skip_filtered_rows(tail, dst);
+    }
+    level_t* def_levels = nullptr;
+    size_t level_parsed = 0;
+    RETURN_IF_ERROR(_decode_levels(&num_values, &level_parsed, &def_levels));
+    DCHECK_EQ(num_values, level_parsed);
+    _null_infos.reset_with_capacity(num_values);
+    size_t num_ranges = 1;
+    size_t num_nulls{};
+    // decode def levels
+    level_t max_def_level = _field->max_def_level();
+    uint8_t* __restrict is_nulls = _null_infos.nulls_data();
+    assign_nulls(def_levels, max_def_level, num_values, is_nulls, &num_ranges, &num_nulls);
+    _null_infos.num_ranges = num_ranges;
+    _null_infos.num_nulls = num_nulls;
+    return _reader->decode_values(num_values, _null_infos, content_type, dst, filter);
+}
+
+// The levels are consumed as usual, only the not null values are skipped without being decoded.
+Status OptionalStoredColumnReader::_skip_filtered_rows(size_t num_rows, starrocks::Column* dst) {
+    if (num_rows == 0) {
+        return Status::OK();
+    }
+    level_t* def_levels = nullptr;
+    size_t level_parsed = 0;
+    RETURN_IF_ERROR(_decode_levels(&num_rows, &level_parsed, &def_levels));
+    DCHECK_EQ(num_rows, level_parsed);
+    RETURN_IF_ERROR(_reader->skip_values(count_not_null(def_levels, level_parsed, _field->max_def_level())));
+    dst->append_default(num_rows);
+    return Status::OK();
 }
 
 Status RepeatedStoredColumnReader::_read_values_on_levels(size_t num_values,
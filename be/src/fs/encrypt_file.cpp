@@ -28,6 +28,7 @@
 #include "gutil/endian.h"
 #include "io/input_stream.h"
 #include "util/defer_op.h"
+#include "util/raw_container.h"
 
 #ifdef __x86_64__
 extern "C" unsigned int OPENSSL_ia32cap_P[];
@@ -93,6 +94,51 @@ std::string get_openssl_errors() {
 
 const uint8_t kEncryptionBlockSize = 16;
 
+// Cipher context cached per thread, so that allocating the context and expanding the key
+// are done once per key instead of once per read/write call. Switching to another offset
+// of the same file only needs a new counter.
+struct ThreadLocalCipherCtx {
+    ~ThreadLocalCipherCtx() {
+        if (ctx != nullptr) {
+            EVP_CIPHER_CTX_free(ctx);
+        }
+    }
+    EVP_CIPHER_CTX* ctx = nullptr;
+    const EVP_CIPHER* cipher = nullptr;
+    std::string key;
+    int enc = 0;
+};
+
+StatusOr<EVP_CIPHER_CTX*> get_cipher_ctx(const FileEncryptionInfo& eh, const uint8_t* iv, int enc) {
+    const auto* cipher = get_evp_cipher(eh);
+    if (PREDICT_FALSE(!cipher)) {
+        return Status::InternalError(
+                fmt::format("get cipher for algorithm {} key_size: {} failed", eh.algorithm, eh.key.size()));
+    }
+    static thread_local ThreadLocalCipherCtx cached;
+    if (cached.ctx == nullptr) {
+        cached.ctx = EVP_CIPHER_CTX_new();
+        if (!cached.ctx) {
+            return Status::InternalError("failed to create cipher context");
+        }
+    }
+    if (cached.cipher == cipher && cached.enc == enc && cached.key == eh.key) {
+        // same key, only reset the counter
+        OPENSSL_RET_NOT_OK(EVP_CipherInit_ex(cached.ctx, nullptr, nullptr, nullptr, iv, enc),
+                           "Failed to reset cipher iv");
+        return cached.ctx;
+    }
+    // invalidate the cache in case the initialization fails
+    cached.cipher = nullptr;
+    OPENSSL_RET_NOT_OK(EVP_CipherInit_ex(cached.ctx, cipher, nullptr, eh.key_bytes(), iv, enc),
+                       "Failed to initialize cipher");
+    OPENSSL_RET_NOT_OK(EVP_CIPHER_CTX_set_padding(cached.ctx, 0), "failed to disable padding");
+    cached.cipher = cipher;
+    cached.key = eh.key;
+    cached.enc = enc;
+    return cached.ctx;
+}
+
 // Encrypts the data in 'cleartext' and writes it to 'ciphertext'. It requires
 // 'offset' to be set in the file as it's used to set the initialization vector.
 Status DoEncryptV(const FileEncryptionInfo& eh, uint64_t offset, const Slice* cleartext, Slice* ciphertext, size_t n) {
@@ -101,18 +147,7 @@ Status DoEncryptV(const FileEncryptionInfo& eh, uint64_t offset, const Slice* cl
     *reinterpret_cast<uint64*>(&iv[0]) = BigEndian::FromHost64(0);
     *reinterpret_cast<uint64*>(&iv[8]) = BigEndian::FromHost64(offset / kEncryptionBlockSize);
 
-    const auto* cipher = get_evp_cipher(eh);
-    if (PREDICT_FALSE(!cipher)) {
-        return Status::InternalError(
-                fmt::format("get cipher for algorithm {} key_size: {} failed", eh.algorithm, eh.key.size()));
-    }
-    auto ctx = EVP_CIPHER_CTX_new();
-    if (!ctx) {
-        return Status::InternalError("failed to create cipher context");
-    }
-    DeferOp cleanup_ctx([&ctx]() { EVP_CIPHER_CTX_free(ctx); });
-    OPENSSL_RET_NOT_OK(EVP_EncryptInit_ex(ctx, cipher, nullptr, eh.key_bytes(), iv), "Failed to initialize encryption");
-    OPENSSL_RET_NOT_OK(EVP_CIPHER_CTX_set_padding(ctx, 0), "failed to disable padding");
+    ASSIGN_OR_RETURN(auto ctx, get_cipher_ctx(eh, iv, 1));
     const size_t offset_mod = offset % kEncryptionBlockSize;
     if (offset_mod) {
         unsigned char scratch_clear[kEncryptionBlockSize];
@@ -141,18 +176,7 @@ Status DoDecryptV(const FileEncryptionInfo& eh, uint64_t offset, Slice* data, si
     *reinterpret_cast<uint64*>(&iv[0]) = BigEndian::FromHost64(0);
     *reinterpret_cast<uint64*>(&iv[8]) = BigEndian::FromHost64(offset / kEncryptionBlockSize);
 
-    const auto* cipher = get_evp_cipher(eh);
-    if (PREDICT_FALSE(!cipher)) {
-        return Status::InternalError(
-                fmt::format("get cipher for algorithm {} key_size: {} failed", eh.algorithm, eh.key.size()));
-    }
-    auto ctx = EVP_CIPHER_CTX_new();
-    if (!ctx) {
-        return Status::InternalError("failed to create cipher context");
-    }
-    DeferOp cleanup_ctx([&ctx]() { EVP_CIPHER_CTX_free(ctx); });
-    OPENSSL_RET_NOT_OK(EVP_DecryptInit_ex(ctx, cipher, nullptr, eh.key_bytes(), iv), "Failed to initialize decryption");
-    OPENSSL_RET_NOT_OK(EVP_CIPHER_CTX_set_padding(ctx, 0), "failed to disable padding");
+    ASSIGN_OR_RETURN(auto ctx, get_cipher_ctx(eh, iv, 0));
     const size_t offset_mod = offset % kEncryptionBlockSize;
     if (offset_mod) {
         unsigned char scratch_clear[kEncryptionBlockSize];
@@ -181,7 +205,8 @@ EncryptWritableFile::EncryptWritableFile(WritableFile* file, Ownership ownership
 EncryptWritableFile::~EncryptWritableFile() = default;
 
 Status EncryptWritableFile::append(const Slice& data) {
-    std::vector<uint8_t> ciphertext(data.size);
+    // every byte is overwritten by the encryption, no need to zero the buffer
+    raw::RawVector<uint8_t> ciphertext(data.size);
     Slice ciphertext_slice(ciphertext.data(), ciphertext.size());
     RETURN_IF_ERROR(DoEncryptV(_encryption_info, _file->size(), &data, &ciphertext_slice, 1));
     return _file->append(ciphertext_slice);
@@ -192,7 +217,7 @@ Status EncryptWritableFile::appendv(const Slice* data, size_t cnt) {
     for (size_t i = 0; i < cnt; ++i) {
         total_size += data[i].size;
     }
-    std::vector<uint8_t> ciphertext(total_size);
+    raw::RawVector<uint8_t> ciphertext(total_size);
     std::vector<Slice> ciphertext_slices(cnt);
     size_t offset = 0;
     for (size_t i = 0; i < cnt; ++i) {
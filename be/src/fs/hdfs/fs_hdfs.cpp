@@ -55,6 +55,10 @@ public:
             auto st = getOrCreateFS();
             SCOPED_RAW_TIMER(&_total_open_file_time_ns);
             if (!st.ok()) return st.status();
+            _file = HdfsFileHandleCache::instance()->take(_hdfs_client, _path, _buffer_size);
+            if (_file != nullptr) {
+                return _file;
+            }
             _file = hdfsOpenFile(st.value(), _path.c_str(), O_RDONLY, _buffer_size, 0, 0);
             if (_file == nullptr) {
                 if (errno == ENOENT) {
@@ -92,9 +96,15 @@ public:
         return Status::OK();
     }
 
-    int close() {
+    // A handle that has not failed is given back to HdfsFileHandleCache instead of being closed,
+    // pass |reusable| = false to really close it after an IO error.
+    int close(bool reusable = true) {
         int r = 0;
         if (_file != nullptr) {
+            if (reusable && HdfsFileHandleCache::instance()->put(_hdfs_client, _path, _buffer_size, _file)) {
+                _file = nullptr;
+                return r;
+            }
             hdfsFS fs = getFS();
             r = hdfsCloseFile(fs, _file);
             _file = nullptr;
@@ -108,7 +118,7 @@ public:
         for (int i = 0; i < (retry + 1); i++) {
             tSize r = hdfsPread(fs, _file, _offset, data, static_cast<tSize>(size));
             if (r == -1) {
-                (void)close();
+                (void)close(false);
                 RETURN_IF_ERROR(ensureOpened());
             } else {
                 _offset += r;
@@ -132,9 +142,11 @@ public:
                 r = hdfsRead(fs, _file, buf + now, size - now);
                 if (r != -1) break;
                 if (i == retry) {
-                    return Status::IOError(fmt::format("fail to hdfsRead {}: {}", _path, get_hdfs_err_msg()));
+                    auto st = Status::IOError(fmt::format("fail to hdfsRead {}: {}", _path, get_hdfs_err_msg()));
+                    (void)close(false);
+                    return st;
                 } else {
-                    (void)close();
+                    (void)close(false);
                     RETURN_IF_ERROR(ensureOpened());
                     RETURN_IF_ERROR(seek(_offset));
                 }
@@ -14,10 +14,15 @@
 
 #include "fs/hdfs/hdfs_fs_cache.h"
 
+#include <fmt/format.h>
+
+#include <algorithm>
 #include <memory>
 
 #include "common/config.h"
+#include "common/logging.h"
 #include "gutil/strings/substitute.h"
+#include "util/time.h"
 #include "udf/java/java_udf.h"
 #include "util/hdfs_util.h"
 
@@ -72,6 +77,13 @@ static Status create_hdfs_fs_handle(const std::string& namenode, const std::shar
                               hedged_read_threshold_millis.data());
     }
 
+    // Set for hdfs client short-circuit local read, it takes effect only when the datanode is co-located
+    // with the BE and has dfs.domain.socket.path configured too.
+    if (config::hdfs_client_enable_short_circuit_read && !config::hdfs_client_domain_socket_path.empty()) {
+        hdfsBuilderConfSetStr(hdfs_builder, "dfs.client.read.shortcircuit", "true");
+        hdfsBuilderConfSetStr(hdfs_builder, "dfs.domain.socket.path", config::hdfs_client_domain_socket_path.data());
+    }
+
     hdfs_client->hdfs_fs = hdfsBuilderConnect(hdfs_builder);
     if (hdfs_client->hdfs_fs == nullptr) {
         return Status::InternalError(strings::Substitute("fail to connect hdfs namenode, namenode=$0, err=$1", namenode,
@@ -123,4 +135,84 @@ Status HdfsFsCache::get_connection(const std::string& namenode, std::shared_ptr<
     return Status::OK();
 }
 
+HdfsFileHandleCache::~HdfsFileHandleCache() {
+    _index.clear();
+    _close_entries(&_entries);
+}
+
+std::string HdfsFileHandleCache::make_key(const std::shared_ptr<HdfsFsClient>& hdfs_client, const std::string& path,
+                                          int buffer_size) {
+    return fmt::format("{}:{}:{}", (void*)hdfs_client.get(), buffer_size, path);
+}
+
+hdfsFile HdfsFileHandleCache::take(const std::shared_ptr<HdfsFsClient>& hdfs_client, const std::string& path,
+                                   int buffer_size) {
+    if (config::hdfs_client_file_handle_cache_size <= 0) {
+        return nullptr;
+    }
+    const std::string key = make_key(hdfs_client, path, buffer_size);
+    EntryList evicted;
+    hdfsFile file = nullptr;
+    {
+        std::lock_guard<std::mutex> l(_lock);
+        _evict_unlocked(MonotonicMillis(), &evicted);
+        auto it = _index.find(key);
+        if (it != _index.end()) {
+            file = it->second->file;
+            _entries.erase(it->second);
+            _index.erase(it);
+        }
+    }
+    _close_entries(&evicted);
+    return file;
+}
+
+bool HdfsFileHandleCache::put(const std::shared_ptr<HdfsFsClient>& hdfs_client, const std::string& path,
+                              int buffer_size, hdfsFile file) {
+    if (config::hdfs_client_file_handle_cache_size <= 0) {
+        return false;
+    }
+    const int64_t now_ms = MonotonicMillis();
+    EntryList evicted;
+    {
+        std::lock_guard<std::mutex> l(_lock);
+        _entries.push_front(Entry{make_key(hdfs_client, path, buffer_size), hdfs_client, file, now_ms});
+        _index.emplace(_entries.front().key, _entries.begin());
+        _evict_unlocked(now_ms, &evicted);
+    }
+    _close_entries(&evicted);
+    return true;
+}
+
+size_t HdfsFileHandleCache::size() {
+    std::lock_guard<std::mutex> l(_lock);
+    return _entries.size();
+}
+
+void HdfsFileHandleCache::_evict_unlocked(int64_t now_ms, EntryList* evicted) {
+    const size_t capacity = std::max(config::hdfs_client_file_handle_cache_size, 0);
+    const int64_t ttl_ms = config::hdfs_client_file_handle_cache_ttl_sec * 1000L;
+    while (!_entries.empty() && (_entries.size() > capacity || now_ms - _entries.back().put_time_ms > ttl_ms)) {
+        auto last = std::prev(_entries.end());
+        auto range = _index.equal_range(last->key);
+        for (auto it = range.first; it != range.second; ++it) {
+            if (it->second == last) {
+                _index.erase(it);
+                break;
+            }
+        }
+        evicted->splice(evicted->end(), _entries, last);
+    }
+}
+
+void HdfsFileHandleCache::_close_entries(EntryList* entries) {
+    // hdfsCloseFile may talk to the datanode, so it is called out of the lock.
+    for (auto& entry : *entries) {
+        if (hdfsCloseFile(entry.hdfs_client->hdfs_fs, entry.file) == -1) {
+            LOG(WARNING) << "Fail to close cached hdfs file handle: " << get_hdfs_err_msg();
+        }
+    }
+    entries->clear();
+}
+
 } // namespace starrocks
@@ -17,6 +17,7 @@
 #include <hdfs/hdfs.h>
 
 #include <atomic>
+#include <list>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -65,4 +66,51 @@ private:
     const HdfsFsCache& operator=(const HdfsFsCache&) = delete;
 };
 
+// Cache for idle read-only HDFS file handles, so that scanners reading the same file one after
+// another can skip the hdfsOpenFile round trip to the namenode. A handle is used by one reader
+// at a time: take() removes it from the cache and put() gives it back when the reader is done.
+// Only reads through hdfsPread or seek + hdfsRead happen on these handles, so the position left
+// by a previous reader does not matter.
+class HdfsFileHandleCache {
+public:
+    ~HdfsFileHandleCache();
+    static HdfsFileHandleCache* instance() {
+        static HdfsFileHandleCache s_instance;
+        return &s_instance;
+    }
+
+    // Return an idle handle of |path| opened by |hdfs_client| with |buffer_size|, or nullptr if there is none.
+    hdfsFile take(const std::shared_ptr<HdfsFsClient>& hdfs_client, const std::string& path, int buffer_size);
+
+    // Return false if the handle is not cached, the caller still owns it and should close it.
+    bool put(const std::shared_ptr<HdfsFsClient>& hdfs_client, const std::string& path, int buffer_size,
+             hdfsFile file);
+
+    size_t size();
+
+private:
+    struct Entry {
+        std::string key;
+        std::shared_ptr<HdfsFsClient> hdfs_client;
+        hdfsFile file;
+        int64_t put_time_ms;
+    };
+    using EntryList = std::list<Entry>;
+
+    static std::string make_key(const std::shared_ptr<HdfsFsClient>& hdfs_client, const std::string& path,
+                                int buffer_size);
+    // Move the entries that are expired or over capacity into |evicted|, must hold _lock.
+    void _evict_unlocked(int64_t now_ms, EntryList* evicted);
+    static void _close_entries(EntryList* entries);
+
+    std::mutex _lock;
+    // The most recently returned handle is at the front.
+    EntryList _entries;
+    std::unordered_multimap<std::string, EntryList::iterator> _index;
+
+    HdfsFileHandleCache() = default;
+    HdfsFileHandleCache(const HdfsFileHandleCache&) = delete;
+    const HdfsFileHandleCache& operator=(const HdfsFileHandleCache&) = delete;
+};
+
 } // namespace starrocks
@@ -134,8 +134,13 @@ void ProfileAction::handle(HttpRequest* req) {
 static std::mutex kIOPprofActionMutex;
 
 void IOProfileAction::handle(HttpRequest* req) {
-    std::lock_guard<std::mutex> lock(kIOPprofActionMutex);
     auto scoped_span = trace::Scope(Tracer::Instance().start_trace("http_handle_io_profile"));
+    // latency stats are always collected, no need to profile for a while
+    if (req->param("mode") == "latency") {
+        HttpChannel::send_reply(req, IOProfiler::get_latency_stats_str());
+        return;
+    }
+    std::lock_guard<std::mutex> lock(kIOPprofActionMutex);
 
     int seconds = 10;
     const std::string& seconds_str = req->param(SECOND_KEY);
@@ -0,0 +1,93 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "http/action/query_flame_graph_action.h"
+
+#include <mutex>
+#include <string>
+
+#include "exec/pipeline/query_context.h"
+#include "gutil/strings/substitute.h"
+#include "http/http_channel.h"
+#include "http/http_headers.h"
+#include "http/http_request.h"
+#include "http/http_status.h"
+#include "runtime/exec_env.h"
+#include "util/stack_util.h"
+#include "util/uid_util.h"
+
+namespace starrocks {
+
+static const std::string QUERY_ID_KEY = "query_id";
+static const std::string SECONDS_KEY = "seconds";
+static const std::string FREQUENCY_KEY = "frequency";
+// the pipeline executor and scan threads are named pip_exec_*, pip_scan_* and pip_con_scan_*
+static const std::string PIPELINE_THREAD_NAME_PREFIX = "pip_";
+
+static const int kDefaultSampleSecs = 10;
+static const int kMaxSampleSecs = 300;
+static const int kDefaultFrequency = 99;
+static const int kMaxFrequency = 1000;
+
+// only one query is sampled at a time
+static std::mutex kQueryFlameGraphMutex;
+
+static bool get_int_param(HttpRequest* req, const std::string& name, int min_value, int max_value, int* value) {
+    const std::string& str_value = req->param(name);
+    if (str_value.empty()) {
+        return true;
+    }
+    try {
+        *value = std::stoi(str_value);
+    } catch (const std::exception& e) {
+        return false;
+    }
+    return *value >= min_value && *value <= max_value;
+}
+
+void QueryFlameGraphAction::handle(HttpRequest* req) {
+    TUniqueId query_id;
+    if (!parse_id(req->param(QUERY_ID_KEY), &query_id)) {
+        HttpChannel::send_reply(req, HttpStatus::BAD_REQUEST,
+                                strings::Substitute("Invalid param $0: '$1'", QUERY_ID_KEY, req->param(QUERY_ID_KEY)));
+        return;
+    }
+    int seconds = kDefaultSampleSecs;
+    if (!get_int_param(req, SECONDS_KEY, 1, kMaxSampleSecs, &seconds)) {
+        HttpChannel::send_reply(req, HttpStatus::BAD_REQUEST,
+                                strings::Substitute("Invalid param $0, it should be in [1, $1]", SECONDS_KEY,
+                                                    kMaxSampleSecs));
+        return;
+    }
+    int frequency = kDefaultFrequency;
+    if (!get_int_param(req, FREQUENCY_KEY, 1, kMaxFrequency, &frequency)) {
+        HttpChannel::send_reply(req, HttpStatus::BAD_REQUEST,
+                                strings::Substitute("Invalid param $0, it should be in [1, $1]", FREQUENCY_KEY,
+                                                    kMaxFrequency));
+        return;
+    }
+    if (_exec_env->query_context_mgr()->get(query_id) == nullptr) {
+        HttpChannel::send_reply(req, HttpStatus::NOT_FOUND,
+                                strings::Substitute("Query $0 is not running on this backend", print_id(query_id)));
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(kQueryFlameGraphMutex);
+    auto tids = get_thread_id_list_with_name_prefix(PIPELINE_THREAD_NAME_PREFIX);
+    std::string stacks = get_collapsed_stacks_for_query(tids, query_id, seconds * 1000, frequency);
+    req->add_output_header(HttpHeaders::CONTENT_TYPE, "text/plain");
+    HttpChannel::send_reply(req, HttpStatus::OK, stacks);
+}
+
+} // namespace starrocks
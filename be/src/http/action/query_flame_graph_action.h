@@ -0,0 +1,38 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "http/http_handler.h"
+
+namespace starrocks {
+
+class ExecEnv;
+
+// Samples the stacks of the pipeline threads while they are running a query, and replies the collapsed stacks
+// which can be rendered by flamegraph.pl.
+//
+// GET /api/query_flame_graph?query_id=<id>[&seconds=10][&frequency=99]
+class QueryFlameGraphAction : public HttpHandler {
+public:
+    explicit QueryFlameGraphAction(ExecEnv* exec_env) : _exec_env(exec_env) {}
+    ~QueryFlameGraphAction() override = default;
+
+    void handle(HttpRequest* req) override;
+
+private:
+    ExecEnv* _exec_env;
+};
+
+} // namespace starrocks
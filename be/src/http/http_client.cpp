@@ -177,6 +177,10 @@ Status HttpClient::execute(const std::function<bool(const void* data, size_t len
 }
 
 StatusOr<uint64_t> HttpClient::download(const std::string& local_path) {
+    return download(local_path, config::max_download_speed_kbps);
+}
+
+StatusOr<uint64_t> HttpClient::download(const std::string& local_path, int64_t max_speed_limit_kbps) {
     // set method to GET
     set_method(GET);
 
@@ -184,7 +188,7 @@ StatusOr<uint64_t> HttpClient::download(const std::string& local_path) {
     // at system level
     curl_easy_setopt(_curl, CURLOPT_LOW_SPEED_LIMIT, config::download_low_speed_limit_kbps * 1024);
     curl_easy_setopt(_curl, CURLOPT_LOW_SPEED_TIME, config::download_low_speed_time);
-    curl_easy_setopt(_curl, CURLOPT_MAX_RECV_SPEED_LARGE, config::max_download_speed_kbps * 1024);
+    curl_easy_setopt(_curl, CURLOPT_MAX_RECV_SPEED_LARGE, static_cast<curl_off_t>(max_speed_limit_kbps * 1024));
 
     WritableFileOptions opts{.sync_on_close = true, .mode = FileSystem::CREATE_OR_OPEN_WITH_TRUNCATE};
     ASSIGN_OR_RETURN(auto output_file, fs::new_writable_file(opts, local_path));
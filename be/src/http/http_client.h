@@ -114,6 +114,8 @@ public:
     // helper function to download a file, you can call this function to downlaod
     // a file to local_path
     StatusOr<uint64_t> download(const std::string& local_path);
+    // same as above, but limit the download speed by `max_speed_limit_kbps` instead of max_download_speed_kbps
+    StatusOr<uint64_t> download(const std::string& local_path, int64_t max_speed_limit_kbps);
 
     Status download(const std::function<Status(const void* data, size_t length)>& callback,
                     int32_t min_speed_limit_kbps, int32_t min_speed_time_sec, int32_t max_speed_limit_kbps);
@@ -16,6 +16,8 @@
 
 #include <fmt/format.h>
 
+#include <atomic>
+#include <memory>
 #include <utility>
 
 #include "common/config.h"
@@ -28,6 +30,36 @@
 
 namespace starrocks::io {
 
+// Remembers the blocks missed recently, so that with `datacache_populate_on_second_access` a block is
+// only written to the cache on its second miss. It is a lossy direct-mapped table of block hashes:
+// a collision only makes a block wait for one more miss, or be admitted one miss early.
+class PopulateDoorkeeper {
+public:
+    static PopulateDoorkeeper* instance() {
+        static PopulateDoorkeeper doorkeeper;
+        return &doorkeeper;
+    }
+
+    // Returns true if the block was missed before, otherwise remembers it and returns false.
+    bool check_and_record(uint64_t block_hash) {
+        // zero marks an empty slot
+        const uint64_t tag = block_hash | 1;
+        auto& slot = _slots[block_hash & (kSlotCount - 1)];
+        if (slot.load(std::memory_order_relaxed) == tag) {
+            return true;
+        }
+        slot.store(tag, std::memory_order_relaxed);
+        return false;
+    }
+
+private:
+    static constexpr size_t kSlotCount = 1 << 20;
+
+    PopulateDoorkeeper() : _slots(new std::atomic<uint64_t>[kSlotCount]()) {}
+
+    std::unique_ptr<std::atomic<uint64_t>[]> _slots;
+};
+
 // We use the `SharedBufferedInputStream` in `CacheInputStream` directly, because the we depend some functions of
 // `SharedBufferedInputStream`.
 // In fact, although the parameter is `SeekableInputStream` before, we only use `CacheInputStream` when using
@@ -152,7 +184,14 @@ Status CacheInputStream::_read_from_cache(const int64_t offset, const int64_t si
         }
         read_size = block_size;
 
-        if (res.ok() && _enable_populate_cache) {
+        if (!res.ok() && !res.is_not_found() && !res.is_resource_busy()) {
+            // The peer is unreachable or failing, e.g. it left the cluster. Stop asking it for the rest of
+            // this stream instead of paying the rpc timeout on every block.
+            _peer_host.clear();
+            _peer_port = 0;
+        }
+
+        if (res.ok() && _enable_populate_cache && config::datacache_populate_peer_cache_blocks) {
             WriteCacheOptions options;
             options.async = _enable_async_populate_mode;
             options.evict_probability = _datacache_evict_probability;
@@ -445,6 +484,13 @@ void CacheInputStream::_populate_to_cache(const char* p, int64_t offset, int64_t
     int64_t end = std::min((offset + count + _block_size - 1) / _block_size * _block_size, _size);
     p -= (offset - begin);
     auto f = [sb, this](const char* buf, size_t off, size_t size) {
+        if (config::datacache_populate_on_second_access &&
+            !PopulateDoorkeeper::instance()->check_and_record(
+                    HashUtil::hash64(_cache_key.data(), _cache_key.size(), off / _block_size))) {
+            _stats.skip_write_cache_count += 1;
+            _stats.skip_write_cache_bytes += size;
+            return;
+        }
         WriteCacheOptions options;
         options.async = _enable_async_populate_mode;
         options.evict_probability = _datacache_evict_probability;
@@ -15,13 +15,18 @@
 #include "io_profiler.h"
 
 #include <cstdint>
+#include <deque>
 #include <memory>
 #include <mutex>
 #include <thread>
 #include <unordered_set>
 
+#include "common/config.h"
 #include "fmt/format.h"
+#include "runtime/current_thread.h"
 #include "util/stack_util.h"
+#include "util/time.h"
+#include "util/uid_util.h"
 #include "util/starrocks_metrics.h"
 #include "util/system_metrics.h"
 
@@ -202,10 +207,120 @@ IOProfiler::IOStat IOProfiler::calculate_scoped_tls_io(const IOStat& snapshot) {
     return io_stat;
 }
 
+enum LatencyOp { LATENCY_READ = 0, LATENCY_WRITE, LATENCY_SYNC, LATENCY_OP_END };
+
+static const char* latency_op_to_string(int op) {
+    switch (op) {
+    case LATENCY_READ:
+        return "read";
+    case LATENCY_WRITE:
+        return "write";
+    default:
+        return "sync";
+    }
+}
+
+// Bucket i counts the requests whose latency is in [2^(i-1), 2^i) us, the first bucket is below 1us
+// and the last one is unbounded.
+static constexpr int kLatencyBuckets = 26;
+static std::atomic<uint64_t> _latency_histograms[IOProfiler::TAG_END][LATENCY_OP_END][kLatencyBuckets];
+
+struct SlowIOSample {
+    int64_t timestamp_ms;
+    uint32_t tag;
+    int op;
+    uint64_t tablet_id;
+    TUniqueId query_id;
+    int64_t bytes;
+    int64_t latency_ns;
+};
+
+static constexpr size_t kMaxSlowIOSamples = 128;
+static std::mutex _slow_io_mutex;
+static std::deque<SlowIOSample> _slow_io_samples;
+
+void IOProfiler::_add_latency(int op, int64_t bytes, int64_t latency_ns) {
+    uint32_t tag = current_io_tag < TAG_END ? current_io_tag : TAG_NONE;
+    uint64_t latency_us = latency_ns > 0 ? latency_ns / 1000 : 0;
+    int bucket = latency_us == 0 ? 0 : std::min(kLatencyBuckets - 1, 64 - __builtin_clzll(latency_us));
+    _latency_histograms[tag][op][bucket].fetch_add(1, std::memory_order_relaxed);
+
+    int64_t threshold_ms = config::io_profiler_slow_io_threshold_ms;
+    if (threshold_ms <= 0 || latency_ns < threshold_ms * 1000000) {
+        return;
+    }
+    uint64_t tablet_id = current_io_stat != nullptr ? (current_io_stat->id & 0x0000FFFFFFFFFFFFUL) : 0;
+    SlowIOSample sample{UnixMillis(), tag, op, tablet_id, CurrentThread::current().query_id(), bytes, latency_ns};
+    std::lock_guard<std::mutex> l(_slow_io_mutex);
+    if (_slow_io_samples.size() >= kMaxSlowIOSamples) {
+        _slow_io_samples.pop_front();
+    }
+    _slow_io_samples.push_back(sample);
+}
+
+void IOProfiler::reset_latency_stats() {
+    for (auto& tag_histograms : _latency_histograms) {
+        for (auto& histogram : tag_histograms) {
+            for (auto& bucket : histogram) {
+                bucket.store(0, std::memory_order_relaxed);
+            }
+        }
+    }
+    std::lock_guard<std::mutex> l(_slow_io_mutex);
+    _slow_io_samples.clear();
+}
+
+std::string IOProfiler::get_latency_stats_str() {
+    // The upper bound of the bucket the percentile falls into, in us.
+    auto percentile = [](const uint64_t* buckets, uint64_t total, double p) -> uint64_t {
+        uint64_t rank = std::max<uint64_t>(1, total * p);
+        uint64_t seen = 0;
+        for (int i = 0; i < kLatencyBuckets; i++) {
+            seen += buckets[i];
+            if (seen >= rank) {
+                return 1UL << i;
+            }
+        }
+        return 1UL << (kLatencyBuckets - 1);
+    };
+
+    std::stringstream ss;
+    ss << fmt::format("{:>10} {:>6} {:>12} {:>12} {:>12} {:>12}\n", "TAG", "OP", "ops", "p50_us<=", "p99_us<=",
+                      "p999_us<=");
+    for (uint32_t tag = 0; tag < TAG_END; tag++) {
+        for (int op = 0; op < LATENCY_OP_END; op++) {
+            uint64_t buckets[kLatencyBuckets];
+            uint64_t total = 0;
+            for (int i = 0; i < kLatencyBuckets; i++) {
+                buckets[i] = _latency_histograms[tag][op][i].load(std::memory_order_relaxed);
+                total += buckets[i];
+            }
+            if (total == 0) {
+                continue;
+            }
+            ss << fmt::format("{:>10} {:>6} {:>12} {:>12} {:>12} {:>12}\n", tag_to_string(tag),
+                              latency_op_to_string(op), total, percentile(buckets, total, 0.5),
+                              percentile(buckets, total, 0.99), percentile(buckets, total, 0.999));
+        }
+    }
+
+    ss << fmt::format("\nslow io (>= {}ms), oldest first:\n", config::io_profiler_slow_io_threshold_ms);
+    ss << fmt::format("{:>14} {:>10} {:>6} {:>10} {:>34} {:>12} {:>12}\n", "timestamp_ms", "TAG", "OP", "Tablet",
+                      "query_id", "bytes", "latency_us");
+    std::lock_guard<std::mutex> l(_slow_io_mutex);
+    for (const auto& sample : _slow_io_samples) {
+        ss << fmt::format("{:>14} {:>10} {:>6} {:>10} {:>34} {:>12} {:>12}\n", sample.timestamp_ms,
+                          tag_to_string(sample.tag), latency_op_to_string(sample.op), sample.tablet_id,
+                          print_id(sample.query_id), sample.bytes, sample.latency_ns / 1000);
+    }
+    return ss.str();
+}
+
 void IOProfiler::_add_tls_read(int64_t bytes, int64_t latency_ns) {
     tls_io_stat.read_ops += 1;
     tls_io_stat.read_bytes += bytes;
     tls_io_stat.read_time_ns += latency_ns;
+    _add_latency(LATENCY_READ, bytes, latency_ns);
     auto* metrics = StarRocksMetrics::instance()->system_metrics()->get_io_metrics_by_tag(current_io_tag);
     if (UNLIKELY(metrics == nullptr)) {
         // some r/w operations may be performed before metrics are initialized, in which case updating metrics is ignored.
@@ -219,6 +334,7 @@ void IOProfiler::_add_tls_write(int64_t bytes, int64_t latency_ns) {
     tls_io_stat.write_ops += 1;
     tls_io_stat.write_bytes += bytes;
     tls_io_stat.write_time_ns += latency_ns;
+    _add_latency(LATENCY_WRITE, bytes, latency_ns);
     auto* metrics = StarRocksMetrics::instance()->system_metrics()->get_io_metrics_by_tag(current_io_tag);
     if (UNLIKELY(metrics == nullptr)) {
         return;
@@ -230,6 +346,7 @@ void IOProfiler::_add_tls_write(int64_t bytes, int64_t latency_ns) {
 void IOProfiler::_add_tls_sync(int64_t latency_ns) {
     tls_io_stat.sync_ops += 1;
     tls_io_stat.sync_time_ns += latency_ns;
+    _add_latency(LATENCY_SYNC, 0, latency_ns);
 }
 
 const char* IOProfiler::tag_to_string(uint32_t tag) {
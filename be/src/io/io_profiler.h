@@ -128,6 +128,11 @@ public:
 
     static inline void add_sync(int64_t latency_ns) { _add_tls_sync(latency_ns); }
 
+    // Latency histograms per tag and the recent slow IO samples, as tabular format string.
+    // Unlike the top n stats they are always collected, independent of start().
+    static std::string get_latency_stats_str();
+    static void reset_latency_stats();
+
     static StatusOr<std::vector<std::string>> get_topn_read_stats(size_t n);
     static StatusOr<std::vector<std::string>> get_topn_write_stats(size_t n);
     static StatusOr<std::vector<std::string>> get_topn_total_stats(size_t n);
@@ -150,6 +155,8 @@ protected:
     static void _add_tls_write(int64_t bytes, int64_t latency_ns);
     static void _add_tls_sync(int64_t latency_ns);
 
+    static void _add_latency(int op, int64_t bytes, int64_t latency_ns);
+
     // Update io statistics associated with a context, such as tag + tablet_id
     static void _add_context_read(int64_t bytes);
     static void _add_context_write(int64_t bytes);
@@ -15,14 +15,26 @@
 #include "io/s3_input_stream.h"
 
 #include <aws/core/Aws.h>
+#include <aws/core/http/HttpRequest.h>
 #include <aws/s3/S3Client.h>
 #include <aws/s3/model/GetObjectRequest.h>
 #include <aws/s3/model/HeadObjectRequest.h>
 #include <fmt/format.h>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+#include "bthread/timer_thread.h"
+#include "common/config.h"
 #include "io/io_profiler.h"
 #include "io/s3_zero_copy_iostream.h"
 #include "util/stopwatch.hpp"
+#include "util/time.h"
 
 #ifdef USE_STAROS
 #include "fslib/metric_key.h"
@@ -37,6 +49,270 @@ inline Status make_error_status(const Aws::S3::S3Error& error) {
             static_cast<int>(error.GetResponseCode()), static_cast<int>(error.GetErrorType()), error.GetMessage()));
 }
 
+namespace {
+
+// Read latency distribution of one bucket, the i-th slot counts the requests finished in [2^i, 2^(i+1)) us.
+class S3LatencyHistogram {
+public:
+    static constexpr int64_t kMinSamples = 64;
+    static constexpr int64_t kMaxSamples = 1 << 16;
+
+    void add(int64_t latency_us) {
+        int slot = latency_us <= 1 ? 0 : std::min<int>(63 - __builtin_clzll(latency_us), kSlots - 1);
+        _slots[slot].fetch_add(1, std::memory_order_relaxed);
+        if (_count.fetch_add(1, std::memory_order_relaxed) + 1 >= kMaxSamples) {
+            decay();
+        }
+    }
+
+    // Returns -1 if there are too few samples to tell.
+    int64_t percentile_us(int percentile) const {
+        int64_t total = _count.load(std::memory_order_relaxed);
+        if (total < kMinSamples) {
+            return -1;
+        }
+        int64_t target = total * std::clamp(percentile, 1, 100) / 100;
+        int64_t seen = 0;
+        for (int i = 0; i < kSlots; i++) {
+            seen += _slots[i].load(std::memory_order_relaxed);
+            if (seen >= target) {
+                return int64_t(1) << (i + 1);
+            }
+        }
+        return int64_t(1) << kSlots;
+    }
+
+private:
+    // Halve all the slots so the distribution follows the recent latency of the store.
+    void decay() {
+        std::unique_lock l(_decay_mutex, std::try_to_lock);
+        if (!l.owns_lock() || _count.load(std::memory_order_relaxed) < kMaxSamples) {
+            return;
+        }
+        int64_t total = 0;
+        for (auto& slot : _slots) {
+            int64_t v = slot.load(std::memory_order_relaxed) / 2;
+            slot.store(v, std::memory_order_relaxed);
+            total += v;
+        }
+        _count.store(total, std::memory_order_relaxed);
+    }
+
+    static constexpr int kSlots = 32;
+    std::array<std::atomic<int64_t>, kSlots> _slots{};
+    std::atomic<int64_t> _count{0};
+    std::mutex _decay_mutex;
+};
+
+S3LatencyHistogram* get_latency_histogram(const std::string& bucket) {
+    static std::shared_mutex mutex;
+    static std::unordered_map<std::string, std::unique_ptr<S3LatencyHistogram>> histograms;
+    {
+        std::shared_lock l(mutex);
+        auto it = histograms.find(bucket);
+        if (it != histograms.end()) {
+            return it->second.get();
+        }
+    }
+    std::unique_lock l(mutex);
+    auto& histogram = histograms[bucket];
+    if (histogram == nullptr) {
+        histogram = std::make_unique<S3LatencyHistogram>();
+    }
+    return histogram.get();
+}
+
+// Limits the hedged reads to s3_hedged_read_budget_percent of the reads. The reads are counted in windows of
+// s3_hedged_read_budget_window_ms, so a burst of slow reads can only use the budget earned recently.
+class S3HedgeBudget {
+public:
+    void add_read() {
+        _roll_window();
+        _reads.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    bool acquire() {
+        _roll_window();
+        // the window just started has few reads, so the previous one also counts
+        int64_t reads = std::max(_reads.load(std::memory_order_relaxed), _last_reads.load(std::memory_order_relaxed));
+        int64_t allowed = reads * std::max(config::s3_hedged_read_budget_percent, 0) / 100;
+        if (_hedges.fetch_add(1, std::memory_order_relaxed) >= allowed) {
+            _hedges.fetch_sub(1, std::memory_order_relaxed);
+            return false;
+        }
+        return true;
+    }
+
+private:
+    void _roll_window() {
+        int64_t now = MonotonicMillis();
+        int64_t start = _window_start_ms.load(std::memory_order_relaxed);
+        if (now - start < std::max(config::s3_hedged_read_budget_window_ms, 1)) {
+            return;
+        }
+        // only one thread starts the new window, the counts of the racing reads may be lost, which is fine
+        if (_window_start_ms.compare_exchange_strong(start, now, std::memory_order_relaxed)) {
+            _last_reads.store(_reads.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+            _hedges.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    std::atomic<int64_t> _window_start_ms{0};
+    std::atomic<int64_t> _reads{0};
+    std::atomic<int64_t> _last_reads{0};
+    std::atomic<int64_t> _hedges{0};
+};
+
+S3HedgeBudget g_hedge_budget;
+
+// State shared by the primary read and its hedge, it outlives the reader if the hedge is still in flight.
+struct HedgedReadState {
+    std::shared_ptr<Aws::S3::S3Client> client;
+    std::string bucket;
+    std::string object;
+    int64_t offset = 0;
+    int64_t length = 0;
+    S3LatencyHistogram* histogram = nullptr;
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool primary_finished = false;
+    bool hedge_launched = false;
+    bool hedge_finished = false;
+    // 0 for the primary read, 1 for the hedge
+    std::atomic<int> winner{-1};
+    // the hedge reads into its own buffer, because the primary may still be writing |out|
+    std::unique_ptr<char[]> hedge_buffer;
+};
+
+Aws::S3::Model::GetObjectRequest make_range_request(const HedgedReadState& state, char* buf) {
+    Aws::S3::Model::GetObjectRequest request;
+    request.SetBucket(state.bucket);
+    request.SetKey(state.object);
+    // https://www.rfc-editor.org/rfc/rfc9110.html#name-range
+    request.SetRange(fmt::format("bytes={}-{}", state.offset, state.offset + state.length - 1));
+    int64_t length = state.length;
+    request.SetResponseStreamFactory(
+            [buf, length]() { return Aws::New<S3ZeroCopyIOStream>(AWS_ALLOCATE_TAG, buf, length); });
+    return request;
+}
+
+// Runs on the global timer thread once the primary read is slower than the tail latency of the bucket.
+void launch_hedged_read(void* arg) {
+    std::unique_ptr<std::shared_ptr<HedgedReadState>> holder(static_cast<std::shared_ptr<HedgedReadState>*>(arg));
+    auto state = *holder;
+    {
+        std::lock_guard l(state->mutex);
+        if (state->primary_finished || !g_hedge_budget.acquire()) {
+            return;
+        }
+        state->hedge_launched = true;
+        state->hedge_buffer.reset(new char[state->length]);
+    }
+    auto request = make_range_request(*state, state->hedge_buffer.get());
+    int64_t start_ns = MonotonicNanos();
+    auto handler = [state, start_ns](const auto* /*client*/, const auto& /*request*/, auto outcome,
+                                     const auto& /*context*/) {
+        bool ok = outcome.IsSuccess() && outcome.GetResult().GetContentLength() == state->length;
+        if (ok) {
+            state->histogram->add((MonotonicNanos() - start_ns) / 1000);
+        }
+        std::lock_guard l(state->mutex);
+        state->hedge_finished = true;
+        int none = -1;
+        if (ok) {
+            state->winner.compare_exchange_strong(none, 1);
+        }
+        state->cv.notify_all();
+    };
+    state->client->GetObjectAsync(request, handler);
+}
+
+} // namespace
+
+Status S3InputStream::_get_object_range(int64_t offset, int64_t length, char* out) {
+    // The poco client can't abandon a request once it is sent, so a hedge could not shorten the read.
+    if (config::s3_hedged_read_enable && !config::enable_poco_client_for_aws_sdk) {
+        return _hedged_get_object_range(offset, length, out);
+    }
+    Aws::S3::Model::GetObjectRequest request;
+    request.SetBucket(_bucket);
+    request.SetKey(_object);
+    // https://www.rfc-editor.org/rfc/rfc9110.html#name-range
+    request.SetRange(fmt::format("bytes={}-{}", offset, offset + length - 1));
+    request.SetResponseStreamFactory(
+            [out, length]() { return Aws::New<S3ZeroCopyIOStream>(AWS_ALLOCATE_TAG, out, length); });
+    Aws::S3::Model::GetObjectOutcome outcome = _s3client->GetObject(request);
+    if (!outcome.IsSuccess()) {
+        return make_error_status(outcome.GetError());
+    }
+    if (UNLIKELY(outcome.GetResult().GetContentLength() != length)) {
+        return Status::InternalError("The response length is different from request length for io stream!");
+    }
+    return Status::OK();
+}
+
+// The primary read is sent synchronously into |out|. If it is still running after the tail latency of the
+// bucket, the global timer thread sends the same ranged GET asynchronously. When the hedge wins, the primary
+// is abandoned through its continue handler and the hedge buffer is copied to |out|.
+Status S3InputStream::_hedged_get_object_range(int64_t offset, int64_t length, char* out) {
+    auto state = std::make_shared<HedgedReadState>();
+    state->client = _s3client;
+    state->bucket = _bucket;
+    state->object = _object;
+    state->offset = offset;
+    state->length = length;
+    state->histogram = get_latency_histogram(_bucket);
+    g_hedge_budget.add_read();
+
+    int64_t delay_ms = std::max<int64_t>(state->histogram->percentile_us(config::s3_hedged_read_latency_percentile),
+                                         config::s3_hedged_read_min_delay_ms * 1000L) /
+                       1000;
+    auto* timer = bthread::get_global_timer_thread();
+    auto* arg = new std::shared_ptr<HedgedReadState>(state);
+    auto tid = timer->schedule(launch_hedged_read, arg, butil::milliseconds_from_now(delay_ms));
+    if (tid == bthread::TimerThread::INVALID_TASK_ID) {
+        delete arg;
+    }
+
+    auto request = make_range_request(*state, out);
+    request.SetContinueRequestHandler([state](const Aws::Http::HttpRequest*) { return state->winner.load() != 1; });
+    int64_t start_ns = MonotonicNanos();
+    Aws::S3::Model::GetObjectOutcome outcome = _s3client->GetObject(request);
+    Status st;
+    if (!outcome.IsSuccess()) {
+        st = make_error_status(outcome.GetError());
+    } else if (UNLIKELY(outcome.GetResult().GetContentLength() != length)) {
+        st = Status::InternalError("The response length is different from request length for io stream!");
+    } else {
+        state->histogram->add((MonotonicNanos() - start_ns) / 1000);
+    }
+
+    {
+        std::lock_guard l(state->mutex);
+        state->primary_finished = true;
+        int none = -1;
+        if (st.ok()) {
+            state->winner.compare_exchange_strong(none, 0);
+        }
+    }
+    // 0 means the hedge has not run, the timer task owns |arg| otherwise
+    if (tid != bthread::TimerThread::INVALID_TASK_ID && timer->unschedule(tid) == 0) {
+        delete arg;
+    }
+
+    std::unique_lock l(state->mutex);
+    state->cv.wait(l, [&] { return state->winner.load() >= 0 || !state->hedge_launched || state->hedge_finished; });
+    if (state->winner.load() == 1) {
+        memcpy(out, state->hedge_buffer.get(), length);
+        return Status::OK();
+    }
+    if (state->winner.load() == 0) {
+        return Status::OK();
+    }
+    return st;
+}
+
 StatusOr<int64_t> S3InputStream::read(void* out, int64_t count) {
     if (UNLIKELY(_size == -1)) {
         ASSIGN_OR_RETURN(_size, S3InputStream::get_size());
@@ -57,28 +333,10 @@ StatusOr<int64_t> S3InputStream::read(void* out, int64_t count) {
     // case6: read start is lower than buffer start         -> load data from s3 to buffer, copy from buffer
     if (count > _read_ahead_size) {
         auto real_length = std::min<int64_t>(_offset + count, _size) - _offset;
-
-        // https://www.rfc-editor.org/rfc/rfc9110.html#name-range
-        auto range = fmt::format("bytes={}-{}", _offset, _offset + real_length - 1);
-        Aws::S3::Model::GetObjectRequest request;
-        request.SetBucket(_bucket);
-        request.SetKey(_object);
-        request.SetRange(std::move(range));
-        request.SetResponseStreamFactory([out, real_length]() {
-            return Aws::New<S3ZeroCopyIOStream>(AWS_ALLOCATE_TAG, reinterpret_cast<char*>(out), real_length);
-        });
-
-        Aws::S3::Model::GetObjectOutcome outcome = _s3client->GetObject(request);
-        if (outcome.IsSuccess()) {
-            if (UNLIKELY(outcome.GetResult().GetContentLength() != real_length)) {
-                return Status::InternalError("The response length is different from request length for io stream!");
-            }
-            _offset += real_length;
-            IOProfiler::add_read(count, watch.elapsed_time());
-            return real_length;
-        } else {
-            return make_error_status(outcome.GetError());
-        }
+        RETURN_IF_ERROR(_get_object_range(_offset, real_length, static_cast<char*>(out)));
+        _offset += real_length;
+        IOProfiler::add_read(count, watch.elapsed_time());
+        return real_length;
     } else {
         int64_t remain_to_read_length = count;
         int64_t copy_length = 0;
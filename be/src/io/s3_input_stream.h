@@ -62,6 +62,10 @@ public:
     int64_t get_read_ahead_size() const { return _read_ahead_size; }
 
 private:
+    // Read [offset, offset + length) of the object into |out|, hedged if s3_hedged_read_enable is set.
+    Status _get_object_range(int64_t offset, int64_t length, char* out);
+    Status _hedged_get_object_range(int64_t offset, int64_t length, char* out);
+
     std::shared_ptr<Aws::S3::S3Client> _s3client;
     std::string _bucket;
     std::string _object;
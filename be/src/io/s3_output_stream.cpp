@@ -21,6 +21,8 @@
 #include <aws/s3/model/UploadPartRequest.h>
 #include <fmt/format.h>
 
+#include <algorithm>
+
 #include "common/logging.h"
 #include "io/io_profiler.h"
 #include "io/s3_zero_copy_iostream.h"
@@ -29,18 +31,27 @@
 namespace starrocks::io {
 
 S3OutputStream::S3OutputStream(std::shared_ptr<Aws::S3::S3Client> client, std::string bucket, std::string object,
-                               int64_t max_single_part_size, int64_t min_upload_part_size)
+                               int64_t max_single_part_size, int64_t min_upload_part_size,
+                               int max_inflight_parts)
         : _client(std::move(client)),
           _bucket(std::move(bucket)),
           _object(std::move(object)),
           _max_single_part_size(max_single_part_size),
           _min_upload_part_size(min_upload_part_size),
+          _max_inflight_parts(std::max(1, max_inflight_parts)),
           _buffer(),
           _upload_id(),
           _etags() {
     CHECK(_client != nullptr);
 }
 
+S3OutputStream::~S3OutputStream() {
+    // The in-flight requests still reference their buffers
+    for (auto& part : _inflight_parts) {
+        part.outcome.wait();
+    }
+}
+
 Status S3OutputStream::write(const void* data, int64_t size) {
     MonotonicStopWatch watch;
     watch.start();
@@ -49,7 +60,7 @@ Status S3OutputStream::write(const void* data, int64_t size) {
         RETURN_IF_ERROR(create_multipart_upload());
         DCHECK(!_upload_id.empty());
     }
-    if (!_upload_id.empty() && _buffer.size() >= _min_upload_part_size) {
+    if (!_upload_id.empty() && _buffer.size() >= upload_part_size()) {
         RETURN_IF_ERROR(multipart_upload());
         _buffer.clear();
     }
@@ -88,6 +99,7 @@ Status S3OutputStream::close() {
         RETURN_IF_ERROR(singlepart_upload());
     } else {
         RETURN_IF_ERROR(multipart_upload());
+        RETURN_IF_ERROR(wait_all_inflight_parts());
         RETURN_IF_ERROR(complete_multipart_upload());
     }
     IOProfiler::add_sync(watch.elapsed_time());
@@ -134,9 +146,19 @@ Status S3OutputStream::multipart_upload() {
     Aws::S3::Model::UploadPartRequest req;
     req.SetBucket(_bucket);
     req.SetKey(_object);
-    req.SetPartNumber(static_cast<int>(_etags.size() + 1));
+    req.SetPartNumber(static_cast<int>(_etags.size() + _inflight_parts.size() + 1));
     req.SetUploadId(_upload_id);
     req.SetContentLength(static_cast<int64_t>(_buffer.size()));
+    if (_max_inflight_parts > 1) {
+        while (_inflight_parts.size() >= static_cast<size_t>(_max_inflight_parts)) {
+            RETURN_IF_ERROR(wait_inflight_part());
+        }
+        auto buffer = std::make_shared<Aws::String>(std::move(_buffer));
+        _buffer.clear();
+        req.SetBody(Aws::MakeShared<S3ZeroCopyIOStream>(AWS_ALLOCATE_TAG, buffer->data(), buffer->size()));
+        _inflight_parts.push_back(InflightPart{std::move(buffer), _client->UploadPartCallable(req)});
+        return Status::OK();
+    }
     req.SetBody(Aws::MakeShared<S3ZeroCopyIOStream>(AWS_ALLOCATE_TAG, _buffer.data(), _buffer.size()));
     auto outcome = _client->UploadPart(req);
     if (outcome.IsSuccess()) {
@@ -147,6 +169,31 @@ Status S3OutputStream::multipart_upload() {
             fmt::format("S3: Fail to upload part of {}/{}: {}", _bucket, _object, outcome.GetError().GetMessage()));
 }
 
+Status S3OutputStream::wait_inflight_part() {
+    DCHECK(!_inflight_parts.empty());
+    auto outcome = _inflight_parts.front().outcome.get();
+    _inflight_parts.pop_front();
+    if (outcome.IsSuccess()) {
+        _etags.push_back(outcome.GetResult().GetETag());
+        return Status::OK();
+    }
+    return Status::IOError(
+            fmt::format("S3: Fail to upload part of {}/{}: {}", _bucket, _object, outcome.GetError().GetMessage()));
+}
+
+Status S3OutputStream::wait_all_inflight_parts() {
+    while (!_inflight_parts.empty()) {
+        RETURN_IF_ERROR(wait_inflight_part());
+    }
+    return Status::OK();
+}
+
+int64_t S3OutputStream::upload_part_size() const {
+    const int64_t parts = _etags.size() + _inflight_parts.size();
+    const int shift = std::min<int64_t>(parts / kPartsPerSizeDoubling, 16);
+    return std::min(_min_upload_part_size << shift, std::max(_min_upload_part_size, kMaxUploadPartSize));
+}
+
 Status S3OutputStream::complete_multipart_upload() {
     VLOG(12) << "Completing multipart upload s3://" << _bucket << "/" << _object;
     DCHECK(!_upload_id.empty());
@@ -16,16 +16,21 @@
 
 #include <aws/s3/S3Client.h>
 
+#include <deque>
+
 #include "io/output_stream.h"
 
 namespace starrocks::io {
 
+// Up to |max_inflight_parts| parts of a multipart upload are sent concurrently. The part size starts
+// at |min_upload_part_size| and doubles every |kPartsPerSizeDoubling| parts, so that large files stay
+// within the S3 limit of 10000 parts while small files keep small parts.
 class S3OutputStream : public OutputStream {
 public:
     explicit S3OutputStream(std::shared_ptr<Aws::S3::S3Client> client, std::string bucket, std::string object,
-                            int64_t max_single_part_size, int64_t min_upload_part_size);
+                            int64_t max_single_part_size, int64_t min_upload_part_size, int max_inflight_parts = 1);
 
-    ~S3OutputStream() override = default;
+    ~S3OutputStream() override;
 
     // Disallow copy and assignment
     S3OutputStream(const S3OutputStream&) = delete;
@@ -54,15 +59,30 @@ private:
     Status multipart_upload();
     Status singlepart_upload();
     Status complete_multipart_upload();
+    // Wait for the oldest in-flight part and record its etag.
+    Status wait_inflight_part();
+    Status wait_all_inflight_parts();
+    int64_t upload_part_size() const;
+
+    static constexpr int64_t kPartsPerSizeDoubling = 1000;
+    static constexpr int64_t kMaxUploadPartSize = 5LL * 1024 * 1024 * 1024;
+
+    struct InflightPart {
+        // The request body points into |buffer|, so it must live until the part finishes.
+        std::shared_ptr<Aws::String> buffer;
+        Aws::S3::Model::UploadPartOutcomeCallable outcome;
+    };
 
     std::shared_ptr<Aws::S3::S3Client> _client;
     const Aws::String _bucket;
     const Aws::String _object;
     const int64_t _max_single_part_size;
     const int64_t _min_upload_part_size;
+    const int _max_inflight_parts;
     Aws::String _buffer;
     Aws::String _upload_id;
     std::vector<Aws::String> _etags;
+    std::deque<InflightPart> _inflight_parts;
 };
 
 } // namespace starrocks::io
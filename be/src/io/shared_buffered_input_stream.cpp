@@ -19,6 +19,7 @@
 #include "common/config.h"
 #include "gutil/strings/fastmem.h"
 #include "runtime/current_thread.h"
+#include "util/threadpool.h"
 #include "util/runtime_profile.h"
 
 namespace starrocks::io {
@@ -215,23 +216,112 @@ Status SharedBufferedInputStream::get_bytes(const uint8_t** buffer, size_t offse
     }
 
     SharedBuffer& sb = *shared_buffer;
-    if (sb.buffer.capacity() == 0) {
-        RETURN_IF_ERROR(CurrentThread::mem_tracker()->check_mem_limit("read into shared buffer"));
-        SCOPED_RAW_TIMER(&_shared_io_timer);
-        _shared_io_count += 1;
-        _shared_io_bytes += sb.size;
-        if (sb.size > sb.raw_size) {
-            // after called _deduplicate_shared_buffer(), sb.size maybe is larger than sb.raw_size
-            // we will count how many extra bytes we read because of alignment.
-            _shared_align_io_bytes += sb.size - sb.raw_size;
-        }
-        sb.buffer.reserve(sb.size);
-        RETURN_IF_ERROR(_stream->read_at_fully(sb.offset, sb.buffer.data(), sb.size));
+    if (!_wait_prefetch(sb)) {
+        RETURN_IF_ERROR(_read_shared_buffer(sb));
     }
+    _prefetch_after(sb.raw_offset + sb.raw_size);
     *buffer = sb.buffer.data() + offset - sb.offset;
     return Status::OK();
 }
 
+Status SharedBufferedInputStream::_read_shared_buffer(SharedBuffer& sb) {
+    RETURN_IF_ERROR(CurrentThread::mem_tracker()->check_mem_limit("read into shared buffer"));
+    SCOPED_RAW_TIMER(&_shared_io_timer);
+    _shared_io_count += 1;
+    _shared_io_bytes += sb.size;
+    if (sb.size > sb.raw_size) {
+        // after called _deduplicate_shared_buffer(), sb.size maybe is larger than sb.raw_size
+        // we will count how many extra bytes we read because of alignment.
+        _shared_align_io_bytes += sb.size - sb.raw_size;
+    }
+    sb.buffer.reserve(sb.size);
+    {
+        std::lock_guard<std::mutex> l(_stream_mutex);
+        RETURN_IF_ERROR(_stream->read_at_fully(sb.offset, sb.buffer.data(), sb.size));
+    }
+    if (_prefetch_pool != nullptr) {
+        std::lock_guard<std::mutex> l(_prefetch_mutex);
+        sb.prefetch_status = Status::OK();
+    }
+    return Status::OK();
+}
+
+bool SharedBufferedInputStream::_wait_prefetch(SharedBuffer& sb) {
+    if (sb.buffer.capacity() == 0) {
+        return false;
+    }
+    if (_prefetch_pool == nullptr) {
+        return true;
+    }
+    std::unique_lock<std::mutex> l(_prefetch_mutex);
+    if (sb.prefetching) {
+        SCOPED_RAW_TIMER(&_prefetch_wait_timer);
+        _prefetch_cv.wait(l, [&sb]() { return !sb.prefetching; });
+    }
+    // the buffer has to be read again by the reader if the prefetch failed
+    return sb.prefetch_status.ok();
+}
+
+void SharedBufferedInputStream::_wait_all_prefetch() {
+    std::unique_lock<std::mutex> l(_prefetch_mutex);
+    _prefetch_cv.wait(l, [this]() { return _num_prefetching == 0; });
+}
+
+void SharedBufferedInputStream::_prefetch_after(int64_t end_offset) {
+    if (_prefetch_pool == nullptr || _prefetch_depth <= 0) {
+        return;
+    }
+    int32_t depth = 0;
+    for (auto iter = _map.upper_bound(end_offset); iter != _map.end() && depth < _prefetch_depth; ++iter, ++depth) {
+        SharedBufferPtr sb = iter->second;
+        if (sb->buffer.capacity() != 0) {
+            continue;
+        }
+        {
+            std::lock_guard<std::mutex> l(_prefetch_mutex);
+            // always allow one buffer in flight, even it's larger than the limit
+            if (_num_prefetching > 0 && _prefetching_bytes + sb->size > _prefetch_max_bytes) {
+                return;
+            }
+        }
+        if (!CurrentThread::mem_tracker()->check_mem_limit("prefetch shared buffer").ok()) {
+            return;
+        }
+        // allocate in the reader thread, so that the memory is tracked by the query
+        sb->buffer.reserve(sb->size);
+        {
+            std::lock_guard<std::mutex> l(_prefetch_mutex);
+            sb->prefetching = true;
+            _num_prefetching++;
+            _prefetching_bytes += sb->size;
+        }
+        Status st = _prefetch_pool->submit_func([this, sb]() {
+            Status status;
+            {
+                std::lock_guard<std::mutex> l(_stream_mutex);
+                status = _stream->read_at_fully(sb->offset, sb->buffer.data(), sb->size);
+            }
+            // notify with the lock held, the stream may be destroyed once _num_prefetching drops to zero
+            std::lock_guard<std::mutex> l(_prefetch_mutex);
+            sb->prefetch_status = std::move(status);
+            sb->prefetching = false;
+            _num_prefetching--;
+            _prefetching_bytes -= sb->size;
+            _prefetch_cv.notify_all();
+        });
+        if (!st.ok()) {
+            std::lock_guard<std::mutex> l(_prefetch_mutex);
+            sb->prefetch_status = std::move(st);
+            sb->prefetching = false;
+            _num_prefetching--;
+            _prefetching_bytes -= sb->size;
+            return;
+        }
+        _prefetch_io_count += 1;
+        _prefetch_io_bytes += sb->size;
+    }
+}
+
 void SharedBufferedInputStream::release() {
     _map.clear();
 }
@@ -247,6 +337,7 @@ Status SharedBufferedInputStream::read_at_fully(int64_t offset, void* out, int64
         SCOPED_RAW_TIMER(&_direct_io_timer);
         _direct_io_count += 1;
         _direct_io_bytes += count;
+        std::lock_guard<std::mutex> l(_stream_mutex);
         RETURN_IF_ERROR(_stream->read_at_fully(offset, out, count));
         return Status::OK();
     }
@@ -261,6 +352,7 @@ StatusOr<int64_t> SharedBufferedInputStream::get_size() {
 }
 
 StatusOr<int64_t> SharedBufferedInputStream::read(void* data, int64_t count) {
+    std::lock_guard<std::mutex> l(_stream_mutex);
     auto n = _stream->read_at(_offset, data, count);
     RETURN_IF_ERROR(n);
     _offset += n.value();
@@ -278,7 +370,7 @@ StatusOr<std::string_view> SharedBufferedInputStream::peek(int64_t count) {
 StatusOr<std::string_view> SharedBufferedInputStream::peek_shared_buffer(int64_t count,
                                                                          SharedBufferPtr* shared_buffer) {
     ASSIGN_OR_RETURN(auto ret, find_shared_buffer(_offset, count));
-    if (ret->buffer.capacity() == 0) return Status::NotSupported("peek shared buffer empty");
+    if (!_wait_prefetch(*ret)) return Status::NotSupported("peek shared buffer empty");
     const uint8_t* buf = ret->buffer.data() + _offset - ret->offset;
     if (shared_buffer) {
         *shared_buffer = ret;
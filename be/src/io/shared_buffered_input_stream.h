@@ -14,13 +14,19 @@
 
 #pragma once
 
+#include <condition_variable>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <mutex>
 
 #include "common/status.h"
 #include "io/seekable_input_stream.h"
 
+namespace starrocks {
+class ThreadPool;
+}
+
 namespace starrocks::io {
 
 class SharedBufferedInputStream : public SeekableInputStream {
@@ -47,16 +53,20 @@ public:
         int64_t size;
         int64_t ref_count;
         std::vector<uint8_t> buffer;
+        // true while the buffer is being read by the prefetch io pool, protected by the prefetch mutex
+        bool prefetching = false;
+        Status prefetch_status;
         void align(int64_t align_size, int64_t file_size);
         std::string debug_string() const;
     };
     using SharedBufferPtr = std::shared_ptr<SharedBuffer>;
 
     SharedBufferedInputStream(std::shared_ptr<SeekableInputStream> stream, std::string filename, size_t file_size);
-    ~SharedBufferedInputStream() override = default;
+    ~SharedBufferedInputStream() override { _wait_all_prefetch(); }
 
     Status seek(int64_t position) override {
         _offset = position;
+        std::lock_guard<std::mutex> l(_stream_mutex);
         return _stream->seek(position);
     }
     StatusOr<int64_t> position() override { return _offset; }
@@ -65,6 +75,7 @@ public:
     StatusOr<int64_t> get_size() override;
     Status skip(int64_t count) override {
         _offset += count;
+        std::lock_guard<std::mutex> l(_stream_mutex);
         return _stream->skip(count);
     }
 
@@ -82,6 +93,13 @@ public:
     void release();
     void set_coalesce_options(const CoalesceOptions& options) { _options = options; }
     void set_align_size(int64_t size) { _align_size = size; }
+    // Read the next |depth| shared buffers ahead on |pool| once a shared buffer is read,
+    // and at most |max_bytes| are being read ahead at any time.
+    void set_prefetch_options(ThreadPool* pool, int32_t depth, int64_t max_bytes) {
+        _prefetch_pool = pool;
+        _prefetch_depth = depth;
+        _prefetch_max_bytes = max_bytes;
+    }
 
     int64_t shared_io_count() const { return _shared_io_count; }
     int64_t shared_io_bytes() const { return _shared_io_bytes; }
@@ -90,6 +108,9 @@ public:
     int64_t direct_io_count() const { return _direct_io_count; }
     int64_t direct_io_bytes() const { return _direct_io_bytes; }
     int64_t direct_io_timer() const { return _direct_io_timer; }
+    int64_t prefetch_io_count() const { return _prefetch_io_count; }
+    int64_t prefetch_io_bytes() const { return _prefetch_io_bytes; }
+    int64_t prefetch_wait_timer() const { return _prefetch_wait_timer; }
     int64_t estimated_mem_usage() const { return _estimated_mem_usage; }
     // each SharedBuffer may contain several ranges, the return the ref sum
     int64_t current_range_ref_sum() const;
@@ -105,6 +126,11 @@ private:
     void _merge_small_ranges(const std::vector<IORange>& ranges);
     Status _set_io_ranges_all_columns(const std::vector<IORange>& ranges);
     Status _set_io_ranges_active_and_lazy_columns(const std::vector<IORange>& ranges);
+    Status _read_shared_buffer(SharedBuffer& sb);
+    // wait the prefetch of |sb| if it's in flight, return false if |sb| still need to be read
+    bool _wait_prefetch(SharedBuffer& sb);
+    void _wait_all_prefetch();
+    void _prefetch_after(int64_t end_offset);
     const std::shared_ptr<SeekableInputStream> _stream;
     const std::string _filename;
     std::map<int64_t, SharedBufferPtr> _map;
@@ -120,6 +146,19 @@ private:
     int64_t _direct_io_timer = 0;
     int64_t _align_size = 0;
     int64_t _estimated_mem_usage = 0;
+
+    ThreadPool* _prefetch_pool = nullptr;
+    int32_t _prefetch_depth = 0;
+    int64_t _prefetch_max_bytes = 0;
+    int64_t _prefetch_io_count = 0;
+    int64_t _prefetch_io_bytes = 0;
+    int64_t _prefetch_wait_timer = 0;
+    // the underlying stream is not thread safe, the prefetch tasks and the reader thread share it by this mutex
+    std::mutex _stream_mutex;
+    std::mutex _prefetch_mutex;
+    std::condition_variable _prefetch_cv;
+    int64_t _num_prefetching = 0;
+    int64_t _prefetching_bytes = 0;
 };
 
 } // namespace starrocks::io
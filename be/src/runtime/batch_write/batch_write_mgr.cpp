@@ -129,7 +129,8 @@ StatusOr<StreamLoadContext*> BatchWriteMgr::create_and_register_pipe(
     std::string pipe_name = fmt::format("txn_{}_label_{}_id_{}", txn_id, label, print_id(load_id));
     auto pipe = std::make_shared<TimeBoundedStreamLoadPipe>(pipe_name, batch_write_interval_ms,
                                                             config::merge_commit_stream_load_pipe_block_wait_us,
-                                                            config::merge_commit_stream_load_pipe_max_buffered_bytes);
+                                                            config::merge_commit_stream_load_pipe_max_buffered_bytes,
+                                                            config::merge_commit_pipe_max_window_bytes);
     RETURN_IF_ERROR(exec_env->load_stream_mgr()->put(load_id, pipe));
     StreamLoadContext* ctx = new StreamLoadContext(exec_env, load_id);
     ctx->ref();
@@ -50,6 +50,8 @@ bvar::Adder<int64_t> g_mc_pending_total("merge_commit", "pending_total");
 bvar::Adder<int64_t> g_mc_pending_bytes("merge_commit", "pending_bytes");
 // Counter for RPC requests sent to initiate new merge commit operations
 bvar::Adder<int64_t> g_mc_send_rpc_total("merge_commit", "send_rpc_total");
+// Counter for RPC requests sent ahead of time to prepare the load of the next batch
+bvar::Adder<int64_t> g_mc_prefetch_rpc_total("merge_commit", "prefetch_rpc_total");
 // Counter for stream load pipes registered for merge commit operations
 bvar::Adder<int64_t> g_mc_register_pipe_total("merge_commit", "register_pipe_total");
 // Counter for stream load pipes unregistered for merge commit operations
@@ -64,6 +66,8 @@ bvar::LatencyRecorder g_mc_wait_plan_latency_ns("merge_commit", "wait_plan");
 bvar::LatencyRecorder g_mc_append_pipe_latency_ns("merge_commit", "append_pipe");
 // Latency recorder for time spent waiting for load operations to complete (nanoseconds)
 bvar::LatencyRecorder g_mc_wait_finish_latency_ns("merge_commit", "wait_finish");
+// Latency recorder for time data waits in the pipe before its merge window closes (nanoseconds)
+bvar::LatencyRecorder g_mc_left_merge_latency_ns("merge_commit", "left_merge");
 
 class AsyncAppendDataContext {
 public:
@@ -330,6 +334,10 @@ int IsomorphicBatchWrite::_execute_tasks(void* meta, bthread::TaskIterator<Task>
         g_mc_pending_latency_ns << ctx->task_pending_cost_ns;
         auto st = batch_write->_execute_write(ctx);
         ctx->finish_async(st);
+        if (st.ok()) {
+            // after the user is notified, so the rpc does not add to its latency
+            batch_write->_prefetch_next_pipe_if_needed(ctx);
+        }
         ctx->total_async_cost_ns.store(MonotonicNanos() - start_ts);
         TRACE_BATCH_WRITE << "async task finish, " << batch_write->_batch_write_id
                           << ", user label: " << ctx->data_ctx()->label
@@ -389,7 +397,9 @@ Status IsomorphicBatchWrite::_execute_write(AsyncAppendDataContext* async_ctx) {
     async_ctx->num_retries.store(num_retries);
     g_mc_append_pipe_latency_ns << write_data_cost_ns;
     g_mc_wait_plan_latency_ns << (rpc_cost_ns + wait_pipe_cost_ns);
-    if (!st.ok()) {
+    if (st.ok()) {
+        g_mc_left_merge_latency_ns << std::max<int64_t>(0, async_ctx->pipe_left_active_ns);
+    } else {
         std::stringstream stream;
         stream << "Failed to write data to stream load pipe, num retry: " << num_retries
                << ", write_data: " << (write_data_cost_ns / 1000) << " us, rpc: " << (rpc_cost_ns / 1000)
@@ -438,6 +448,29 @@ Status IsomorphicBatchWrite::_write_data_to_pipe(AsyncAppendDataContext* async_c
     }
 }
 
+void IsomorphicBatchWrite::_prefetch_next_pipe_if_needed(AsyncAppendDataContext* async_ctx) {
+    int64_t prefetch_ns = config::merge_commit_pipe_prefetch_ms * (int64_t)1000000;
+    if (prefetch_ns <= 0 || async_ctx->pipe_left_active_ns >= prefetch_ns || _stopped.load(std::memory_order_acquire)) {
+        return;
+    }
+    // at most one request per prefetch interval, FE may return the load which is already running
+    int64_t now = MonotonicNanos();
+    if (now - _last_prefetch_pipe_ns < prefetch_ns) {
+        return;
+    }
+    {
+        std::unique_lock<bthread::Mutex> lock(_mutex);
+        if (_alive_stream_load_pipe_ctxs.size() > 1) {
+            return;
+        }
+    }
+    _last_prefetch_pipe_ns = now;
+    g_mc_prefetch_rpc_total << 1;
+    auto st = _send_rpc_request(async_ctx->data_ctx());
+    TRACE_BATCH_WRITE << "prefetch next pipe, " << _batch_write_id << ", user label: " << async_ctx->data_ctx()->label
+                      << ", pipe_left_active: " << (async_ctx->pipe_left_active_ns / 1000) << "us, status: " << st;
+}
+
 Status IsomorphicBatchWrite::_send_rpc_request(StreamLoadContext* data_ctx) {
     TNetworkAddress master_addr = get_master_address();
     TMergeCommitRequest request;
@@ -68,6 +68,7 @@ private:
     Status _execute_write(AsyncAppendDataContext* async_ctx);
     Status _write_data_to_pipe(AsyncAppendDataContext* data_ctx);
     Status _send_rpc_request(StreamLoadContext* data_ctx);
+    void _prefetch_next_pipe_if_needed(AsyncAppendDataContext* async_ctx);
     Status _wait_for_load_finish(StreamLoadContext* data_ctx);
 
     BatchWriteId _batch_write_id;
@@ -85,6 +86,8 @@ private:
     bthread::ExecutionQueueId<Task> _queue_id{kInvalidQueueId};
 
     std::atomic<bool> _stopped{false};
+    // last time the load for the next batch was requested ahead of time. Only accessed by the execution queue
+    int64_t _last_prefetch_pipe_ns{0};
 };
 using IsomorphicBatchWriteSharedPtr = std::shared_ptr<IsomorphicBatchWrite>;
 
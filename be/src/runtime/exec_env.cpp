@@ -413,6 +413,23 @@ Status ExecEnv::init(const std::vector<StorePath>& store_paths, bool as_cn) {
                             .set_idle_timeout(MonoDelta::FromMilliseconds(2000))
                             .build(&_dictionary_cache_pool));
 
+    RETURN_IF_ERROR(ThreadPoolBuilder("io_prefetch") // thread pool for reading ahead coalesced io buffers
+                            .set_min_threads(1)
+                            .set_max_threads(std::max(1, config::io_coalesce_prefetch_thread_num))
+                            .set_max_queue_size(INT32_MAX) // unlimit queue size
+                            .set_idle_timeout(MonoDelta::FromMilliseconds(2000))
+                            .build(&_io_coalesce_prefetch_pool));
+
+    int parquet_encode_threads = config::parquet_writer_encode_thread_num > 0
+                                         ? config::parquet_writer_encode_thread_num
+                                         : CpuInfo::num_cores();
+    RETURN_IF_ERROR(ThreadPoolBuilder("parquet_encode") // thread pool for encoding parquet column chunks
+                            .set_min_threads(1)
+                            .set_max_threads(parquet_encode_threads)
+                            .set_max_queue_size(INT32_MAX) // unlimit queue size
+                            .set_idle_timeout(MonoDelta::FromMilliseconds(2000))
+                            .build(&_parquet_writer_encode_pool));
+
     _max_executor_threads = CpuInfo::num_cores();
     if (config::pipeline_exec_thread_pool_thread_num > 0) {
         _max_executor_threads = config::pipeline_exec_thread_pool_thread_num;
@@ -593,7 +610,7 @@ Status ExecEnv::init(const std::vector<StorePath>& store_paths, bool as_cn) {
 
     _heartbeat_flags = new HeartbeatFlags();
     auto capacity = std::max<size_t>(config::query_cache_capacity, 4L * 1024 * 1024);
-    _cache_mgr = new query_cache::CacheManager(capacity);
+    _cache_mgr = new query_cache::CacheManager(capacity, std::max<int64_t>(config::query_cache_compressed_capacity, 0));
 
     _spill_dir_mgr = std::make_shared<spill::DirManager>();
     RETURN_IF_ERROR(_spill_dir_mgr->init(config::spill_local_storage_dir));
@@ -712,6 +729,14 @@ void ExecEnv::stop() {
         _dictionary_cache_pool->shutdown();
     }
 
+    if (_io_coalesce_prefetch_pool) {
+        _io_coalesce_prefetch_pool->shutdown();
+    }
+
+    if (_parquet_writer_encode_pool) {
+        _parquet_writer_encode_pool->shutdown();
+    }
+
     if (_diagnose_daemon) {
         _diagnose_daemon->stop();
     }
@@ -777,6 +802,8 @@ void ExecEnv::destroy() {
     SAFE_DELETE(_put_combined_txn_log_thread_pool);
     SAFE_DELETE(_diagnose_daemon);
     _dictionary_cache_pool.reset();
+    _io_coalesce_prefetch_pool.reset();
+    _parquet_writer_encode_pool.reset();
     _automatic_partition_pool.reset();
     _put_aggregate_metadata_thread_pool.reset();
     _metrics = nullptr;
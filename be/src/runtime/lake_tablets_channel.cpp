@@ -890,6 +890,8 @@ void LakeTabletsChannel::_update_tablet_profile(DeltaWriter* writer, RuntimeProf
                            DEFAULT_IF_NULL(flush_stat, flush_stat->memtable_stats.sort_count.load(), 0));
     ADD_AND_UPDATE_TIMER(profile, "MemtableSortTime",
                          DEFAULT_IF_NULL(flush_stat, flush_stat->memtable_stats.sort_time_ns.load(), 0));
+    ADD_AND_UPDATE_COUNTER(profile, "MemtablePresortedCount", TUnit::UNIT,
+                           DEFAULT_IF_NULL(flush_stat, flush_stat->memtable_stats.presorted_count.load(), 0));
     ADD_AND_UPDATE_COUNTER(profile, "MemtableAggCount", TUnit::UNIT,
                            DEFAULT_IF_NULL(flush_stat, flush_stat->memtable_stats.agg_count.load(), 0));
     ADD_AND_UPDATE_TIMER(profile, "MemtableAggTime",
@@ -267,6 +267,9 @@ void LocalTabletsChannel::add_chunk(Chunk* chunk, const PTabletWriterAddChunkReq
     auto start_submit_write_task_ts = watch.elapsed_time();
     int64_t wait_memtable_flush_time_us = 0;
     int32_t total_row_num = 0;
+    // the delta writers written by this request, to check their immutable state without looking up every row
+    std::vector<std::pair<int64_t, AsyncDeltaWriter*>> written_writers;
+    written_writers.reserve(channel_size);
     for (int i = 0; i < channel_size; ++i) {
         size_t from = channel_row_idx_start_points[i];
         size_t size = channel_row_idx_start_points[i + 1] - from;
@@ -286,6 +289,7 @@ void LocalTabletsChannel::add_chunk(Chunk* chunk, const PTabletWriterAddChunkReq
             return;
         }
         auto& delta_writer = it->second;
+        written_writers.emplace_back(tablet_id, delta_writer.get());
 
         // back pressure OlapTableSink since there are too many memtables need to flush
         while (delta_writer->get_state() != kAborted &&
@@ -384,13 +388,10 @@ void LocalTabletsChannel::add_chunk(Chunk* chunk, const PTabletWriterAddChunkReq
         }
     }
 
-    std::set<long> immutable_tablet_ids;
-    for (auto tablet_id : request.tablet_ids()) {
-        auto& writer = _delta_writers[tablet_id];
-        if (writer->is_immutable() && immutable_tablet_ids.count(tablet_id) == 0) {
+    for (auto& [tablet_id, writer] : written_writers) {
+        if (writer->is_immutable()) {
             response->add_immutable_tablet_ids(tablet_id);
             response->add_immutable_partition_ids(writer->partition_id());
-            immutable_tablet_ids.insert(tablet_id);
 
             _insert_immutable_partition(writer->partition_id());
         }
@@ -439,7 +440,7 @@ void LocalTabletsChannel::add_chunk(Chunk* chunk, const PTabletWriterAddChunkReq
     response->set_wait_memtable_flush_time_us(wait_memtable_flush_time_us);
 
     // reset error message if it already set by other replica
-    {
+    if (UNLIKELY(_has_status_error.load(std::memory_order_acquire))) {
         std::lock_guard l(_status_lock);
         if (!_status.ok()) {
             response->mutable_status()->set_status_code(_status.code());
@@ -477,6 +478,15 @@ void LocalTabletsChannel::_flush_stale_memtables() {
     if (_is_immutable_partition_empty() && config::stale_memtable_flush_time_sec <= 0) {
         return;
     }
+    // scanning all the delta writers on every request of every sender is what makes many senders contend,
+    // so one sender scans at a time, and at most once per kStaleMemtableCheckIntervalMs
+    int64_t now_ms = MonotonicMillis();
+    int64_t last_check_ms = _last_stale_memtable_check_ms.load(std::memory_order_relaxed);
+    if (now_ms - last_check_ms < kStaleMemtableCheckIntervalMs ||
+        !_last_stale_memtable_check_ms.compare_exchange_strong(last_check_ms, now_ms)) {
+        return;
+    }
+    const std::set<int64_t> immutable_partition_ids = _get_immutable_partition_ids();
     bool high_mem_usage = false;
     bool full_mem_usage = false;
     if (_mem_tracker->limit_exceeded_by_ratio(70) ||
@@ -497,7 +507,7 @@ void LocalTabletsChannel::_flush_stale_memtables() {
         bool need_flush = false;
         auto last_write_ts = writer->last_write_ts();
         if (last_write_ts > 0) {
-            if (_has_immutable_partition(writer->partition_id())) {
+            if (immutable_partition_ids.count(writer->partition_id()) > 0) {
                 if (high_mem_usage) {
                     // immutable tablet flush stale memtable immediately when high mem usage
                     need_flush = true;
@@ -826,6 +836,7 @@ void LocalTabletsChannel::abort(const std::vector<int64_t>& tablet_ids, const st
     if (abort_with_exception) {
         std::lock_guard l(_status_lock);
         _status = Status::Aborted(reason);
+        _has_status_error.store(true, std::memory_order_release);
     }
 }
 
@@ -1183,6 +1194,7 @@ void LocalTabletsChannel::_update_peer_replica_profile(DeltaWriter* writer, Runt
     ADD_AND_UPDATE_TIMER(profile, "MemtableFinalizeTime", memtable_stat.finalize_time_ns);
     ADD_AND_UPDATE_COUNTER(profile, "MemtableSortCount", TUnit::UNIT, memtable_stat.sort_count);
     ADD_AND_UPDATE_TIMER(profile, "MemtableSortTime", memtable_stat.sort_time_ns);
+    ADD_AND_UPDATE_COUNTER(profile, "MemtablePresortedCount", TUnit::UNIT, memtable_stat.presorted_count);
     ADD_AND_UPDATE_COUNTER(profile, "MemtableAggCount", TUnit::UNIT, memtable_stat.agg_count);
     ADD_AND_UPDATE_TIMER(profile, "MemtableAggTime", memtable_stat.agg_time_ns);
     ADD_AND_UPDATE_TIMER(profile, "MemtableFlushTime", memtable_stat.flush_time_ns);
@@ -234,6 +234,11 @@ private:
 
     mutable bthread::Mutex _status_lock;
     Status _status = Status::OK();
+    // whether _status is not OK, checked without _status_lock on every add_chunk
+    std::atomic<bool> _has_status_error{false};
+
+    static constexpr int64_t kStaleMemtableCheckIntervalMs = 100;
+    std::atomic<int64_t> _last_stale_memtable_check_ms{0};
 
     std::map<string, string> _column_to_expr_value;
 
@@ -18,4 +18,16 @@ namespace starrocks {
 
 MemHookAllocator kDefaultColumnAllocator = MemHookAllocator{};
 
+void ColumnBufferRecycler::release() {
+    for (auto& free_list : _free_lists) {
+        for (void* ptr : free_list) {
+            kDefaultColumnAllocator.free(ptr);
+        }
+        free_list.clear();
+        free_list.shrink_to_fit();
+    }
+    _s_total_cached_bytes.fetch_sub(_cached_bytes, std::memory_order_relaxed);
+    _cached_bytes = 0;
+}
+
 }
\ No newline at end of file
@@ -16,13 +16,90 @@
 
 #include <glog/logging.h>
 
+#include <algorithm>
+#include <atomic>
+#include <vector>
+
 #include "runtime/memory/mem_hook_allocator.h"
+#include "runtime/memory/system_allocator.h"
 
 namespace starrocks {
 
 extern MemHookAllocator kDefaultColumnAllocator;
 inline thread_local Allocator* tls_column_allocator = &kDefaultColumnAllocator;
 
+// Cache of column buffers owned by a pipeline driver. Operators build and drop chunks of the same size
+// for every batch, so the freed buffers of a power-of-two size in [4KB, 1MB] are kept in free lists and
+// reused by the following allocations of the same size instead of going through malloc/free.
+// The cached buffers stay accounted in the memory tracker of the query, and are freed by release().
+// `max_total_cached_bytes` bounds the bytes cached by all the recyclers of the process together, so the
+// retained memory doesn't grow with the number of drivers.
+// It's not thread-safe, and only used by the thread which is running the driver.
+class ColumnBufferRecycler {
+public:
+    static constexpr size_t kMinSizeClass = 12;
+    static constexpr size_t kMaxSizeClass = 20;
+
+    explicit ColumnBufferRecycler(size_t max_total_cached_bytes) : _max_total_cached_bytes(max_total_cached_bytes) {}
+    ~ColumnBufferRecycler() { release(); }
+
+    ColumnBufferRecycler(const ColumnBufferRecycler&) = delete;
+    ColumnBufferRecycler& operator=(const ColumnBufferRecycler&) = delete;
+
+    static bool is_recyclable(size_t bytes) {
+        return bytes >= (size_t{1} << kMinSizeClass) && bytes <= (size_t{1} << kMaxSizeClass) &&
+               (bytes & (bytes - 1)) == 0;
+    }
+
+    // Return a cached buffer of exactly `bytes`, or nullptr if there is none.
+    void* allocate(size_t bytes) {
+        auto& free_list = _free_lists[_size_class(bytes)];
+        if (free_list.empty()) {
+            return nullptr;
+        }
+        void* ptr = free_list.back();
+        free_list.pop_back();
+        _cached_bytes -= bytes;
+        _s_total_cached_bytes.fetch_sub(bytes, std::memory_order_relaxed);
+        _num_reused++;
+        return ptr;
+    }
+
+    // Keep the buffer for reuse, return false if the cache is full and the buffer should be freed.
+    bool recycle(void* ptr, size_t bytes) {
+        if (_s_total_cached_bytes.fetch_add(bytes, std::memory_order_relaxed) + bytes > _max_total_cached_bytes) {
+            _s_total_cached_bytes.fetch_sub(bytes, std::memory_order_relaxed);
+            return false;
+        }
+        _free_lists[_size_class(bytes)].push_back(ptr);
+        _cached_bytes += bytes;
+        _peak_cached_bytes = std::max(_peak_cached_bytes, _cached_bytes);
+        return true;
+    }
+
+    // Free all the cached buffers.
+    void release();
+
+    size_t cached_bytes() const { return _cached_bytes; }
+    size_t peak_cached_bytes() const { return _peak_cached_bytes; }
+    size_t num_reused() const { return _num_reused; }
+    // Bytes cached by all the recyclers of the process.
+    static size_t total_cached_bytes() { return _s_total_cached_bytes.load(std::memory_order_relaxed); }
+
+private:
+    static size_t _size_class(size_t bytes) { return __builtin_ctzll(bytes) - kMinSizeClass; }
+
+    static inline std::atomic<size_t> _s_total_cached_bytes{0};
+
+    const size_t _max_total_cached_bytes;
+    size_t _cached_bytes = 0;
+    size_t _peak_cached_bytes = 0;
+    size_t _num_reused = 0;
+    std::vector<void*> _free_lists[kMaxSizeClass - kMinSizeClass + 1];
+};
+
+inline thread_local ColumnBufferRecycler* tls_column_buffer_recycler = nullptr;
+
 // Implement the std::allocator: https://en.cppreference.com/w/cpp/memory/allocator
 template <class T>
 class ColumnAllocator {
@@ -46,11 +123,26 @@ public:
     // Allocator n elements, throw std::bad_malloc if allocate failed
     T* allocate(size_t n) {
         DCHECK(tls_column_allocator != nullptr);
-        return static_cast<T*>(tls_column_allocator->checked_alloc(n * sizeof(T)));
+        auto* recycler = _recycler();
+        if (recycler != nullptr && ColumnBufferRecycler::is_recyclable(n * sizeof(T))) {
+            if (void* ptr = recycler->allocate(n * sizeof(T)); ptr != nullptr) {
+                return static_cast<T*>(ptr);
+            }
+        }
+        void* ptr = tls_column_allocator->checked_alloc(n * sizeof(T));
+        if (n * sizeof(T) >= SystemAllocator::kHugePageSize) {
+            SystemAllocator::advise_huge_pages(ptr, n * sizeof(T));
+        }
+        return static_cast<T*>(ptr);
     }
 
     void deallocate(T* ptr, size_t n) {
         DCHECK(tls_column_allocator != nullptr);
+        auto* recycler = _recycler();
+        if (recycler != nullptr && ColumnBufferRecycler::is_recyclable(n * sizeof(T)) &&
+            recycler->recycle(ptr, n * sizeof(T))) {
+            return;
+        }
         tls_column_allocator->free(ptr);
     }
 
@@ -66,6 +158,12 @@ public:
     bool operator!=(const ColumnAllocator& rhs) const { return false; }
 
     void swap(ColumnAllocator& rhs) {}
+
+private:
+    // The recycler only holds buffers of the default allocator.
+    static ColumnBufferRecycler* _recycler() {
+        return tls_column_allocator == &kDefaultColumnAllocator ? tls_column_buffer_recycler : nullptr;
+    }
 };
 
 class ThreadLocalColumnAllocatorSetter {
@@ -79,4 +177,16 @@ public:
 private:
     Allocator* _prev = nullptr;
 };
+
+class ThreadLocalColumnBufferRecyclerSetter {
+public:
+    ThreadLocalColumnBufferRecyclerSetter(ColumnBufferRecycler* recycler) {
+        _prev = tls_column_buffer_recycler;
+        tls_column_buffer_recycler = recycler;
+    }
+    ~ThreadLocalColumnBufferRecyclerSetter() { tls_column_buffer_recycler = _prev; }
+
+private:
+    ColumnBufferRecycler* _prev = nullptr;
+};
 } // namespace starrocks
\ No newline at end of file
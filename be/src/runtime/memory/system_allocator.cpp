@@ -41,6 +41,7 @@
 #include "common/config.h"
 #include "common/logging.h"
 #include "runtime/mem_tracker.h"
+#include "util/starrocks_metrics.h"
 
 namespace starrocks {
 
@@ -54,6 +55,30 @@ uint8_t* SystemAllocator::allocate(MemTracker* mem_tracker, size_t length) {
     }
 }
 
+size_t SystemAllocator::advise_huge_pages(void* ptr, size_t length) {
+    if (!config::madvise_huge_pages || ptr == nullptr || length < config::huge_page_min_alloc_bytes) {
+        return 0;
+    }
+    auto begin = reinterpret_cast<uintptr_t>(ptr);
+    uintptr_t aligned_begin = (begin + kHugePageSize - 1) & ~(kHugePageSize - 1);
+    uintptr_t aligned_end = (begin + length) & ~(kHugePageSize - 1);
+    if (aligned_end <= aligned_begin) {
+        return 0;
+    }
+    size_t advised = aligned_end - aligned_begin;
+#ifdef MADV_HUGEPAGE
+    if (madvise(reinterpret_cast<void*>(aligned_begin), advised, MADV_HUGEPAGE) != 0) {
+        StarRocksMetrics::instance()->huge_page_advise_failed_total.increment(1);
+        return 0;
+    }
+    StarRocksMetrics::instance()->huge_page_advise_total.increment(1);
+    StarRocksMetrics::instance()->huge_page_advised_bytes_total.increment(advised);
+    return advised;
+#else
+    return 0;
+#endif
+}
+
 void SystemAllocator::free(MemTracker* mem_tracker, uint8_t* ptr, size_t length) {
     if (config::use_mmap_allocate_chunk) {
         auto res = munmap(ptr, length);
@@ -88,6 +113,7 @@ uint8_t* SystemAllocator::allocate_via_mmap(MemTracker* mem_tracker, size_t leng
     if (mem_tracker != nullptr) {
         mem_tracker->consume(length);
     }
+    advise_huge_pages(ptr, length);
     return ptr;
 }
 
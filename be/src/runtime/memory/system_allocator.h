@@ -49,6 +49,16 @@ public:
 
     static void free(MemTracker* mem_tracker, uint8_t* ptr, size_t length);
 
+    static constexpr size_t kHugePageSize = 2 * 1024 * 1024;
+
+    // Advise the kernel to back the 2MB aligned part of [ptr, ptr + length) with transparent huge pages,
+    // it's only done when config::madvise_huge_pages is true and length >= config::huge_page_min_alloc_bytes.
+    // Large hash tables (e.g. the buckets of a join hash table) are accessed randomly, huge pages reduce
+    // the dTLB misses of them. It's only a hint, the memory is backed by normal pages if the kernel
+    // doesn't support it or there are no free huge pages.
+    // Return the bytes advised.
+    static size_t advise_huge_pages(void* ptr, size_t length);
+
 private:
     static uint8_t* allocate_via_mmap(MemTracker* mem_tracker, size_t length);
     static uint8_t* allocate_via_malloc(size_t length);
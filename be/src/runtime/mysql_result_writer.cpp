@@ -40,6 +40,7 @@
 #include "column/const_column.h"
 #include "common/statusor.h"
 #include "exprs/expr.h"
+#include "gutil/strings/fastmem.h"
 #include "runtime/buffer_control_block.h"
 #include "runtime/buffer_control_result_writer.h"
 #include "runtime/current_thread.h"
@@ -122,17 +123,20 @@ StatusOr<TFetchDataResultPtr> MysqlResultWriter::_process_chunk(Chunk* chunk) {
     }
 
     // Step 2: convert chunk to mysql row format row by row
-    {
+    if (!_is_binary_format) {
+        SCOPED_TIMER(_convert_tuple_timer);
+        _serialize_text_columns(result_columns, num_rows);
+        for (int i = 0; i < num_rows; ++i) {
+            _assemble_text_row(i, &result_rows[i]);
+        }
+    } else {
         _row_buffer->reserve(128);
         SCOPED_TIMER(_convert_tuple_timer);
         for (int i = 0; i < num_rows; ++i) {
             DCHECK_EQ(0, _row_buffer->length());
-            if (_is_binary_format) {
-                _row_buffer->start_binary_row(num_columns);
-            }
-            // TODO: codegen here
+            _row_buffer->start_binary_row(num_columns);
             for (auto& result_column : result_columns) {
-                if (_is_binary_format && !result_column->is_nullable()) {
+                if (!result_column->is_nullable()) {
                     _row_buffer->update_field_pos();
                 }
                 result_column->put_mysql_row_buffer(_row_buffer, i, _is_binary_format);
@@ -145,6 +149,45 @@ StatusOr<TFetchDataResultPtr> MysqlResultWriter::_process_chunk(Chunk* chunk) {
     return result;
 }
 
+void MysqlResultWriter::_serialize_text_columns(const Columns& columns, int num_rows) {
+    _column_buffers.resize(columns.size());
+    _column_offsets.resize(columns.size());
+    for (size_t col = 0; col < columns.size(); ++col) {
+        if (_column_buffers[col] == nullptr) {
+            _column_buffers[col] = std::make_unique<MysqlRowBuffer>(false);
+        }
+        auto* buffer = _column_buffers[col].get();
+        auto& offsets = _column_offsets[col];
+        buffer->reset();
+        offsets.resize(num_rows + 1);
+        offsets[0] = 0;
+        const auto& column = columns[col];
+        for (int i = 0; i < num_rows; ++i) {
+            column->put_mysql_row_buffer(buffer, i, false);
+            offsets[i + 1] = buffer->length();
+        }
+    }
+}
+
+size_t MysqlResultWriter::_text_row_length(int row) const {
+    size_t len = 0;
+    for (const auto& offsets : _column_offsets) {
+        len += offsets[row + 1] - offsets[row];
+    }
+    return len;
+}
+
+void MysqlResultWriter::_assemble_text_row(int row, std::string* dst) const {
+    raw::make_room(dst, _text_row_length(row));
+    char* pos = dst->data();
+    for (size_t col = 0; col < _column_buffers.size(); ++col) {
+        const auto& offsets = _column_offsets[col];
+        size_t len = offsets[row + 1] - offsets[row];
+        strings::memcpy_inlined(pos, _column_buffers[col]->data().data() + offsets[row], len);
+        pos += len;
+    }
+}
+
 StatusOr<TFetchDataResultPtrs> MysqlResultWriter::process_chunk(Chunk* chunk) {
     SCOPED_TIMER(_append_chunk_timer);
     int num_rows = chunk->num_rows();
@@ -174,18 +217,24 @@ StatusOr<TFetchDataResultPtrs> MysqlResultWriter::process_chunk(Chunk* chunk) {
         auto& result_rows = result->result_batch.rows;
         result_rows.resize(num_rows);
 
+        if (!_is_binary_format) {
+            _serialize_text_columns(result_columns, num_rows);
+        }
         for (int i = 0; i < num_rows; ++i) {
-            DCHECK_EQ(0, _row_buffer->length());
-            if (_is_binary_format) {
+            size_t len = 0;
+            if (!_is_binary_format) {
+                len = _text_row_length(i);
+            } else {
+                DCHECK_EQ(0, _row_buffer->length());
                 _row_buffer->start_binary_row(num_columns);
-            }
-            for (auto& result_column : result_columns) {
-                if (_is_binary_format && !result_column->is_nullable()) {
-                    _row_buffer->update_field_pos();
+                for (auto& result_column : result_columns) {
+                    if (!result_column->is_nullable()) {
+                        _row_buffer->update_field_pos();
+                    }
+                    result_column->put_mysql_row_buffer(_row_buffer, i, _is_binary_format);
                 }
-                result_column->put_mysql_row_buffer(_row_buffer, i, _is_binary_format);
+                len = _row_buffer->length();
             }
-            size_t len = _row_buffer->length();
 
             if (UNLIKELY(current_bytes + len >= _max_row_buffer_size)) {
                 result_rows.resize(current_rows);
@@ -198,8 +247,12 @@ StatusOr<TFetchDataResultPtrs> MysqlResultWriter::process_chunk(Chunk* chunk) {
                 current_bytes = 0;
                 current_rows = 0;
             }
-            _row_buffer->move_content(&result_rows[current_rows]);
-            _row_buffer->reserve(len * 1.1);
+            if (!_is_binary_format) {
+                _assemble_text_row(i, &result_rows[current_rows]);
+            } else {
+                _row_buffer->move_content(&result_rows[current_rows]);
+                _row_buffer->reserve(len * 1.1);
+            }
 
             current_bytes += len;
             current_rows += 1;
@@ -62,9 +62,18 @@ private:
     // this function is only used in non-pipeline engine
     StatusOr<TFetchDataResultPtr> _process_chunk(Chunk* chunk);
 
+    // Serialize the result columns one column at a time into per-column buffers. The rows of the text protocol
+    // are assembled from the fragments afterwards, since the text fields of a row don't depend on each other.
+    void _serialize_text_columns(const Columns& columns, int num_rows);
+    size_t _text_row_length(int row) const;
+    void _assemble_text_row(int row, std::string* dst) const;
+
     const std::vector<ExprContext*>& _output_expr_ctxs;
     MysqlRowBuffer* _row_buffer;
     bool _is_binary_format;
+    std::vector<std::unique_ptr<MysqlRowBuffer>> _column_buffers;
+    // the fragment of row i in column c is [_column_offsets[c][i], _column_offsets[c][i + 1]) of _column_buffers[c]
+    std::vector<std::vector<size_t>> _column_offsets;
 
     const size_t _max_row_buffer_size = 1024 * 1024 * 1024;
 };
@@ -41,6 +41,7 @@
 #include "common/status.h"
 #include "fmt/format.h"
 #include "gutil/strings/split.h"
+#include "runtime/routine_load/kafka_consumer_pipe.h"
 #include "runtime/small_file_mgr.h"
 #include "service/backend_options.h"
 #include "util/defer_op.h"
@@ -189,7 +190,8 @@ Status KafkaDataConsumer::assign_topic_partitions(const std::map<int32_t, int64_
     return Status::OK();
 }
 
-Status KafkaDataConsumer::group_consume(TimedBlockingQueue<RdKafka::Message*>* queue, int64_t max_running_time_ms) {
+Status KafkaDataConsumer::group_consume(TimedBlockingQueue<KafkaConsumedMessage*>* queue, int64_t max_running_time_ms,
+                                        bool build_json_buffer) {
     DCHECK(!_k_consumer->closed());
     _last_visit_time = time(nullptr);
     int64_t left_time = max_running_time_ms;
@@ -220,16 +222,31 @@ Status KafkaDataConsumer::group_consume(TimedBlockingQueue<RdKafka::Message*>* q
         std::unique_ptr<RdKafka::Message> msg(_k_consumer->consume(consume_timeout /* timeout, ms */));
         consumer_watch.stop();
         switch (msg->err()) {
-        case RdKafka::ERR_NO_ERROR:
-            if (!queue->blocking_put(msg.get())) {
+        case RdKafka::ERR_NO_ERROR: {
+            auto consumed = std::make_unique<KafkaConsumedMessage>();
+            if (build_json_buffer) {
+                auto buffer_or =
+                        KafkaConsumerPipe::build_json_buffer(static_cast<const char*>(msg->payload()),
+                                                             static_cast<size_t>(msg->len()), msg->partition(),
+                                                             msg->offset());
+                if (!buffer_or.ok()) {
+                    done = true;
+                    st = buffer_or.status();
+                    break;
+                }
+                consumed->buffer = std::move(buffer_or).value();
+            }
+            consumed->msg = std::move(msg);
+            if (!queue->blocking_put(consumed.get())) {
                 // queue is shutdown
                 done = true;
             } else {
                 ++put_rows;
-                msg.release(); // release the ownership, msg will be deleted after being processed
+                consumed.release(); // release the ownership, msg will be deleted after being processed
             }
             ++received_rows;
             break;
+        }
         case RdKafka::ERR__TIMED_OUT: {
             // leave the status as OK, because this may happened
             // if there is no data in kafka.
@@ -260,13 +277,15 @@ Status KafkaDataConsumer::group_consume(TimedBlockingQueue<RdKafka::Message*>* q
             // The last offset of partition = `offset of eof` - 1
             // The goal of put the EOF msg to queue is that:
             // we will calculate the last offset of the partition using offset of EOF msg
-            if (!queue->blocking_put(msg.get())) {
+            auto consumed = std::make_unique<KafkaConsumedMessage>();
+            consumed->msg = std::move(msg);
+            if (!queue->blocking_put(consumed.get())) {
                 done = true;
             } else if (_non_eof_partition_count <= 0) {
-                msg.release();
+                consumed.release();
                 done = true;
             } else {
-                msg.release();
+                consumed.release();
             }
             break;
         }
@@ -42,6 +42,7 @@
 #include "pulsar/Client.h"
 #include "runtime/stream_load/stream_load_context.h"
 #include "util/blocking_queue.hpp"
+#include "util/byte_buffer.h"
 #include "util/uid_util.h"
 
 namespace starrocks {
@@ -141,6 +142,13 @@ private:
     mutable std::mutex _lock;
 };
 
+// A message consumed from kafka. If the consumer is asked to, it also builds the pipe buffer
+// of a data message, and the thread feeding the pipe only needs to append it.
+struct KafkaConsumedMessage {
+    std::unique_ptr<RdKafka::Message> msg;
+    ByteBufferPtr buffer;
+};
+
 class KafkaDataConsumer : public DataConsumer {
 public:
     explicit KafkaDataConsumer(StreamLoadContext* ctx)
@@ -171,8 +179,10 @@ public:
     Status assign_topic_partitions(const std::map<int32_t, int64_t>& begin_partition_offset, const std::string& topic,
                                    StreamLoadContext* ctx);
 
-    // start the consumer and put msgs to queue
-    Status group_consume(TimedBlockingQueue<RdKafka::Message*>* queue, int64_t max_running_time_ms);
+    // start the consumer and put msgs to queue. If build_json_buffer is true, the pipe buffers
+    // of data messages are built as by KafkaConsumerPipe::append_json
+    Status group_consume(TimedBlockingQueue<KafkaConsumedMessage*>* queue, int64_t max_running_time_ms,
+                         bool build_json_buffer);
 
     // get the partitions ids of the topic
     Status get_partition_meta(std::vector<int32_t>* partition_ids, int timeout);
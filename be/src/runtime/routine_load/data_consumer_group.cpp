@@ -33,6 +33,7 @@
 // under the License.
 #include "runtime/routine_load/data_consumer_group.h"
 
+#include "common/config.h"
 #include "librdkafka/rdkafka.h"
 #include "librdkafka/rdkafkacpp.h"
 #include "runtime/routine_load/data_consumer.h"
@@ -69,7 +70,7 @@ KafkaDataConsumerGroup::~KafkaDataConsumerGroup() {
     // clean the msgs left in queue
     _queue.shutdown();
     while (true) {
-        RdKafka::Message* msg;
+        KafkaConsumedMessage* msg;
         if (_queue.blocking_get(&msg)) {
             delete msg;
             msg = nullptr;
@@ -82,9 +83,14 @@ KafkaDataConsumerGroup::~KafkaDataConsumerGroup() {
 
 Status KafkaDataConsumerGroup::start_all(StreamLoadContext* ctx) {
     Status result_st = Status::OK();
+    // json and avro messages are appended to the pipe one buffer each, so the consumers can build them
+    bool build_json_buffer =
+            config::routine_load_kafka_build_buffer_in_consumer &&
+            (ctx->format == TFileFormatType::FORMAT_JSON || ctx->format == TFileFormatType::FORMAT_AVRO);
     // start all consumers
     for (auto& consumer : _consumers) {
-        if (!_thread_pool.offer([this, consumer, capture0 = &_queue, capture1 = ctx->max_interval_s * 1000,
+        if (!_thread_pool.offer([this, consumer, build_json_buffer, capture0 = &_queue,
+                                 capture1 = ctx->max_interval_s * 1000,
                                  capture2 = [this, &result_st](const Status& st) {
                                      std::unique_lock<std::mutex> lock(_mutex);
                                      _counter--;
@@ -97,7 +103,7 @@ Status KafkaDataConsumerGroup::start_all(StreamLoadContext* ctx) {
                                      if (result_st.ok() && !st.ok()) {
                                          result_st = st;
                                      }
-                                 }] { actual_consume(consumer, capture0, capture1, capture2); })) {
+                                 }] { actual_consume(consumer, capture0, capture1, build_json_buffer, capture2); })) {
             LOG(WARNING) << "failed to submit data consumer: " << consumer->id() << ", group id: " << _grp_id;
             return Status::InternalError("failed to submit data consumer");
         } else {
@@ -193,12 +199,13 @@ Status KafkaDataConsumerGroup::start_all(StreamLoadContext* ctx) {
             }
         }
 
-        RdKafka::Message* msg;
-        bool res = _queue.blocking_get(&msg);
+        KafkaConsumedMessage* consumed;
+        bool res = _queue.blocking_get(&consumed);
         if (res) {
+            RdKafka::Message* msg = consumed->msg.get();
             VLOG(3) << "get kafka message"
                     << ", partition: " << msg->partition() << ", offset: " << msg->offset() << ", len: " << msg->len();
-            DeferOp msgDeleter([&] { delete msg; });
+            DeferOp msgDeleter([&] { delete consumed; });
 
             if (msg->err() == RdKafka::ERR__PARTITION_EOF) {
                 // For transaction producer, producer will append one control msg to the group of msgs,
@@ -220,9 +227,13 @@ Status KafkaDataConsumerGroup::start_all(StreamLoadContext* ctx) {
                 }
             } else {
                 Status st = Status::OK();
-                st = (kafka_pipe.get()->*append_data)(static_cast<const char*>(msg->payload()),
-                                                      static_cast<size_t>(msg->len()), row_delimiter, msg->partition(),
-                                                      msg->offset());
+                if (consumed->buffer != nullptr) {
+                    st = kafka_pipe->append(std::move(consumed->buffer));
+                } else {
+                    st = (kafka_pipe.get()->*append_data)(static_cast<const char*>(msg->payload()),
+                                                          static_cast<size_t>(msg->len()), row_delimiter,
+                                                          msg->partition(), msg->offset());
+                }
                 if (st.ok()) {
                     received_rows++;
                     left_bytes -= msg->len();
@@ -257,9 +268,11 @@ Status KafkaDataConsumerGroup::start_all(StreamLoadContext* ctx) {
 }
 
 void KafkaDataConsumerGroup::actual_consume(const std::shared_ptr<DataConsumer>& consumer,
-                                            TimedBlockingQueue<RdKafka::Message*>* queue, int64_t max_running_time_ms,
+                                            TimedBlockingQueue<KafkaConsumedMessage*>* queue,
+                                            int64_t max_running_time_ms, bool build_json_buffer,
                                             const ConsumeFinishCallback& cb) {
-    Status st = std::static_pointer_cast<KafkaDataConsumer>(consumer)->group_consume(queue, max_running_time_ms);
+    Status st = std::static_pointer_cast<KafkaDataConsumer>(consumer)->group_consume(queue, max_running_time_ms,
+                                                                                     build_json_buffer);
     cb(st);
 }
 
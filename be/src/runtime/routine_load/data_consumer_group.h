@@ -90,12 +90,13 @@ public:
 
 private:
     // start a single consumer
-    void actual_consume(const std::shared_ptr<DataConsumer>& consumer, TimedBlockingQueue<RdKafka::Message*>* queue,
-                        int64_t max_running_time_ms, const ConsumeFinishCallback& cb);
+    void actual_consume(const std::shared_ptr<DataConsumer>& consumer,
+                        TimedBlockingQueue<KafkaConsumedMessage*>* queue, int64_t max_running_time_ms,
+                        bool build_json_buffer, const ConsumeFinishCallback& cb);
 
 private:
     // blocking queue to receive msgs from all consumers
-    TimedBlockingQueue<RdKafka::Message*> _queue;
+    TimedBlockingQueue<KafkaConsumedMessage*> _queue;
 };
 
 // for pulsar
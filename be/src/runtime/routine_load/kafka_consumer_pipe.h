@@ -76,6 +76,14 @@ public:
     }
 
     Status append_json(const char* data, size_t size, char row_delimiter, int32_t partition, int64_t offset) {
+        ASSIGN_OR_RETURN(auto buf, build_json_buffer(data, size, partition, offset));
+        return append(std::move(buf));
+    }
+
+    // Build the buffer that append_json() appends for a message. It does not touch the pipe,
+    // so the consumer threads can call it concurrently.
+    static StatusOr<ByteBufferPtr> build_json_buffer(const char* data, size_t size, int32_t partition,
+                                                     int64_t offset) {
         bool need_meta = partition >= 0 && offset >= 0;
         // For efficiency reasons, simdjson requires a string with a few bytes (simdjson::SIMDJSON_PADDING) at the end.
         ASSIGN_OR_RETURN(auto buf, ByteBuffer::allocate_with_tracker(
@@ -88,7 +96,7 @@ public:
             meta->set_partition(partition);
             meta->set_offset(offset);
         }
-        return append(std::move(buf));
+        return buf;
     }
 };
 
@@ -698,7 +698,6 @@ Status DataStreamRecvr::PipelineSenderQueue::add_chunks(const PTransmitChunkPara
         DCHECK(!request.has_is_pipeline_level_shuffle() && !request.is_pipeline_level_shuffle());
     }
     const bool use_pass_through = request.use_pass_through();
-    DCHECK(!(keep_order && use_pass_through));
     DCHECK(request.chunks_size() > 0 || use_pass_through);
     if (_is_cancelled || _num_remaining_senders <= 0) {
         VLOG_ROW << print_id(request.finst_id()) << " adds chunks to "
@@ -714,20 +713,57 @@ Status DataStreamRecvr::PipelineSenderQueue::add_chunks(const PTransmitChunkPara
     // NOTE: in the merge scenario, chunk is obtained through try_get_chunk and its return type is not Status.
     // there is no chance to handle deserialize error, so the lazy deserialization is not supported now,
     // we can change related interface's defination to do this later.
+    // In the keep order scenario, the pass through chunks are pulled under the lock, see below.
     ChunkList chunks;
-    ASSIGN_OR_RETURN(chunks,
-                     use_pass_through
-                             ? get_chunks_from_pass_through(request.sender_id(), total_chunk_bytes)
-                             : (keep_order ? get_chunks_from_request<true>(request, metrics, total_chunk_bytes)
-                                           : get_chunks_from_request<false>(request, metrics, total_chunk_bytes)));
-    COUNTER_UPDATE(use_pass_through ? metrics.bytes_pass_through_counter : metrics.bytes_received_counter,
-                   total_chunk_bytes);
+    if (!keep_order || !use_pass_through) {
+        ASSIGN_OR_RETURN(chunks, use_pass_through
+                                         ? get_chunks_from_pass_through(request.sender_id(), total_chunk_bytes)
+                                         : (keep_order ? get_chunks_from_request<true>(request, metrics,
+                                                                                       total_chunk_bytes)
+                                                       : get_chunks_from_request<false>(request, metrics,
+                                                                                        total_chunk_bytes)));
+        COUNTER_UPDATE(use_pass_through ? metrics.bytes_pass_through_counter : metrics.bytes_received_counter,
+                       total_chunk_bytes);
+    }
 
     if (_is_cancelled) {
         return Status::OK();
     }
 
-    if (keep_order) {
+    if (keep_order && use_pass_through) {
+        ScopedTimer<MonotonicStopWatch> wait_timer(metrics.wait_lock_timer);
+        std::lock_guard<Mutex> l(_lock);
+        wait_timer.stop();
+
+        if (_is_cancelled) {
+            return Status::OK();
+        }
+
+        // The pass through chunks of one sender are pulled in the order they were appended, and one request
+        // may pull the chunks of later requests. So the sequence of the request is meaningless here, pulling
+        // under the lock and flushing to the ready queue directly is enough to keep the order of the sender.
+        // The sender appends all its chunks before sending EOS, and the EOS request pulls them before the
+        // sender is removed, so a data request arriving after EOS finds nothing left to pull.
+        ASSIGN_OR_RETURN(chunks, get_chunks_from_pass_through(request.sender_id(), total_chunk_bytes));
+        COUNTER_UPDATE(metrics.bytes_pass_through_counter, total_chunk_bytes);
+
+        if (!chunks.empty() && done != nullptr && _recvr->exceeds_limit(total_chunk_bytes)) {
+            chunks.back().closure = *done;
+            chunks.back().queue_enter_time = MonotonicNanos();
+            COUNTER_UPDATE(metrics.closure_block_counter, 1);
+            *done = nullptr;
+        }
+
+        for (auto& item : chunks) {
+            size_t chunk_bytes = item.chunk_bytes;
+            auto* closure = item.closure;
+            _chunk_queues[0].enqueue(*_producer_token, std::move(item));
+            _chunk_queue_states[0].blocked_closure_num += closure != nullptr;
+            _total_chunks++;
+            _recvr->_num_buffered_bytes += chunk_bytes;
+            COUNTER_ADD(metrics.peak_buffer_mem_bytes, chunk_bytes);
+        }
+    } else if (keep_order) {
         const int32_t be_number = request.be_number();
         const int32_t sequence = request.sequence();
         ScopedTimer<MonotonicStopWatch> wait_timer(metrics.wait_lock_timer);
@@ -806,6 +842,20 @@ Status DataStreamRecvr::PipelineSenderQueue::add_chunks(const PTransmitChunkPara
             *done = nullptr;
         }
 
+        if (!_is_pipeline_level_shuffle) {
+            // All the chunks go to the same queue, so enqueue them in one batch and publish the
+            // accounting once per request instead of once per chunk. The accounting is published
+            // before the enqueue so that consumers never observe it lower than the queued chunks.
+            const size_t num_chunks = chunks.size();
+            const bool has_closure = !chunks.empty() && chunks.back().closure != nullptr;
+            _chunk_queue_states[0].blocked_closure_num += has_closure;
+            _total_chunks += num_chunks;
+            _recvr->_num_buffered_bytes += total_chunk_bytes;
+            COUNTER_ADD(metrics.peak_buffer_mem_bytes, total_chunk_bytes);
+            _chunk_queues[0].enqueue_bulk(std::make_move_iterator(chunks.begin()), num_chunks);
+            chunks.clear();
+        }
+
         for (auto& chunk : chunks) {
             int index = _is_pipeline_level_shuffle ? chunk.driver_sequence : 0;
             size_t chunk_bytes = chunk.chunk_bytes;
@@ -109,7 +109,8 @@ StatusOr<ByteBufferPtr> StreamLoadPipe::read() {
     }
     auto buf = std::move(_buf_queue.front());
     _buf_queue.pop_front();
-    _buffered_bytes -= buf->limit;
+    // queued buffers are not touched, so remaining() is what was accounted when appending
+    _buffered_bytes -= buf->remaining();
     _put_cond.notify_one();
     return buf;
 }
@@ -135,7 +136,8 @@ StatusOr<ByteBufferPtr> StreamLoadPipe::no_block_read() {
     }
     auto buf = std::move(_buf_queue.front());
     _buf_queue.pop_front();
-    _buffered_bytes -= buf->limit;
+    // queued buffers are not touched, so remaining() is what was accounted when appending
+    _buffered_bytes -= buf->remaining();
     _put_cond.notify_one();
     return buf;
 }
@@ -163,13 +165,18 @@ Status StreamLoadPipe::read(uint8_t* data, size_t* data_size, bool* eof) {
             }
             _read_buf = _buf_queue.front();
             _buf_queue.pop_front();
+            _read_buf_bytes = _read_buf->remaining();
         }
 
         size_t copy_size = std::min(*data_size - bytes_read, _read_buf->remaining());
         _read_buf->get_bytes((char*)data + bytes_read, copy_size);
         bytes_read += copy_size;
         if (!_read_buf->has_remaining()) {
-            _buffered_bytes -= _read_buf->limit;
+            {
+                std::lock_guard<std::mutex> l(_lock);
+                _buffered_bytes -= _read_buf_bytes;
+                _read_buf_bytes = 0;
+            }
             _put_cond.notify_one();
         }
     }
@@ -199,13 +206,18 @@ Status StreamLoadPipe::no_block_read(uint8_t* data, size_t* data_size, bool* eof
             }
             _read_buf = _buf_queue.front();
             _buf_queue.pop_front();
+            _read_buf_bytes = _read_buf->remaining();
         }
 
         size_t copy_size = std::min(*data_size - bytes_read, _read_buf->remaining());
         _read_buf->get_bytes((char*)data + bytes_read, copy_size);
         bytes_read += copy_size;
         if (!_read_buf->has_remaining()) {
-            _buffered_bytes -= _read_buf->limit;
+            {
+                std::lock_guard<std::mutex> l(_lock);
+                _buffered_bytes -= _read_buf_bytes;
+                _read_buf_bytes = 0;
+            }
             _put_cond.notify_one();
         }
     }
@@ -341,9 +353,11 @@ StatusOr<int64_t> StreamLoadPipeInputStream::read(void* data, int64_t size) {
 }
 
 Status StreamLoadPipeInputStream::skip(int64_t n) {
-    std::unique_ptr<char[]> buf(new char[n]);
+    // skip through a bounded scratch buffer, the skipped range may be as large as the whole load
+    int64_t buf_size = std::min<int64_t>(n, DEFAULT_STREAM_LOAD_PIPE_CHUNK_SIZE);
+    std::unique_ptr<char[]> buf(new char[buf_size]);
     do {
-        ASSIGN_OR_RETURN(auto r, read(buf.get(), n));
+        ASSIGN_OR_RETURN(auto r, read(buf.get(), std::min(n, buf_size)));
         if (r == 0) {
             break;
         }
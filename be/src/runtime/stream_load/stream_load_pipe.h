@@ -113,6 +113,12 @@ public:
         return _append_buffer_bytes;
     }
 
+    // bytes appended but not consumed yet, which bounds the memory held by the pipe
+    size_t buffered_bytes() {
+        std::unique_lock<std::mutex> l(_lock);
+        return _buffered_bytes;
+    }
+
 private:
     Status _append(const ByteBufferPtr& buf);
 
@@ -135,6 +141,8 @@ private:
 
     ByteBufferPtr _write_buf;
     ByteBufferPtr _read_buf;
+    // bytes of _read_buf accounted in _buffered_bytes when it was appended
+    size_t _read_buf_bytes{0};
     Status _err_st = Status::OK();
 };
 
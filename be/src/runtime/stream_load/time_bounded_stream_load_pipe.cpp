@@ -23,6 +23,8 @@ namespace starrocks {
 // Tracks the time (in nanoseconds) by which the pipe exceeds its active time window.
 // This is used to monitor the potential issue of pipeline engine scheduler
 bvar::LatencyRecorder g_pipe_window_overrun_ns("merge_commit", "pipe_window_overrun");
+// Counter for pipes which finish before the end of their active time window because the window is full
+bvar::Adder<int64_t> g_pipe_window_full_total("merge_commit", "pipe_window_full_total");
 
 StatusOr<ByteBufferPtr> TimeBoundedStreamLoadPipe::read() {
     RETURN_IF_ERROR(_finish_pipe_if_needed());
@@ -37,9 +39,14 @@ Status TimeBoundedStreamLoadPipe::read(uint8_t* data, size_t* data_size, bool* e
 Status TimeBoundedStreamLoadPipe::_finish_pipe_if_needed() {
     auto current_ts = _get_current_ns();
     int64_t window_overrun_ns = current_ts - _start_time_ns - _active_window_ns;
-    if (window_overrun_ns >= 0) {
+    bool window_full = _max_window_bytes > 0 && append_buffer_bytes() >= _max_window_bytes;
+    if (window_overrun_ns >= 0 || window_full) {
         auto st = StreamLoadPipe::finish();
-        g_pipe_window_overrun_ns << window_overrun_ns;
+        if (window_overrun_ns >= 0) {
+            g_pipe_window_overrun_ns << window_overrun_ns;
+        } else {
+            g_pipe_window_full_total << 1;
+        }
         TRACE_BATCH_WRITE << "finish pipe: " << _name << ", expect active: " << (_active_window_ns / 1000000)
                           << " ms, actual active: " << (current_ts - _start_time_ns) / 1000000
                           << " ms, num appends: " << num_append_buffers() << ", bytes: " << append_buffer_bytes()
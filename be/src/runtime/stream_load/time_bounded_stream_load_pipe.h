@@ -28,10 +28,12 @@ class TimeBoundedStreamLoadPipe : public StreamLoadPipe {
 public:
     TimeBoundedStreamLoadPipe(const std::string& name, int32_t active_window_ms,
                               int32_t non_blocking_wait_us = DEFAULT_STREAM_LOAD_PIPE_NON_BLOCKING_WAIT_US,
-                              size_t max_buffered_bytes = DEFAULT_STREAM_LOAD_PIPE_BUFFERED_BYTES)
+                              size_t max_buffered_bytes = DEFAULT_STREAM_LOAD_PIPE_BUFFERED_BYTES,
+                              size_t max_window_bytes = 0)
             : StreamLoadPipe(true, non_blocking_wait_us, max_buffered_bytes, DEFAULT_STREAM_LOAD_PIPE_CHUNK_SIZE) {
         _name = name;
         _active_window_ns = active_window_ms * (int64_t)1000000;
+        _max_window_bytes = max_window_bytes;
         _start_time_ns = _get_current_ns();
     }
 
@@ -62,6 +64,9 @@ private:
     std::string _name;
     int64_t _start_time_ns;
     int64_t _active_window_ns;
+    // the window closes early once this many bytes are appended, so that a high arrival rate gets
+    // batches of bounded size rather than of bounded time. 0 means no limit
+    size_t _max_window_bytes;
 };
 
 } // namespace starrocks
@@ -85,6 +85,11 @@ protected:
         return _immutable_partition_ids.count(partition_id) > 0;
     }
 
+    std::set<int64_t> _get_immutable_partition_ids() const {
+        std::lock_guard l(_immutable_partition_ids_lock);
+        return _immutable_partition_ids;
+    }
+
     void _insert_immutable_partition(int64_t partition_id) {
         std::lock_guard l(_immutable_partition_ids_lock);
         _immutable_partition_ids.insert(partition_id);
@@ -35,6 +35,7 @@
 #include "runtime/descriptors.h"
 #include "serde/protobuf_serde.h"
 #include "types/hll.h"
+#include "util/bit_packing.inline.h"
 #include "util/coding.h"
 #include "util/json.h"
 #include "util/percentile_value.h"
@@ -147,6 +148,34 @@ const uint8_t* decode_string_lz4(const uint8_t* buff, void* target, size_t size)
     return buff + encode_size;
 }
 
+// The null flags are packed into a bitmap, one bit per row in little-endian order.
+uint8_t* encode_null_bitmap(const NullColumn& column, uint8_t* buff) {
+    const uint8_t* nulls = column.raw_data();
+    const size_t num_rows = column.size();
+    const size_t num_full_bytes = num_rows / 8;
+    for (size_t i = 0; i < num_full_bytes; i++) {
+        const uint8_t* p = nulls + i * 8;
+        buff[i] = (p[0] & 1) | (p[1] & 1) << 1 | (p[2] & 1) << 2 | (p[3] & 1) << 3 | (p[4] & 1) << 4 |
+                  (p[5] & 1) << 5 | (p[6] & 1) << 6 | (p[7] & 1) << 7;
+    }
+    if (num_rows % 8 != 0) {
+        uint8_t last = 0;
+        for (size_t i = num_full_bytes * 8; i < num_rows; i++) {
+            last |= (nulls[i] & 1) << (i % 8);
+        }
+        buff[num_full_bytes] = last;
+    }
+    return buff + BitUtil::Ceil(num_rows, 8);
+}
+
+const uint8_t* decode_null_bitmap(const uint8_t* buff, size_t num_rows, NullColumn* column) {
+    const int64_t bitmap_bytes = BitUtil::Ceil(num_rows, 8);
+    auto& data = column->get_data();
+    raw::make_room(&data, num_rows);
+    BitPacking::UnpackValues<uint8_t, 1>(buff, bitmap_bytes, num_rows, data.data());
+    return buff + bitmap_bytes;
+}
+
 template <typename T, bool sorted>
 class FixedLengthColumnSerde {
 public:
@@ -382,18 +411,34 @@ public:
 class NullableColumnSerde {
 public:
     static int64_t max_serialized_size(const NullableColumn& column, const int encode_level) {
-        return serde::ColumnArraySerde::max_serialized_size(*column.null_column(), encode_level) +
-               serde::ColumnArraySerde::max_serialized_size(*column.data_column(), encode_level);
+        int64_t null_size = 0;
+        if (EncodeContext::enable_encode_null(encode_level)) {
+            null_size = sizeof(uint32_t) + BitUtil::Ceil(column.null_column()->size(), 8);
+        } else {
+            null_size = serde::ColumnArraySerde::max_serialized_size(*column.null_column(), encode_level);
+        }
+        return null_size + serde::ColumnArraySerde::max_serialized_size(*column.data_column(), encode_level);
     }
 
     static uint8_t* serialize(const NullableColumn& column, uint8_t* buff, const int encode_level) {
-        buff = serde::ColumnArraySerde::serialize(*column.null_column(), buff, false, encode_level);
+        if (EncodeContext::enable_encode_null(encode_level)) {
+            buff = write_little_endian_32(column.null_column()->size(), buff);
+            buff = encode_null_bitmap(*column.null_column(), buff);
+        } else {
+            buff = serde::ColumnArraySerde::serialize(*column.null_column(), buff, false, encode_level);
+        }
         buff = serde::ColumnArraySerde::serialize(*column.data_column(), buff, false, encode_level);
         return buff;
     }
 
     static const uint8_t* deserialize(const uint8_t* buff, NullableColumn* column, const int encode_level) {
-        buff = serde::ColumnArraySerde::deserialize(buff, column->null_column().get(), false, encode_level);
+        if (EncodeContext::enable_encode_null(encode_level)) {
+            uint32_t num_rows = 0;
+            buff = read_little_endian_32(buff, &num_rows);
+            buff = decode_null_bitmap(buff, num_rows, column->null_column().get());
+        } else {
+            buff = serde::ColumnArraySerde::deserialize(buff, column->null_column().get(), false, encode_level);
+        }
         buff = serde::ColumnArraySerde::deserialize(buff, column->data_column().get(), false, encode_level);
         column->update_has_null();
         return buff;
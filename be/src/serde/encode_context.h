@@ -61,9 +61,13 @@ public:
 
     static bool enable_encode_string(const int encode_level) { return encode_level & ENCODE_STRING; }
 
+    static bool enable_encode_null(const int encode_level) { return encode_level & ENCODE_NULL; }
+
 private:
     static constexpr int ENCODE_INTEGER = 2;
     static constexpr int ENCODE_STRING = 4;
+    // pack the null flags of nullable columns into a bitmap
+    static constexpr int ENCODE_NULL = 8;
 
     // if encode ratio < EncodeRatioLimit, encode it, otherwise not.
     void _adjust(const int col_id);
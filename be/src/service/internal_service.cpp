@@ -95,6 +95,20 @@ namespace starrocks {
 using PromiseStatus = std::promise<Status>;
 using PromiseStatusSharedPtr = std::shared_ptr<PromiseStatus>;
 
+// Deserialize the thrift request carried by the attachment of |cntl|. The attachment is read in place
+// when it is backed by a single block, which saves copying the whole plan for every fragment.
+template <typename TMsg, typename TProtocol>
+static Status deserialize_thrift_attachment(brpc::Controller* cntl, const TProtocol& protocol, TMsg* msg) {
+    const auto& attachment = cntl->request_attachment();
+    uint32_t len = attachment.size();
+    if (attachment.backing_block_num() == 1) {
+        const auto block = attachment.backing_block(0);
+        return deserialize_thrift_msg((const uint8_t*)block.data(), &len, protocol, msg);
+    }
+    auto ser_request = attachment.to_string();
+    return deserialize_thrift_msg((const uint8_t*)ser_request.data(), &len, protocol, msg);
+}
+
 template <typename T>
 PInternalServiceImplBase<T>::PInternalServiceImplBase(ExecEnv* exec_env) : _exec_env(exec_env) {}
 
@@ -338,16 +352,11 @@ void PInternalServiceImplBase<T>::_exec_batch_plan_fragments(google::protobuf::R
         return;
     }
 
-    auto ser_request = cntl->request_attachment().to_string();
     std::shared_ptr<TExecBatchPlanFragmentsParams> t_batch_requests = std::make_shared<TExecBatchPlanFragmentsParams>();
-    {
-        const auto* buf = (const uint8_t*)ser_request.data();
-        uint32_t len = ser_request.size();
-        if (Status status = deserialize_thrift_msg(buf, &len, TProtocolType::BINARY, t_batch_requests.get());
-            !status.ok()) {
-            status.to_protobuf(response->mutable_status());
-            return;
-        }
+    if (Status status = deserialize_thrift_attachment(cntl, TProtocolType::BINARY, t_batch_requests.get());
+        !status.ok()) {
+        status.to_protobuf(response->mutable_status());
+        return;
     }
 
     auto& common_request = t_batch_requests->common_param;
@@ -436,13 +445,8 @@ void PInternalServiceImplBase<T>::load_diagnose(google::protobuf::RpcController*
 template <typename T>
 Status PInternalServiceImplBase<T>::_exec_plan_fragment(brpc::Controller* cntl,
                                                         const PExecPlanFragmentRequest* request) {
-    auto ser_request = cntl->request_attachment().to_string();
     TExecPlanFragmentParams t_request;
-    {
-        const auto* buf = (const uint8_t*)ser_request.data();
-        uint32_t len = ser_request.size();
-        RETURN_IF_ERROR(deserialize_thrift_msg(buf, &len, request->attachment_protocol(), &t_request));
-    }
+    RETURN_IF_ERROR(deserialize_thrift_attachment(cntl, request->attachment_protocol(), &t_request));
     // incremental scan ranges deployment.
     if (!t_request.__isset.fragment) {
         return pipeline::FragmentExecutor::append_incremental_scan_ranges(_exec_env, t_request);
@@ -1303,13 +1307,8 @@ void PInternalServiceImplBase<T>::list_fail_point(google::protobuf::RpcControlle
 template <typename T>
 Status PInternalServiceImplBase<T>::_exec_short_circuit(brpc::Controller* cntl, const PExecShortCircuitRequest* request,
                                                         PExecShortCircuitResult* response) {
-    auto ser_request = cntl->request_attachment().to_string();
     std::shared_ptr<TExecShortCircuitParams> t_requests = std::make_shared<TExecShortCircuitParams>();
-    {
-        const auto* buf = (const uint8_t*)ser_request.data();
-        uint32_t len = ser_request.size();
-        RETURN_IF_ERROR(deserialize_thrift_msg(buf, &len, request->attachment_protocol(), t_requests.get()));
-    }
+    RETURN_IF_ERROR(deserialize_thrift_attachment(cntl, request->attachment_protocol(), t_requests.get()));
     ShortCircuitExecutor executor{_exec_env};
     RETURN_IF_ERROR(executor.prepare(*t_requests));
     RETURN_IF_ERROR(executor.execute());
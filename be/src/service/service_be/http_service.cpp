@@ -50,6 +50,7 @@
 #include "http/action/pipeline_blocking_drivers_action.h"
 #include "http/action/pprof_actions.h"
 #include "http/action/query_cache_action.h"
+#include "http/action/query_flame_graph_action.h"
 #include "http/action/reload_tablet_action.h"
 #include "http/action/restore_tablet_action.h"
 #include "http/action/runtime_filter_cache_action.h"
@@ -272,6 +273,10 @@ Status HttpServiceBE::start() {
                                       pipeline_driver_poller_action);
     _http_handlers.emplace_back(pipeline_driver_poller_action);
 
+    auto* query_flame_graph_action = new QueryFlameGraphAction(_env);
+    _ev_http_server->register_handler(HttpMethod::GET, "/api/query_flame_graph", query_flame_graph_action);
+    _http_handlers.emplace_back(query_flame_graph_action);
+
     auto* greplog_action = new GrepLogAction();
     _ev_http_server->register_handler(HttpMethod::GET, "/greplog", greplog_action);
     _http_handlers.emplace_back(greplog_action);
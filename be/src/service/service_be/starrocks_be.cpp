@@ -123,7 +123,8 @@ void start_be(const std::vector<StorePath>& paths, bool as_cn) {
 
 #ifdef USE_STAROS
     auto* local_cache = cache_env->local_cache();
-    if (config::datacache_unified_instance_enable && local_cache->is_initialized()) {
+    if (config::datacache_unified_instance_enable && local_cache != nullptr && local_cache->is_initialized() &&
+        local_cache->engine_type() == DataCacheEngineType::STARCACHE) {
         auto* starcache = reinterpret_cast<StarCacheWrapper*>(local_cache);
         init_staros_worker(starcache->starcache_instance());
     } else {
@@ -14,6 +14,7 @@
 
 #include "storage/binlog_reader.h"
 
+#include <numeric>
 #include <utility>
 
 #include "column/datum.h"
@@ -196,11 +197,9 @@ void BinlogReader::_append_meta_column(Chunk* output_chunk, int32_t num_rows, in
 
     if (_binlog_seq_id_column_index > -1) {
         ColumnPtr& column = output_chunk->get_column_by_index(_binlog_seq_id_column_index);
-        int64_t end_seq_id = start_seq_id + num_rows - 1;
-        for (int64_t seq_id = start_seq_id; seq_id <= end_seq_id; seq_id++) {
-            Datum datum(seq_id);
-            column->append_datum(datum);
-        }
+        std::vector<int64_t> seq_ids(num_rows);
+        std::iota(seq_ids.begin(), seq_ids.end(), start_seq_id);
+        column->append_numbers(seq_ids.data(), sizeof(int64_t) * seq_ids.size());
     }
 
     if (_binlog_timestamp_column_index > -1) {
@@ -14,6 +14,7 @@
 
 #include "storage/chunk_helper.h"
 
+#include <algorithm>
 #include <numeric>
 #include <utility>
 
@@ -26,6 +27,7 @@
 #include "column/struct_column.h"
 #include "column/type_traits.h"
 #include "column/vectorized_fwd.h"
+#include "common/config.h"
 #include "gutil/strings/fastmem.h"
 #include "runtime/current_thread.h"
 #include "runtime/descriptors.h"
@@ -472,6 +474,15 @@ ChunkPtr ChunkHelper::createDummyChunk() {
     return dummyChunk;
 }
 
+size_t ChunkHelper::adaptive_chunk_size(size_t chunk_size, size_t row_bytes) {
+    const int64_t budget = config::adaptive_chunk_cache_budget_bytes;
+    if (budget <= 0 || row_bytes == 0) {
+        return chunk_size;
+    }
+    size_t rows = budget / row_bytes;
+    return std::min(chunk_size, std::max(rows, kMinAdaptiveChunkSize));
+}
+
 ChunkAccumulator::ChunkAccumulator(size_t desired_size) : _desired_size(desired_size) {}
 
 void ChunkAccumulator::set_desired_size(size_t desired_size) {
@@ -575,12 +586,18 @@ void ChunkPipelineAccumulator::push(const ChunkPtr& chunk) {
     } else {
         _in_chunk->append(*chunk);
         _mem_usage += chunk->bytes_usage();
+        _num_coalesced_chunks++;
     }
 
-    if (_out_chunk == nullptr && (_in_chunk->num_rows() >= _max_size * LOW_WATERMARK_ROWS_RATE ||
-                                  _mem_usage >= LOW_WATERMARK_BYTES || _in_chunk->owner_info().is_last_chunk())) {
-        _out_chunk = std::move(_in_chunk);
-        _mem_usage = 0;
+    if (_out_chunk == nullptr) {
+        bool rows_reached = _in_chunk->num_rows() >= _max_size * LOW_WATERMARK_ROWS_RATE;
+        bool budget_reached = _bytes_budget > 0 && _mem_usage >= _bytes_budget;
+        if (rows_reached || budget_reached || _mem_usage >= LOW_WATERMARK_BYTES ||
+            _in_chunk->owner_info().is_last_chunk()) {
+            _num_budget_limited_chunks += !rows_reached && budget_reached;
+            _out_chunk = std::move(_in_chunk);
+            _mem_usage = 0;
+        }
     }
 }
 
@@ -99,6 +99,11 @@ public:
     static void reorder_chunk(const std::vector<SlotDescriptor*>& slots, Chunk* chunk);
 
     static ChunkPtr createDummyChunk();
+
+    // The rows of a chunk of rows of `row_bytes` fitting config::adaptive_chunk_cache_budget_bytes, which is
+    // in [min(kMinAdaptiveChunkSize, chunk_size), chunk_size]. It's chunk_size if the budget is disabled.
+    static size_t adaptive_chunk_size(size_t chunk_size, size_t row_bytes);
+    static constexpr size_t kMinAdaptiveChunkSize = 256;
 };
 
 // Accumulate small chunk into desired size
@@ -128,6 +133,8 @@ class ChunkPipelineAccumulator {
 public:
     ChunkPipelineAccumulator() = default;
     void set_max_size(size_t max_size) { _max_size = max_size; }
+    // Stop coalescing a chunk once its bytes reach `budget`, 0 means no budget.
+    void set_bytes_budget(size_t budget) { _bytes_budget = budget; }
     void push(const ChunkPtr& chunk);
     ChunkPtr& pull();
     void finalize();
@@ -138,6 +145,11 @@ public:
     bool need_input() const;
     bool is_finished() const;
 
+    // the number of input chunks appended to another one
+    size_t num_coalesced_chunks() const { return _num_coalesced_chunks; }
+    // the number of output chunks cut short by the bytes budget
+    size_t num_budget_limited_chunks() const { return _num_budget_limited_chunks; }
+
 private:
     static bool _check_json_schema_equallity(const Chunk* one, const Chunk* two);
 
@@ -154,6 +166,9 @@ private:
     // For bitmap columns, the cost of calculating mem_usage is relatively high,
     // so incremental calculation is used to avoid becoming a performance bottleneck.
     size_t _mem_usage = 0;
+    size_t _bytes_budget = 0;
+    size_t _num_coalesced_chunks = 0;
+    size_t _num_budget_limited_chunks = 0;
     bool _finalized = false;
 };
 
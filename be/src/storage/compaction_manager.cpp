@@ -387,7 +387,7 @@ void CompactionManager::update_tablet(const TabletSharedPtr& tablet) {
     if (tablet->need_compaction()) {
         CompactionCandidate candidate;
         candidate.tablet = tablet;
-        candidate.score = tablet->compaction_score();
+        candidate.score = tablet->adjust_compaction_score_by_reads(tablet->compaction_score());
         candidate.type = tablet->compaction_type();
         update_candidates({candidate});
     }
@@ -59,6 +59,7 @@
 #include "util/errno.h"
 #include "util/monotime.h"
 #include "util/string_util.h"
+#include "util/threadpool.h"
 
 using strings::Substitute;
 
@@ -277,10 +278,12 @@ void DataDir::load() {
     LOG(INFO) << "begin loading tablet from meta " << _path;
     std::set<int64_t> tablet_ids;
     std::set<int64_t> failed_tablet_ids;
-    auto load_tablet_func = [this, &tablet_ids, &failed_tablet_ids](int64_t tablet_id, int32_t schema_hash,
-                                                                    std::string_view value) -> bool {
+    std::mutex tablet_ids_mutex;
+    auto do_load_tablet = [this, &tablet_ids, &failed_tablet_ids, &tablet_ids_mutex](
+                                  int64_t tablet_id, int32_t schema_hash, std::string_view value) {
         Status st =
                 _tablet_manager->load_tablet_from_meta(this, tablet_id, schema_hash, value, false, false, false, false);
+        std::lock_guard l(tablet_ids_mutex);
         if (!st.ok() && !st.is_not_found() && !st.is_already_exist()) {
             // load_tablet_from_meta() may return NotFound which means the tablet status is DELETED
             // This may happen when the tablet was just deleted before the BE restarted,
@@ -294,10 +297,42 @@ void DataDir::load() {
         } else {
             tablet_ids.insert(tablet_id);
         }
+    };
+    // Scanning rocksdb is sequential, but creating the tablets (parsing the meta, initializing the
+    // updates of primary key tablets) is independent between tablets, so it is done in a thread pool.
+    std::unique_ptr<ThreadPool> load_tablet_pool;
+    if (config::load_tablet_meta_threads_per_data_dir > 1) {
+        Status st = ThreadPoolBuilder("load_tablet_meta")
+                            .set_min_threads(0)
+                            .set_max_threads(config::load_tablet_meta_threads_per_data_dir)
+                            .set_max_queue_size(config::load_tablet_meta_threads_per_data_dir * 64)
+                            .build(&load_tablet_pool);
+        if (!st.ok()) {
+            LOG(WARNING) << "create thread pool to load tablets failed, load them in one thread. path: " << _path
+                         << ", status: " << st;
+            load_tablet_pool.reset();
+        }
+    }
+    auto load_tablet_func = [&](int64_t tablet_id, int32_t schema_hash, std::string_view value) -> bool {
+        if (load_tablet_pool != nullptr) {
+            // The value is only valid during the callback, so copy it for the thread pool.
+            // If the queue is full, load the tablet in the scanning thread to bound the buffered metas.
+            Status st = load_tablet_pool->submit_func(
+                    [&do_load_tablet, tablet_id, schema_hash, meta = std::string(value)]() {
+                        do_load_tablet(tablet_id, schema_hash, meta);
+                    });
+            if (st.ok()) {
+                return true;
+            }
+        }
+        do_load_tablet(tablet_id, schema_hash, value);
         return true;
     };
     Status load_tablet_status =
             TabletMetaManager::walk_until_timeout(_kv_store, load_tablet_func, config::load_tablet_timeout_seconds);
+    if (load_tablet_pool != nullptr) {
+        load_tablet_pool->wait();
+    }
     if (load_tablet_status.is_time_out()) {
         LOG(WARNING) << "load tablets from rocksdb timeout, try to compact meta and retry. path: " << _path;
         Status s = _kv_store->compact();
@@ -317,6 +352,13 @@ void DataDir::load() {
         tablet_ids.clear();
         failed_tablet_ids.clear();
         load_tablet_status = TabletMetaManager::walk(_kv_store, load_tablet_func);
+        if (load_tablet_pool != nullptr) {
+            load_tablet_pool->wait();
+        }
+    }
+
+    if (load_tablet_pool != nullptr) {
+        load_tablet_pool->shutdown();
     }
 
     if (failed_tablet_ids.size() != 0) {
@@ -421,14 +421,7 @@ public:
             const auto& src = chunk->get_column_by_index(idx);
             const auto* raw_data = reinterpret_cast<const Slice*>(src->raw_data());
             for (int i = 0; i < size; i++) {
-                bool contains_zero = false;
-                for (int j = 0; j < raw_data[i].size; j++) {
-                    if (raw_data[i][j] == '\0') {
-                        contains_zero = true;
-                        break;
-                    }
-                }
-                if (value_encode_flags[i] && contains_zero) {
+                if (value_encode_flags[i] && memchr(raw_data[i].data, '\0', raw_data[i].size) != nullptr) {
                     value_encode_flags[i] = 0;
                 }
             }
@@ -15,6 +15,7 @@
 #include "storage/disjunctive_predicates.h"
 
 #include "column/chunk.h"
+#include "simd/simd.h"
 
 namespace starrocks {
 
@@ -24,8 +25,21 @@ Status DisjunctivePredicates::evaluate(const Chunk* chunk, uint8_t* selection) c
 
 Status DisjunctivePredicates::evaluate(const Chunk* chunk, uint8_t* selection, uint16_t from, uint16_t to) const {
     RETURN_IF_ERROR(_preds[0].evaluate(chunk, selection, from, to));
+    if (_preds.size() == 1) {
+        return Status::OK();
+    }
+    _buffer.resize(to);
+    uint8_t* buff = _buffer.data();
     for (size_t i = 1; i < _preds.size(); i++) {
-        RETURN_IF_ERROR(_preds[i].evaluate_or(chunk, selection, from, to));
+        // No need to evaluate the remaining disjuncts once every row is selected,
+        // e.g, all the rows of the chunk have been deleted by previous delete conditions.
+        if (SIMD::count_zero(selection + from, to - from) == 0) {
+            break;
+        }
+        RETURN_IF_ERROR(_preds[i].evaluate(chunk, buff, from, to));
+        for (uint16_t j = from; j < to; j++) {
+            selection[j] |= buff[j];
+        }
     }
     return Status::OK();
 }
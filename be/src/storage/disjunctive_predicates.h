@@ -77,6 +77,8 @@ public:
 private:
     // TODO: reorder for better performance.
     std::vector<ConjunctivePredicates> _preds;
+    // Scratch selection of one disjunct, reused across chunks.
+    mutable std::vector<uint8_t> _buffer;
 };
 
 } // namespace starrocks
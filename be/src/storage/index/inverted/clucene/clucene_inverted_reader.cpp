@@ -19,6 +19,8 @@
 #include <boost/locale/encoding_utf.hpp>
 #include <memory>
 
+#include "cache/object_cache/page_cache.h"
+#include "common/config.h"
 #include "storage/index/index_descriptor.h"
 #include "storage/index/inverted/clucene/match_operator.h"
 #include "types/logical_type.h"
@@ -46,6 +48,48 @@ Status CLuceneInvertedReader::create(const std::string& path, const std::shared_
     }
 }
 
+// The index files of a segment are immutable, so the result of a query only depends on the index path,
+// the column, the query type and the query string.
+static std::string query_cache_key(const std::string& index_path, const std::string& column_name,
+                                   InvertedIndexQueryType query_type, const std::string& search_str) {
+    return fmt::format("inverted_query:{}:{}:{}:{}", index_path, column_name, static_cast<int>(query_type),
+                       search_str);
+}
+
+static StoragePageCache* query_cache() {
+    return config::enable_inverted_index_query_cache ? StoragePageCache::instance() : nullptr;
+}
+
+static bool lookup_query_cache(const std::string& key, roaring::Roaring* bit_map) {
+    auto* cache = query_cache();
+    if (cache == nullptr) {
+        return false;
+    }
+    PageCacheHandle handle;
+    if (!cache->lookup(key, &handle)) {
+        return false;
+    }
+    *bit_map = **reinterpret_cast<const std::shared_ptr<roaring::Roaring>*>(handle.data());
+    return true;
+}
+
+static void insert_query_cache(const std::string& key, const roaring::Roaring& bit_map) {
+    auto* cache = query_cache();
+    if (cache == nullptr) {
+        return;
+    }
+    auto capture = std::make_unique<std::shared_ptr<roaring::Roaring>>(std::make_shared<roaring::Roaring>(bit_map));
+    auto deleter = [](const starrocks::CacheKey& key, void* value) {
+        delete (std::shared_ptr<roaring::Roaring>*)value;
+    };
+    PageCacheHandle handle;
+    ObjectCacheWriteOptions options;
+    Status st = cache->insert(key, (void*)(capture.get()), bit_map.getSizeInBytes(), deleter, options, &handle);
+    if (st.ok()) {
+        capture.release();
+    }
+}
+
 Status FullTextCLuceneInvertedReader::query(OlapReaderStatistics* stats, const std::string& column_name,
                                             const void* query_value, InvertedIndexQueryType query_type,
                                             roaring::Roaring* bit_map) {
@@ -57,6 +101,11 @@ Status FullTextCLuceneInvertedReader::query(OlapReaderStatistics* stats, const s
             << ", column_name: " << column_name << ", search_str: " << search_str;
     std::wstring column_name_ws = std::wstring(column_name.begin(), column_name.end());
 
+    std::string cache_key = query_cache_key(_index_path, column_name, query_type, search_str);
+    if (lookup_query_cache(cache_key, bit_map)) {
+        return Status::OK();
+    }
+
     if (!index_exists(_index_path)) {
         LOG(WARNING) << "inverted index path: " << _index_path << " not exist.";
         return Status::NotFound(fmt::format("Not exists index_file {}", _index_path.c_str()));
@@ -112,6 +161,7 @@ Status FullTextCLuceneInvertedReader::query(OlapReaderStatistics* stats, const s
         LOG(WARNING) << "CLuceneError occured, error msg: " << e.what();
         return Status::InternalError(fmt::format("CLuceneError occured, error msg: {}", e.what()));
     }
+    insert_query_cache(cache_key, result);
     bit_map->swap(result);
     return Status::OK();
 }
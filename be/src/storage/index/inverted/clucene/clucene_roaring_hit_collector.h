@@ -13,17 +13,40 @@
 // limitations under the License.
 
 #pragma once
+#include <array>
+
 #include "CLucene.h"
 #include "roaring/roaring.hh"
 
 namespace starrocks {
+// Hits are buffered and added to the bitmap in batches, which lets roaring fill whole containers at once
+// instead of looking up the container of every single doc.
 class RoaringHitCollector final : public lucene::search::HitCollector {
 public:
     RoaringHitCollector(roaring::Roaring* bitmap) : _collector(bitmap){};
-    void collect(const int32_t doc, const float_t score) override { _collector->add(doc); }
+    ~RoaringHitCollector() { flush(); }
+
+    void collect(const int32_t doc, const float_t score) override {
+        _buffer[_buffered++] = doc;
+        if (_buffered == kBatchSize) {
+            flush();
+        }
+    }
+
+    void flush() {
+        if (_buffered == 0) {
+            return;
+        }
+        _collector->addMany(_buffered, _buffer.data());
+        _buffered = 0;
+    }
 
 private:
+    static constexpr size_t kBatchSize = 4096;
+
     roaring::Roaring* _collector;
+    std::array<uint32_t, kBatchSize> _buffer;
+    size_t _buffered = 0;
 };
 
 } // namespace starrocks
\ No newline at end of file
@@ -23,7 +23,9 @@ namespace starrocks {
 
 Status MatchOperator::match(roaring::Roaring* result) {
     RoaringHitCollector result_collector(result);
-    return _match_internal(&result_collector);
+    RETURN_IF_ERROR(_match_internal(&result_collector));
+    result_collector.flush();
+    return Status::OK();
 }
 
 Status MatchTermOperator::_match_internal(lucene::search::HitCollector* hit_collector) {
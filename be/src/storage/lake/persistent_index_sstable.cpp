@@ -16,6 +16,7 @@
 
 #include <butil/time.h> // NOLINT
 
+#include "common/config.h"
 #include "fs/fs.h"
 #include "storage/lake/utils.h"
 #include "storage/sstable/table_builder.h"
@@ -31,6 +32,7 @@ Status PersistentIndexSstable::init(std::unique_ptr<RandomAccessFile> rf, const
         options.filter_policy = _filter_policy.get();
     }
     options.block_cache = cache;
+    options.open_prefetch_bytes = std::max<int64_t>(0, config::lake_pk_index_sst_open_prefetch_bytes);
     sstable::Table* table;
     RETURN_IF_ERROR(sstable::Table::Open(options, rf.get(), sstable_pb.filesize(), &table));
     _sst.reset(table);
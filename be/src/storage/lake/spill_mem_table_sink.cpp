@@ -14,16 +14,24 @@
 
 #include "storage/lake/spill_mem_table_sink.h"
 
+#include <limits>
+
 #include "exec/spill/options.h"
 #include "exec/spill/serde.h"
 #include "exec/spill/spiller.h"
 #include "exec/spill/spiller_factory.h"
+#include "runtime/exec_env.h"
 #include "runtime/runtime_state.h"
 #include "storage/aggregate_iterator.h"
 #include "storage/chunk_helper.h"
+#include "storage/compaction_utils.h"
+#include "storage/lake/general_tablet_writer.h"
 #include "storage/lake/load_spill_block_manager.h"
 #include "storage/lake/tablet_writer.h"
 #include "storage/merge_iterator.h"
+#include "storage/projection_iterator.h"
+#include "storage/row_source_mask.h"
+#include "util/defer_op.h"
 
 namespace starrocks::lake {
 
@@ -249,9 +257,14 @@ Status SpillMemTableSink::merge_blocks_to_segments() {
     size_t total_chunk = 0;
 
     std::vector<ChunkIteratorPtr> merge_inputs;
+    std::vector<spill::BlockGroup*> merge_groups;
     size_t current_input_bytes = 0;
+    const bool vertical = _can_merge_vertically();
     auto merge_func = [&] {
         total_merges++;
+        if (vertical) {
+            return _merge_vertically(merge_groups, &total_rows, &total_chunk);
+        }
         // PK shouldn't do agg because pk support order key different from primary key,
         // in that case, data is sorted by order key and cannot be aggregated by primary key
         bool do_agg = _schema->keys_type() == KeysType::AGG_KEYS || _schema->keys_type() == KeysType::UNIQUE_KEYS;
@@ -289,9 +302,11 @@ Status SpillMemTableSink::merge_blocks_to_segments() {
              merge_inputs.size() * config::load_spill_max_chunk_bytes >= config::load_spill_max_merge_bytes)) {
             RETURN_IF_ERROR(merge_func());
             merge_inputs.clear();
+            merge_groups.clear();
             current_input_bytes = 0;
         }
         merge_inputs.push_back(std::make_shared<BlockGroupIterator>(*_schema, *_spiller->serde(), group.blocks()));
+        merge_groups.push_back(&group);
         current_input_bytes += group.data_size();
         total_block_bytes += group.data_size();
         total_blocks += group.blocks().size();
@@ -303,9 +318,9 @@ Status SpillMemTableSink::merge_blocks_to_segments() {
     auto duration_ms = timer.elapsed_time() / 1000000;
     LOG(INFO) << fmt::format(
             "SpillMemTableSink merge finished, txn:{} tablet:{} blockgroups:{} blocks:{} input_bytes:{} merges:{} "
-            "rows:{} chunks:{} duration:{}ms",
+            "rows:{} chunks:{} vertical:{} duration:{}ms",
             _block_manager->txn_id(), _block_manager->tablet_id(), groups.size(), total_blocks, total_block_bytes,
-            total_merges, total_rows, total_chunk, duration_ms);
+            total_merges, total_rows, total_chunk, vertical, duration_ms);
     ADD_COUNTER(_profile, "SpillMergeInputGroups", TUnit::UNIT)->update(groups.size());
     ADD_COUNTER(_profile, "SpillMergeInputBytes", TUnit::BYTES)->update(total_block_bytes);
     ADD_COUNTER(_profile, "SpillMergeCount", TUnit::UNIT)->update(total_merges);
@@ -313,4 +328,84 @@ Status SpillMemTableSink::merge_blocks_to_segments() {
     return Status::OK();
 }
 
-} // namespace starrocks::lake
\ No newline at end of file
+bool SpillMemTableSink::_can_merge_vertically() const {
+    if (config::load_spill_vertical_merge_min_columns <= 0 || _schema == nullptr) {
+        return false;
+    }
+    const auto& tablet_schema = _writer->tablet_schema();
+    // rows of other key types may need to be aggregated during the merge, which the row source masks
+    // can't describe, and the spilled chunks must carry exactly the columns of the tablet
+    return tablet_schema->keys_type() == KeysType::DUP_KEYS &&
+           tablet_schema->num_columns() >= config::load_spill_vertical_merge_min_columns &&
+           _schema->num_fields() == tablet_schema->num_columns();
+}
+
+Status SpillMemTableSink::_merge_vertically(const std::vector<spill::BlockGroup*>& groups, size_t* total_rows,
+                                            size_t* total_chunks) {
+    const auto& tablet_schema = _writer->tablet_schema();
+    std::vector<std::vector<uint32_t>> column_groups;
+    CompactionUtils::split_column_into_groups(tablet_schema->num_columns(), tablet_schema->sort_key_idxes(),
+                                              config::load_spill_vertical_merge_max_columns_per_group,
+                                              &column_groups);
+
+    const auto& store_paths = ExecEnv::GetInstance()->store_paths();
+    RETURN_IF(store_paths.empty(), Status::InternalError("no store path for row source masks"));
+    auto mask_buffer = std::make_unique<RowSourceMaskBuffer>(_writer->tablet_id(), store_paths.begin()->path);
+    std::vector<RowSourceMask> source_masks;
+
+    // one segment for all the inputs of this merge, as the horizontal merge does
+    auto writer = std::make_unique<VerticalGeneralTabletWriter>(_writer->tablet_manager(), _writer->tablet_id(),
+                                                                tablet_schema, _writer->txn_id(),
+                                                                std::numeric_limits<uint32_t>::max(), false);
+    RETURN_IF_ERROR(writer->open());
+    DeferOp defer([&]() { writer->close(); });
+
+    for (size_t i = 0; i < column_groups.size(); ++i) {
+        bool is_key = (i == 0);
+        Schema schema(_schema.get(), column_groups[i]);
+        std::vector<ChunkIteratorPtr> inputs;
+        inputs.reserve(groups.size());
+        for (auto* group : groups) {
+            inputs.push_back(new_projection_iterator(
+                    schema, std::make_shared<BlockGroupIterator>(*_schema, *_spiller->serde(), group->blocks())));
+        }
+        ChunkIteratorPtr merge_itr;
+        if (is_key) {
+            merge_itr = new_heap_merge_iterator(inputs);
+        } else {
+            // replay the order of the key columns
+            RETURN_IF_ERROR(mask_buffer->flip_to_read());
+            merge_itr = new_mask_merge_iterator(inputs, mask_buffer.get());
+        }
+        RETURN_IF_ERROR(merge_itr->init_encoded_schema(EMPTY_GLOBAL_DICTMAPS));
+        auto char_field_indexes = ChunkHelper::get_char_field_indexes(schema);
+        auto chunk = ChunkHelper::new_chunk(schema, config::vector_chunk_size);
+        while (true) {
+            chunk->reset();
+            auto st = is_key ? merge_itr->get_next(chunk.get(), &source_masks) : merge_itr->get_next(chunk.get());
+            if (st.is_end_of_file()) {
+                break;
+            } else if (!st.ok()) {
+                return st;
+            }
+            ChunkHelper::padding_char_columns(char_field_indexes, schema, tablet_schema, chunk.get());
+            RETURN_IF_ERROR(writer->write_columns(*chunk, column_groups[i], is_key));
+            if (is_key) {
+                *total_rows += chunk->num_rows();
+                (*total_chunks)++;
+                RETURN_IF_ERROR(mask_buffer->write(source_masks));
+                source_masks.clear();
+            }
+        }
+        merge_itr->close();
+        RETURN_IF_ERROR(writer->flush_columns());
+        if (is_key) {
+            RETURN_IF_ERROR(mask_buffer->flush());
+        }
+    }
+    RETURN_IF_ERROR(writer->finish());
+    _writer->add_files_from(*writer);
+    return Status::OK();
+}
+
+} // namespace starrocks::lake
@@ -76,6 +76,9 @@ public:
 private:
     Status _prepare(const ChunkPtr& chunk_ptr);
     Status _do_spill(const Chunk& chunk, const spill::SpillOutputDataStreamPtr& output);
+    bool _can_merge_vertically() const;
+    // merge the block groups column group by column group into the segments of a vertical writer
+    Status _merge_vertically(const std::vector<spill::BlockGroup*>& groups, size_t* total_rows, size_t* total_chunks);
 
 private:
     LoadSpillBlockManager* _block_manager = nullptr;
@@ -140,6 +140,17 @@ public:
 
     const OlapWriterStatistics& stats() const { return _stats; }
 
+    // Take over the files of another finished writer of the same tablet and txn, their segments
+    // become part of the rowset written by this writer.
+    void add_files_from(const TabletWriter& other) {
+        _files.insert(_files.end(), other._files.begin(), other._files.end());
+        _num_rows += other._num_rows;
+        _data_size += other._data_size;
+        _stats.bytes_write_ns += other._stats.bytes_write_ns;
+        _stats.bytes_write += other._stats.bytes_write;
+        _stats.segment_count += other._stats.segment_count;
+    }
+
 protected:
     TabletManager* _tablet_mgr;
     int64_t _tablet_id;
@@ -14,6 +14,8 @@
 
 #include "storage/lake/transactions.h"
 
+#include <future>
+
 #include "fs/fs_util.h"
 #include "gen_cpp/lake_types.pb.h"
 #include "gutil/strings/join.h"
@@ -139,6 +141,30 @@ StatusOr<TxnLogPtr> load_txn_log(TabletManager* tablet_mgr, int64_t tablet_id, c
     }
 }
 
+// Start loading the txn logs of `txns[offset:]` concurrently, each load is a remote read and a batch publish
+// would otherwise pay them one after another. Returns an empty vector if the logs should be loaded serially.
+std::vector<std::future<StatusOr<TxnLogPtr>>> prefetch_txn_logs(TabletManager* tablet_mgr, int64_t tablet_id,
+                                                                std::span<const TxnInfoPB> txns, size_t offset) {
+    std::vector<std::future<StatusOr<TxnLogPtr>>> txn_logs;
+    auto* pool = ExecEnv::GetInstance()->load_segment_thread_pool();
+    if (!config::lake_enable_batch_publish_prefetch_txn_log || pool == nullptr || txns.size() <= offset + 1) {
+        return txn_logs;
+    }
+    txn_logs.reserve(txns.size() - offset);
+    for (size_t i = offset; i < txns.size(); i++) {
+        auto task = std::make_shared<std::packaged_task<StatusOr<TxnLogPtr>()>>(
+                [tablet_mgr, tablet_id, txn_info = txns[i]]() {
+                    return load_txn_log(tablet_mgr, tablet_id, txn_info);
+                });
+        txn_logs.emplace_back(task->get_future());
+        if (!pool->submit_func([task]() { (*task)(); }).ok()) {
+            // load it in place, the future is ready afterwards
+            (*task)();
+        }
+    }
+    return txn_logs;
+}
+
 } // namespace
 
 StatusOr<TabletMetadataPtr> publish_version(TabletManager* tablet_mgr, int64_t tablet_id, int64_t base_version,
@@ -247,9 +273,11 @@ StatusOr<TabletMetadataPtr> publish_version(TabletManager* tablet_mgr, int64_t t
     // 5. txn4 will be published in later publish task, but we can't judge what's the latest_version in BE and we can not reapply txn_log if
     // txn logs have been deleted.
     int txn_offset = base_version - ori_base_version;
+    auto prefetched_txn_logs = prefetch_txn_logs(tablet_mgr, tablet_id, txns, txn_offset);
     for (size_t i = txn_offset, sz = txns.size(); i < sz; i++) {
         bool ignore_txn_log = false;
-        auto txn_log_st = load_txn_log(tablet_mgr, tablet_id, txns[i]);
+        auto txn_log_st = prefetched_txn_logs.empty() ? load_txn_log(tablet_mgr, tablet_id, txns[i])
+                                                      : prefetched_txn_logs[i - txn_offset].get();
 
         if (txn_log_st.status().is_not_found()) {
             if (i == 0) {
@@ -17,6 +17,7 @@
 #include <butil/time.h>
 #include <bvar/bvar.h>
 
+#include <mutex>
 #include <set>
 #include <string_view>
 #include <unordered_map>
@@ -86,6 +87,7 @@ static int get_num_active_file_queued_tasks(void*) {
 static bvar::LatencyRecorder g_del_file_latency("lake_vacuum_del_file"); // unit: us
 static bvar::Adder<uint64_t> g_del_fails("lake_vacuum_del_file_fails");
 static bvar::Adder<uint64_t> g_deleted_files("lake_vacuum_deleted_files");
+static bvar::Adder<int64_t> g_del_throttle_wait("lake_vacuum_del_throttle_wait_us");
 static bvar::LatencyRecorder g_metadata_travel_latency("lake_vacuum_metadata_travel"); // unit: ms
 static bvar::LatencyRecorder g_vacuum_txnlog_latency("lake_vacuum_delete_txnlog");
 static bvar::PassiveStatus<int> g_queued_delete_file_tasks("lake_vacuum_queued_delete_file_tasks",
@@ -133,6 +135,30 @@ Status delete_files_with_retry(FileSystem* fs, std::span<const std::string> path
     }
 }
 
+// Pace the deletes of all vacuum tasks on this node to config::lake_vacuum_max_deleted_files_per_second,
+// |num_files| is the number of files about to be deleted. Each caller reserves its time slot under the
+// lock and sleeps out of it, so concurrent delete tasks share the rate instead of each getting a full one.
+void throttle_delete_files(int64_t num_files) {
+    const int64_t rate = config::lake_vacuum_max_deleted_files_per_second;
+    if (rate <= 0 || num_files <= 0) {
+        return;
+    }
+    static std::mutex s_lock;
+    static int64_t s_next_slot_us = 0;
+    int64_t wait_us = 0;
+    {
+        std::lock_guard l(s_lock);
+        auto now = butil::monotonic_time_us();
+        auto start = std::max(now, s_next_slot_us);
+        s_next_slot_us = start + num_files * 1000000 / rate;
+        wait_us = start - now;
+    }
+    if (wait_us > 0) {
+        g_del_throttle_wait << wait_us;
+        std::this_thread::sleep_for(std::chrono::microseconds(wait_us));
+    }
+}
+
 // Batch delete files with specified FileSystem object |fs|
 Status do_delete_files(FileSystem* fs, const std::vector<std::string>& paths) {
     if (UNLIKELY(paths.empty())) {
@@ -144,6 +170,7 @@ Status do_delete_files(FileSystem* fs, const std::vector<std::string>& paths) {
         if (wait_duration > 0) {
             std::this_thread::sleep_for(std::chrono::milliseconds(wait_duration));
         }
+        throttle_delete_files(static_cast<int64_t>(batch.size()));
 
         if (config::lake_print_delete_log) {
             for (size_t i = 0, n = batch.size(); i < n; i++) {
@@ -19,6 +19,7 @@
 #include "column/binary_column.h"
 #include "column/json_column.h"
 #include "common/logging.h"
+#include "exec/sorting/merge.h"
 #include "exec/sorting/sorting.h"
 #include "gutil/strings/substitute.h"
 #include "io/io_profiler.h"
@@ -41,6 +42,10 @@ static const string LOAD_OP_COLUMN = "__op";
 
 #define ADD_COUNTER_RELAXED(counter, value) counter.fetch_add(value, std::memory_order_relaxed)
 
+// The rows inserted are sorted into a run once there are so many of them in incremental sort,
+// which keeps the number of runs small for loads of many small batches.
+static constexpr size_t kMinSortedRunRows = 4096;
+
 Schema MemTable::convert_schema(const TabletSchemaCSPtr& tablet_schema,
                                 const std::vector<SlotDescriptor*>* slot_descs) {
     if (tablet_schema->keys_type() == KeysType::PRIMARY_KEYS) {
@@ -226,6 +231,16 @@ StatusOr<bool> MemTable::insert(const Chunk& chunk, const uint32_t* indexes, uin
         _total_rows += chunk.num_rows();
     }
 
+    // rows pre-sorted by the sender keep their order in _chunk, so the sort at flush can be skipped
+    if (cur_row_count == 0) {
+        _chunk_presorted = true;
+    }
+    _chunk_presorted = _chunk_presorted && _is_presorted_since(cur_row_count);
+
+    if (_is_incremental_sort() && _chunk->num_rows() >= kMinSortedRunRows) {
+        RETURN_IF_ERROR(_seal_sorted_run());
+    }
+
     // if memtable is full, push it to the flush executor,
     // and create a new memtable for incoming data
     bool suggest_flush = false;
@@ -258,7 +273,7 @@ Status MemTable::finalize() {
         SCOPED_RAW_TIMER(&duration_ns);
 
         if (_keys_type != KeysType::DUP_KEYS) {
-            if (_chunk->num_rows() > 0) {
+            if (_chunk->num_rows() > 0 || !_sorted_runs.empty()) {
                 // merge last undo merge
                 RETURN_IF_ERROR(_merge());
             }
@@ -407,9 +422,11 @@ void MemTable::_aggregate(bool is_final) {
 }
 
 Status MemTable::_sort(bool is_final, bool by_sort_key) {
+    if (_is_incremental_sort()) {
+        return _sort_incremental(is_final);
+    }
     auto start_time = MonotonicNanos();
     DeferOp defer([&]() { ADD_COUNTER_RELAXED(_stats.sort_time_ns, MonotonicNanos() - start_time); });
-    ADD_COUNTER_RELAXED(_stats.sort_count, 1);
     SmallPermutation perm = create_small_permutation(static_cast<uint32_t>(_chunk->num_rows()));
     std::swap(perm, _permutations);
 
@@ -424,7 +441,12 @@ Status MemTable::_sort(bool is_final, bool by_sort_key) {
     if (_keys_type != KeysType::PRIMARY_KEYS) {
         by_sort_key = true;
     }
-    RETURN_IF_ERROR(_sort_column_inc(by_sort_key));
+    if (by_sort_key && _chunk_presorted) {
+        ADD_COUNTER_RELAXED(_stats.presorted_count, 1);
+    } else {
+        ADD_COUNTER_RELAXED(_stats.sort_count, 1);
+        RETURN_IF_ERROR(_sort_column_inc(by_sort_key));
+    }
     if (is_final) {
         // No need to reserve, it will be reserve in IColumn::append_selective(),
         // Otherwise it will use more peak memory
@@ -441,6 +463,112 @@ Status MemTable::_sort(bool is_final, bool by_sort_key) {
     return Status::OK();
 }
 
+Status MemTable::_sort_incremental(bool is_final) {
+    RETURN_IF_ERROR(_seal_sorted_run());
+    RETURN_IF_ERROR(_merge_sorted_runs(1));
+    if (_sorted_runs.empty()) {
+        _result_chunk = _chunk->clone_empty_with_schema(0);
+    } else {
+        _result_chunk = std::move(_sorted_runs[0]);
+        _sorted_runs.clear();
+    }
+    if (is_final) {
+        _chunk.reset();
+    } else {
+        _chunk->reset();
+    }
+    _chunk_memory_usage = 0;
+    _chunk_bytes_usage = 0;
+    return Status::OK();
+}
+
+bool MemTable::_is_presorted_since(size_t from_row) const {
+    // the rows of primary keys tables are sorted by primary key first, and rows with equal sort keys
+    // are ordered by the merge condition column, so only the plain sort key order can be trusted
+    if (_keys_type == KeysType::PRIMARY_KEYS || !_merge_condition.empty()) {
+        return false;
+    }
+    std::vector<ColumnId> sort_key_idxes;
+    if (!_get_sort_key_idxes(true, &sort_key_idxes).ok()) {
+        return false;
+    }
+    Columns columns;
+    for (auto sort_key_idx : sort_key_idxes) {
+        columns.push_back(_chunk->get_column_by_index(sort_key_idx));
+    }
+    size_t num_rows = _chunk->num_rows();
+    for (size_t row = std::max<size_t>(from_row, 1); row < num_rows; ++row) {
+        for (const auto& column : columns) {
+            // ascending with nulls first, the same as _sort_column_inc
+            int cmp = column->compare_at(row - 1, row, *column, -1);
+            if (cmp > 0) {
+                return false;
+            }
+            if (cmp < 0) {
+                break;
+            }
+        }
+    }
+    return true;
+}
+
+Status MemTable::_seal_sorted_run() {
+    if (_chunk->num_rows() == 0) {
+        return Status::OK();
+    }
+    {
+        auto start_time = MonotonicNanos();
+        DeferOp defer([&]() { ADD_COUNTER_RELAXED(_stats.sort_time_ns, MonotonicNanos() - start_time); });
+        SmallPermutation perm = create_small_permutation(static_cast<uint32_t>(_chunk->num_rows()));
+        std::swap(perm, _permutations);
+        if (_chunk_presorted) {
+            ADD_COUNTER_RELAXED(_stats.presorted_count, 1);
+        } else {
+            ADD_COUNTER_RELAXED(_stats.sort_count, 1);
+            RETURN_IF_ERROR(_sort_column_inc(true));
+        }
+        ChunkPtr run = _chunk->clone_empty_with_schema(0);
+        _append_to_sorted_chunk(_chunk.get(), run.get(), false);
+        _chunk->reset();
+        _sorted_runs.emplace_back(std::move(run));
+    }
+    return _merge_sorted_runs(std::numeric_limits<size_t>::max());
+}
+
+Status MemTable::_merge_sorted_runs(size_t max_runs) {
+    if (_sorted_runs.size() < 2) {
+        return Status::OK();
+    }
+    auto start_time = MonotonicNanos();
+    DeferOp defer([&]() { ADD_COUNTER_RELAXED(_stats.sort_time_ns, MonotonicNanos() - start_time); });
+    std::vector<ColumnId> sort_key_idxes;
+    RETURN_IF_ERROR(_get_sort_key_idxes(true, &sort_key_idxes));
+    auto sort_descs = SortDescs::asc_null_first(sort_key_idxes.size());
+    // Merging only runs of similar size keeps the runs in descending size, so each row is merged
+    // O(log(n)) times and few runs are left to merge at flush.
+    while (_sorted_runs.size() >= 2) {
+        size_t n = _sorted_runs.size();
+        if (n <= max_runs && _sorted_runs[n - 2]->num_rows() > _sorted_runs[n - 1]->num_rows()) {
+            break;
+        }
+        std::vector<ChunkPtr> runs{_sorted_runs[n - 2], _sorted_runs[n - 1]};
+        Columns left_columns;
+        Columns right_columns;
+        for (auto sort_key_idx : sort_key_idxes) {
+            left_columns.push_back(runs[0]->get_column_by_index(sort_key_idx));
+            right_columns.push_back(runs[1]->get_column_by_index(sort_key_idx));
+        }
+        Permutation perm;
+        RETURN_IF_ERROR(merge_sorted_chunks_two_way(sort_descs, SortedRun(runs[0], std::move(left_columns)),
+                                                    SortedRun(runs[1], std::move(right_columns)), &perm));
+        ChunkPtr merged = runs[0]->clone_empty_with_schema(0);
+        materialize_by_permutation(merged.get(), runs, perm);
+        _sorted_runs.pop_back();
+        _sorted_runs.back() = std::move(merged);
+    }
+    return Status::OK();
+}
+
 void MemTable::_append_to_sorted_chunk(Chunk* src, Chunk* dest, bool is_final) {
     DCHECK_EQ(src->num_rows(), _permutations.size());
     permutate_to_selective(_permutations, &_selective_values);
@@ -499,9 +627,8 @@ Status MemTable::_split_upserts_deletes(ChunkPtr& src, ChunkPtr* upserts, Mutabl
     return Status::OK();
 }
 
-Status MemTable::_sort_column_inc(bool by_sort_key) {
-    Columns columns;
-    std::vector<ColumnId> sort_key_idxes;
+Status MemTable::_get_sort_key_idxes(bool by_sort_key, std::vector<ColumnId>* sort_key_idxes_ptr) const {
+    auto& sort_key_idxes = *sort_key_idxes_ptr;
     if (by_sort_key) {
         sort_key_idxes = _vectorized_schema->sort_key_idxes();
         if (sort_key_idxes.empty()) {
@@ -528,6 +655,13 @@ Status MemTable::_sort_column_inc(bool by_sort_key) {
             sort_key_idxes.push_back(i);
         }
     }
+    return Status::OK();
+}
+
+Status MemTable::_sort_column_inc(bool by_sort_key) {
+    Columns columns;
+    std::vector<ColumnId> sort_key_idxes;
+    RETURN_IF_ERROR(_get_sort_key_idxes(by_sort_key, &sort_key_idxes));
 
     for (auto sort_key_idx : sort_key_idxes) {
         columns.push_back(_chunk->get_column_by_index(sort_key_idx));
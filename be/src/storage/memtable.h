@@ -42,6 +42,8 @@ struct MemtableStats {
     std::atomic_int32_t sort_count = 0;
     // Accumulated time to sort
     std::atomic_int64_t sort_time_ns = 0;
+    // The number of sort operation skipped because the rows were inserted in sort key order
+    std::atomic_int32_t presorted_count = 0;
     // The number of agg operation
     std::atomic_int32_t agg_count = 0;
     // Accumulated time to aggregate
@@ -61,6 +63,7 @@ struct MemtableStats {
         finalize_time_ns += other.finalize_time_ns;
         sort_count += other.sort_count;
         sort_time_ns += other.sort_time_ns;
+        presorted_count += other.presorted_count;
         agg_count += other.agg_count;
         agg_time_ns += other.agg_time_ns;
         flush_time_ns += other.flush_time_ns;
@@ -119,8 +122,21 @@ private:
 
     Status _sort(bool is_final, bool by_sort_key = false);
     Status _sort_column_inc(bool by_sort_key = false);
+    Status _get_sort_key_idxes(bool by_sort_key, std::vector<ColumnId>* sort_key_idxes) const;
     void _append_to_sorted_chunk(Chunk* src, Chunk* dest, bool is_final);
 
+    // incremental sort, see enable_memtable_incremental_sort
+    bool _is_incremental_sort() const {
+        return _incremental_sort && _keys_type != KeysType::PRIMARY_KEYS && _merge_condition.empty();
+    }
+    // whether the rows of _chunk from |from_row| on keep the sort key order of the rows before them
+    bool _is_presorted_since(size_t from_row) const;
+    // sort the rows in _chunk into a new sorted run
+    Status _seal_sorted_run();
+    // merge the newest two runs until at most `max_runs` runs left or the older run is larger than the newer one
+    Status _merge_sorted_runs(size_t max_runs);
+    Status _sort_incremental(bool is_final);
+
     void _init_aggregator_if_needed();
     void _aggregate(bool is_final);
 
@@ -128,6 +144,11 @@ private:
 
     ChunkPtr _chunk;
     ChunkPtr _result_chunk;
+    // sorted runs in the order of insertion, the rows of an older run come first on equal keys
+    std::vector<ChunkPtr> _sorted_runs;
+    // whether the rows in _chunk are already in sort key order, e.g. pre-sorted by the sender
+    bool _chunk_presorted = true;
+    const bool _incremental_sort = config::enable_memtable_incremental_sort;
 
     // for sort by columns
     SmallPermutation _permutations;
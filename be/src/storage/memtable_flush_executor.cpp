@@ -105,6 +105,10 @@ Status FlushToken::submit(std::unique_ptr<MemTable> memtable, bool eos,
     }
     // Does not acount the size of MemtableFlushTask into any memory tracker
     SCOPED_THREAD_LOCAL_MEM_SETTER(nullptr, false);
+    if (eos && config::enable_memtable_flush_eos_priority) {
+        // the load waits for the last flush to commit, so let it overtake the flushes of the loads still writing
+        _flush_token->set_priority(ThreadPool::HIGH_PRIORITY);
+    }
     auto task = std::make_shared<MemtableFlushTask>(this, std::move(memtable), eos, std::move(cb));
     _stats.queueing_memtable_num++;
     return _flush_token->submit(std::move(task));
@@ -71,26 +71,29 @@ protected:
 };
 
 // Compare two chunks by the one specific row of each other.
+// The sort key indexes and merge condition are owned by the merge iterator, so that
+// pushing and popping the heap does not copy them.
 class ComparableChunk : public MergingChunk {
 public:
-    explicit ComparableChunk(Chunk* chunk, size_t order, size_t key_columns, std::vector<uint32_t> sort_key_idxes,
-                             std::string merge_condition)
+    explicit ComparableChunk(Chunk* chunk, size_t order, size_t key_columns,
+                             const std::vector<uint32_t>* sort_key_idxes, const std::string* merge_condition)
             : MergingChunk(chunk),
               _order(order),
               _key_columns(key_columns),
-              _sort_key_idxes(std::move(sort_key_idxes)),
-              _merge_condition(std::move(merge_condition)) {}
+              _sort_key_idxes(sort_key_idxes),
+              _merge_condition(merge_condition) {}
 
-    explicit ComparableChunk(Chunk* chunk, size_t order, size_t key_columns, std::vector<uint32_t> sort_key_idxes,
-                             std::string merge_condition, std::shared_ptr<std::vector<uint64_t>> rssid_rowids)
-            : ComparableChunk(chunk, order, key_columns, std::move(sort_key_idxes), std::move(merge_condition)) {
+    explicit ComparableChunk(Chunk* chunk, size_t order, size_t key_columns,
+                             const std::vector<uint32_t>* sort_key_idxes, const std::string* merge_condition,
+                             std::shared_ptr<std::vector<uint64_t>> rssid_rowids)
+            : ComparableChunk(chunk, order, key_columns, sort_key_idxes, merge_condition) {
         _rssid_rowids = std::move(rssid_rowids);
     }
 
     bool operator>(const ComparableChunk& rhs) const {
         DCHECK_EQ(_key_columns, rhs._key_columns);
-        int r = compare_chunk(_key_columns, _sort_key_idxes, *_chunk, _compared_row, *rhs._chunk, rhs._compared_row,
-                              _merge_condition);
+        int r = compare_chunk(_key_columns, *_sort_key_idxes, *_chunk, _compared_row, *rhs._chunk, rhs._compared_row,
+                              *_merge_condition);
         return (r > 0) | ((r == 0) & (_order > rhs._order));
     }
 
@@ -108,15 +111,33 @@ public:
         // must be less than all rows in rhs, thus here we start comparision from _compared_row + 1;
         size_t next_compare_row = _compared_row + 1;
         size_t upper_bound = std::min(_compared_row + limit_num, _chunk->num_rows());
+        // Rows in this chunk are sorted, so gallop forward to bound the run, then binary search
+        // inside the last step. Long runs cost O(log(run)) comparisons instead of O(run).
+        size_t step = 1;
         while (next_compare_row < upper_bound && less_than(next_compare_row, rhs)) {
-            next_compare_row++;
+            next_compare_row += step;
+            step <<= 1;
         }
-        return next_compare_row;
+        if (step == 1) {
+            return next_compare_row;
+        }
+        // All rows before `low` are less than |rhs|, and `high` is either the upper bound or a row not less than it.
+        size_t low = next_compare_row - (step >> 1) + 1;
+        size_t high = std::min(next_compare_row, upper_bound);
+        while (low < high) {
+            size_t mid = low + (high - low) / 2;
+            if (less_than(mid, rhs)) {
+                low = mid + 1;
+            } else {
+                high = mid;
+            }
+        }
+        return low;
     }
 
     bool less_than(size_t lhs_row, const ComparableChunk& rhs) {
-        int r = compare_chunk(_key_columns, _sort_key_idxes, *_chunk, lhs_row, *rhs._chunk, rhs._compared_row,
-                              _merge_condition);
+        int r = compare_chunk(_key_columns, *_sort_key_idxes, *_chunk, lhs_row, *rhs._chunk, rhs._compared_row,
+                              *_merge_condition);
         return (r < 0) | ((r == 0) & (_order < rhs._order));
     }
 
@@ -126,8 +147,8 @@ private:
     // used to determinate the order of two rows when their key columns are all equals.
     uint16_t _order;
     uint16_t _key_columns;
-    std::vector<uint32_t> _sort_key_idxes;
-    std::string _merge_condition;
+    const std::vector<uint32_t>* _sort_key_idxes;
+    const std::string* _merge_condition;
     std::shared_ptr<std::vector<uint64_t>> _rssid_rowids;
 };
 
@@ -216,7 +237,8 @@ inline void MergeIterator::close() {
 
 class HeapMergeIterator final : public MergeIterator {
 public:
-    explicit HeapMergeIterator(std::vector<ChunkIteratorPtr> children) : MergeIterator(std::move(children)) {}
+    explicit HeapMergeIterator(std::vector<ChunkIteratorPtr> children)
+            : MergeIterator(std::move(children)), _sort_key_idxes(_schema.sort_key_idxes()) {}
 
     std::string merge_condition;
 
@@ -241,6 +263,7 @@ private:
     using ChunkHeap = MinPriorityQueue<ComparableChunk>;
 
     ChunkHeap _heap;
+    const std::vector<uint32_t> _sort_key_idxes;
 };
 
 inline Status HeapMergeIterator::do_get_next(Chunk* chunk, std::vector<RowSourceMask>* source_masks,
@@ -353,11 +376,10 @@ inline Status HeapMergeIterator::fill(size_t child) {
                     "Merge iterator only supports merging chunks with rows less than $0", max_merge_chunk_size));
         }
         if (need_rssid_rowids) {
-            _heap.push(ComparableChunk{chunk, child, _schema.num_key_fields(), _schema.sort_key_idxes(),
-                                       merge_condition, std::move(rssid_rowids)});
+            _heap.push(ComparableChunk{chunk, child, _schema.num_key_fields(), &_sort_key_idxes, &merge_condition,
+                                       std::move(rssid_rowids)});
         } else {
-            _heap.push(
-                    ComparableChunk{chunk, child, _schema.num_key_fields(), _schema.sort_key_idxes(), merge_condition});
+            _heap.push(ComparableChunk{chunk, child, _schema.num_key_fields(), &_sort_key_idxes, &merge_condition});
         }
     } else if (st.is_end_of_file()) {
         // ignore Status::EndOfFile.
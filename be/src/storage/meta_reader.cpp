@@ -371,7 +371,8 @@ Status SegmentMetaCollecter::__collect_max_or_min(ColumnId cid, Column* column,
     TypeInfoPtr type_info = get_type_info(delegate_type(type));
     if constexpr (!is_max) { // min
         Datum min;
-        if (!segment_zone_map_pb->has_null()) {
+        // nulls are not part of the zone map range, the min of the non-null values is the result of MIN
+        if (segment_zone_map_pb->has_not_null()) {
             RETURN_IF_ERROR(datum_from_string(type_info.get(), &min, segment_zone_map_pb->min(), nullptr));
             column->append_datum(min);
         } else {
@@ -264,6 +264,8 @@ struct OlapReaderStatistics {
 
     int64_t total_pages_num = 0;
     int64_t cached_pages_num = 0;
+    // pages missed by the page cache but found in its compressed tier
+    int64_t compressed_cached_pages_num = 0;
 
     int64_t rows_bitmap_index_filtered = 0;
     int64_t bitmap_index_filter_timer = 0;
@@ -305,6 +307,10 @@ struct OlapReaderStatistics {
     int64_t prefetch_hit_count = 0;
     int64_t prefetch_wait_finish_ns = 0;
     int64_t prefetch_pending_ns = 0;
+    // pages read ahead by the coalesced io streams of the column files
+    int64_t io_coalesce_prefetch_count = 0;
+    int64_t io_coalesce_prefetch_bytes = 0;
+    int64_t io_coalesce_prefetch_wait_ns = 0;
     // ------ for lake tablet ------
 
     // ------ for json type, to count flat column ------
@@ -14,6 +14,10 @@
 
 #include "storage/persistent_index.h"
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
 #include <cstring>
 #include <numeric>
 #include <utility>
@@ -60,6 +64,9 @@ constexpr size_t kPackSize = 16;
 constexpr size_t kBucketSizeMax = 256;
 constexpr size_t kFixedMaxKeySize = 128;
 constexpr size_t kBatchBloomFilterReadSize = 4ULL << 20;
+constexpr size_t kMaxCoalescedPageReadBytes = 1ULL << 20;
+// how many keys ahead the batch operations of FixedMutableIndex prefetch the hash slots
+constexpr size_t kL0PrefetchDistance = 16;
 constexpr uint32_t kMutableIndexFormatVersion1 = 1;
 constexpr uint32_t kMutableIndexFormatVersion2 = 2;
 // The introduction of this magic number serves two purposes:
@@ -816,9 +823,13 @@ public:
                const std::vector<size_t>& idxes) const override {
         TRY_CATCH_BAD_ALLOC({
             size_t nfound = 0;
-            for (const auto idx : idxes) {
+            std::vector<uint64_t> hashes;
+            _hash_and_prefetch(keys, idxes, &hashes);
+            for (size_t i = 0; i < idxes.size(); i++) {
+                const auto idx = idxes[i];
                 const auto& key = *reinterpret_cast<const KeyType*>(keys[idx].data);
-                uint64_t hash = FixedKeyHash<KeySize>()(key);
+                uint64_t hash = hashes[i];
+                _prefetch_ahead(hashes, i);
                 auto iter = _map.find(key, hash);
                 if (iter == _map.end()) {
                     values[idx] = NullIndexValue;
@@ -837,10 +848,14 @@ public:
                   size_t* num_found, const std::vector<size_t>& idxes) override {
         TRY_CATCH_BAD_ALLOC({
             size_t nfound = 0;
-            for (const auto idx : idxes) {
+            std::vector<uint64_t> hashes;
+            _hash_and_prefetch(keys, idxes, &hashes);
+            for (size_t i = 0; i < idxes.size(); i++) {
+                const auto idx = idxes[i];
                 const auto& key = *reinterpret_cast<const KeyType*>(keys[idx].data);
                 const auto value = values[idx];
-                uint64_t hash = FixedKeyHash<KeySize>()(key);
+                uint64_t hash = hashes[i];
+                _prefetch_ahead(hashes, i);
                 if (auto [it, inserted] = _map.emplace_with_hash(hash, key, value); inserted) {
                     not_found->key_infos.emplace_back((uint32_t)idx, hash);
                 } else {
@@ -859,10 +874,14 @@ public:
                   const std::vector<size_t>& idxes) override {
         TRY_CATCH_BAD_ALLOC({
             size_t nfound = 0;
-            for (const auto idx : idxes) {
+            std::vector<uint64_t> hashes;
+            _hash_and_prefetch(keys, idxes, &hashes);
+            for (size_t i = 0; i < idxes.size(); i++) {
+                const auto idx = idxes[i];
                 const auto& key = *reinterpret_cast<const KeyType*>(keys[idx].data);
                 const auto value = values[idx];
-                uint64_t hash = FixedKeyHash<KeySize>()(key);
+                uint64_t hash = hashes[i];
+                _prefetch_ahead(hashes, i);
                 if (auto [it, inserted] = _map.emplace_with_hash(hash, key, value); inserted) {
                     not_found->key_infos.emplace_back((uint32_t)idx, hash);
                 } else {
@@ -1117,6 +1136,23 @@ public:
     void set_mutable_index_format_version(uint32_t ver) override { _mutable_index_format_version = ver; }
 
 private:
+    // Hash all the keys of a batch first, so that the slot of a key can be prefetched some keys before it is probed.
+    void _hash_and_prefetch(const Slice* keys, const std::vector<size_t>& idxes, std::vector<uint64_t>* hashes) const {
+        hashes->resize(idxes.size());
+        for (size_t i = 0; i < idxes.size(); i++) {
+            (*hashes)[i] = FixedKeyHash<KeySize>()(*reinterpret_cast<const KeyType*>(keys[idxes[i]].data));
+        }
+        for (size_t i = 0; i < std::min(kL0PrefetchDistance, hashes->size()); i++) {
+            _map.prefetch_hash((*hashes)[i]);
+        }
+    }
+
+    void _prefetch_ahead(const std::vector<uint64_t>& hashes, size_t i) const {
+        if (i + kL0PrefetchDistance < hashes.size()) {
+            _map.prefetch_hash(hashes[i + kL0PrefetchDistance]);
+        }
+    }
+
     phmap::flat_hash_map<KeyType, IndexValue, FixedKeyHash<KeySize>> _map;
     uint32_t _mutable_index_format_version = kMutableIndexFormatVersion2;
 };
@@ -2472,7 +2508,7 @@ Status ImmutableIndex::_get_kvs_for_shard(std::vector<std::vector<KVRef>>& kvs_b
         return Status::OK();
     }
     *shard = std::make_unique<ImmutableIndexShard>(shard_info.npage, shard_info.page_size);
-    RETURN_IF_ERROR(_file->read_at_fully(shard_info.offset, (*shard)->data(), shard_info.bytes));
+    RETURN_IF_ERROR(_read_at(shard_info.offset, (*shard)->data(), shard_info.bytes));
     RETURN_IF_ERROR((*shard)->decompress_pages(_compression_type, shard_info.npage, shard_info.uncompressed_size,
                                                shard_info.bytes, shard_info.page_off));
     if (shard_info.key_size != 0) {
@@ -2548,7 +2584,8 @@ Status ImmutableIndex::_get_in_varlen_shard(size_t shard_idx, size_t n, const Sl
     return Status::OK();
 }
 
-bool ImmutableIndex::_filter(size_t shard_idx, std::vector<KeyInfo>& keys_info, std::vector<KeyInfo>* res) const {
+bool ImmutableIndex::_filter(size_t shard_idx, const std::vector<KeyInfo>& keys_info,
+                             std::vector<KeyInfo>* res) const {
     // add configure enable_pindex_filter, if there are some bug exists, set it to false
     if (!config::enable_pindex_filter || _bf_off.empty()) {
         return false;
@@ -2574,7 +2611,7 @@ bool ImmutableIndex::_filter(size_t shard_idx, std::vector<KeyInfo>& keys_info,
     size_t len = _bf_off[shard_idx + 1] - off;
     std::string bf_buff;
     raw::stl_string_resize_uninitialized(&bf_buff, len);
-    Status st = _file->read_at_fully(off, bf_buff.data(), bf_buff.size());
+    Status st = _read_at(off, bf_buff.data(), bf_buff.size());
     if (!st.ok()) {
         LOG(WARNING) << "shard_idx: " << shard_idx << "read bloom filter failed, " << st;
         return false;
@@ -2623,11 +2660,11 @@ Status ImmutableIndex::_read_page(size_t shard_idx, size_t pageid, LargeIndexPag
     const auto& shard_info = _shards[shard_idx];
     IndexPage compressed_page;
     if (_compression_type == CompressionTypePB::NO_COMPRESSION) {
-        RETURN_IF_ERROR(_file->read_at_fully(shard_info.offset + shard_info.page_size * pageid, page->data(),
-                                             shard_info.page_size));
+        RETURN_IF_ERROR(_read_at(shard_info.offset + shard_info.page_size * pageid, page->data(),
+                                 shard_info.page_size));
     } else {
-        RETURN_IF_ERROR(_file->read_at_fully(shard_info.offset + shard_info.page_off[pageid], compressed_page.data,
-                                             shard_info.page_off[pageid + 1] - shard_info.page_off[pageid]));
+        RETURN_IF_ERROR(_read_at(shard_info.offset + shard_info.page_off[pageid], compressed_page.data,
+                                 shard_info.page_off[pageid + 1] - shard_info.page_off[pageid]));
         const BlockCompressionCodec* codec = nullptr;
         RETURN_IF_ERROR(get_block_compression_codec(_compression_type, &codec));
         Slice compressed_body((uint8_t*)compressed_page.data,
@@ -2644,13 +2681,66 @@ Status ImmutableIndex::_read_page(size_t shard_idx, size_t pageid, LargeIndexPag
     return Status::OK();
 }
 
+Status ImmutableIndex::_read_pages(size_t shard_idx, const std::map<size_t, std::vector<KeyInfo>>& keys_info_by_page,
+                                  std::map<size_t, LargeIndexPage>* pages, IOStat* stat) const {
+    const auto& shard_info = _shards[shard_idx];
+    auto page_offset = [&](size_t pageid) {
+        return _compression_type == CompressionTypePB::NO_COMPRESSION ? shard_info.page_size * pageid
+                                                                      : shard_info.page_off[pageid];
+    };
+    // Pages with consecutive ids are adjacent in the file, read each run of them with one IO
+    // instead of one IO per page.
+    auto iter = keys_info_by_page.begin();
+    while (iter != keys_info_by_page.end()) {
+        size_t first = iter->first;
+        size_t last = first;
+        for (++iter; iter != keys_info_by_page.end() && iter->first == last + 1 &&
+                     page_offset(iter->first + 1) - page_offset(first) <= kMaxCoalescedPageReadBytes;
+             ++iter) {
+            last = iter->first;
+        }
+        if (first == last) {
+            LargeIndexPage page(shard_info.page_size / kPageSize);
+            RETURN_IF_ERROR(_read_page(shard_idx, first, &page, stat));
+            (*pages)[first] = std::move(page);
+            continue;
+        }
+        size_t begin = page_offset(first);
+        size_t bytes = page_offset(last + 1) - begin;
+        std::string buff;
+        raw::stl_string_resize_uninitialized(&buff, bytes);
+        RETURN_IF_ERROR(_read_at(shard_info.offset + begin, buff.data(), bytes));
+        const BlockCompressionCodec* codec = nullptr;
+        if (_compression_type != CompressionTypePB::NO_COMPRESSION) {
+            RETURN_IF_ERROR(get_block_compression_codec(_compression_type, &codec));
+        }
+        for (size_t pageid = first; pageid <= last; pageid++) {
+            LargeIndexPage page(shard_info.page_size / kPageSize);
+            const char* page_data = buff.data() + page_offset(pageid) - begin;
+            if (codec == nullptr) {
+                memcpy(page.data(), page_data, shard_info.page_size);
+            } else {
+                Slice compressed_body(page_data, page_offset(pageid + 1) - page_offset(pageid));
+                Slice decompressed_body((uint8_t*)page.data(), shard_info.page_size);
+                RETURN_IF_ERROR(codec->decompress(compressed_body, &decompressed_body));
+            }
+            (*pages)[pageid] = std::move(page);
+        }
+        if (stat != nullptr) {
+            stat->read_iops++;
+            stat->read_io_bytes += bytes;
+        }
+    }
+    return Status::OK();
+}
+
 Status ImmutableIndex::_get_in_fixlen_shard_by_page(size_t shard_idx, size_t n, const Slice* keys, IndexValue* values,
                                                     KeysInfo* found_keys_info,
                                                     std::map<size_t, std::vector<KeyInfo>>& keys_info_by_page,
                                                     std::map<size_t, LargeIndexPage>& pages) const {
     const auto& shard_info = _shards[shard_idx];
     uint8_t candidate_idxes[kBucketSizeMax];
-    for (auto [_, keys_info] : keys_info_by_page) {
+    for (const auto& [_, keys_info] : keys_info_by_page) {
         for (size_t i = 0; i < keys_info.size(); i++) {
             IndexHash h(keys_info[i].second);
             auto pageid = h.page() % shard_info.npage;
@@ -2698,7 +2788,7 @@ Status ImmutableIndex::_get_in_varlen_shard_by_page(size_t shard_idx, size_t n,
                                                     std::map<size_t, LargeIndexPage>& pages) const {
     const auto& shard_info = _shards[shard_idx];
     uint8_t candidate_idxes[kBucketSizeMax];
-    for (auto [_, keys_info] : keys_info_by_page) {
+    for (const auto& [_, keys_info] : keys_info_by_page) {
         for (size_t i = 0; i < keys_info.size(); i++) {
             IndexHash h(keys_info[i].second);
             auto pageid = h.page() % shard_info.npage;
@@ -2749,11 +2839,7 @@ Status ImmutableIndex::_get_in_shard_by_page(size_t shard_idx, size_t n, const S
                                              IOStat* stat) const {
     const auto& shard_info = _shards[shard_idx];
     std::map<size_t, LargeIndexPage> pages;
-    for (auto [pageid, keys_info] : keys_info_by_page) {
-        LargeIndexPage page(shard_info.page_size / kPageSize);
-        RETURN_IF_ERROR(_read_page(shard_idx, pageid, &page, stat));
-        pages[pageid] = std::move(page);
-    }
+    RETURN_IF_ERROR(_read_pages(shard_idx, keys_info_by_page, &pages, stat));
     if (shard_info.key_size != 0) {
         return _get_in_fixlen_shard_by_page(shard_idx, n, keys, values, found_keys_info, keys_info_by_page, pages);
     } else {
@@ -2772,7 +2858,7 @@ Status ImmutableIndex::pk_dump(PrimaryKeyDump* dump, PrimaryIndexDumpPB* dump_pb
             continue;
         }
         shard_ptrs[shard_idx] = std::make_unique<ImmutableIndexShard>(shard_info.npage, shard_info.page_size);
-        RETURN_IF_ERROR(_file->read_at_fully(shard_info.offset, shard_ptrs[shard_idx]->data(), shard_info.bytes));
+        RETURN_IF_ERROR(_read_at(shard_info.offset, shard_ptrs[shard_idx]->data(), shard_info.bytes));
         RETURN_IF_ERROR(shard_ptrs[shard_idx]->decompress_pages(_compression_type, shard_info.npage,
                                                                 shard_info.uncompressed_size, shard_info.bytes,
                                                                 shard_info.page_off));
@@ -2834,7 +2920,7 @@ Status ImmutableIndex::_get_in_shard(size_t shard_idx, size_t n, const Slice* ke
         RETURN_ERROR_IF_FALSE(shard->npage() * shard_info.page_size == shard_info.uncompressed_size,
                               "illegal shard size");
     }
-    RETURN_IF_ERROR(_file->read_at_fully(shard_info.offset, shard->data(), shard_info.bytes));
+    RETURN_IF_ERROR(_read_at(shard_info.offset, shard->data(), shard_info.bytes));
     RETURN_IF_ERROR(shard->decompress_pages(_compression_type, shard_info.npage, shard_info.uncompressed_size,
                                             shard_info.bytes, shard_info.page_off));
     if (stat != nullptr) {
@@ -2912,6 +2998,15 @@ Status ImmutableIndex::_check_not_exist_in_shard(size_t shard_idx, size_t n, con
     if (shard_info.size == 0 || keys_info.size() == 0) {
         return Status::OK();
     }
+    // keys of an insert-only batch are mostly absent, the bloom filter saves reading the whole shard for them
+    KeysInfo filtered_keys_info;
+    const KeysInfo* check_keys_info = &keys_info;
+    if (_filter(shard_idx, keys_info.key_infos, &filtered_keys_info.key_infos)) {
+        if (filtered_keys_info.size() == 0) {
+            return Status::OK();
+        }
+        check_keys_info = &filtered_keys_info;
+    }
     std::unique_ptr<ImmutableIndexShard> shard =
             std::make_unique<ImmutableIndexShard>(shard_info.npage, shard_info.page_size);
     if (shard_info.uncompressed_size == 0) {
@@ -2920,13 +3015,13 @@ Status ImmutableIndex::_check_not_exist_in_shard(size_t shard_idx, size_t n, con
         RETURN_ERROR_IF_FALSE(shard->npage() * shard_info.page_size == shard_info.uncompressed_size,
                               "illegal shard size");
     }
-    RETURN_IF_ERROR(_file->read_at_fully(shard_info.offset, shard->data(), shard_info.bytes));
+    RETURN_IF_ERROR(_read_at(shard_info.offset, shard->data(), shard_info.bytes));
     RETURN_IF_ERROR(shard->decompress_pages(_compression_type, shard_info.npage, shard_info.uncompressed_size,
                                             shard_info.bytes, shard_info.page_off));
     if (shard_info.key_size != 0) {
-        return _check_not_exist_in_fixlen_shard(shard_idx, n, keys, keys_info, &shard);
+        return _check_not_exist_in_fixlen_shard(shard_idx, n, keys, *check_keys_info, &shard);
     } else {
-        return _check_not_exist_in_varlen_shard(shard_idx, n, keys, keys_info, &shard);
+        return _check_not_exist_in_varlen_shard(shard_idx, n, keys, *check_keys_info, &shard);
     }
 }
 
@@ -2955,7 +3050,7 @@ bool ImmutableIndex::_need_bloom_filter(size_t idx_begin, size_t idx_end,
     size_t read_shard_bytes = 0;
     for (size_t i = 0; i < keys_info_by_shard.size(); i++) {
         if (!keys_info_by_shard[i].key_infos.empty()) {
-            read_shard_bytes += _shards[i].bytes;
+            read_shard_bytes += _shards[idx_begin + i].bytes;
         }
     }
     return bf_bytes * config::max_bf_read_bytes_percent <= read_shard_bytes;
@@ -2995,7 +3090,7 @@ Status ImmutableIndex::_prepare_bloom_filter(size_t idx_begin, size_t idx_end) c
             size_t bytes = _bf_off[start_idx + num] - offset;
             std::string buff;
             raw::stl_string_resize_uninitialized(&buff, bytes);
-            RETURN_IF_ERROR(_file->read_at_fully(offset, buff.data(), buff.size()));
+            RETURN_IF_ERROR(_read_at(offset, buff.data(), buff.size()));
             for (size_t i = 0; i < num; i++) {
                 size_t buff_off = _bf_off[start_idx + i] - _bf_off[start_idx];
                 size_t buff_size = _bf_off[start_idx + i + 1] - _bf_off[start_idx + i];
@@ -3017,7 +3112,7 @@ Status ImmutableIndex::_prepare_bloom_filter(size_t idx_begin, size_t idx_end) c
         size_t bytes = _bf_off[start_idx + num] - offset;
         std::string buff;
         raw::stl_string_resize_uninitialized(&buff, bytes);
-        RETURN_IF_ERROR(_file->read_at_fully(offset, buff.data(), buff.size()));
+        RETURN_IF_ERROR(_read_at(offset, buff.data(), buff.size()));
         for (size_t i = 0; i < num; i++) {
             size_t buff_off = _bf_off[start_idx + i] - _bf_off[start_idx];
             size_t buff_size = _bf_off[start_idx + i + 1] - _bf_off[start_idx + i];
@@ -3082,6 +3177,10 @@ Status ImmutableIndex::check_not_exist(size_t n, const Slice* keys, size_t key_s
         auto shard = h.shard(shard_bits);
         keys_info_by_shard[shard].key_infos.emplace_back(i, h.hash);
     }
+    if (nshard > 1 ? _need_bloom_filter(shard_off, shard_off + nshard, keys_info_by_shard)
+                   : config::enable_pindex_filter && StorageEngine::instance()->update_manager()->keep_pindex_bf()) {
+        RETURN_IF_ERROR(_prepare_bloom_filter(shard_off, shard_off + nshard));
+    }
     for (size_t i = 0; i < nshard; i++) {
         RETURN_IF_ERROR(_check_not_exist_in_shard(shard_off + i, n, keys, keys_info_by_shard[i]));
     }
@@ -3089,6 +3188,74 @@ Status ImmutableIndex::check_not_exist(size_t n, const Slice* keys, size_t key_s
 }
 
 DEFINE_FAIL_POINT(immutable_index_no_page_off);
+ImmutableIndex::~ImmutableIndex() {
+    _unmap();
+}
+
+void ImmutableIndex::_try_mmap() {
+    // only local files without a scheme can be mapped
+    if (!config::enable_pindex_mmap_read || _file == nullptr || _file->filename().find("://") != std::string::npos) {
+        return;
+    }
+    auto file_size = _file->get_size();
+    if (!file_size.ok() || *file_size == 0) {
+        return;
+    }
+    int fd = ::open(_file->filename().c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        LOG(WARNING) << "open " << _file->filename() << " for mmap failed: " << std::strerror(errno);
+        return;
+    }
+    // the mapping keeps the file referenced, the fd is not needed after mmap
+    void* addr = ::mmap(nullptr, *file_size, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (addr == MAP_FAILED) {
+        LOG(WARNING) << "mmap " << _file->filename() << " failed: " << std::strerror(errno);
+        return;
+    }
+    // probes touch a few pages of a shard, readahead around them is wasted
+    ::madvise(addr, *file_size, MADV_RANDOM);
+    _mmap_data = reinterpret_cast<const uint8_t*>(addr);
+    _mmap_size = *file_size;
+}
+
+void ImmutableIndex::_unmap() {
+    if (_mmap_data != nullptr) {
+        ::munmap(const_cast<uint8_t*>(_mmap_data), _mmap_size);
+        _mmap_data = nullptr;
+        _mmap_size = 0;
+    }
+}
+
+Status ImmutableIndex::_read_at(uint64_t offset, void* data, size_t size) const {
+    if (_mmap_data == nullptr) {
+        return _file->read_at_fully(offset, data, size);
+    }
+    if (offset + size > _mmap_size) {
+        return Status::Corruption(strings::Substitute("read $0 out of bound, offset: $1, size: $2, file size: $3",
+                                                      _file->filename(), offset, size, _mmap_size));
+    }
+    memcpy(data, _mmap_data + offset, size);
+    return Status::OK();
+}
+
+size_t ImmutableIndex::mmap_resident_bytes() const {
+    if (_mmap_data == nullptr) {
+        return 0;
+    }
+    const size_t page_size = ::sysconf(_SC_PAGESIZE);
+    const size_t npage = (_mmap_size + page_size - 1) / page_size;
+    std::vector<unsigned char> residency(npage);
+    if (::mincore(const_cast<uint8_t*>(_mmap_data), _mmap_size, residency.data()) != 0) {
+        return 0;
+    }
+    size_t resident = 0;
+    for (auto r : residency) {
+        resident += (r & 1);
+    }
+    return std::min(resident * page_size, _mmap_size);
+}
+
 StatusOr<std::unique_ptr<ImmutableIndex>> ImmutableIndex::load(std::unique_ptr<RandomAccessFile>&& file,
                                                                bool load_bf_data) {
     ASSIGN_OR_RETURN(auto file_size, file->get_size());
@@ -3257,6 +3424,7 @@ StatusOr<std::unique_ptr<ImmutableIndex>> ImmutableIndex::load(std::unique_ptr<R
     }
     idx->_file.swap(file);
     idx->_bf_off.swap(bf_off);
+    idx->_try_mmap();
     return std::move(idx);
 }
 
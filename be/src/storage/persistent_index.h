@@ -438,6 +438,8 @@ private:
 
 class ImmutableIndex {
 public:
+    ~ImmutableIndex();
+
     // batch get
     // |n|: size of key/value array
     // |keys|: key array as slice array
@@ -464,12 +466,14 @@ public:
     }
 
     void clear() {
+        _unmap();
         if (_file != nullptr) {
             _file.reset();
         }
     }
 
     void destroy() {
+        _unmap();
         if (_file != nullptr) {
             WARN_IF_ERROR(FileSystem::Default()->delete_file(_file->filename()),
                           "Failed to delete file" + _file->filename());
@@ -494,6 +498,9 @@ public:
         return size;
     }
 
+    // bytes of the mapped index file currently resident in the page cache, 0 if not mapped
+    size_t mmap_resident_bytes() const;
+
     size_t memory_usage() {
         size_t mem_usage = 0;
         for (auto& bf : _bf_vec) {
@@ -501,7 +508,7 @@ public:
                 mem_usage += bf->size();
             }
         }
-        return mem_usage;
+        return mem_usage + mmap_resident_bytes();
     }
 
     std::string filename() const {
@@ -561,6 +568,10 @@ private:
 
     Status _read_page(size_t shard_idx, size_t pageid, LargeIndexPage* page, IOStat* stat) const;
 
+    // read the pages of `keys_info_by_page`, coalescing the reads of adjacent pages
+    Status _read_pages(size_t shard_idx, const std::map<size_t, std::vector<KeyInfo>>& keys_info_by_page,
+                       std::map<size_t, LargeIndexPage>* pages, IOStat* stat) const;
+
     Status _get_in_shard_by_page(size_t shard_idx, size_t n, const Slice* keys, IndexValue* values,
                                  KeysInfo* found_keys_info, std::map<size_t, std::vector<KeyInfo>>& keys_info_by_page,
                                  IOStat* stat) const;
@@ -580,9 +591,20 @@ private:
 
     Status _prepare_bloom_filter(size_t idx_begin, size_t idx_end) const;
 
-    bool _filter(size_t shard_idx, std::vector<KeyInfo>& keys_info, std::vector<KeyInfo>* res) const;
+    bool _filter(size_t shard_idx, const std::vector<KeyInfo>& keys_info, std::vector<KeyInfo>* res) const;
+
+    // map the index file read-only when `enable_pindex_mmap_read` is set, fallback to pread on failure
+    void _try_mmap();
+
+    void _unmap();
+
+    // read `size` bytes at `offset`, copied from the mapping if the file is mapped
+    Status _read_at(uint64_t offset, void* data, size_t size) const;
 
     std::unique_ptr<RandomAccessFile> _file;
+    // the whole index file mapped by `_try_mmap`, nullptr if not mapped
+    const uint8_t* _mmap_data = nullptr;
+    size_t _mmap_size = 0;
     EditVersion _version;
     size_t _size = 0;
 
@@ -67,6 +67,12 @@ private:
 
 void PersistentIndexCompactionManager::schedule(const std::function<std::vector<TabletAndScore>()>& pick_algo) {
     update_ready_tablet_queue(pick_algo);
+    if (!_ready_tablets_queue.empty() && io_busy()) {
+        // keep the queue, tablets will be submitted once disk io calms down.
+        VLOG(1) << strings::Substitute("skip pk index compaction schedule, max disk io util: $0%",
+                                       StarRocksMetrics::instance()->max_disk_io_util_percent.value());
+        return;
+    }
     for (auto it = _ready_tablets_queue.begin(); it != _ready_tablets_queue.end();) {
         auto& tablet_score = *it;
         auto tablet_id = tablet_score.first;
@@ -126,6 +132,11 @@ bool PersistentIndexCompactionManager::disk_limit(DataDir* data_dir) {
     return _data_dir_to_task_num_map[data_dir] >= std::max(1, config::pindex_major_compaction_limit_per_disk);
 }
 
+bool PersistentIndexCompactionManager::io_busy() {
+    const int32_t limit = config::pindex_major_compaction_max_disk_io_util_percent;
+    return limit > 0 && StarRocksMetrics::instance()->max_disk_io_util_percent.value() >= limit;
+}
+
 Status PersistentIndexCompactionManager::update_max_threads(int max_threads) {
     if (_worker_thread_pool != nullptr) {
         RETURN_IF_ERROR(_worker_thread_pool->update_max_threads(max_threads));
@@ -49,6 +49,8 @@ public:
     bool is_running(int64_t tablet_id);
     // Is tablet's disk out of concurrency limit
     bool disk_limit(DataDir* data_dir);
+    // Are the disks too busy to start new compaction, see `pindex_major_compaction_max_disk_io_util_percent`
+    bool io_busy();
 
 protected:
     std::mutex _mutex;
@@ -136,7 +136,7 @@ Status ArrayColumnIterator::next_batch_null_offsets(const SparseRange<>& range,
         size_t element_ordinal = _array_size_iterator->element_ordinal();
         // if array column in nullable or element of array is empty, element_range may be empty.
         // so we should reseek the element_ordinal
-        if (element_range->span_size() == 0) {
+        if (_access_values && element_range->span_size() == 0) {
             RETURN_IF_ERROR(_element_iterator->seek_to_ordinal(element_ordinal));
         }
         // 2. Read offset column
@@ -214,6 +214,7 @@ Status ArrayColumnIterator::fetch_values_by_rowid(const rowid_t* rowids, size_t
     auto* offsets = array_column->offsets_column().get();
     offsets->reserve(offsets->size() + array_size.size());
     size_t offset = offsets->get_data().back();
+    size_t start = offset;
     for (size_t i = 0; i < array_size.size(); ++i) {
         offset += array_size.get_data()[i];
         offsets->append(offset);
@@ -234,15 +235,8 @@ Status ArrayColumnIterator::fetch_values_by_rowid(const rowid_t* rowids, size_t
             array_column->elements_column() = ConstColumn::create(array_column->elements_column());
         }
 
-        size_t size_to_read = 0;
-        for (size_t i = 0; i < size; ++i) {
-            RETURN_IF_ERROR(_array_size_iterator->seek_to_ordinal_and_calc_element_ordinal(rowids[i]));
-            size_t element_ordinal = _array_size_iterator->element_ordinal();
-            RETURN_IF_ERROR(_element_iterator->seek_to_ordinal(element_ordinal));
-            size_to_read += array_size.get_data()[i];
-        }
-
-        array_column->elements_column()->append_default(size_to_read);
+        // only the offsets are accessed, no need to seek the element iterator
+        array_column->elements_column()->append_default(offset - start);
     }
 
     return Status::OK();
@@ -253,7 +247,9 @@ Status ArrayColumnIterator::seek_to_first() {
         RETURN_IF_ERROR(_null_iterator->seek_to_first());
     }
     RETURN_IF_ERROR(_array_size_iterator->seek_to_first());
-    RETURN_IF_ERROR(_element_iterator->seek_to_first());
+    if (_access_values) {
+        RETURN_IF_ERROR(_element_iterator->seek_to_first());
+    }
     return Status::OK();
 }
 
@@ -262,8 +258,10 @@ Status ArrayColumnIterator::seek_to_ordinal(ordinal_t ord) {
         RETURN_IF_ERROR(_null_iterator->seek_to_ordinal(ord));
     }
     RETURN_IF_ERROR(_array_size_iterator->seek_to_ordinal_and_calc_element_ordinal(ord));
-    size_t element_ordinal = _array_size_iterator->element_ordinal();
-    RETURN_IF_ERROR(_element_iterator->seek_to_ordinal(element_ordinal));
+    if (_access_values) {
+        size_t element_ordinal = _array_size_iterator->element_ordinal();
+        RETURN_IF_ERROR(_element_iterator->seek_to_ordinal(element_ordinal));
+    }
     return Status::OK();
 }
 
@@ -36,6 +36,7 @@
 
 #include <memory>
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "gutil/casts.h"
 #include "gutil/strings/substitute.h" // for Substitute
@@ -119,16 +120,23 @@ faststring* BinaryDictPageBuilder::finish() {
 
 void BinaryDictPageBuilder::reset() {
     _finished = false;
-    if (_encoding_type == DICT_ENCODING && _dict_builder->is_page_full()) {
+    if (_encoding_type == DICT_ENCODING && (_dict_builder->is_page_full() || _page_mostly_new_values())) {
         _data_page_builder = std::make_unique<BinaryPlainPageBuilder>(_options);
         _data_page_builder->reserve_head(BINARY_DICT_PAGE_HEADER_SIZE);
         _encoding_type = PLAIN_ENCODING;
     } else {
         _data_page_builder->reset();
     }
+    _page_start_dict_size = _dictionary.size();
     _finished = false;
 }
 
+bool BinaryDictPageBuilder::_page_mostly_new_values() const {
+    uint32_t page_count = _data_page_builder->count();
+    size_t new_values = _dictionary.size() - _page_start_dict_size;
+    return page_count > 0 && new_values > page_count * config::dictionary_page_fallback_new_value_ratio;
+}
+
 uint32_t BinaryDictPageBuilder::count() const {
     return _data_page_builder->count();
 }
@@ -91,6 +91,10 @@ public:
     bool all_dict_encoded() const override { return _encoding_type == DICT_ENCODING; }
 
 private:
+    // Whether the data page just finished added more than dictionary_page_fallback_new_value_ratio of
+    // its values to the dictionary.
+    bool _page_mostly_new_values() const;
+
     struct HashOfSlice {
         // Enable heterogeneous lookup.
         typedef bool is_transparent;
@@ -115,6 +119,8 @@ private:
     std::unique_ptr<BinaryPlainPageBuilder> _dict_builder;
 
     EncodingTypePB _encoding_type;
+    // dictionary size when the current data page started
+    size_t _page_start_dict_size = 0;
     // query for dict item -> dict id
     phmap::flat_hash_map<std::string, uint32_t, HashOfSlice, Eq> _dictionary;
     faststring _first_value;
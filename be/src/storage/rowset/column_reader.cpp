@@ -73,6 +73,7 @@
 #include "storage/types.h"
 #include "types/logical_type.h"
 #include "util/bloom_filter.h"
+#include "util/json_flattener.h"
 #include "util/compression/block_compression.h"
 #include "util/rle_encoding.h"
 
@@ -401,6 +402,12 @@ Status ColumnReader::bloom_filter(const std::vector<const ColumnPredicate*>& pre
         }
     }
 
+    // the ngram options come from the index properties, resolve them once instead of for every page.
+    NgramBloomFilterReaderOptions ngram_options;
+    if constexpr (!is_original_bf) {
+        ngram_options = _get_reader_options_for_ngram();
+    }
+
     for (const auto& pid : page_ids) {
         std::unique_ptr<BloomFilter> bf;
         RETURN_IF_ERROR(bf_iter->read_bloom_filter(pid, &bf));
@@ -409,8 +416,7 @@ Status ColumnReader::bloom_filter(const std::vector<const ColumnPredicate*>& pre
             if constexpr (is_original_bf) {
                 return pred->support_original_bloom_filter() && pred->original_bloom_filter(bf.get());
             } else {
-                return pred->support_ngram_bloom_filter() &&
-                       pred->ngram_bloom_filter(bf.get(), _get_reader_options_for_ngram());
+                return pred->support_ngram_bloom_filter() && pred->ngram_bloom_filter(bf.get(), ngram_options);
             }
         });
         if (satisfy) {
@@ -816,6 +822,9 @@ StatusOr<std::unique_ptr<ColumnIterator>> ColumnReader::_new_json_iterator(Colum
             target_paths.emplace_back(p->absolute_path().substr(field_name.size() + 1));
             target_types.emplace_back(p->value_type().type);
         }
+        if (!path->is_from_compaction()) {
+            JsonPathAccessStats::instance()->record(target_paths);
+        }
     }
 
     if (!_is_flat_json) {
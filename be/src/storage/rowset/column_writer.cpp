@@ -233,6 +233,9 @@ public:
     // Speculate char/varchar encoding
     EncodingTypePB speculate_string_encoding(const BinaryColumn& bin_col);
 
+    // Speculate char/varchar encoding when dictionary encoding is not suitable
+    EncodingTypePB speculate_non_dict_string_encoding(const BinaryColumn& bin_col);
+
     Status finish_current_page() override { return _scalar_column_writer->finish_current_page(); };
 
     uint64_t estimate_buffer_size() override { return _scalar_column_writer->estimate_buffer_size(); };
@@ -308,13 +311,15 @@ StatusOr<std::unique_ptr<ColumnWriter>> ColumnWriter::create(const ColumnWriterO
                                                              const TabletColumn* column, WritableFile* wfile) {
     TypeInfoPtr type_info = get_type_info(*column);
     DCHECK(type_info.get() != nullptr);
-    if (is_string_type(delegate_type(column->type()))) {
+    // an encoding given by the client is used as is, otherwise it's speculated from the data
+    const bool speculate_encoding = opts.meta->encoding() == DEFAULT_ENCODING;
+    if (speculate_encoding && is_string_type(delegate_type(column->type()))) {
         ColumnWriterOptions str_opts = opts;
         str_opts.need_speculate_encoding = true;
         str_opts.field_name = column->name();
         auto column_writer = std::make_unique<ScalarColumnWriter>(str_opts, type_info, wfile);
         return std::make_unique<StringColumnWriter>(str_opts, std::move(type_info), std::move(column_writer));
-    } else if (enable_non_string_column_dict_encoding() &&
+    } else if (speculate_encoding && enable_non_string_column_dict_encoding() &&
                numeric_types_support_dict_encoding(delegate_type(column->type()))) {
         DCHECK(column->type() != TYPE_VARCHAR);
         DCHECK(column->type() != TYPE_CHAR);
@@ -878,7 +883,7 @@ inline EncodingTypePB StringColumnWriter::speculate_string_encoding(const Binary
             size_t hash = SliceHash()(bin_col.get_slice(i));
             hash_set.insert(hash);
             if (hash_set.size() > max_card) {
-                return PLAIN_ENCODING;
+                return speculate_non_dict_string_encoding(bin_col);
             }
         }
     }
@@ -886,6 +891,33 @@ inline EncodingTypePB StringColumnWriter::speculate_string_encoding(const Binary
     return DICT_ENCODING;
 }
 
+// High cardinality strings with long common prefixes between neighbours (URLs, paths) shrink a lot with
+// the front coding of the prefix page, which still supports seeking by its restart points.
+inline EncodingTypePB StringColumnWriter::speculate_non_dict_string_encoding(const BinaryColumn& bin_col) {
+    auto min_shared_ratio = config::string_prefix_encoding_min_shared_ratio;
+    if (min_shared_ratio <= 0) {
+        return PLAIN_ENCODING;
+    }
+    size_t total_bytes = 0;
+    size_t shared_bytes = 0;
+    Slice prev;
+    for (size_t i = 0; i < bin_col.size(); i++) {
+        Slice cur = bin_col.get_slice(i);
+        size_t max_shared = std::min(prev.size, cur.size);
+        size_t shared = 0;
+        while (shared < max_shared && prev.data[shared] == cur.data[shared]) {
+            shared++;
+        }
+        shared_bytes += shared;
+        total_bytes += cur.size;
+        prev = cur;
+    }
+    if (total_bytes > 0 && static_cast<double>(shared_bytes) >= static_cast<double>(total_bytes) * min_shared_ratio) {
+        return PREFIX_ENCODING;
+    }
+    return PLAIN_ENCODING;
+}
+
 Status StringColumnWriter::finish() {
     if (_is_speculated) {
         return _scalar_column_writer->finish();
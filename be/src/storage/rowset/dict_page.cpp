@@ -17,6 +17,7 @@
 #include <memory>
 #include <vector>
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "gutil/casts.h"
 #include "gutil/strings/substitute.h" // for Substitute
@@ -101,16 +102,24 @@ faststring* DictPageBuilder<Type>::finish() {
 template <LogicalType Type>
 void DictPageBuilder<Type>::reset() {
     _finished = false;
-    if (_encoding_type == DICT_ENCODING && _dict_builder->is_page_full()) {
+    if (_encoding_type == DICT_ENCODING && (_dict_builder->is_page_full() || _page_mostly_new_values())) {
         _data_page_builder = std::make_unique<BitshufflePageBuilder<Type>>(_options);
         _data_page_builder->reserve_head(BINARY_DICT_PAGE_HEADER_SIZE);
         _encoding_type = BIT_SHUFFLE;
     } else {
         _data_page_builder->reset();
     }
+    _page_start_dict_size = _dictionary.size();
     _finished = false;
 }
 
+template <LogicalType Type>
+bool DictPageBuilder<Type>::_page_mostly_new_values() const {
+    uint32_t page_count = _data_page_builder->count();
+    size_t new_values = _dictionary.size() - _page_start_dict_size;
+    return page_count > 0 && new_values > page_count * config::dictionary_page_fallback_new_value_ratio;
+}
+
 template <LogicalType Type>
 uint32_t DictPageBuilder<Type>::count() const {
     return _data_page_builder->count();
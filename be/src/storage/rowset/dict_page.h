@@ -102,6 +102,10 @@ public:
 private:
     enum { SIZE_OF_TYPE = TypeTraits<Type>::size };
 
+    // Whether the data page just finished added more than dictionary_page_fallback_new_value_ratio of
+    // its values to the dictionary.
+    bool _page_mostly_new_values() const;
+
     PageBuilderOptions _options;
     bool _finished;
 
@@ -110,6 +114,8 @@ private:
     std::unique_ptr<BitshufflePageBuilder<Type>> _dict_builder;
 
     EncodingTypePB _encoding_type;
+    // dictionary size when the current data page started
+    size_t _page_start_dict_size = 0;
     // query for dict item -> dict id
     phmap::flat_hash_map<ValueType, ValueCodeType> _dictionary;
     ValueType _first_value;
@@ -153,9 +153,9 @@ Status MapColumnIterator::next_batch(const SparseRange<>& range, Column* dst) {
     size_t read_rows = 0;
     RETURN_IF_ERROR(get_element_range_vec(range, map_column, true /* seek */, element_read_range, read_rows));
 
-    // if array column is nullable, element_read_range may be empty
-    DCHECK(element_read_range.empty() || (element_read_range.begin() == _keys->get_current_ordinal()));
     if (_access_keys) {
+        // if array column is nullable, element_read_range may be empty
+        DCHECK(element_read_range.empty() || (element_read_range.begin() == _keys->get_current_ordinal()));
         RETURN_IF_ERROR(_keys->next_batch(element_read_range, map_column->keys_column().get()));
     } else {
         if (!map_column->keys_column()->is_constant()) {
@@ -212,18 +212,18 @@ Status MapColumnIterator::fetch_values_by_rowid(const rowid_t* rowids, size_t si
     }
 
     // 3. Read elements
-    for (size_t i = 0; i < size; ++i) {
+    for (size_t i = 0; (_access_keys || _access_values) && i < size; ++i) {
         RETURN_IF_ERROR(_offsets->seek_to_ordinal_and_calc_element_ordinal(rowids[i]));
         size_t element_ordinal = _offsets->element_ordinal();
         size_t size_to_read = array_size.get_data()[i];
 
-        RETURN_IF_ERROR(_keys->seek_to_ordinal(element_ordinal));
         if (_access_keys) {
+            RETURN_IF_ERROR(_keys->seek_to_ordinal(element_ordinal));
             RETURN_IF_ERROR(_keys->next_batch(&size_to_read, map_column->keys_column().get()));
         }
 
-        RETURN_IF_ERROR(_values->seek_to_ordinal(element_ordinal));
         if (_access_values) {
+            RETURN_IF_ERROR(_values->seek_to_ordinal(element_ordinal));
             RETURN_IF_ERROR(_values->next_batch(&size_to_read, map_column->values_column().get()));
         }
     }
@@ -254,8 +254,12 @@ Status MapColumnIterator::seek_to_first() {
         RETURN_IF_ERROR(_nulls->seek_to_first());
     }
     RETURN_IF_ERROR(_offsets->seek_to_first());
-    RETURN_IF_ERROR(_keys->seek_to_first());
-    RETURN_IF_ERROR(_values->seek_to_first());
+    if (_access_keys) {
+        RETURN_IF_ERROR(_keys->seek_to_first());
+    }
+    if (_access_values) {
+        RETURN_IF_ERROR(_values->seek_to_first());
+    }
     return Status::OK();
 }
 
@@ -265,8 +269,12 @@ Status MapColumnIterator::seek_to_ordinal(ordinal_t ord) {
     }
     RETURN_IF_ERROR(_offsets->seek_to_ordinal_and_calc_element_ordinal(ord));
     size_t element_ordinal = _offsets->element_ordinal();
-    RETURN_IF_ERROR(_keys->seek_to_ordinal(element_ordinal));
-    RETURN_IF_ERROR(_values->seek_to_ordinal(element_ordinal));
+    if (_access_keys) {
+        RETURN_IF_ERROR(_keys->seek_to_ordinal(element_ordinal));
+    }
+    if (_access_values) {
+        RETURN_IF_ERROR(_values->seek_to_ordinal(element_ordinal));
+    }
     return Status::OK();
 }
 
@@ -287,8 +295,12 @@ Status MapColumnIterator::get_element_range_vec(const SparseRange<>& range, MapC
         // if array column in nullable or element of array is empty, element_read_range may be empty.
         // so we should reseek the element_ordinal
         if (seek && element_read_range.span_size() == 0) {
-            RETURN_IF_ERROR(_keys->seek_to_ordinal(element_ordinal));
-            RETURN_IF_ERROR(_values->seek_to_ordinal(element_ordinal));
+            if (_access_keys) {
+                RETURN_IF_ERROR(_keys->seek_to_ordinal(element_ordinal));
+            }
+            if (_access_values) {
+                RETURN_IF_ERROR(_values->seek_to_ordinal(element_ordinal));
+            }
         }
         // 2. Read offset column
         // [1, 2, 3], [4, 5, 6]
@@ -186,7 +186,20 @@ Status PageIO::read_and_decompress_page(const PageReadOptions& opts, PageHandle*
     std::unique_ptr<std::vector<uint8_t>> page(new std::vector<uint8_t>());
     raw::stl_vector_resize_uninitialized(page.get(), page_size + Column::APPEND_OVERFLOW_MAX_SIZE, page_size - 4);
     Slice page_slice(page->data(), page_size);
-    {
+    // the compressed tier holds the page as it is on disk, its checksum was verified when it was inserted
+    const bool use_compressed_tier = opts.use_page_cache && opts.codec != nullptr && cache->has_compressed_tier();
+    bool from_compressed_tier = false;
+    if (use_compressed_tier) {
+        PageCacheHandle compressed_handle;
+        if (cache->lookup_compressed(cache_key, &compressed_handle)) {
+            const auto* compressed_page = reinterpret_cast<const std::vector<uint8_t>*>(compressed_handle.data());
+            DCHECK_EQ(page_size, compressed_page->size());
+            memcpy(page_slice.data, compressed_page->data(), page_size);
+            from_compressed_tier = true;
+            opts.stats->compressed_cached_pages_num++;
+        }
+    }
+    if (!from_compressed_tier) {
         SCOPED_RAW_TIMER(&opts.stats->io_ns);
         // todo override is_cache_hit
         RETURN_IF_ERROR(opts.read_file->read_at_fully(opts.page_pointer.offset, page_slice.data, page_slice.size));
@@ -197,7 +210,7 @@ Status PageIO::read_and_decompress_page(const PageReadOptions& opts, PageHandle*
         ++opts.stats->io_count_request;
     }
 
-    if (opts.verify_checksum) {
+    if (opts.verify_checksum && !from_compressed_tier) {
         uint32_t expect = decode_fixed32_le((uint8_t*)page_slice.data + page_slice.size - 4);
         uint32_t actual = crc32c::Value(page_slice.data, page_slice.size - 4);
         if (expect != actual) {
@@ -223,6 +236,14 @@ Status PageIO::read_and_decompress_page(const PageReadOptions& opts, PageHandle*
             return Status::Corruption(strings::Substitute(
                     "Bad page: page is compressed but codec is NO_COMPRESSION, file=$0", opts.read_file->filename()));
         }
+        if (use_compressed_tier && !from_compressed_tier) {
+            // keep the compressed page, so it can be decompressed again after the decompressed page is evicted
+            auto compressed_page = std::make_unique<std::vector<uint8_t>>(page->data(), page->data() + page_size);
+            PageCacheHandle compressed_handle;
+            if (cache->insert_compressed(cache_key, compressed_page.get(), &compressed_handle).ok()) {
+                (void)compressed_page.release();
+            }
+        }
         SCOPED_RAW_TIMER(&opts.stats->decompress_ns);
         // Allocate APPEND_OVERFLOW_MAX_SIZE more bytes to make append_strings_overflow work
         std::unique_ptr<std::vector<uint8_t>> decompressed_page(new std::vector<uint8_t>());
@@ -16,6 +16,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <optional>
 #include <unordered_map>
 #include <utility>
 
@@ -29,6 +30,7 @@
 #include "gutil/casts.h"
 #include "gutil/stl_util.h"
 #include "io/shared_buffered_input_stream.h"
+#include "runtime/exec_env.h"
 #include "segment_options.h"
 #include "simd/simd.h"
 #include "storage/chunk_helper.h"
@@ -298,6 +300,9 @@ private:
 
     void _update_stats(io::SeekableInputStream* rfile);
 
+    // Index the newest delta column group file of every column in `_dcgs`.
+    void _init_dcg_column_locations();
+
     //  This function will search and build the segment from delta column group.
     StatusOr<std::shared_ptr<Segment>> _get_dcg_segment(uint32_t ucid);
 
@@ -325,6 +330,8 @@ private:
     Status _get_dcg_st;
     DelVectorPtr _del_vec;
     DeltaColumnGroupList _dcgs;
+    // column unique id -> (index in `_dcgs`, column file index in that dcg) of its newest version
+    std::unordered_map<ColumnUID, std::pair<uint32_t, int32_t>> _dcg_column_locations;
     roaring::api::roaring_uint32_iterator_t _roaring_iter;
 
     std::unordered_map<ColumnId, std::unique_ptr<io::SeekableInputStream>> _column_files;
@@ -466,6 +473,9 @@ SegmentIterator::SegmentIterator(std::shared_ptr<Segment> segment, Schema schema
             RowsetId rowsetid = _opts.rowsetid;
             _get_dcg_st = _opts.dcg_loader->load(tablet_id, rowsetid, segment_id(), INT64_MAX, &_dcgs);
         }
+        if (_get_dcg_st.ok()) {
+            _init_dcg_column_locations();
+        }
     }
 }
 
@@ -611,18 +621,25 @@ Status SegmentIterator::_get_row_ranges_by_vector_index() {
     std::vector<int64_t> result_ids;
     std::vector<float> result_distances;
     std::vector<int64_t> filtered_result_ids;
-    DelIdFilter del_id_filter(_scan_range);
+    // The rows left by the previous index filters and the delete vector are passed to the search as an
+    // allow-list. When nothing was filtered, every id is a member and the allow-list is skipped.
+    std::optional<DelIdFilter> del_id_filter;
+    tenann::IdFilter* id_filter = nullptr;
+    if (_scan_range.span_size() < num_rows()) {
+        del_id_filter.emplace(_scan_range);
+        id_filter = &del_id_filter.value();
+    }
 
     {
         SCOPED_RAW_TIMER(&_opts.stats->vector_search_timer);
         if (_vector_range >= 0) {
-            st = _ann_reader->range_search(_query_view, _k, &result_ids, &result_distances, &del_id_filter,
+            st = _ann_reader->range_search(_query_view, _k, &result_ids, &result_distances, id_filter,
                                            static_cast<float>(_vector_range), _result_order);
         } else {
             result_ids.resize(_k);
             result_distances.resize(_k);
             st = _ann_reader->search(_query_view, _k, (result_ids.data()),
-                                     reinterpret_cast<uint8_t*>(result_distances.data()), &del_id_filter);
+                                     reinterpret_cast<uint8_t*>(result_distances.data()), id_filter);
         }
     }
 
@@ -717,22 +734,32 @@ Status SegmentIterator::_try_to_update_ranges_by_runtime_filter() {
             false, _opts.stats->raw_rows_read);
 }
 
-StatusOr<std::shared_ptr<Segment>> SegmentIterator::_get_dcg_segment(uint32_t ucid) {
-    // iterate dcg from new ver to old ver
-    for (const auto& dcg : _dcgs) {
-        // cols file index -> column index in corresponding file
-        std::pair<int32_t, int32_t> idx = dcg->get_column_idx(ucid);
-        if (idx.first >= 0) {
-            ASSIGN_OR_RETURN(auto column_file, dcg->column_file_by_idx(parent_name(_segment->file_name()), idx.first));
-            if (_dcg_segments.count(column_file) == 0) {
-                ASSIGN_OR_RETURN(auto dcg_segment, _segment->new_dcg_segment(*dcg, idx.first, _opts.tablet_schema));
-                _dcg_segments[column_file] = dcg_segment;
+void SegmentIterator::_init_dcg_column_locations() {
+    // iterate dcg from new ver to old ver, so the newest file holding a column wins
+    for (uint32_t i = 0; i < _dcgs.size(); i++) {
+        const auto& column_uids = _dcgs[i]->column_ids();
+        for (size_t idx = 0; idx < column_uids.size(); idx++) {
+            for (ColumnUID uid : column_uids[idx]) {
+                _dcg_column_locations.emplace(uid, std::make_pair(i, static_cast<int32_t>(idx)));
             }
-            return _dcg_segments[column_file];
         }
     }
-    // the column not exist in delta column group
-    return nullptr;
+}
+
+StatusOr<std::shared_ptr<Segment>> SegmentIterator::_get_dcg_segment(uint32_t ucid) {
+    auto iter = _dcg_column_locations.find(ucid);
+    if (iter == _dcg_column_locations.end()) {
+        // the column not exist in delta column group
+        return nullptr;
+    }
+    const auto& dcg = _dcgs[iter->second.first];
+    const int32_t file_idx = iter->second.second;
+    ASSIGN_OR_RETURN(auto column_file, dcg->column_file_by_idx(parent_name(_segment->file_name()), file_idx));
+    auto& dcg_segment = _dcg_segments[column_file];
+    if (dcg_segment == nullptr) {
+        ASSIGN_OR_RETURN(dcg_segment, _segment->new_dcg_segment(*dcg, file_idx, _opts.tablet_schema));
+    }
+    return dcg_segment;
 }
 
 StatusOr<std::unique_ptr<ColumnIterator>> SegmentIterator::_new_dcg_column_iterator(const TabletColumn& column,
@@ -814,6 +841,13 @@ Status SegmentIterator::_init_column_iterator_by_cid(const ColumnId cid, const C
                     .max_dist_size = config::io_coalesce_read_max_distance_size,
                     .max_buffer_size = config::io_coalesce_read_max_buffer_size};
             shared_buffered_input_stream->set_coalesce_options(options);
+            // read ahead the next coalesced pages of this column while the current ones are decoded,
+            // which overlaps the remote io latency of all the projected columns
+            auto* prefetch_pool = ExecEnv::GetInstance()->io_coalesce_prefetch_pool();
+            if (config::io_coalesce_prefetch_depth > 0 && prefetch_pool != nullptr) {
+                shared_buffered_input_stream->set_prefetch_options(prefetch_pool, config::io_coalesce_prefetch_depth,
+                                                                   config::io_coalesce_prefetch_max_bytes);
+            }
             iter_opts.read_file = shared_buffered_input_stream.get();
             iter_opts.is_io_coalesce = true;
             _column_files[cid] = std::move(shared_buffered_input_stream);
@@ -2531,6 +2565,7 @@ void SegmentIterator::close() {
         _del_vec.reset();
     }
     _dcgs.clear();
+    _dcg_column_locations.clear();
     _context_list[0].close();
     _context_list[1].close();
     _column_iterators.resize(0);
@@ -2539,6 +2574,17 @@ void SegmentIterator::close() {
     _dcg_segments.clear();
     _column_decoders.clear();
 
+    for (auto cid : _io_coalesce_column_index) {
+        auto it = _column_files.find(cid);
+        if (it == _column_files.end() || it->second == nullptr) {
+            continue;
+        }
+        auto* stream = down_cast<io::SharedBufferedInputStream*>(it->second.get());
+        _opts.stats->io_coalesce_prefetch_count += stream->prefetch_io_count();
+        _opts.stats->io_coalesce_prefetch_bytes += stream->prefetch_io_bytes();
+        _opts.stats->io_coalesce_prefetch_wait_ns += stream->prefetch_wait_timer();
+    }
+
     for (auto& [cid, rfile] : _column_files) {
         // update statistics before reset column file
         _update_stats(rfile.get());
@@ -48,6 +48,7 @@
 #include "storage/index/index_descriptor.h"
 #include "storage/row_store_encoder.h"
 #include "storage/rowset/column_writer.h" // ColumnWriter
+#include "storage/rowset/encoding_info.h"
 #include "storage/rowset/page_io.h"
 #include "storage/seek_tuple.h"
 #include "storage/short_key_index.h"
@@ -158,6 +159,11 @@ Status SegmentWriter::init(const std::vector<uint32_t>& column_indexes, bool has
         } else {
             _init_column_meta(opts.meta, column_index, column);
         }
+        if (auto iter = _opts.column_encodings.find(column_index); iter != _opts.column_encodings.end()) {
+            const EncodingInfo* encoding_info = nullptr;
+            RETURN_IF_ERROR(EncodingInfo::get(column.type(), iter->second, &encoding_info));
+            opts.meta->set_encoding(iter->second);
+        }
 
         // now we create zone map for key columns
         // and not support zone map for array type.
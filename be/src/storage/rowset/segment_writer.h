@@ -39,6 +39,7 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "common/status.h"
@@ -81,6 +82,9 @@ struct SegmentWriterOptions {
     std::string encryption_meta;
     bool is_compaction = false;
     std::shared_ptr<FlatJsonConfig> flat_json_config = nullptr;
+    // Encodings of scalar columns by column index, they are used as is instead of being speculated
+    // from the data. Used by benchmarks and tests to pin the encoding of a column.
+    std::unordered_map<uint32_t, EncodingTypePB> column_encodings;
 };
 
 // SegmentWriter is responsible for writing data into single segment by all or partital columns.
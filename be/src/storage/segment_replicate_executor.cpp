@@ -126,8 +126,9 @@ Status ReplicateChannel::async_segment(SegmentPB* segment, butil::IOBuf& data, b
     // 3. send segment sync request
     _send_request(segment, data, eos);
 
-    // 4. wait if eos=true
-    if (eos || _mem_tracker->any_limit_exceeded()) {
+    // 4. wait if the load is out of memory, the response of eos is waited by wait_response() so that
+    // the replicas commit in parallel
+    if (!eos && _mem_tracker->any_limit_exceeded()) {
         RETURN_IF_ERROR(_wait_response(replicate_tablet_infos, failed_tablet_infos));
     }
 
@@ -138,6 +139,13 @@ Status ReplicateChannel::async_segment(SegmentPB* segment, butil::IOBuf& data, b
     return get_status();
 }
 
+Status ReplicateChannel::wait_response(std::vector<std::unique_ptr<PTabletInfo>>* replicate_tablet_infos,
+                                       std::vector<std::unique_ptr<PTabletInfo>>* failed_tablet_infos) {
+    RETURN_IF_ERROR(get_status());
+    RETURN_IF_ERROR(_wait_response(replicate_tablet_infos, failed_tablet_infos));
+    return get_status();
+}
+
 void ReplicateChannel::_send_request(SegmentPB* segment, butil::IOBuf& data, bool eos) {
     PTabletWriterAddSegmentRequest request;
     request.set_allocated_id(const_cast<starrocks::PUniqueId*>(&_opt->load_id));
@@ -372,24 +380,46 @@ void ReplicateToken::_sync_segment(std::unique_ptr<SegmentPB> segment, bool eos)
         auto st = Status::OK();
         if (_failed_node_id.count(channel->node_id()) == 0) {
             st = channel->async_segment(segment.get(), data, eos, &_replicated_tablet_infos, &_failed_tablet_infos);
-            if (!st.ok()) {
-                LOG(WARNING) << "Failed to sync segment " << channel->debug_string() << " err " << st;
-                channel->cancel(st);
-                _failed_node_id.insert(channel->node_id());
+        }
+        if (!_check_replica_status(channel.get(), st)) {
+            return;
+        }
+    }
+
+    // 3. wait all the replicas to commit after eos is sent to all of them, so the latency of the commit is
+    // the slowest replica rather than the sum of them
+    if (eos) {
+        for (const auto& [_, channel] : _replicate_channels) {
+            auto st = Status::OK();
+            if (_failed_node_id.count(channel->node_id()) == 0) {
+                st = channel->wait_response(&_replicated_tablet_infos, &_failed_tablet_infos);
+            }
+            if (!_check_replica_status(channel.get(), st)) {
+                return;
             }
         }
+    }
+}
 
-        if (_failed_node_id.size() > _max_fail_replica_num) {
-            LOG(WARNING) << "Failed to sync segment err " << st << " by " << debug_string() << " fail_num "
-                         << _failed_node_id.size() << " max_fail_num " << _max_fail_replica_num;
-            for (const auto& [_, channel] : _replicate_channels) {
-                if (_failed_node_id.count(channel->node_id()) == 0) {
-                    channel->cancel(Status::InternalError("failed replica num exceed max fail num"));
-                }
+bool ReplicateToken::_check_replica_status(ReplicateChannel* channel, const Status& st) {
+    if (!st.ok() && _failed_node_id.count(channel->node_id()) == 0) {
+        LOG(WARNING) << "Failed to sync segment " << channel->debug_string() << " err " << st;
+        channel->cancel(st);
+        _failed_node_id.insert(channel->node_id());
+    }
+
+    if (_failed_node_id.size() > _max_fail_replica_num) {
+        LOG(WARNING) << "Failed to sync segment err " << st << " by " << debug_string() << " fail_num "
+                     << _failed_node_id.size() << " max_fail_num " << _max_fail_replica_num;
+        for (const auto& [_, channel] : _replicate_channels) {
+            if (_failed_node_id.count(channel->node_id()) == 0) {
+                channel->cancel(Status::InternalError("failed replica num exceed max fail num"));
             }
-            return set_status(st);
         }
+        set_status(st);
+        return false;
     }
+    return true;
 }
 
 Status SegmentReplicateExecutor::init(const std::vector<DataDir*>& data_dirs) {
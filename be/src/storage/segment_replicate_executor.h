@@ -45,6 +45,10 @@ public:
                          std::vector<std::unique_ptr<PTabletInfo>>* replicate_tablet_infos,
                          std::vector<std::unique_ptr<PTabletInfo>>* failed_tablet_infos);
 
+    // wait the response of the last request, which is not waited by async_segment() if it is eos
+    Status wait_response(std::vector<std::unique_ptr<PTabletInfo>>* replicate_tablet_infos,
+                         std::vector<std::unique_ptr<PTabletInfo>>* failed_tablet_infos);
+
     void cancel(const Status& status);
 
     int64_t node_id() { return _node_id; }
@@ -138,6 +142,8 @@ private:
     friend class SegmentReplicateTask;
 
     void _sync_segment(std::unique_ptr<SegmentPB> segment, bool eos);
+    // record the failure of a replica, return false if too many replicas have failed
+    bool _check_replica_status(ReplicateChannel* channel, const Status& st);
 
     std::unique_ptr<ThreadPoolToken> _replicate_token;
 
@@ -7,6 +7,7 @@
 #include <snappy/snappy-sinksource.h>
 #include <snappy/snappy.h>
 
+#include <cstring>
 #include <string>
 
 #include "common/status.h"
@@ -76,10 +77,17 @@ Status ReadBlock(RandomAccessFile* file, const ReadOptions& options, const Block
     size_t n = static_cast<size_t>(handle.size());
     char* buf = new char[n + kBlockTrailerSize];
     //Status s = file->Read(handle.offset(), n + kBlockTrailerSize, &contents, buf);
-    Status s = file->read_at_fully(handle.offset(), buf, n + kBlockTrailerSize);
-    ReadIOStat* stat = options.stat;
-    if (stat != nullptr) {
-        stat->bytes_from_file += (n + kBlockTrailerSize);
+    Status s;
+    const Slice* prefetched = options.prefetched;
+    if (prefetched != nullptr && handle.offset() >= options.prefetched_offset &&
+        handle.offset() + n + kBlockTrailerSize <= options.prefetched_offset + prefetched->get_size()) {
+        memcpy(buf, prefetched->get_data() + (handle.offset() - options.prefetched_offset), n + kBlockTrailerSize);
+    } else {
+        s = file->read_at_fully(handle.offset(), buf, n + kBlockTrailerSize);
+        ReadIOStat* stat = options.stat;
+        if (stat != nullptr) {
+            stat->bytes_from_file += (n + kBlockTrailerSize);
+        }
     }
     if (!s.ok()) {
         delete[] buf;
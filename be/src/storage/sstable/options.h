@@ -93,6 +93,11 @@ struct Options {
     // Many applications will benefit from passing the result of
     // NewBloomFilterPolicy() here.
     const FilterPolicy* filter_policy = nullptr;
+
+    // If > 0, Table::Open reads this many bytes from the tail of the file in
+    // one IO and serves the footer, index, metaindex and filter blocks from it
+    // when they fit. This saves round trips when the file lives on remote storage.
+    size_t open_prefetch_bytes = 0;
 };
 
 struct ReadIOStat {
@@ -126,6 +131,12 @@ struct ReadOptions {
     uint64_t max_rss_rowid = 0;
 
     ReadIOStat* stat = nullptr;
+
+    // If set, blocks that are fully covered by this buffer are copied from it
+    // instead of being read from the file. The buffer holds the file content
+    // starting at `prefetched_offset`.
+    const Slice* prefetched = nullptr;
+    uint64_t prefetched_offset = 0;
 };
 
 // Options that control write operations
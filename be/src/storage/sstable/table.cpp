@@ -6,6 +6,9 @@
 
 #include <butil/time.h> // NOLINT
 
+#include <algorithm>
+#include <memory>
+
 #include "common/status.h"
 #include "fs/fs.h"
 #include "runtime/exec_env.h"
@@ -49,12 +52,19 @@ Status Table::Open(const Options& options, RandomAccessFile* file, uint64_t size
         return Status::Corruption("file is too short to be an sstable");
     }
 
-    char footer_space[Footer::kEncodedLength];
+    // The filter, metaindex and index blocks are written right before the footer, so
+    // one read of the file tail usually covers everything Open needs.
+    const uint64_t tail_size = std::min<uint64_t>(
+            size, std::max<uint64_t>(options.open_prefetch_bytes, Footer::kEncodedLength));
+    const uint64_t tail_offset = size - tail_size;
+    std::unique_ptr<char[]> tail_space(new char[tail_size]);
     //Status s = file->Read(size - Footer::kEncodedLength, Footer::kEncodedLength, &footer_input, footer_space);
-    Status s = file->read_at_fully(size - Footer::kEncodedLength, footer_space, Footer::kEncodedLength);
+    Status s = file->read_at_fully(tail_offset, tail_space.get(), tail_size);
     if (!s.ok()) return s;
+    Slice tail(tail_space.get(), tail_size);
+    const Slice* prefetched = options.open_prefetch_bytes > 0 ? &tail : nullptr;
 
-    Slice footer_input(footer_space, Footer::kEncodedLength);
+    Slice footer_input(tail_space.get() + tail_size - Footer::kEncodedLength, Footer::kEncodedLength);
     Footer footer;
     s = footer.DecodeFrom(&footer_input);
     if (!s.ok()) return s;
@@ -67,6 +77,8 @@ Status Table::Open(const Options& options, RandomAccessFile* file, uint64_t size
     if (options.paranoid_checks) {
         opt.verify_checksums = true;
     }
+    opt.prefetched = prefetched;
+    opt.prefetched_offset = tail_offset;
     s = ReadBlock(file, opt, footer.index_handle(), &index_block_contents);
 
     if (s.ok()) {
@@ -82,13 +94,13 @@ Status Table::Open(const Options& options, RandomAccessFile* file, uint64_t size
         rep->filter_data = nullptr;
         rep->filter = nullptr;
         *table = new Table(rep);
-        (*table)->ReadMeta(footer);
+        (*table)->ReadMeta(footer, prefetched, tail_offset);
     }
 
     return s;
 }
 
-void Table::ReadMeta(const Footer& footer) {
+void Table::ReadMeta(const Footer& footer, const Slice* prefetched, uint64_t prefetched_offset) {
     if (rep_->options.filter_policy == nullptr) {
         return; // Do not need any metadata
     }
@@ -101,6 +113,8 @@ void Table::ReadMeta(const Footer& footer) {
     if (rep_->options.paranoid_checks) {
         opt.verify_checksums = true;
     }
+    opt.prefetched = prefetched;
+    opt.prefetched_offset = prefetched_offset;
     BlockContents contents;
     if (!ReadBlock(rep_->file, opt, footer.metaindex_handle(), &contents).ok()) {
         // Do not propagate errors since meta info is not needed for operation
@@ -113,13 +127,13 @@ void Table::ReadMeta(const Footer& footer) {
     key.append(rep_->options.filter_policy->Name());
     iter->Seek(key);
     if (iter->Valid() && iter->key() == Slice(key)) {
-        ReadFilter(iter->value());
+        ReadFilter(iter->value(), prefetched, prefetched_offset);
     }
     delete iter;
     delete meta;
 }
 
-void Table::ReadFilter(const Slice& filter_handle_value) {
+void Table::ReadFilter(const Slice& filter_handle_value, const Slice* prefetched, uint64_t prefetched_offset) {
     Slice v = filter_handle_value;
     BlockHandle filter_handle;
     if (!filter_handle.DecodeFrom(&v).ok()) {
@@ -132,6 +146,8 @@ void Table::ReadFilter(const Slice& filter_handle_value) {
     if (rep_->options.paranoid_checks) {
         opt.verify_checksums = true;
     }
+    opt.prefetched = prefetched;
+    opt.prefetched_offset = prefetched_offset;
     BlockContents block;
     if (!ReadBlock(rep_->file, opt, filter_handle, &block).ok()) {
         return;
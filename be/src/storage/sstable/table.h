@@ -60,8 +60,9 @@ private:
 
     explicit Table(Rep* rep) : rep_(rep) {}
 
-    void ReadMeta(const Footer& footer);
-    void ReadFilter(const Slice& filter_handle_value);
+    // `prefetched` is the tail of the file starting at `prefetched_offset`, or nullptr.
+    void ReadMeta(const Footer& footer, const Slice* prefetched, uint64_t prefetched_offset);
+    void ReadFilter(const Slice& filter_handle_value, const Slice* prefetched, uint64_t prefetched_offset);
 
     Rep* const rep_;
 };
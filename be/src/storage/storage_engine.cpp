@@ -81,6 +81,7 @@
 #include "util/starrocks_metrics.h"
 #include "util/stopwatch.hpp"
 #include "util/thread.h"
+#include "util/threadpool.h"
 #include "util/thrift_rpc_helper.h"
 #include "util/time.h"
 #include "util/trace.h"
@@ -239,6 +240,14 @@ Status StorageEngine::_open(const EngineOptions& options) {
     RETURN_IF_ERROR(_load_spill_block_merge_executor->init());
     REGISTER_THREAD_POOL_METRICS(load_spill_block_merge, _load_spill_block_merge_executor->get_thread_pool());
 
+    // The downloads of all the clone tasks share the pool, so the number of download threads is bounded
+    // regardless of the number of running clone tasks.
+    RETURN_IF_ERROR(ThreadPoolBuilder("clone_download")
+                            .set_min_threads(0)
+                            .set_max_threads(std::max<int>(1, dirs.size()) * config::parallel_clone_task_per_path)
+                            .set_idle_timeout(MonoDelta::FromSeconds(60))
+                            .build(&_clone_download_thread_pool));
+
     _memtable_flush_executor = std::make_unique<MemTableFlushExecutor>();
     RETURN_IF_ERROR_WITH_WARN(_memtable_flush_executor->init(dirs), "init MemTableFlushExecutor failed");
     REGISTER_THREAD_POOL_METRICS(memtable_flush, _memtable_flush_executor->get_thread_pool());
@@ -87,6 +87,7 @@ class PublishVersionManager;
 class DictionaryCacheManager;
 class SegmentFlushExecutor;
 class SegmentReplicateExecutor;
+class ThreadPool;
 
 struct DeltaColumnGroupKey {
     int64_t tablet_id;
@@ -242,6 +243,9 @@ public:
 
     MemTableFlushExecutor* memtable_flush_executor() { return _memtable_flush_executor.get(); }
 
+    // Thread pool shared by the clone tasks to download the files of a snapshot in parallel.
+    ThreadPool* clone_download_thread_pool() { return _clone_download_thread_pool.get(); }
+
     MemTableFlushExecutor* lake_memtable_flush_executor() { return _lake_memtable_flush_executor.get(); }
 
     SegmentReplicateExecutor* segment_replicate_executor() { return _segment_replicate_executor.get(); }
@@ -500,6 +504,8 @@ private:
 
     std::unique_ptr<MemTableFlushExecutor> _memtable_flush_executor;
 
+    std::unique_ptr<ThreadPool> _clone_download_thread_pool;
+
     std::unique_ptr<MemTableFlushExecutor> _lake_memtable_flush_executor;
 
     std::unique_ptr<SegmentReplicateExecutor> _segment_replicate_executor;
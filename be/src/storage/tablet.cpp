@@ -1725,6 +1725,28 @@ double Tablet::compaction_score() {
     return _compaction_context ? _compaction_context->score : 0;
 }
 
+void Tablet::update_query_read_stats(size_t num_segment_iters) {
+    // a racy update only loses a sample, which is fine for a moving average
+    double avg = _avg_query_read_segments.load(std::memory_order_relaxed);
+    _avg_query_read_segments.store(avg * 0.9 + num_segment_iters * 0.1, std::memory_order_relaxed);
+    _last_query_read_seconds.store(UnixSeconds(), std::memory_order_relaxed);
+}
+
+double Tablet::adjust_compaction_score_by_reads(double score) const {
+    if (!config::enable_compaction_read_amp_bonus || score <= 0) {
+        return score;
+    }
+    int64_t last_read = _last_query_read_seconds.load(std::memory_order_relaxed);
+    if (last_read == 0 || UnixSeconds() - last_read > config::compaction_read_amp_hot_seconds) {
+        // cold tablet, no query pays its read amplification
+        return score;
+    }
+    // a query reading a single segment pays no merge cost
+    double extra_segments = std::max(0.0, _avg_query_read_segments.load(std::memory_order_relaxed) - 1);
+    double bonus = std::min(extra_segments / 9, 1.0) * config::compaction_read_amp_max_bonus;
+    return score * (1 + bonus);
+}
+
 void Tablet::stop_compaction() {
     std::lock_guard lock(_compaction_task_lock);
     StorageEngine::instance()->compaction_manager()->stop_compaction(
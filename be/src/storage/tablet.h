@@ -274,6 +274,12 @@ public:
     double compaction_score();
     CompactionType compaction_type();
 
+    // Record a query which scanned `num_segment_iters` segment iterators of this tablet.
+    void update_query_read_stats(size_t num_segment_iters);
+    // Scale `score` up by the read amplification recent queries paid on this tablet,
+    // see `enable_compaction_read_amp_bonus`.
+    double adjust_compaction_score_by_reads(double score) const;
+
     void set_compaction_context(std::unique_ptr<CompactionContext>& context);
 
 #ifdef BE_TEST
@@ -466,6 +472,11 @@ private:
     // timestamp of last base compaction success
     std::atomic<int64_t> _last_base_compaction_success_millis{0};
 
+    // timestamp in seconds of the last query scan
+    std::atomic<int64_t> _last_query_read_seconds{0};
+    // exponential moving average of segment iterators read per query
+    std::atomic<double> _avg_query_read_segments{0};
+
     std::atomic<TStatusCode::type> _last_cumu_compaction_failure_status = TStatusCode::OK;
 
     std::atomic<int64_t> _cumulative_point{0};
@@ -1040,10 +1040,10 @@ Status TabletManager::report_all_tablets_info(std::map<TTabletId, TTablet>* tabl
                 tablet_info.__set_transaction_ids(find->second);
                 expire_txn_map.erase(find);
             }
-            t_tablet.tablet_infos.push_back(tablet_info);
+            t_tablet.tablet_infos.push_back(std::move(tablet_info));
 
             if (!t_tablet.tablet_infos.empty()) {
-                tablets_info->emplace(tablet_ptr->tablet_id(), t_tablet);
+                tablets_info->emplace(tablet_ptr->tablet_id(), std::move(t_tablet));
             }
         }
     }
@@ -402,6 +402,9 @@ Status TabletReader::get_segment_iterators(const TabletReaderParams& params, std
 Status TabletReader::_init_collector(const TabletReaderParams& params) {
     std::vector<ChunkIteratorPtr> seg_iters;
     RETURN_IF_ERROR(get_segment_iterators(params, &seg_iters));
+    if (params.reader_type == ReaderType::READER_QUERY && _tablet != nullptr) {
+        _tablet->update_query_read_stats(seg_iters.size());
+    }
 
     // Put each SegmentIterator into a TimedChunkIterator, if a profile is provided.
     if (params.profile != nullptr) {
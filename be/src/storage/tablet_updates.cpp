@@ -66,6 +66,7 @@
 #include "storage/union_iterator.h"
 #include "storage/update_compaction_state.h"
 #include "storage/update_manager.h"
+#include "util/countdown_latch.h"
 #include "util/defer_op.h"
 #include "util/failpoint/fail_point.h"
 #include "util/pretty_printer.h"
@@ -1323,6 +1324,40 @@ bool TabletUpdates::check_delta_column_generate_from_version(EditVersion begin_v
     return false;
 }
 
+// Run `gen_func(i)` for each i in [0, n), split into strided batches on the get_pindex worker pool
+// when there are enough segments. Batches that can not be submitted run in the calling thread.
+static void gen_del_vecs_parallel(size_t n, const std::function<void(size_t)>& gen_func) {
+    const int32_t min_segments = config::pk_apply_parallel_delvec_min_segments;
+    ThreadPool* pool = StorageEngine::instance()->update_manager()->get_pindex_thread_pool();
+    if (min_segments <= 0 || n < static_cast<size_t>(min_segments) || pool == nullptr) {
+        for (size_t i = 0; i < n; i++) {
+            gen_func(i);
+        }
+        return;
+    }
+    const size_t nbatch = std::min<size_t>(n, std::max(1, pool->max_threads()));
+    CountDownLatch latch(nbatch - 1);
+    auto run_batch = [&](size_t batch) {
+        for (size_t i = batch; i < n; i += nbatch) {
+            gen_func(i);
+        }
+    };
+    MemTracker* mem_tracker = CurrentThread::mem_tracker();
+    for (size_t batch = 1; batch < nbatch; batch++) {
+        auto st = pool->submit_func([&, batch]() {
+            SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(mem_tracker);
+            run_batch(batch);
+            latch.count_down();
+        });
+        if (!st.ok()) {
+            run_batch(batch);
+            latch.count_down();
+        }
+    }
+    run_batch(0);
+    latch.wait();
+}
+
 Status TabletUpdates::_apply_normal_rowset_commit(const EditVersionInfo& version_info, const RowsetSharedPtr& rowset) {
     CHECK_MEM_LIMIT("TabletUpdates::_apply_normal_rowset_commit");
     auto span = Tracer::Instance().start_trace_tablet("apply_rowset_commit", _tablet.tablet_id());
@@ -1654,31 +1689,27 @@ Status TabletUpdates::_apply_normal_rowset_commit(const EditVersionInfo& version
     span->AddEvent("gen_delvec");
     size_t ndelvec = new_deletes.size();
     vector<std::pair<uint32_t, DelVectorPtr>> new_del_vecs(ndelvec);
+    // latest delvec of segments from previous rowsets, newly added segments do not have one
+    vector<DelVectorPtr> old_del_vecs(ndelvec);
+    vector<const vector<segment_rowid_t>*> del_ids_vec(ndelvec);
     size_t idx = 0;
     size_t old_total_del = 0;
     size_t new_del = 0;
     size_t total_del = 0;
     string delvec_change_info;
+    auto is_new_segment = [&](uint32_t rssid) {
+        return rssid >= rowset_id && rssid < rowset_id + rowset->num_segments();
+    };
     for (auto& new_delete : new_deletes) {
         uint32_t rssid = new_delete.first;
-        if (rssid >= rowset_id && rssid < rowset_id + rowset->num_segments()) {
-            // it's newly added rowset's segment, do not have latest delvec yet
-            new_del_vecs[idx].first = rssid;
-            new_del_vecs[idx].second = std::make_shared<DelVector>();
-            auto& del_ids = new_delete.second;
-            new_del_vecs[idx].second->init(version.major_number(), del_ids.data(), del_ids.size());
-            if (VLOG_IS_ON(1)) {
-                StringAppendF(&delvec_change_info, " %u:+%zu", rssid, del_ids.size());
-            }
-            new_del += del_ids.size();
-            total_del += del_ids.size();
-        } else {
+        new_del_vecs[idx].first = rssid;
+        del_ids_vec[idx] = &new_delete.second;
+        if (!is_new_segment(rssid)) {
             TabletSegmentId tsid;
             tsid.tablet_id = tablet_id;
             tsid.segment_id = rssid;
-            DelVectorPtr old_del_vec;
             // TODO(cbl): should get the version before this apply version, to be safe
-            st = manager->get_latest_del_vec(_tablet.data_dir()->get_meta(), tsid, &old_del_vec);
+            st = manager->get_latest_del_vec(_tablet.data_dir()->get_meta(), tsid, &old_del_vecs[idx]);
             FAIL_POINT_TRIGGER_EXECUTE(tablet_apply_get_del_vec_failed,
                                        { st = Status::InternalError("inject tablet_apply_get_del_vec_failed"); });
             if (!st.ok()) {
@@ -1687,11 +1718,34 @@ Status TabletUpdates::_apply_normal_rowset_commit(const EditVersionInfo& version
                 failure_handler(msg, st.code(), false);
                 return apply_st;
             }
-            new_del_vecs[idx].first = rssid;
-            old_del_vec->add_dels_as_new_version(new_delete.second, version.major_number(),
-                                                 &(new_del_vecs[idx].second));
+        }
+        idx++;
+    }
+    // build the new version of delvecs, each one only touches its own slot so the result is
+    // the same whether it runs serially or in parallel.
+    gen_del_vecs_parallel(ndelvec, [&](size_t i) {
+        if (is_new_segment(new_del_vecs[i].first)) {
+            // it's newly added rowset's segment, do not have latest delvec yet
+            new_del_vecs[i].second = std::make_shared<DelVector>();
+            new_del_vecs[i].second->init(version.major_number(), del_ids_vec[i]->data(), del_ids_vec[i]->size());
+        } else {
+            old_del_vecs[i]->add_dels_as_new_version(*del_ids_vec[i], version.major_number(),
+                                                     &(new_del_vecs[i].second));
+        }
+    });
+    for (idx = 0; idx < ndelvec; idx++) {
+        uint32_t rssid = new_del_vecs[idx].first;
+        const auto& old_del_vec = old_del_vecs[idx];
+        if (is_new_segment(rssid)) {
+            size_t num_dels = del_ids_vec[idx]->size();
+            if (VLOG_IS_ON(1)) {
+                StringAppendF(&delvec_change_info, " %u:+%zu", rssid, num_dels);
+            }
+            new_del += num_dels;
+            total_del += num_dels;
+        } else {
             size_t cur_old = old_del_vec->cardinality();
-            size_t cur_add = new_delete.second.size();
+            size_t cur_add = del_ids_vec[idx]->size();
             size_t cur_new = new_del_vecs[idx].second->cardinality();
             FAIL_POINT_TRIGGER_EXECUTE(tablet_delvec_inconsistent, {
                 cur_old = 0;
@@ -1717,8 +1771,6 @@ Status TabletUpdates::_apply_normal_rowset_commit(const EditVersionInfo& version
             new_del += cur_add;
             total_del += cur_new;
         }
-
-        idx++;
     }
     StarRocksMetrics::instance()->update_del_vector_deletes_total.increment(total_del);
     StarRocksMetrics::instance()->update_del_vector_deletes_new.increment(new_del);
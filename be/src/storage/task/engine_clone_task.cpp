@@ -37,7 +37,9 @@
 #include <fmt/format.h>
 #include <sys/stat.h>
 
+#include <atomic>
 #include <filesystem>
+#include <mutex>
 #include <set>
 
 #include "agent/agent_common.h"
@@ -61,9 +63,11 @@
 #include "storage/rowset/rowset_factory.h"
 #include "storage/snapshot_manager.h"
 #include "storage/tablet_updates.h"
+#include "util/countdown_latch.h"
 #include "util/defer_op.h"
 #include "util/network_util.h"
 #include "util/string_parser.hpp"
+#include "util/threadpool.h"
 #include "util/thrift_rpc_helper.h"
 
 using std::set;
@@ -586,19 +590,15 @@ Status EngineCloneTask::_download_files(DataDir* data_dir, const std::string& re
         }
     }
 
-    // Get copy from remote
+    // Get file sizes from remote
+    std::vector<uint64_t> file_sizes(file_name_list.size());
     uint64_t total_file_size = 0;
-    MonotonicStopWatch watch;
-    watch.start();
     for (int i = 0; i < file_name_list.size(); ++i) {
-        std::string& file_name = file_name_list[i];
-        auto remote_file_url = remote_url_prefix + file_name;
-
-        uint64_t file_size = 0;
         if (use_file_name_and_size_format) {
-            file_size = file_size_list[i];
+            file_sizes[i] = file_size_list[i];
         } else {
-            auto get_file_size_cb = [&remote_file_url, &file_size](HttpClient* client) {
+            auto remote_file_url = remote_url_prefix + file_name_list[i];
+            auto get_file_size_cb = [&remote_file_url, &file_size = file_sizes[i]](HttpClient* client) {
                 RETURN_IF_ERROR(client->init(remote_file_url));
                 client->set_timeout_ms(GET_LENGTH_TIMEOUT * 1000);
                 RETURN_IF_ERROR(client->head());
@@ -607,13 +607,28 @@ Status EngineCloneTask::_download_files(DataDir* data_dir, const std::string& re
             };
             RETURN_IF_ERROR(HttpClient::execute_with_retry(DOWNLOAD_FILE_MAX_RETRY, 1, get_file_size_cb));
         }
+        total_file_size += file_sizes[i];
+    }
 
-        // check disk capacity
-        if (data_dir->capacity_limit_reached(file_size)) {
-            return Status::InternalError("Disk reach capacity limit");
-        }
+    // check disk capacity, the files may be downloaded in parallel
+    if (data_dir->capacity_limit_reached(total_file_size)) {
+        return Status::InternalError("Disk reach capacity limit");
+    }
 
-        total_file_size += file_size;
+    size_t num_data_files = file_name_list.empty() ? 0 : file_name_list.size() - 1;
+    size_t parallelism = std::min<size_t>(std::max(config::clone_download_parallelism, 1), num_data_files);
+    auto* download_pool = StorageEngine::instance()->clone_download_thread_pool();
+    if (download_pool == nullptr) {
+        parallelism = 1;
+    }
+
+    auto download_file = [&](size_t i, int64_t max_speed_kbps) {
+        if (StorageEngine::instance()->bg_worker_stopped()) {
+            return Status::InternalError("Process is going to quit. The download will stop.");
+        }
+        const std::string& file_name = file_name_list[i];
+        auto remote_file_url = remote_url_prefix + file_name;
+        uint64_t file_size = file_sizes[i];
         uint64_t estimate_timeout = file_size / config::download_low_speed_limit_kbps / 1024;
         if (estimate_timeout < config::download_low_speed_time) {
             estimate_timeout = config::download_low_speed_time;
@@ -624,10 +639,11 @@ Status EngineCloneTask::_download_files(DataDir* data_dir, const std::string& re
         VLOG(2) << "Downloading " << file_name << " to " << local_path << ". bytes=" << file_size
                 << " timeout=" << estimate_timeout;
 
-        auto download_cb = [&remote_file_url, estimate_timeout, &local_file_path, file_size](HttpClient* client) {
+        auto download_cb = [&remote_file_url, estimate_timeout, &local_file_path, file_size,
+                            max_speed_kbps](HttpClient* client) {
             RETURN_IF_ERROR(client->init(remote_file_url));
             client->set_timeout_ms(estimate_timeout * 1000);
-            RETURN_IF_ERROR(client->download(local_file_path));
+            RETURN_IF_ERROR(client->download(local_file_path, max_speed_kbps));
 
             // Check file length
             uint64_t local_file_size = std::filesystem::file_size(local_file_path);
@@ -639,8 +655,63 @@ Status EngineCloneTask::_download_files(DataDir* data_dir, const std::string& re
             chmod(local_file_path.c_str(), S_IRUSR | S_IWUSR);
             return Status::OK();
         };
-        RETURN_IF_ERROR(HttpClient::execute_with_retry(DOWNLOAD_FILE_MAX_RETRY, 1, download_cb));
-    } // Clone files from remote backend
+        return HttpClient::execute_with_retry(DOWNLOAD_FILE_MAX_RETRY, 1, download_cb);
+    };
+
+    // Clone files from remote backend. The last file, which is the header file if there is one,
+    // is downloaded after all the others have succeeded
+    MonotonicStopWatch watch;
+    watch.start();
+    if (parallelism <= 1) {
+        for (size_t i = 0; i < num_data_files; ++i) {
+            RETURN_IF_ERROR(download_file(i, config::max_download_speed_kbps));
+        }
+    } else {
+        // The downloads in parallel share max_download_speed_kbps, so that a clone task never takes more
+        // bandwidth than a serial one.
+        int64_t max_speed_kbps = config::max_download_speed_kbps;
+        if (max_speed_kbps > 0) {
+            max_speed_kbps = std::max<int64_t>(1, max_speed_kbps / static_cast<int64_t>(parallelism));
+        }
+        std::atomic<size_t> next_file{0};
+        std::mutex status_lock;
+        Status download_status;
+        auto download_worker = [&]() {
+            while (true) {
+                size_t i = next_file.fetch_add(1);
+                if (i >= num_data_files) {
+                    return;
+                }
+                auto st = download_file(i, max_speed_kbps);
+                if (!st.ok()) {
+                    std::lock_guard<std::mutex> l(status_lock);
+                    if (download_status.ok()) {
+                        download_status = st;
+                    }
+                    // stop the other workers from taking new files
+                    next_file.store(num_data_files);
+                    return;
+                }
+            }
+        };
+        CountDownLatch latch(parallelism);
+        for (size_t i = 0; i < parallelism; ++i) {
+            auto st = download_pool->submit_func([&download_worker, &latch]() {
+                download_worker();
+                latch.count_down();
+            });
+            if (!st.ok()) {
+                // the pool is shutting down or full, download by this thread instead
+                download_worker();
+                latch.count_down();
+            }
+        }
+        latch.wait();
+        RETURN_IF_ERROR(download_status);
+    }
+    if (!file_name_list.empty()) {
+        RETURN_IF_ERROR(download_file(file_name_list.size() - 1, config::max_download_speed_kbps));
+    }
 
     uint64_t total_time_ms = watch.elapsed_time() / 1000 / 1000;
     total_time_ms = total_time_ms > 0 ? total_time_ms : 0;
@@ -14,6 +14,7 @@
 
 #include "storage/vertical_compaction_task.h"
 
+#include <thread>
 #include <vector>
 
 #include "column/schema.h"
@@ -27,6 +28,7 @@
 #include "storage/rowset/rowset_writer.h"
 #include "storage/tablet_reader.h"
 #include "storage/tablet_reader_params.h"
+#include "util/blocking_queue.hpp"
 #include "util/time.h"
 #include "util/trace.h"
 
@@ -138,6 +140,9 @@ Status VerticalCompactionTask::_compact_column_group(bool is_key, int column_gro
         return ret.status();
     }
     int32_t chunk_size = ret.value();
+    if (!is_key && config::enable_vertical_compaction_read_ahead) {
+        chunk_size = std::max(1, chunk_size / 2);
+    }
     VLOG(2) << "compaction task_id:" << _task_info.task_id << ", tablet=" << _tablet->tablet_id()
             << ", column group=" << column_group_index << ", reader chunk size=" << chunk_size;
     reader_params.chunk_size = chunk_size;
@@ -192,6 +197,11 @@ StatusOr<size_t> VerticalCompactionTask::_compact_data(bool is_key, int32_t chun
                                                        RowSourceMaskBuffer* mask_buffer,
                                                        std::vector<RowSourceMask>* source_masks) {
     DCHECK(reader);
+    if (!is_key && config::enable_vertical_compaction_read_ahead) {
+        RETURN_IF_ERROR(_compact_value_column_group_with_read_ahead(chunk_size, column_group, schema, reader,
+                                                                    output_rs_writer));
+        return 0;
+    }
     size_t output_rows = 0;
     auto chunk = ChunkHelper::new_chunk(schema, chunk_size);
     auto char_field_indexes = ChunkHelper::get_char_field_indexes(schema);
@@ -248,4 +258,83 @@ StatusOr<size_t> VerticalCompactionTask::_compact_data(bool is_key, int32_t chun
     return output_rows;
 }
 
+Status VerticalCompactionTask::_compact_value_column_group_with_read_ahead(int32_t chunk_size,
+                                                                           const std::vector<uint32_t>& column_group,
+                                                                           const Schema& schema, TabletReader* reader,
+                                                                           RowsetWriter* output_rs_writer) {
+    struct ReadChunk {
+        ChunkPtr chunk;
+        size_t del_filtered_rows = 0;
+        size_t merged_rows = 0;
+    };
+    // up to three chunks are alive: one being written, one queued and one being read, the chunk size of the
+    // group is halved in `_compact_column_group` to stay close to the memory budget of the serial path
+    BlockingQueue<ReadChunk> read_chunks(1);
+    Status read_status;
+    MemTracker* mem_tracker = CurrentThread::mem_tracker();
+    // the reader and its row source mask buffer are only touched by this thread after open
+    std::thread read_thread([&]() {
+        SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(mem_tracker);
+        std::vector<RowSourceMask> source_masks;
+        while (!should_stop()) {
+            ReadChunk read_chunk;
+            read_chunk.chunk = ChunkHelper::new_chunk(schema, chunk_size);
+            Status st = reader->get_next(read_chunk.chunk.get(), &source_masks);
+            if (!st.ok()) {
+                if (!st.is_end_of_file()) {
+                    read_status = std::move(st);
+                }
+                break;
+            }
+            source_masks.clear();
+            read_chunk.del_filtered_rows = reader->stats().rows_del_filtered;
+            read_chunk.merged_rows = reader->merged_rows();
+            if (!read_chunks.blocking_put(std::move(read_chunk))) {
+                break;
+            }
+        }
+        read_chunks.shutdown();
+    });
+
+    Status status;
+    auto char_field_indexes = ChunkHelper::get_char_field_indexes(schema);
+    size_t column_group_del_filtered_rows = 0;
+    size_t column_group_merged_rows = 0;
+    ReadChunk read_chunk;
+    while (read_chunks.blocking_get(&read_chunk)) {
+#ifndef BE_TEST
+        status = tls_thread_status.mem_tracker()->check_mem_limit("Compaction");
+        if (!status.ok()) {
+            LOG(WARNING) << "fail to execute compaction: " << status.message() << std::endl;
+            break;
+        }
+#endif
+        auto* chunk = read_chunk.chunk.get();
+        ChunkHelper::padding_char_columns(char_field_indexes, schema, _tablet_schema, chunk);
+        status = output_rs_writer->add_columns(*chunk, column_group, false);
+        if (!status.ok()) {
+            break;
+        }
+        _task_info.total_output_num_rows += chunk->num_rows();
+        _task_info.total_del_filtered_rows += read_chunk.del_filtered_rows - column_group_del_filtered_rows;
+        _task_info.total_merged_rows += read_chunk.merged_rows - column_group_merged_rows;
+        column_group_del_filtered_rows = read_chunk.del_filtered_rows;
+        column_group_merged_rows = read_chunk.merged_rows;
+    }
+    // stop the read thread if the writer fails first
+    read_chunks.shutdown();
+    read_thread.join();
+    RETURN_IF_ERROR(status);
+    if (!read_status.ok()) {
+        LOG(WARNING) << "reader get next error. tablet=" << _tablet->tablet_id() << ", err=" << read_status.to_string();
+        return Status::InternalError(fmt::format("reader get_next error: {}", read_status.to_string()));
+    }
+    if (should_stop()) {
+        LOG(INFO) << "vertical compaction task_id:" << _task_info.task_id << ", tablet:" << _task_info.tablet_id
+                  << " is stopped.";
+        return Status::Cancelled("vertical compaction task is stopped.");
+    }
+    return Status::OK();
+}
+
 } // namespace starrocks
@@ -48,6 +48,11 @@ private:
                                    const Schema& schema, TabletReader* reader, RowsetWriter* output_rs_writer,
                                    RowSourceMaskBuffer* mask_buffer, std::vector<RowSourceMask>* source_masks);
 
+    // Same as `_compact_data` for a value column group, but the chunks are read ahead on another thread.
+    Status _compact_value_column_group_with_read_ahead(int32_t chunk_size, const std::vector<uint32_t>& column_group,
+                                                       const Schema& schema, TabletReader* reader,
+                                                       RowsetWriter* output_rs_writer);
+
     StatusOr<int32_t> _calculate_chunk_size_for_column_group(const std::vector<uint32_t>& column_group);
 };
 
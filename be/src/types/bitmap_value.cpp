@@ -216,6 +216,66 @@ BitmapValue& BitmapValue::operator|=(const BitmapValue& rhs) {
     return *this;
 }
 
+void BitmapValue::fast_union(const std::vector<const BitmapValue*>& values) {
+    std::vector<const detail::Roaring64Map*> bitmaps;
+    bitmaps.reserve(values.size() + 1);
+    for (const auto* value : values) {
+        if (value->_type == BITMAP) {
+            bitmaps.push_back(value->_bitmap.get());
+        }
+    }
+    // nothing to gain from the bulk union, and operator|= can share the only bitmap.
+    if (bitmaps.size() <= 1) {
+        for (const auto* value : values) {
+            *this |= *value;
+        }
+        return;
+    }
+
+    if (_type == BITMAP) {
+        bitmaps.push_back(_bitmap.get());
+    }
+    auto result = std::make_shared<detail::Roaring64Map>(
+            detail::Roaring64Map::fastunion(bitmaps.size(), bitmaps.data()));
+    if (_type == SINGLE) {
+        result->add(_sv);
+    } else if (_type == SET) {
+        for (auto x : *_set) {
+            result->add(x);
+        }
+    }
+    for (const auto* value : values) {
+        if (value->_type == SINGLE) {
+            result->add(value->_sv);
+        } else if (value->_type == SET) {
+            for (auto x : *value->_set) {
+                result->add(x);
+            }
+        }
+    }
+
+    _bitmap = std::move(result);
+    _set.reset();
+    _type = BITMAP;
+    _mem_usage = 0;
+}
+
+void BitmapValue::fast_intersect(const std::vector<const BitmapValue*>& values) {
+    std::vector<std::pair<int64_t, const BitmapValue*>> sorted;
+    sorted.reserve(values.size());
+    for (const auto* value : values) {
+        sorted.emplace_back(value->cardinality(), value);
+    }
+    std::sort(sorted.begin(), sorted.end(),
+              [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+    for (const auto& entry : sorted) {
+        if (_type == EMPTY) {
+            break;
+        }
+        *this &= *entry.second;
+    }
+}
+
 // Note: rhs BitmapValue is only readable after this method
 // Compute the intersection between the current bitmap and the provided bitmap.
 // Possible type transitions are:
@@ -143,6 +143,16 @@ public:
     // BITMAP -> SINGLE
     BitmapValue& operator&=(const BitmapValue& rhs);
 
+    // Compute the union between the current bitmap and all the provided bitmaps.
+    // Unlike calling operator|= for every value, all roaring bitmaps are unioned in one pass
+    // with lazy container unions, so the cardinality is only computed once per container.
+    void fast_union(const std::vector<const BitmapValue*>& values);
+
+    // Compute the intersection between the current bitmap and all the provided bitmaps.
+    // The values are intersected from the smallest cardinality and stop as soon as the
+    // current bitmap becomes empty.
+    void fast_intersect(const std::vector<const BitmapValue*>& values);
+
     void remove(uint64_t rhs);
 
     BitmapValue& operator-=(const BitmapValue& rhs);
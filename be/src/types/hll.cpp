@@ -168,6 +168,21 @@ void HyperLogLog::update(uint64_t hash_value) {
     }
 }
 
+void HyperLogLog::update_batch(const uint64_t* hash_values, size_t size) {
+    size_t i = 0;
+    // Empty and explicit type may turn into register format in the middle of the batch.
+    for (; i < size && _type != HLL_DATA_SPARSE && _type != HLL_DATA_FULL; ++i) {
+        if (hash_values[i] != 0) {
+            update(hash_values[i]);
+        }
+    }
+    for (; i < size; ++i) {
+        if (hash_values[i] != 0) {
+            _update_registers(hash_values[i]);
+        }
+    }
+}
+
 MFV_AVX512BW(void merge_registers_impl(uint8_t* dest, const uint8_t* other) {
     constexpr int SIMD_SIZE = sizeof(__m512i);
     constexpr int loop = HLL_REGISTERS_COUNT / SIMD_SIZE;
@@ -113,6 +113,10 @@ public:
     // NOTE: input must be a hash_value
     void update(uint64_t hash_value);
 
+    // Update a batch of hash values. Zero hash values are skipped, as callers of update() do.
+    // Once in register format, the values are scattered into registers without any type check.
+    void update_batch(const uint64_t* hash_values, size_t size);
+
     void merge(const HyperLogLog& other);
 
     // Return max size of serialized binary
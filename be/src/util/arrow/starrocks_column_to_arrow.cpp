@@ -97,13 +97,19 @@ struct ColumnToArrowConverter<LT, AT, is_nullable, ConvFloatAndIntegerGuard<LT,
         if constexpr (is_nullable) {
             const auto* nullable_column = down_cast<const NullableColumn*>(column.get());
             const auto* data_column = down_cast<const StarRocksColumnType*>(nullable_column->data_column().get());
-            const auto& data = data_column->get_data();
-            for (auto i = start_idx; i < end_idx; ++i) {
-                if (nullable_column->is_null(i)) {
-                    ARROW_RETURN_NOT_OK(builder->AppendNull());
-                } else {
-                    ARROW_RETURN_NOT_OK(builder->Append(data[i]));
+            const auto* values = data_column->get_data().data() + start_idx;
+            const auto num_rows = end_idx - start_idx;
+            if (!nullable_column->has_null()) {
+                ARROW_RETURN_NOT_OK(builder->AppendValues(values, num_rows));
+            } else {
+                // append the values in bulk with the validity bytes flipped from the null map, the
+                // loop is vectorized by compiler and arrow packs the bytes into its validity bitmap.
+                const auto* nulls = nullable_column->immutable_null_column_data().data() + start_idx;
+                raw::RawVector<uint8_t> valid_bytes(num_rows);
+                for (auto i = 0; i < num_rows; ++i) {
+                    valid_bytes[i] = !nulls[i];
                 }
+                ARROW_RETURN_NOT_OK(builder->AppendValues(values, num_rows, valid_bytes.data()));
             }
         } else {
             const auto* data_column = down_cast<const StarRocksColumnType*>(column.get());
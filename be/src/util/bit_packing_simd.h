@@ -19,6 +19,8 @@
 #include <immintrin.h>
 #endif
 
+#include <type_traits>
+
 #include "common/logging.h"
 #include "util/bit_packing.h"
 
@@ -73,7 +75,14 @@ static inline void unpackNaive(int bit_width, const uint8_t* __restrict__ in, in
 template <typename T>
 inline void unpack(int bit_width, const uint8_t* __restrict__ in, int64_t in_bytes, int64_t num_values,
                    T* __restrict__ out) {
-    unpackNaive<T>(bit_width, in, in_bytes, num_values, out);
+    if constexpr (std::is_integral_v<T> && std::is_signed_v<T> && sizeof(T) <= sizeof(uint32_t)) {
+        // Unpacked values are never negative, so signed outputs (e.g. the int16_t parquet levels)
+        // share the kernels of the unsigned type with the same width.
+        using U = std::make_unsigned_t<T>;
+        unpack<U>(bit_width, in, in_bytes, num_values, reinterpret_cast<U*>(out));
+    } else {
+        unpackNaive<T>(bit_width, in, in_bytes, num_values, out);
+    }
 }
 
 template <>
@@ -813,6 +813,20 @@ private:
             }
         }
 
+        // Pledge the total input size so that zstd sizes its window and tables for the actual input,
+        // which is much cheaper for small pages and chunks, and records the content size in the frame.
+        // The pledged size is reset when the context is returned to the pool.
+        size_t total_input_size = 0;
+        for (const auto& input : inputs) {
+            total_input_size += input.size;
+        }
+        ret = ZSTD_CCtx_setPledgedSrcSize(ctx, total_input_size);
+        if (ZSTD_isError(ret)) {
+            context->compression_fail = true;
+            return Status::InternalError(strings::Substitute("ZSTD set pledged src size failed: $0",
+                                                             ZSTD_getErrorString(ZSTD_getErrorCode(ret))));
+        }
+
         ZSTD_outBuffer out_buf;
         out_buf.dst = output->data;
         out_buf.size = output->size;
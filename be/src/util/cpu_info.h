@@ -100,6 +100,17 @@ public:
 
     static std::vector<size_t> get_core_ids();
 
+    /// Returns the maximum possible number of NUMA nodes.
+    static int get_max_num_numa_nodes() { return max_num_numa_nodes_; }
+
+    /// Returns the NUMA node of the core, or 0 if the NUMA info is not available.
+    static int get_numa_node_of_core(size_t core) {
+        if (core_to_numa_node_ == nullptr || core >= static_cast<size_t>(max_num_cores_)) {
+            return 0;
+        }
+        return core_to_numa_node_[core];
+    }
+
     static bool is_cgroup_with_cpuset() { return is_cgroup_with_cpuset_; }
     static bool is_cgroup_with_cpu_quota() { return is_cgroup_with_cpu_quota_; }
 
@@ -113,6 +124,7 @@ public:
 
     // For TEST only
     static int64_t* TEST_mutable_hardware_flags() { return &hardware_flags_; }
+    static std::vector<long>* TEST_mutable_cache_sizes() { return &cache_sizes; }
 
 private:
     static constexpr size_t DEFAULT_L2_CACHE_SIZE = 1 * 1024 * 1024;
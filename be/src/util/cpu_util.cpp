@@ -16,7 +16,10 @@
 
 #include <fmt/format.h>
 
+#include <map>
+
 #include "common/config.h"
+#include "util/cpu_info.h"
 #include "util/thread.h"
 
 namespace starrocks {
@@ -50,6 +53,20 @@ void CpuUtil::bind_cpus(Thread* thread, const std::vector<size_t>& cpuids) {
     thread->set_first_bound_cpuid(cpuids[0]);
 }
 
+CpuUtil::CpuIds CpuUtil::numa_local_cpuids(const CpuIds& cpuids, size_t index) {
+    std::map<int, CpuIds> numa_node_to_cpuids;
+    for (const auto cpu_id : cpuids) {
+        numa_node_to_cpuids[CpuInfo::get_numa_node_of_core(cpu_id)].emplace_back(cpu_id);
+    }
+    if (numa_node_to_cpuids.size() <= 1) {
+        return cpuids;
+    }
+
+    auto it = numa_node_to_cpuids.begin();
+    std::advance(it, index % numa_node_to_cpuids.size());
+    return std::move(it->second);
+}
+
 std::string CpuUtil::to_string(const CpuIds& cpuids) {
     std::string result = "(";
     for (size_t i = 0; i < cpuids.size(); i++) {
@@ -29,6 +29,10 @@ public:
 
     static void bind_cpus(Thread* thread, const std::vector<size_t>& cpuids);
 
+    // Group cpuids by NUMA node, and return the group of the index-th node in a round-robin manner.
+    // Return cpuids itself, if all of them are on the same NUMA node.
+    static CpuIds numa_local_cpuids(const CpuIds& cpuids, size_t index);
+
     static std::string to_string(const CpuIds& cpuids);
 };
 
@@ -37,6 +37,7 @@
 #include <algorithm>
 #include <cstring>
 
+#include "gutil/endian.h"
 #include "util/bit_util.h"
 #include "util/coding.h"
 
@@ -282,7 +283,6 @@ bool ForDecoder<T>::init() {
     return true;
 }
 
-// todo(kks): improve this method by SIMD instructions
 // The reverse of bit_pack method, get original integer data list from packed bits
 // param[in] input: the packed bits need to unpack
 // param[in] in_num: the integer number in packed bits
@@ -290,20 +290,46 @@ bool ForDecoder<T>::init() {
 // param[out] output: the original integer data list
 template <typename T>
 void ForDecoder<T>::bit_unpack(const uint8_t* input, uint8_t in_num, int bit_width, T* output) {
+    int i = 0;
+    size_t bit_pos = 0;
+    if (bit_width == 0) {
+        for (; i < in_num; i++) {
+            output[i] = 0;
+        }
+        return;
+    }
+    // The values are packed from the most significant bit of each byte, so every value with at most 57 bits
+    // is the top bits of the 64-bit big endian word starting at its first byte, after dropping the bits of
+    // the previous value. This extracts one value per load instead of one bit per iteration, and stops
+    // where a load would read past the packed bytes of this frame.
+    if (bit_width <= 57) {
+        const size_t packed_bytes = (static_cast<size_t>(in_num) * bit_width + 7) / 8;
+        const int shift = 64 - bit_width;
+        for (; i < in_num; i++, bit_pos += bit_width) {
+            size_t byte_pos = bit_pos / 8;
+            if (byte_pos + 8 > packed_bytes) {
+                break;
+            }
+            uint64_t word = BigEndian::Load64(input + byte_pos);
+            uint64_t value = (word << (bit_pos % 8)) >> shift;
+            output[i] = value;
+        }
+    }
+
+    // bit by bit for the remaining values
     unsigned char in_mask = 0x80;
-    int bit_index = 0;
-    while (in_num > 0) {
-        *output = 0;
-        for (int i = 0; i < bit_width; i++) {
+    input += bit_pos / 8;
+    int bit_index = bit_pos % 8;
+    for (; i < in_num; i++) {
+        output[i] = 0;
+        for (int k = 0; k < bit_width; k++) {
             if (bit_index > 7) {
                 input++;
                 bit_index = 0;
             }
-            *output |= ((T)((*input & (in_mask >> bit_index)) >> (7 - bit_index))) << (bit_width - i - 1);
+            output[i] |= ((T)((*input & (in_mask >> bit_index)) >> (7 - bit_index))) << (bit_width - k - 1);
             bit_index++;
         }
-        output++;
-        in_num--;
     }
 }
 
@@ -337,18 +363,18 @@ void ForDecoder<T>::decode_current_frame(T* output) {
         bit_unpack(_buffer + delta_offset, current_frame_size, bit_width, output);
     } else {
         bool is_ascending = _storage_formats[_current_decoded_frame] == 1;
-        std::vector<T> delta_values(current_frame_size);
-        bit_unpack(_buffer + delta_offset, current_frame_size, bit_width, delta_values.data());
+        // unpack the deltas into the output and add the frame min in place
+        bit_unpack(_buffer + delta_offset, current_frame_size, bit_width, output);
         if (is_ascending) {
             T pre_value = min;
             for (uint8_t i = 0; i < current_frame_size; i++) {
-                T value = delta_values[i] + pre_value;
+                T value = output[i] + pre_value;
                 output[i] = value;
                 pre_value = value;
             }
         } else {
             for (uint8_t i = 0; i < current_frame_size; i++) {
-                output[i] = delta_values[i] + min;
+                output[i] = output[i] + min;
             }
         }
     }
@@ -53,6 +53,7 @@
 #include "util/json_converter.h"
 #include "util/phmap/phmap.h"
 #include "util/runtime_profile.h"
+#include "util/time.h"
 
 namespace starrocks {
 
@@ -660,6 +661,57 @@ void dfs_add_remain_keys(JsonFlatPath* node, std::unordered_set<std::string_view
     }
 }
 
+void JsonPathAccessStats::record(const std::vector<std::string>& paths) {
+    if (config::json_flat_access_stats_window_sec <= 0 || paths.empty()) {
+        return;
+    }
+    std::lock_guard l(_lock);
+    _maybe_rotate(MonotonicSeconds());
+    for (const auto& path : paths) {
+        auto iter = _counts.find(path);
+        if (iter != _counts.end()) {
+            iter->second++;
+        } else if (_counts.size() < kMaxPaths) {
+            _counts.emplace(path, 1);
+        }
+    }
+}
+
+std::vector<uint64_t> JsonPathAccessStats::access_counts(const std::vector<std::string_view>& paths) {
+    std::vector<uint64_t> counts(paths.size(), 0);
+    if (config::json_flat_access_stats_window_sec <= 0) {
+        return counts;
+    }
+    std::lock_guard l(_lock);
+    _maybe_rotate(MonotonicSeconds());
+    std::string key;
+    for (size_t i = 0; i < paths.size(); i++) {
+        key.assign(paths[i]);
+        if (auto iter = _counts.find(key); iter != _counts.end()) {
+            counts[i] += iter->second;
+        }
+        if (auto iter = _prev_counts.find(key); iter != _prev_counts.end()) {
+            counts[i] += iter->second;
+        }
+    }
+    return counts;
+}
+
+void JsonPathAccessStats::_maybe_rotate(int64_t now_s) {
+    const int64_t window_s = config::json_flat_access_stats_window_sec;
+    if (now_s - _window_start_s < window_s) {
+        return;
+    }
+    if (now_s - _window_start_s < 2 * window_s) {
+        _prev_counts = std::move(_counts);
+    } else {
+        // no access in the last whole window
+        _prev_counts.clear();
+    }
+    _counts.clear();
+    _window_start_s = now_s;
+}
+
 void JsonPathDeriver::_finalize() {
     // try downgrade json-uint to bigint
     int128_t max = RunTimeTypeLimits<TYPE_BIGINT>::max_value();
@@ -672,13 +724,35 @@ void JsonPathDeriver::_finalize() {
     std::vector<std::pair<JsonFlatPath*, std::string>> hit_leaf;
     _dfs_finalize(_path_root.get(), "", &hit_leaf);
 
-    // sort by name, just for stable order
+    size_t limit = _max_column > 0 ? _max_column : std::numeric_limits<size_t>::max();
+    std::unordered_map<JsonFlatPath*, uint64_t> access_counts;
+    if (hit_leaf.size() > limit) {
+        // more candidates than flat columns, the paths queried recently win the flat columns
+        std::vector<std::string_view> paths;
+        paths.reserve(hit_leaf.size());
+        for (const auto& [node, path] : hit_leaf) {
+            paths.emplace_back(std::string_view(path).substr(1));
+        }
+        auto counts = JsonPathAccessStats::instance()->access_counts(paths);
+        for (size_t i = 0; i < hit_leaf.size(); i++) {
+            access_counts[hit_leaf[i].first] = counts[i];
+        }
+    }
+    // sort by queried first, then by hits
+    auto is_queried = [&](JsonFlatPath* node) {
+        auto iter = access_counts.find(node);
+        return iter != access_counts.end() && iter->second > 0;
+    };
     std::sort(hit_leaf.begin(), hit_leaf.end(), [&](const auto& a, const auto& b) {
+        bool queried_a = is_queried(a.first);
+        bool queried_b = is_queried(b.first);
+        if (queried_a != queried_b) {
+            return queried_a;
+        }
         auto desc_a = _derived_maps[a.first];
         auto desc_b = _derived_maps[b.first];
         return desc_a.hits > desc_b.hits;
     });
-    size_t limit = _max_column > 0 ? _max_column : std::numeric_limits<size_t>::max();
     for (size_t i = limit; i < hit_leaf.size(); i++) {
         if (!hit_leaf[i].first->remain && _derived_maps[hit_leaf[i].first].hits >= _total_rows) {
             limit++;
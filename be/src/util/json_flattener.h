@@ -23,6 +23,7 @@
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <string_view>
 #include <tuple>
@@ -104,6 +105,35 @@ public:
     static std::pair<std::string_view, std::string_view> split_path(const std::string_view& path);
 };
 
+// Counts how many times each json path is read as a flat sub column by queries. When a json column has more
+// candidate paths than json_flat_column_max, JsonPathDeriver keeps the queried paths flat first, so the flat
+// columns follow what queries read after the json schema drifts. The counts are kept for two windows of
+// json_flat_access_stats_window_sec, so paths that are not read any more lose their priority.
+// Paths are not distinguished by table, the stats only decide the order of candidates.
+class JsonPathAccessStats {
+public:
+    static JsonPathAccessStats* instance() {
+        static JsonPathAccessStats s_instance;
+        return &s_instance;
+    }
+
+    void record(const std::vector<std::string>& paths);
+
+    // Access count of each path in |paths| in the current and the previous window.
+    std::vector<uint64_t> access_counts(const std::vector<std::string_view>& paths);
+
+private:
+    static constexpr size_t kMaxPaths = 100000;
+
+    // must hold _lock
+    void _maybe_rotate(int64_t now_s);
+
+    std::mutex _lock;
+    int64_t _window_start_s = 0;
+    std::unordered_map<std::string, uint64_t> _counts;
+    std::unordered_map<std::string, uint64_t> _prev_counts;
+};
+
 // to deriver json flanttern path
 class JsonPathDeriver {
 public:
@@ -6,6 +6,7 @@
 
 #include <rapidjson/document.h>
 
+#include <algorithm>
 #include <cstdio>
 #include <cstdlib>
 #include <sstream>
@@ -150,6 +151,69 @@ bool HandleTable::_resize() {
     return true;
 }
 
+void FrequencySketch::resize(size_t num_entries) {
+    size_t width = 1;
+    while (width < num_entries) {
+        width <<= 1;
+    }
+    _width = num_entries == 0 ? 0 : width;
+    _table.reset(_width == 0 ? nullptr : new std::atomic<uint8_t>[_width * kDepth]);
+    for (size_t i = 0; i < _width * kDepth; ++i) {
+        _table[i].store(0, std::memory_order_relaxed);
+    }
+    _additions.store(0, std::memory_order_relaxed);
+    _sample_size = _width * 10;
+}
+
+size_t FrequencySketch::_index(uint32_t hash, int row) const {
+    static constexpr uint64_t kSeeds[kDepth] = {0xc3a5c85c97cb3127ULL, 0xb492b66fbe98f273ULL, 0x9ae16a3b2f90404fULL,
+                                                0xcbf29ce484222325ULL};
+    // the high bits of hash are used to choose the shard, so mix all the bits before masking
+    uint64_t h = (static_cast<uint64_t>(hash) + 1) * kSeeds[row];
+    h ^= h >> 32;
+    return row * _width + (h & (_width - 1));
+}
+
+void FrequencySketch::increment(uint32_t hash) {
+    if (_width == 0) {
+        return;
+    }
+    // Concurrent lookups may lose an increment, which is fine for an estimation.
+    bool added = false;
+    for (int row = 0; row < kDepth; ++row) {
+        auto& counter = _table[_index(hash, row)];
+        uint8_t count = counter.load(std::memory_order_relaxed);
+        if (count < kMaxCount) {
+            counter.store(count + 1, std::memory_order_relaxed);
+            added = true;
+        }
+    }
+    // only the thread reaching the sample size does the reset
+    if (added && _additions.fetch_add(1, std::memory_order_relaxed) + 1 == _sample_size) {
+        _reset();
+    }
+}
+
+uint32_t FrequencySketch::estimate(uint32_t hash) const {
+    if (_width == 0) {
+        return 0;
+    }
+    uint32_t freq = kMaxCount;
+    for (int row = 0; row < kDepth; ++row) {
+        freq = std::min<uint32_t>(freq, _table[_index(hash, row)].load(std::memory_order_relaxed));
+    }
+    return freq;
+}
+
+void FrequencySketch::_reset() {
+    for (size_t i = 0; i < _width * kDepth; ++i) {
+        _table[i].store(_table[i].load(std::memory_order_relaxed) >> 1, std::memory_order_relaxed);
+    }
+    _additions.fetch_sub(_sample_size / 2, std::memory_order_relaxed);
+}
+
+static constexpr uint8_t kMaxVisits = 3;
+
 LRUCache::LRUCache() {
     // Make empty circular linked list
     _lru.next = &_lru;
@@ -161,9 +225,38 @@ LRUCache::~LRUCache() noexcept {
 }
 
 bool LRUCache::_unref(LRUHandle* e) {
-    DCHECK(e->refs > 0);
-    e->refs--;
-    return e->refs == 0;
+    DCHECK(e->ref_count() > 0);
+    return (e->refs.fetch_sub(1, std::memory_order_acq_rel) & ~LRUHandle::kUnlinked) == 1;
+}
+
+bool LRUCache::_unref_without_lock(LRUHandle* e) {
+    // Gives up when the lock is needed: to account the last reference, or to link an unlinked entry
+    // back into the LRU list when only the cache references it afterwards.
+    uint32_t refs = e->refs.load(std::memory_order_relaxed);
+    while (true) {
+        uint32_t count = refs & ~LRUHandle::kUnlinked;
+        if (count == 1 || (count == 2 && (refs & LRUHandle::kUnlinked))) {
+            return false;
+        }
+        if (e->refs.compare_exchange_weak(refs, refs - 1, std::memory_order_acq_rel)) {
+            return true;
+        }
+    }
+}
+
+bool LRUCache::_unlink_if_referenced(LRUHandle* e) {
+    // Only CLOCK keeps referenced entries in the LRU list, they are unlinked the first time the eviction
+    // passes them so that it does not walk them again until they are released.
+    // Releases may drop references concurrently, so the bit is set only if the entry is still referenced.
+    uint32_t refs = e->refs.load(std::memory_order_relaxed);
+    DCHECK(!(refs & LRUHandle::kUnlinked));
+    while (refs > 1) {
+        if (e->refs.compare_exchange_weak(refs, refs | LRUHandle::kUnlinked, std::memory_order_acq_rel)) {
+            _lru_remove(e);
+            return true;
+        }
+    }
+    return false;
 }
 
 void LRUCache::_lru_remove(LRUHandle* e) {
@@ -183,8 +276,9 @@ void LRUCache::_lru_append(LRUHandle* list, LRUHandle* e) {
 void LRUCache::set_capacity(size_t capacity) {
     std::vector<LRUHandle*> last_ref_list;
     {
-        std::lock_guard l(_mutex);
+        std::unique_lock l(_mutex);
         _capacity = capacity;
+        _resize_sketch();
         _evict_from_lru(0, &last_ref_list);
     }
 
@@ -193,39 +287,83 @@ void LRUCache::set_capacity(size_t capacity) {
     }
 }
 
+void LRUCache::set_admission(CacheAdmission admission) {
+    std::unique_lock l(_mutex);
+    _admission = admission;
+    _resize_sketch();
+}
+
+void LRUCache::set_eviction(CacheEviction eviction) {
+    std::unique_lock l(_mutex);
+    _eviction = eviction;
+}
+
+void LRUCache::_resize_sketch() {
+    if (_admission != CacheAdmission::TINY_LFU) {
+        _sketch.resize(0);
+        return;
+    }
+    // one counter per 4KB of capacity, roughly the number of pages the shard can hold
+    size_t num_entries = std::clamp<size_t>(_capacity / 4096, 256, 65536);
+    if (_sketch.width() < num_entries || _sketch.width() / 2 >= num_entries) {
+        _sketch.resize(num_entries);
+    }
+}
+
+uint64_t LRUCache::get_rejected_count() const {
+    return _rejected_count.load(std::memory_order_relaxed);
+}
+
 uint64_t LRUCache::get_lookup_count() const {
-    std::lock_guard l(_mutex);
-    return _lookup_count;
+    return _lookup_count.load(std::memory_order_relaxed);
 }
 
 uint64_t LRUCache::get_hit_count() const {
-    std::lock_guard l(_mutex);
-    return _hit_count;
+    return _hit_count.load(std::memory_order_relaxed);
 }
 
 size_t LRUCache::get_usage() const {
-    std::lock_guard l(_mutex);
-    return _usage;
+    return _usage.load(std::memory_order_relaxed);
 }
 
 size_t LRUCache::get_capacity() const {
-    std::lock_guard l(_mutex);
-    return _capacity;
+    return _capacity.load(std::memory_order_relaxed);
 }
 
 Cache::Handle* LRUCache::lookup(const CacheKey& key, uint32_t hash) {
-    std::lock_guard l(_mutex);
-    ++_lookup_count;
+    if (_eviction == CacheEviction::CLOCK) {
+        // A hit only marks the entry as visited, so lookups share the lock with each other.
+        std::shared_lock l(_mutex);
+        return _lookup(key, hash);
+    }
+    std::unique_lock l(_mutex);
+    return _lookup(key, hash);
+}
+
+Cache::Handle* LRUCache::_lookup(const CacheKey& key, uint32_t hash) {
+    _lookup_count.fetch_add(1, std::memory_order_relaxed);
+    if (_admission == CacheAdmission::TINY_LFU) {
+        _sketch.increment(hash);
+    }
     LRUHandle* e = _table.lookup(key, hash);
     if (e != nullptr) {
         // we get it from _table, so in_cache must be true
         DCHECK(e->in_cache);
-        if (e->refs == 1) {
+        if (_eviction == CacheEviction::CLOCK) {
+            e->refs.fetch_add(1, std::memory_order_relaxed);
+            // a lost update of concurrent lookups only costs a second chance
+            uint8_t visits = e->visits.load(std::memory_order_relaxed);
+            if (visits < kMaxVisits) {
+                e->visits.store(visits + 1, std::memory_order_relaxed);
+            }
+        } else if (e->refs == 1) {
             // only in LRU free list, remove it from list
             _lru_remove(e);
+            e->refs = 2 | LRUHandle::kUnlinked;
+        } else {
+            e->refs.fetch_add(1, std::memory_order_relaxed);
         }
-        e->refs++;
-        ++_hit_count;
+        _hit_count.fetch_add(1, std::memory_order_relaxed);
     }
     return reinterpret_cast<Cache::Handle*>(e);
 }
@@ -235,24 +373,28 @@ void LRUCache::release(Cache::Handle* handle) {
         return;
     }
     auto* e = reinterpret_cast<LRUHandle*>(handle);
+    if (_eviction == CacheEviction::CLOCK &&
+        _usage.load(std::memory_order_relaxed) <= _capacity.load(std::memory_order_relaxed) &&
+        _unref_without_lock(e)) {
+        // Once the reference is dropped without the lock, e may be evicted and freed by others.
+        return;
+    }
     bool last_ref = false;
     {
-        std::lock_guard l(_mutex);
+        std::unique_lock l(_mutex);
         last_ref = _unref(e);
         if (last_ref) {
             _usage -= e->charge;
-        } else if (e->in_cache && e->refs == 1) {
-            // only exists in cache
+        } else if (e->in_cache && e->ref_count() == 1) {
+            // only exists in cache, put it to LRU free list
+            if (e->unlinked()) {
+                e->refs.fetch_and(~LRUHandle::kUnlinked, std::memory_order_relaxed);
+                _lru_append(&_lru, e);
+            }
             if (_usage > _capacity) {
                 // take this opportunity and remove the item
-                _table.remove(e->key(), e->hash);
-                e->in_cache = false;
-                _unref(e);
-                _usage -= e->charge;
+                _evict_one_entry(e);
                 last_ref = true;
-            } else {
-                // put it to LRU free list
-                _lru_append(&_lru, e);
             }
         }
     }
@@ -265,19 +407,33 @@ void LRUCache::release(Cache::Handle* handle) {
 
 void LRUCache::_evict_from_lru(size_t charge, std::vector<LRUHandle*>* deleted) {
     LRUHandle* cur = &_lru;
-    // 1. evict normal cache entries
+    // 1. evict normal cache entries, under CLOCK an entry visited since the last pass moves to the
+    // newest end instead
     while (_usage + charge > _capacity && cur->next != &_lru) {
         LRUHandle* old = cur->next;
+        if (_unlink_if_referenced(old)) {
+            continue;
+        }
         if (old->priority == CachePriority::DURABLE) {
             cur = cur->next;
             continue;
         }
+        uint8_t visits = old->visits.load(std::memory_order_relaxed);
+        if (_eviction == CacheEviction::CLOCK && visits > 0) {
+            old->visits.store(visits - 1, std::memory_order_relaxed);
+            _lru_remove(old);
+            _lru_append(&_lru, old);
+            continue;
+        }
         _evict_one_entry(old);
         deleted->push_back(old);
     }
     // 2. evict durable cache entries if need
     while (_usage + charge > _capacity && _lru.next != &_lru) {
         LRUHandle* old = _lru.next;
+        if (_unlink_if_referenced(old)) {
+            continue;
+        }
         DCHECK(old->priority == CachePriority::DURABLE);
         _evict_one_entry(old);
         deleted->push_back(old);
@@ -294,6 +450,25 @@ void LRUCache::_evict_one_entry(LRUHandle* e) {
     _usage -= e->charge;
 }
 
+bool LRUCache::_admit(const CacheKey& key, uint32_t hash, size_t charge, CachePriority priority) {
+    if (_admission != CacheAdmission::TINY_LFU || priority == CachePriority::DURABLE || _usage + charge <= _capacity) {
+        return true;
+    }
+    // always admit the replacement of an existing entry
+    if (_table.lookup(key, hash) != nullptr) {
+        return true;
+    }
+    // compare with the entry that would be evicted first
+    LRUHandle* victim = _lru.next;
+    while (victim != &_lru && (victim->priority == CachePriority::DURABLE || victim->ref_count() > 1)) {
+        victim = victim->next;
+    }
+    if (victim == &_lru) {
+        return true;
+    }
+    return _sketch.estimate(hash) >= _sketch.estimate(victim->hash);
+}
+
 Cache::Handle* LRUCache::insert(const CacheKey& key, uint32_t hash, void* value, size_t value_size,
                                 void (*deleter)(const CacheKey& key, void* value), CachePriority priority) {
     size_t key_mem_size = sizeof(LRUHandle) - 1 + key.size();
@@ -304,7 +479,9 @@ Cache::Handle* LRUCache::insert(const CacheKey& key, uint32_t hash, void* value,
     e->charge = kv_mem_size;
     e->key_length = key.size();
     e->hash = hash;
-    e->refs = 2; // one for the returned handle, one for LRUCache.
+    // one for the returned handle, one for LRUCache. It joins the LRU list once the handle is released.
+    e->refs = 2 | LRUHandle::kUnlinked;
+    e->visits = 0;
     e->next = e->prev = nullptr;
     e->in_cache = true;
     e->priority = priority;
@@ -312,9 +489,19 @@ Cache::Handle* LRUCache::insert(const CacheKey& key, uint32_t hash, void* value,
     memcpy(e->key_data, key.data(), key.size());
     std::vector<LRUHandle*> last_ref_list;
     {
-        std::lock_guard l(_mutex);
+        std::unique_lock l(_mutex);
 
-        // Free the space following strict LRU policy until enough space
+        if (!_admit(key, hash, kv_mem_size, priority)) {
+            // The entry is rejected by the admission policy, hand it back to the caller without caching it.
+            // It is freed when the returned handle is released.
+            e->refs = 1;
+            e->in_cache = false;
+            _usage += kv_mem_size;
+            _rejected_count.fetch_add(1, std::memory_order_relaxed);
+            return reinterpret_cast<Cache::Handle*>(e);
+        }
+
+        // Free the space following LRU policy until enough space
         // is freed or the lru list is empty
         _evict_from_lru(kv_mem_size, &last_ref_list);
 
@@ -325,11 +512,13 @@ Cache::Handle* LRUCache::insert(const CacheKey& key, uint32_t hash, void* value,
         _usage += kv_mem_size;
         if (old != nullptr) {
             old->in_cache = false;
+            if (old->unlinked()) {
+                old->refs.fetch_and(~LRUHandle::kUnlinked, std::memory_order_relaxed);
+            } else {
+                _lru_remove(old);
+            }
             if (_unref(old)) {
                 _usage -= old->charge;
-                // old is on LRU because it's in cache and its reference count
-                // was just 1 (Unref returned 0)
-                _lru_remove(old);
                 last_ref_list.push_back(old);
             }
         }
@@ -348,18 +537,19 @@ void LRUCache::erase(const CacheKey& key, uint32_t hash) {
     LRUHandle* e = nullptr;
     bool last_ref = false;
     {
-        std::lock_guard l(_mutex);
+        std::unique_lock l(_mutex);
         e = _table.remove(key, hash);
         if (e != nullptr) {
+            if (e->unlinked()) {
+                e->refs.fetch_and(~LRUHandle::kUnlinked, std::memory_order_relaxed);
+            } else {
+                _lru_remove(e);
+            }
+            e->in_cache = false;
             last_ref = _unref(e);
             if (last_ref) {
                 _usage -= e->charge;
-                if (e->in_cache) {
-                    // locate in free list
-                    _lru_remove(e);
-                }
             }
-            e->in_cache = false;
         }
     }
     // free handle out of mutex, when last_ref is true, e must not be nullptr
@@ -371,16 +561,13 @@ void LRUCache::erase(const CacheKey& key, uint32_t hash) {
 int LRUCache::prune() {
     std::vector<LRUHandle*> last_ref_list;
     {
-        std::lock_guard l(_mutex);
+        std::unique_lock l(_mutex);
         while (_lru.next != &_lru) {
             LRUHandle* old = _lru.next;
-            DCHECK(old->in_cache);
-            DCHECK(old->refs == 1); // LRU list contains elements which may be evicted
-            _lru_remove(old);
-            _table.remove(old->key(), old->hash);
-            old->in_cache = false;
-            _unref(old);
-            _usage -= old->charge;
+            if (_unlink_if_referenced(old)) {
+                continue;
+            }
+            _evict_one_entry(old);
             last_ref_list.push_back(old);
         }
     }
@@ -398,9 +585,12 @@ uint32_t ShardedLRUCache::_shard(uint32_t hash) {
     return hash >> (32 - kNumShardBits);
 }
 
-ShardedLRUCache::ShardedLRUCache(size_t capacity) : _last_id(0), _capacity(capacity) {
+ShardedLRUCache::ShardedLRUCache(size_t capacity, CacheAdmission admission, CacheEviction eviction)
+        : _last_id(0), _capacity(capacity) {
     const size_t per_shard = (_capacity + (kNumShards - 1)) / kNumShards;
     for (auto& _shard : _shards) {
+        _shard.set_admission(admission);
+        _shard.set_eviction(eviction);
         _shard.set_capacity(per_shard);
     }
 }
@@ -6,9 +6,12 @@
 
 #include <rapidjson/document.h>
 
+#include <atomic>
 #include <cstdint>
 #include <cstring>
+#include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -112,6 +115,17 @@ private:
 // The entry with smaller CachePriority will evict firstly
 enum class CachePriority { NORMAL = 0, DURABLE = 1 };
 
+// How a full LRUCache shard decides whether a new entry may displace its LRU victim.
+// ALWAYS: the new entry is always admitted, i.e. plain LRU.
+// TINY_LFU: the new entry is admitted only if its estimated access frequency is higher than the
+// victim's, so that a one-pass scan can not flush the frequently used entries out of the cache.
+enum class CacheAdmission { ALWAYS = 0, TINY_LFU = 1 };
+
+// LRU moves an entry to the newest end on every hit, so lookups take the shard lock exclusively.
+// CLOCK only marks a hit entry as visited and lets the eviction give it a second chance, so lookups
+// share the shard lock with each other.
+enum class CacheEviction { LRU = 0, CLOCK = 1 };
+
 class Cache {
 public:
     Cache() = default;
@@ -203,12 +217,22 @@ typedef struct LRUHandle {
     size_t charge;
     size_t key_length;
     bool in_cache; // Whether entry is in the cache.
-    uint32_t refs;
+    // Reference count, the kUnlinked bit is set while the entry is in the cache but kept out of
+    // the LRU list because it is referenced by callers.
+    std::atomic<uint32_t> refs;
+    // Saturating count of lookups under CLOCK eviction, each time the eviction passes the entry it
+    // takes one and gives the entry a second chance.
+    std::atomic<uint8_t> visits;
     uint32_t hash; // Hash of key(); used for fast sharding and comparisons
     CachePriority priority = CachePriority::NORMAL;
     size_t value_size;
     char key_data[1]; // Beginning of key
 
+    static constexpr uint32_t kUnlinked = 1u << 31;
+
+    uint32_t ref_count() const { return refs.load(std::memory_order_relaxed) & ~kUnlinked; }
+    bool unlinked() const { return refs.load(std::memory_order_relaxed) & kUnlinked; }
+
     CacheKey key() const {
         // For cheaper lookups, we allow a temporary Handle object
         // to store a pointer to a key in "value".
@@ -258,6 +282,33 @@ private:
     bool _resize();
 };
 
+// Count-min sketch of 4-bit saturating counters used by the TinyLFU admission policy.
+// All counters are halved after `sample_size` increments, so the estimation reflects
+// recent popularity instead of the whole history.
+class FrequencySketch {
+public:
+    // Resize the sketch to track about `num_entries` entries, all counters are reset.
+    void resize(size_t num_entries);
+
+    void increment(uint32_t hash);
+    uint32_t estimate(uint32_t hash) const;
+
+    size_t width() const { return _width; }
+
+private:
+    static constexpr int kDepth = 4;
+    static constexpr uint8_t kMaxCount = 15;
+
+    size_t _index(uint32_t hash, int row) const;
+    void _reset();
+
+    // counters are updated by concurrent lookups without the exclusive lock
+    std::unique_ptr<std::atomic<uint8_t>[]> _table;
+    size_t _width{0};
+    std::atomic<size_t> _additions{0};
+    size_t _sample_size{0};
+};
+
 // A single shard of sharded cache.
 class LRUCache {
 public:
@@ -267,6 +318,10 @@ public:
     // Separate from constructor so caller can easily make an array of LRUCache
     void set_capacity(size_t capacity);
 
+    void set_admission(CacheAdmission admission);
+
+    void set_eviction(CacheEviction eviction);
+
     // Like Cache methods, but with an extra "hash" parameter.
     Cache::Handle* insert(const CacheKey& key, uint32_t hash, void* value, size_t value_size,
                           void (*deleter)(const CacheKey& key, void* value),
@@ -280,31 +335,46 @@ public:
     uint64_t get_hit_count() const;
     size_t get_usage() const;
     size_t get_capacity() const;
+    // number of inserts rejected by the admission policy
+    uint64_t get_rejected_count() const;
     static size_t key_handle_size(const CacheKey& key) { return sizeof(LRUHandle) - 1 + key.size(); }
 
 private:
     void _lru_remove(LRUHandle* e);
     void _lru_append(LRUHandle* list, LRUHandle* e);
     bool _unref(LRUHandle* e);
+    bool _unref_without_lock(LRUHandle* e);
+    bool _unlink_if_referenced(LRUHandle* e);
+    Cache::Handle* _lookup(const CacheKey& key, uint32_t hash);
     void _evict_from_lru(size_t charge, std::vector<LRUHandle*>* deleted);
     void _evict_one_entry(LRUHandle* e);
+    bool _admit(const CacheKey& key, uint32_t hash, size_t charge, CachePriority priority);
+    void _resize_sketch();
 
     // Initialized before use.
-    size_t _capacity{0};
+    std::atomic<size_t> _capacity{0};
+    CacheAdmission _admission{CacheAdmission::ALWAYS};
+    CacheEviction _eviction{CacheEviction::LRU};
 
-    // _mutex protects the following state.
-    mutable std::mutex _mutex;
-    size_t _usage{0};
+    // _mutex protects the following state. Under CLOCK eviction lookup only takes it shared, the others
+    // take it exclusively. _usage and entry refs are atomic so that they can be read or dropped without
+    // the exclusive lock.
+    mutable std::shared_mutex _mutex;
+    std::atomic<size_t> _usage{0};
 
     // Dummy head of LRU list.
     // lru.prev is newest entry, lru.next is oldest entry.
-    // Entries have refs==1 and in_cache==true.
+    // Entries have in_cache==true and no kUnlinked bit. Under LRU eviction they have refs==1, under CLOCK
+    // eviction a looked up entry stays in the list until the eviction reaches it and unlinks it.
     LRUHandle _lru;
 
     HandleTable _table;
 
-    uint64_t _lookup_count{0};
-    uint64_t _hit_count{0};
+    std::atomic<uint64_t> _lookup_count{0};
+    std::atomic<uint64_t> _hit_count{0};
+    std::atomic<uint64_t> _rejected_count{0};
+
+    FrequencySketch _sketch;
 };
 
 static const int kNumShardBits = 5;
@@ -312,7 +382,8 @@ static const int kNumShards = 1 << kNumShardBits;
 
 class ShardedLRUCache : public Cache {
 public:
-    explicit ShardedLRUCache(size_t capacity);
+    explicit ShardedLRUCache(size_t capacity, CacheAdmission admission = CacheAdmission::ALWAYS,
+                             CacheEviction eviction = CacheEviction::LRU);
     ~ShardedLRUCache() override = default;
     Handle* insert(const CacheKey& key, void* value, size_t value_size,
                    void (*deleter)(const CacheKey& key, void* value),
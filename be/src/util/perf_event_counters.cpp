@@ -0,0 +1,92 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "util/perf_event_counters.h"
+
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <memory>
+
+#include "common/logging.h"
+
+namespace starrocks {
+
+const char* const PerfEventCounters::kEventNames[NUM_EVENTS] = {"PerfCycles", "PerfInstructions", "PerfCacheMisses",
+                                                                "PerfBranchMisses"};
+
+static constexpr uint64_t kEventConfigs[PerfEventCounters::NUM_EVENTS] = {
+        PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES,
+        PERF_COUNT_HW_BRANCH_MISSES};
+
+PerfEventCounters* PerfEventCounters::thread_local_instance() {
+    static thread_local std::unique_ptr<PerfEventCounters> tls_counters;
+    static thread_local bool tls_opened = false;
+    if (!tls_opened) {
+        tls_opened = true;
+        std::unique_ptr<PerfEventCounters> counters(new PerfEventCounters());
+        if (counters->_open()) {
+            tls_counters = std::move(counters);
+        }
+    }
+    return tls_counters.get();
+}
+
+bool PerfEventCounters::_open() {
+    for (int i = 0; i < NUM_EVENTS; ++i) {
+        struct perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = kEventConfigs[i];
+        attr.read_format = PERF_FORMAT_GROUP;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        // count the calling thread on any cpu
+        int fd = syscall(__NR_perf_event_open, &attr, 0, -1, i == 0 ? -1 : _fds[0], 0);
+        if (fd < 0) {
+            LOG_FIRST_N(WARNING, 1) << "perf events are not available, failed to open event " << kEventNames[i]
+                                    << ", errno: " << errno;
+            return false;
+        }
+        _fds[i] = fd;
+    }
+    return true;
+}
+
+PerfEventCounters::~PerfEventCounters() {
+    for (int fd : _fds) {
+        if (fd >= 0) {
+            close(fd);
+        }
+    }
+}
+
+bool PerfEventCounters::read(Values* values) const {
+    struct {
+        uint64_t nr;
+        uint64_t values[NUM_EVENTS];
+    } buf;
+    ssize_t bytes = ::read(_fds[0], &buf, sizeof(buf));
+    if (bytes != sizeof(buf) || buf.nr != NUM_EVENTS) {
+        return false;
+    }
+    memcpy(values->values, buf.values, sizeof(buf.values));
+    return true;
+}
+
+} // namespace starrocks
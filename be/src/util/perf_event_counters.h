@@ -0,0 +1,83 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+
+#include "util/runtime_profile.h"
+
+namespace starrocks {
+
+// Hardware counters of the calling thread, read by perf_event_open(2). The events are opened as one
+// group, so the counters of all the events are read by one read(2), which costs about 1us.
+// It's not thread-safe, each thread uses its own instance returned by thread_local_instance().
+class PerfEventCounters {
+public:
+    enum Event { CPU_CYCLES = 0, INSTRUCTIONS, CACHE_MISSES, BRANCH_MISSES, NUM_EVENTS };
+
+    struct Values {
+        uint64_t values[NUM_EVENTS] = {};
+    };
+
+    // Profile counter names of the events.
+    static const char* const kEventNames[NUM_EVENTS];
+
+    // Return the counters of the current thread, or nullptr if perf events are not available,
+    // e.g. not permitted by kernel.perf_event_paranoid or not supported by the virtual machine.
+    static PerfEventCounters* thread_local_instance();
+
+    ~PerfEventCounters();
+
+    bool read(Values* values) const;
+
+private:
+    PerfEventCounters() = default;
+    bool _open();
+
+    int _fds[NUM_EVENTS] = {-1, -1, -1, -1};
+};
+
+// Add the hardware counters of the current thread in the scope to the profile counters, multiplied by `scale`.
+// Do nothing if `perf` is nullptr or the profile counters are not created.
+class ScopedPerfEventCounters {
+public:
+    ScopedPerfEventCounters(const PerfEventCounters* perf, RuntimeProfile::Counter* const* counters, int64_t scale)
+            : _perf(perf), _counters(counters), _scale(scale) {
+        if (_perf != nullptr && (_counters[0] == nullptr || !_perf->read(&_start))) {
+            _perf = nullptr;
+        }
+    }
+
+    ~ScopedPerfEventCounters() {
+        PerfEventCounters::Values end;
+        if (_perf == nullptr || !_perf->read(&end)) {
+            return;
+        }
+        for (int i = 0; i < PerfEventCounters::NUM_EVENTS; ++i) {
+            COUNTER_UPDATE(_counters[i], static_cast<int64_t>(end.values[i] - _start.values[i]) * _scale);
+        }
+    }
+
+private:
+    const PerfEventCounters* _perf;
+    RuntimeProfile::Counter* const* _counters;
+    const int64_t _scale;
+    PerfEventCounters::Values _start;
+};
+
+#define SCOPED_PERF_EVENT_COUNTERS(perf, counters, scale) \
+    ScopedPerfEventCounters MACRO_CONCAT(SCOPED_PERF_EVENT_COUNTERS, __COUNTER__)(perf, counters, scale)
+
+} // namespace starrocks
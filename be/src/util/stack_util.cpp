@@ -24,6 +24,7 @@
 #include <fmt/ostream.h>
 #include <sys/syscall.h>
 
+#include <algorithm>
 #include <thread>
 #include <tuple>
 
@@ -61,6 +62,8 @@ struct StackTraceTask {
     void* addrs[kMaxStackDepth];
     int depth{0};
     bool done = false;
+    // if set, the stack is only captured when the thread is running this query
+    const TUniqueId* query_id = nullptr;
     int64_t cost_us = 0;
     string to_string(const std::string& line_prefix = "") const {
         string ret;
@@ -135,6 +138,12 @@ void get_stack_trace_sighandler(int signum, siginfo_t* siginfo, void* ucontext)
         return;
     }
     auto& task = it->second;
+    if (task.query_id != nullptr && CurrentThread::current().query_id() != *task.query_id) {
+        task.depth = 0;
+        task.cost_us = MonotonicMicros() - start_us;
+        task.done = true;
+        return;
+    }
     task.depth = google::glog_internal_namespace_::GetStackTrace(task.addrs, StackTraceTask::kMaxStackDepth, 2);
     // get_stack_trace_for_thread first checks done flag then gets the cost.
     // To ensure the cost is valid, set cost before done flag
@@ -348,6 +357,114 @@ std::vector<int> get_thread_id_list() {
     return thread_id_list;
 }
 
+std::vector<int> get_thread_id_list_with_name_prefix(const std::string& prefix) {
+    std::vector<int> thread_id_list;
+    for (int tid : get_thread_id_list()) {
+        FILE* fp = fopen(fmt::format("/proc/self/task/{}/comm", tid).c_str(), "r");
+        if (fp == nullptr) {
+            continue;
+        }
+        char name[64];
+        if (fgets(name, sizeof(name), fp) != nullptr && strncmp(name, prefix.c_str(), prefix.size()) == 0) {
+            thread_id_list.push_back(tid);
+        }
+        fclose(fp);
+    }
+    return thread_id_list;
+}
+
+static std::string symbolize_frame(void* addr) {
+    char buf[1024];
+    bool success = false;
+#ifndef BE_TEST
+    success = google::glog_internal_namespace_::Symbolize(
+            addr, buf, sizeof(buf), google::glog_internal_namespace_::SymbolizeOptions::kNoLineNumbers);
+#else
+    std::tuple<void*, char*, size_t> tuple = {addr, buf, sizeof(buf)};
+    TEST_SYNC_POINT_CALLBACK("StackTraceTask::symbolize", &tuple);
+    success = true;
+#endif
+    if (!success) {
+        return fmt::format("{}", addr);
+    }
+    std::string frame(buf);
+    // ';' separates the frames in the collapsed format
+    std::replace(frame.begin(), frame.end(), ';', ':');
+    return frame;
+}
+
+std::string get_collapsed_stacks_for_query(const std::vector<int>& tids, const TUniqueId& query_id, int duration_ms,
+                                           int frequency) {
+    static bool sighandler_installed = false;
+    if (!sighandler_installed) {
+        if (!install_stack_trace_sighandler()) {
+            auto msg = strings::Substitute("install stack trace signal handler failed, error: $0", strerror(errno));
+            LOG(WARNING) << msg;
+            return msg;
+        }
+        sighandler_installed = true;
+    }
+    const auto pid = getpid();
+    const auto uid = getuid();
+    const int64_t interval_us = 1000000 / std::max(frequency, 1);
+    const int64_t end_us = MonotonicMicros() + duration_ms * 1000L;
+    // stack -> number of samples
+    std::unordered_map<StackTraceTask, int64_t, StackTraceTaskHash> samples;
+    while (MonotonicMicros() < end_us) {
+        int64_t round_start_us = MonotonicMicros();
+        auto stack_trace_id = g_stack_trace_id.fetch_add(1);
+        StackTraceTaskMapSharedPtr tasks = std::make_shared<StackTraceTaskMap>();
+        for (int tid : tids) {
+            tasks->emplace(tid, StackTraceTask()).first->second.query_id = &query_id;
+        }
+        g_running_stack_trace.insert_or_assign(stack_trace_id, tasks);
+        DeferOp defer([stack_trace_id]() { g_running_stack_trace.erase(stack_trace_id); });
+        for (int tid : tids) {
+            union sigval payload;
+            payload.sival_int = stack_trace_id;
+            // the thread may have exited, just skip it
+            (void)signal_thread(pid, tid, uid, SIGRTMIN, payload);
+        }
+        // wait for the samples of this round, the late ones are dropped
+        while (MonotonicMicros() - round_start_us < interval_us) {
+            usleep(std::min<int64_t>(1000, interval_us));
+            bool all_done = true;
+            for (auto& [tid, task] : *tasks) {
+                all_done &= task.done;
+            }
+            if (all_done) {
+                break;
+            }
+        }
+        for (auto& [tid, task] : *tasks) {
+            if (task.done && task.depth > 0) {
+                samples[task]++;
+            }
+        }
+        int64_t remain_us = interval_us - (MonotonicMicros() - round_start_us);
+        if (remain_us > 0) {
+            usleep(remain_us);
+        }
+    }
+
+    std::unordered_map<void*, std::string> symbols;
+    std::string ret;
+    for (auto& [task, count] : samples) {
+        // the outermost frame comes first
+        for (int i = task.depth - 1; i >= 0; --i) {
+            auto iter = symbols.find(task.addrs[i]);
+            if (iter == symbols.end()) {
+                iter = symbols.emplace(task.addrs[i], symbolize_frame(task.addrs[i])).first;
+            }
+            ret += iter->second;
+            ret += i > 0 ? ";" : " ";
+        }
+        ret += std::to_string(count);
+        ret += "\n";
+    }
+    return ret;
+}
+
 class ExceptionStackContext {
 public:
     static ExceptionStackContext* get_instance() {
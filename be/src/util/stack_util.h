@@ -23,6 +23,8 @@
 
 namespace starrocks {
 
+class TUniqueId;
+
 // Returns the stack trace as a string from the current location.
 // Note: there is a libc bug that causes this not to work on 64 bit machines
 // for recursive calls.
@@ -36,6 +38,13 @@ std::string get_stack_trace_for_all_threads_with_prefix(const std::string& line_
 std::string get_stack_trace_for_all_threads();
 // get all thread stack trace, and filter by function pattern
 std::string get_stack_trace_for_function(const std::string& function_pattern);
+// get the ids of the threads whose name starts with `prefix`
+std::vector<int> get_thread_id_list_with_name_prefix(const std::string& prefix);
+// Samples the stacks of the threads in `tids` which are running the query `query_id`, `frequency` times per
+// second for `duration_ms`. Returns the stacks in the collapsed format of flamegraph.pl: one line per distinct
+// stack with the frames from the outermost one separated by ';', followed by the number of its samples.
+std::string get_collapsed_stacks_for_query(const std::vector<int>& tids, const TUniqueId& query_id, int duration_ms,
+                                           int frequency);
 
 // wrap libc's _cxa_throw to print stack trace of exceptions
 extern "C" {
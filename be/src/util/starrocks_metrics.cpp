@@ -113,6 +113,13 @@ StarRocksMetrics::StarRocksMetrics() : _metrics(_s_registry_name), _table_metric
     REGISTER_STARROCKS_METRIC(primary_key_wait_apply_done_duration_ms);
     REGISTER_STARROCKS_METRIC(primary_key_wait_apply_done_total);
 
+    REGISTER_STARROCKS_METRIC(huge_page_advise_total);
+    REGISTER_STARROCKS_METRIC(huge_page_advise_failed_total);
+    REGISTER_STARROCKS_METRIC(huge_page_advised_bytes_total);
+
+    REGISTER_STARROCKS_METRIC(spill_arbitrate_revoked_queries_total);
+    REGISTER_STARROCKS_METRIC(spill_arbitrate_revoked_operators_total);
+
     // push request
     _metrics.register_metric("push_requests_total", MetricLabels().add("status", "SUCCESS"),
                              &push_requests_success_total);
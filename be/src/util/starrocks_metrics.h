@@ -98,7 +98,7 @@ public:
     pipeline::PipelineExecutorMetrics pipeline_executor_metrics;
     METRIC_DEFINE_INT_GAUGE(pipe_prepare_pool_queue_len, MetricUnit::NOUNIT);
     METRIC_DEFINE_INT_GAUGE(pipe_scan_executor_queuing, MetricUnit::NOUNIT);
-    METRIC_DEFINE_INT_GAUGE(pipe_driver_overloaded, MetricUnit::NOUNIT);
+    METRIC_DEFINE_INT_CORE_LOCAL_GAUGE(pipe_driver_overloaded, MetricUnit::NOUNIT);
     METRIC_DEFINE_INT_GAUGE(pipe_driver_schedule_count, MetricUnit::NOUNIT);
     METRIC_DEFINE_INT_GAUGE(pipe_driver_execution_time, MetricUnit::NANOSECONDS);
     METRIC_DEFINE_INT_GAUGE(pipe_driver_queue_len, MetricUnit::NOUNIT);
@@ -284,8 +284,17 @@ public:
     METRIC_DEFINE_INT_COUNTER(primary_key_wait_apply_done_duration_ms, MetricUnit::MILLISECONDS);
     METRIC_DEFINE_INT_COUNTER(primary_key_wait_apply_done_total, MetricUnit::REQUESTS);
 
+    // Transparent huge pages advised for large allocations, see SystemAllocator::advise_huge_pages.
+    METRIC_DEFINE_INT_COUNTER(huge_page_advise_total, MetricUnit::REQUESTS);
+    METRIC_DEFINE_INT_COUNTER(huge_page_advise_failed_total, MetricUnit::REQUESTS);
+    METRIC_DEFINE_INT_COUNTER(huge_page_advised_bytes_total, MetricUnit::BYTES);
+
+    // Queries and operators asked to spill by spill::MemoryArbitrator because the process is short of memory.
+    METRIC_DEFINE_INT_COUNTER(spill_arbitrate_revoked_queries_total, MetricUnit::REQUESTS);
+    METRIC_DEFINE_INT_COUNTER(spill_arbitrate_revoked_operators_total, MetricUnit::REQUESTS);
+
     // Gauges
-    METRIC_DEFINE_INT_GAUGE(memory_pool_bytes_total, MetricUnit::BYTES);
+    METRIC_DEFINE_INT_CORE_LOCAL_GAUGE(memory_pool_bytes_total, MetricUnit::BYTES);
     METRIC_DEFINE_INT_GAUGE(process_thread_num, MetricUnit::NOUNIT);
     METRIC_DEFINE_INT_GAUGE(process_fd_num_used, MetricUnit::NOUNIT);
     METRIC_DEFINE_INT_GAUGE(process_fd_num_limit_soft, MetricUnit::NOUNIT);
@@ -202,6 +202,23 @@ private:
     // Return PARSE_FAILURE on leading whitespace. Trailing whitespace is allowed.
     static inline bool string_to_bool_internal(const char* s, int len, ParseResult* result);
 
+    // Returns true if all 8 bytes of chunk (loaded from memory in little-endian order) are '0'..'9'.
+    static inline bool is_eight_digits_swar(uint64_t chunk) {
+        return ((chunk & 0xF0F0F0F0F0F0F0F0ULL) |
+                (((chunk + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) == 0x3333333333333333ULL;
+    }
+
+    // Converts 8 ascii digits to their value with three multiplications instead of 8 dependent ones.
+    static inline uint32_t parse_eight_digits_swar(uint64_t chunk) {
+        constexpr uint64_t mask = 0x000000FF000000FFULL;
+        constexpr uint64_t mul1 = 100 + (1000000ULL << 32);
+        constexpr uint64_t mul2 = 1 + (10000ULL << 32);
+        chunk -= 0x3030303030303030ULL;
+        chunk = (chunk * 10) + (chunk >> 8);
+        chunk = (((chunk & mask) * mul1) + (((chunk >> 16) & mask) * mul2)) >> 32;
+        return static_cast<uint32_t>(chunk);
+    }
+
     // Returns true if s only contains whitespace.
     static inline bool is_all_whitespace(const char* s, int len) {
         for (int i = 0; i < len; ++i) {
@@ -407,7 +424,20 @@ inline T StringParser::string_to_int_no_overflow(const char* s, int len, ParseRe
         *result = PARSE_FAILURE;
         return 0;
     }
-    for (int i = 1; i < len; ++i) {
+    int i = 1;
+    // Long values (e.g. bigint ids) are consumed 8 digits at a time, see parse_eight_digits_swar.
+    if constexpr (sizeof(T) >= sizeof(uint32_t)) {
+        while (i + 8 <= len) {
+            uint64_t chunk;
+            memcpy(&chunk, s + i, sizeof(chunk));
+            if (!is_eight_digits_swar(chunk)) {
+                break;
+            }
+            val = val * 100000000 + parse_eight_digits_swar(chunk);
+            i += 8;
+        }
+    }
+    for (; i < len; ++i) {
         if (LIKELY(s[i] >= '0' && s[i] <= '9')) {
             T digit = s[i] - '0';
             val = val * 10 + digit;
@@ -102,6 +102,11 @@ ThreadPoolBuilder& ThreadPoolBuilder::set_borrowed_cpuids(const std::vector<CpuU
     return *this;
 }
 
+ThreadPoolBuilder& ThreadPoolBuilder::set_bind_numa_node(bool bind_numa_node) {
+    _bind_numa_node = bind_numa_node;
+    return *this;
+}
+
 Status ThreadPoolBuilder::build(std::unique_ptr<ThreadPool>* pool) const {
     pool->reset(new ThreadPool(*this));
     RETURN_IF_ERROR((*pool)->init());
@@ -124,6 +129,11 @@ Status ThreadPoolToken::submit_func(std::function<void()> f, ThreadPool::Priorit
     return submit(std::make_shared<FunctionRunnable>(std::move(f)), pri);
 }
 
+void ThreadPoolToken::set_priority(ThreadPool::Priority pri) {
+    std::lock_guard l(_pool->_lock);
+    _priority = pri;
+}
+
 void ThreadPoolToken::shutdown() {
     // Define the to_release queue before acquiring the lock, so that tasks in the queue
     // are destructed after the lock is released. This is important because the task's
@@ -261,7 +271,8 @@ ThreadPool::ThreadPool(const ThreadPoolBuilder& builder)
           _total_queued_tasks(0),
           _tokenless(new_token(ExecutionMode::CONCURRENT)),
           _cpuids(builder._cpuids),
-          _borrowed_cpuids(builder._borrowed_cpuids) {}
+          _borrowed_cpuids(builder._borrowed_cpuids),
+          _bind_numa_node(builder._bind_numa_node) {}
 
 ThreadPool::~ThreadPool() noexcept {
     // There should only be one live token: the one used in tokenless submission.
@@ -343,6 +354,18 @@ void ThreadPool::shutdown() {
     }
 }
 
+void ThreadPool::enqueue_token(ThreadPoolToken* token) {
+    if (token->_priority == HIGH_PRIORITY) {
+        auto it = _queue.begin();
+        while (it != _queue.end() && (*it)->_priority == HIGH_PRIORITY) {
+            ++it;
+        }
+        _queue.insert(it, token);
+    } else {
+        _queue.emplace_back(token);
+    }
+}
+
 std::unique_ptr<ThreadPoolToken> ThreadPool::new_token(ExecutionMode mode) {
     std::lock_guard unique_lock(_lock);
     std::unique_ptr<ThreadPoolToken> t(new ThreadPoolToken(this, mode));
@@ -431,7 +454,7 @@ Status ThreadPool::do_submit(std::shared_ptr<Runnable> r, ThreadPoolToken* token
     DCHECK(state == ThreadPoolToken::State::IDLE || state == ThreadPoolToken::State::RUNNING);
     token->_entries.emplace_back(pri, std::move(task));
     if (state == ThreadPoolToken::State::IDLE || token->mode() == ExecutionMode::CONCURRENT) {
-        _queue.emplace_back(token);
+        enqueue_token(token);
         if (state == ThreadPoolToken::State::IDLE) {
             token->transition(ThreadPoolToken::State::RUNNING);
         }
@@ -510,9 +533,14 @@ Status ThreadPool::update_min_threads(int min_threads) {
 }
 
 static void _bind_cpus_inlock(Thread* thread, const size_t thread_index, const CpuUtil::CpuIds& cpuids,
-                              const std::vector<CpuUtil::CpuIds>& borrowed_cpuids) {
+                              const std::vector<CpuUtil::CpuIds>& borrowed_cpuids, bool bind_numa_node) {
     if (borrowed_cpuids.empty() || thread_index < cpuids.size()) {
-        CpuUtil::bind_cpus(thread, cpuids);
+        if (bind_numa_node) {
+            // Spread the threads over the NUMA nodes, and keep each of them on one node.
+            CpuUtil::bind_cpus(thread, CpuUtil::numa_local_cpuids(cpuids, thread_index));
+        } else {
+            CpuUtil::bind_cpus(thread, cpuids);
+        }
         return;
     }
 
@@ -551,7 +579,7 @@ void ThreadPool::bind_cpus(const CpuUtil::CpuIds& cpuids, const std::vector<CpuU
 
     int i = 0;
     for (auto* thread : _threads) {
-        _bind_cpus_inlock(thread, i++, cpuids, borrowed_cpuids);
+        _bind_cpus_inlock(thread, i++, cpuids, borrowed_cpuids, _bind_numa_node);
     }
 }
 
@@ -569,7 +597,7 @@ void ThreadPool::dispatch_thread() {
     // Owned by this worker thread and added/removed from _idle_threads as needed.
     IdleThread me;
 
-    _bind_cpus_inlock(current_thread, _num_threads - 1, _cpuids, _borrowed_cpuids);
+    _bind_cpus_inlock(current_thread, _num_threads - 1, _cpuids, _borrowed_cpuids, _bind_numa_node);
 
     while (true) {
         // Note: Status::Aborted() is used to indicate normal shutdown.
@@ -661,7 +689,7 @@ void ThreadPool::dispatch_thread() {
             } else if (token->_entries.empty()) {
                 token->transition(ThreadPoolToken::State::IDLE);
             } else if (token->mode() == ExecutionMode::SERIAL) {
-                _queue.emplace_back(token);
+                enqueue_token(token);
             }
         }
         if (--_active_threads == 0) {
@@ -147,6 +147,8 @@ public:
     ThreadPoolBuilder& set_idle_timeout(const MonoDelta& idle_timeout);
     ThreadPoolBuilder& set_cpuids(const CpuUtil::CpuIds& cpuids);
     ThreadPoolBuilder& set_borrowed_cpuids(const std::vector<CpuUtil::CpuIds>& borrowed_cpuids);
+    // Bind each thread to the cpuids of only one NUMA node, instead of all the cpuids.
+    ThreadPoolBuilder& set_bind_numa_node(bool bind_numa_node);
 
     // Instantiate a new ThreadPool with the existing builder arguments.
     Status build(std::unique_ptr<ThreadPool>* pool) const;
@@ -160,6 +162,7 @@ private:
     MonoDelta _idle_timeout;
     CpuUtil::CpuIds _cpuids;
     std::vector<CpuUtil::CpuIds> _borrowed_cpuids;
+    bool _bind_numa_node = false;
 
     ThreadPoolBuilder(const ThreadPoolBuilder&) = delete;
     const ThreadPoolBuilder& operator=(const ThreadPoolBuilder&) = delete;
@@ -324,6 +327,10 @@ private:
     // Submits a task to be run via token.
     Status do_submit(std::shared_ptr<Runnable> r, ThreadPoolToken* token, ThreadPool::Priority pri);
 
+    // Appends a runnable token to '_queue', after the tokens of high priority if it has a high priority.
+    // REQUIRES: caller holds '_lock'.
+    void enqueue_token(ThreadPoolToken* token);
+
     // Releases token 't' and invalidates it.
     void release_token(ThreadPoolToken* t);
 
@@ -417,6 +424,7 @@ private:
 
     CpuUtil::CpuIds _cpuids;
     std::vector<CpuUtil::CpuIds> _borrowed_cpuids;
+    const bool _bind_numa_node;
 
     // Total number of tasks that have finished
     CoreLocalCounter<int64_t> _total_executed_tasks{MetricUnit::NOUNIT};
@@ -450,6 +458,11 @@ public:
     // Submits a function bound using std::bind(&FuncName, args...)  with specified priority.
     Status submit_func(std::function<void()> f, ThreadPool::Priority pri = ThreadPool::LOW_PRIORITY);
 
+    // Sets the priority of this token among the tokens of the pool. The queued tasks of a token of
+    // high priority are picked before those of the tokens of low priority, while the tasks of this
+    // token keep their own order.
+    void set_priority(ThreadPool::Priority pri);
+
     // Marks the token as unusable for future submissions. Any queued tasks not
     // yet running are destroyed. If tasks are in flight, Shutdown() will wait
     // on their completion before returning.
@@ -537,6 +550,9 @@ private:
     // token.
     int _active_threads;
 
+    // Priority of the token in the pool's queue of runnable tokens.
+    ThreadPool::Priority _priority = ThreadPool::LOW_PRIORITY;
+
     ThreadPoolToken(const ThreadPoolToken&) = delete;
     const ThreadPoolToken& operator=(const ThreadPoolToken&) = delete;
 };
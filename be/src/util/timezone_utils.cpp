@@ -216,4 +216,10 @@ int64_t TimezoneUtils::to_utc_offset(const cctz::time_zone& ctz) {
     return a.cs - b.cs;
 }
 
+bool TimezoneUtils::is_fixed_offset(const cctz::time_zone& ctz) {
+    // fixed_time_zone() returns the same zone for the same offset, so a region zone never compares equal
+    // to it, even if its current offset is the same.
+    return ctz == cctz::fixed_time_zone(cctz::seconds(to_utc_offset(ctz)));
+}
+
 } // namespace starrocks
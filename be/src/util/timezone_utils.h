@@ -53,6 +53,8 @@ public:
     static bool find_cctz_time_zone(std::string_view timezone, cctz::time_zone& ctz);
     static bool timezone_offsets(std::string_view src, std::string_view dst, int64_t* offset);
     static int64_t to_utc_offset(const cctz::time_zone& ctz); // timezone offset in seconds.
+    // true if ctz is a fixed offset from UTC, e.g. "+08:00" or "UTC", which never has any transition.
+    static bool is_fixed_offset(const cctz::time_zone& ctz);
     static cctz::time_zone local_time_zone();
 
 public:
@@ -0,0 +1,93 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "cache/lrucache_engine.h"
+
+#include <gtest/gtest.h>
+
+#include "testutil/assert.h"
+
+namespace starrocks {
+
+class LRUCacheEngineTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        CacheOptions options;
+        options.mem_space_size = 1024 * 1024;
+        options.engine = "lrucache";
+        ASSERT_OK(_cache.init(options));
+    }
+
+    static IOBuffer make_buffer(char ch, size_t size) {
+        auto* data = new char[size];
+        memset(data, ch, size);
+        IOBuffer buffer;
+        buffer.append_user_data(data, size, [](void* p) { delete[] static_cast<char*>(p); });
+        return buffer;
+    }
+
+    LRUCacheEngine _cache;
+};
+
+TEST_F(LRUCacheEngineTest, test_write_and_read) {
+    ASSERT_TRUE(_cache.available());
+    ASSERT_EQ(DataCacheEngineType::LRUCACHE, _cache.engine_type());
+
+    WriteCacheOptions write_options;
+    ASSERT_OK(_cache.write("block_1", make_buffer('a', 4096), &write_options));
+    ASSERT_EQ(4096, write_options.stats.write_mem_bytes);
+    ASSERT_TRUE(_cache.exist("block_1"));
+    // no overwrite by default
+    ASSERT_TRUE(_cache.write("block_1", make_buffer('b', 4096), &write_options).is_already_exist());
+
+    ReadCacheOptions read_options;
+    IOBuffer buffer;
+    ASSERT_OK(_cache.read("block_1", 100, 1000, &buffer, &read_options));
+    ASSERT_EQ(1000, buffer.size());
+    ASSERT_EQ(std::string(1000, 'a'), buffer.const_raw_buf().to_string());
+    ASSERT_EQ(1000, read_options.stats.read_mem_bytes);
+
+    // out of range
+    IOBuffer buffer2;
+    ASSERT_FALSE(_cache.read("block_1", 4000, 1000, &buffer2, &read_options).ok());
+    ASSERT_TRUE(_cache.read("block_2", 0, 10, &buffer2, &read_options).is_not_found());
+
+    write_options.overwrite = true;
+    ASSERT_OK(_cache.write("block_1", make_buffer('b', 4096), &write_options));
+    // the buffer read before still holds the old content
+    ASSERT_EQ(std::string(1000, 'a'), buffer.const_raw_buf().to_string());
+
+    ASSERT_OK(_cache.remove("block_1"));
+    ASSERT_FALSE(_cache.exist("block_1"));
+}
+
+TEST_F(LRUCacheEngineTest, test_evict_and_quota) {
+    for (int i = 0; i < 512; i++) {
+        ASSERT_OK(_cache.write(std::to_string(i), make_buffer('a', 4096), nullptr));
+    }
+    auto metrics = _cache.cache_metrics(0);
+    ASSERT_EQ(1024 * 1024, metrics.mem_quota_bytes);
+    ASSERT_LE(metrics.mem_used_bytes, 1024 * 1024);
+    // the oldest items are evicted
+    ASSERT_FALSE(_cache.exist("0"));
+    ASSERT_TRUE(_cache.exist("511"));
+
+    ASSERT_OK(_cache.update_mem_quota(0, false));
+    ASSERT_FALSE(_cache.available());
+    ASSERT_FALSE(_cache.exist("511"));
+    ASSERT_FALSE(_cache.update_disk_spaces({}).ok());
+}
+
+} // namespace starrocks
@@ -92,6 +92,31 @@ TEST_F(StoragePageCacheTest, insert_with_deleter) {
     }
 }
 
+// NOLINTNEXTLINE
+TEST_F(StoragePageCacheTest, compressed_tier) {
+    std::string key("abc0");
+    PageCacheHandle handle;
+    ASSERT_FALSE(_page_cache->has_compressed_tier());
+
+    auto compressed_lru_cache = std::make_shared<ShardedLRUCache>(_capacity);
+    auto compressed_obj_cache = std::make_shared<LRUCacheModule>(compressed_lru_cache);
+    _page_cache->set_compressed_tier(compressed_obj_cache.get());
+    ASSERT_TRUE(_page_cache->has_compressed_tier());
+
+    auto data = std::make_unique<std::vector<uint8_t>>(256, 7);
+    ASSERT_OK(_page_cache->insert_compressed(key, data.get(), &handle));
+    auto* check_data = data.release();
+
+    // the two tiers are looked up separately
+    ASSERT_FALSE(_page_cache->lookup(key, &handle));
+    ASSERT_TRUE(_page_cache->lookup_compressed(key, &handle));
+    ASSERT_EQ(handle.data(), check_data);
+    ASSERT_EQ(0, _page_cache->memory_usage());
+
+    handle = PageCacheHandle();
+    _page_cache->set_compressed_tier(nullptr);
+}
+
 // NOLINTNEXTLINE
 TEST_F(StoragePageCacheTest, normal) {
     {
@@ -16,7 +16,10 @@
 
 #include <gtest/gtest.h>
 
+#include "column/column_helper.h"
 #include "column/fixed_length_column.h"
+#include "column/nullable_column.h"
+#include "exprs/agg/aggregate_factory.h"
 
 namespace starrocks {
 class AnalytorTest : public ::testing::Test {
@@ -126,4 +129,61 @@ TEST_F(AnalytorTest, find_partition_end) {
     ASSERT_EQ(analytor3._partition.end, 0);
 }
 
+// NOLINTNEXTLINE
+TEST_F(AnalytorTest, segment_tree_sliding_frame) {
+    std::unique_ptr<FunctionContext> ctx(
+            FunctionContext::create_test_context({TypeDescriptor(TYPE_INT)}, TypeDescriptor(TYPE_INT)));
+    TPlanNode plan_node;
+    RowDescriptor row_desc;
+    Analytor analytor(plan_node, row_desc, nullptr, false);
+
+    const AggregateFunction* max_func = get_window_function("max", TYPE_INT, TYPE_INT, true);
+    ASSERT_NE(max_func, nullptr);
+
+    const int64_t num_rows = 1000;
+    auto data = NullableColumn::create(Int32Column::create(), NullColumn::create());
+    for (int32_t i = 0; i < num_rows; ++i) {
+        if (i % 97 == 0) {
+            data->append_nulls(1);
+        } else {
+            data->append_datum(Datum((i * 7919) % 1013));
+        }
+    }
+
+    analytor._is_merge_funcs = false;
+    analytor._is_lead_lag_functions = {false};
+    analytor._agg_fn_ctxs = {ctx.get()};
+    analytor._agg_functions = {max_func};
+    analytor._agg_intput_columns = {Columns{data}};
+    analytor._agg_fn_types = {FunctionTypes{TypeDescriptor(TYPE_INT), true, true}};
+    analytor._agg_states_offsets = {0};
+    analytor._mem_pool = std::make_unique<MemPool>();
+    AggDataPtr states = analytor._mem_pool->allocate_aligned(max_func->size(), max_func->alignof_size());
+    analytor._managed_fn_states.emplace_back(
+            std::make_unique<ManagedFunctionStates<Analytor>>(&analytor._agg_fn_ctxs, states, &analytor));
+    analytor._partition.start = 0;
+    analytor._partition.is_real = true;
+    analytor._partition.end = num_rows;
+
+    analytor._build_segment_tree();
+    // levels of 16, 32, ..., 512 rows
+    ASSERT_EQ(6, analytor._segment_tree_nodes[0].size());
+
+    for (int64_t start : {-20, 0, 3, 16, 17, 250, 999}) {
+        for (int64_t width : {0, 1, 15, 16, 33, 300, 1000, 1200}) {
+            auto expected = ColumnHelper::create_column(TypeDescriptor(TYPE_INT), true);
+            analytor._reset_window_state();
+            analytor._update_window_batch(0, num_rows, start, start + width);
+            max_func->finalize_to_column(ctx.get(), states, expected.get());
+
+            auto actual = ColumnHelper::create_column(TypeDescriptor(TYPE_INT), true);
+            analytor._reset_window_state();
+            analytor._update_window_batch_by_segment_tree(start, start + width);
+            max_func->finalize_to_column(ctx.get(), states, actual.get());
+
+            ASSERT_EQ(expected->debug_item(0), actual->debug_item(0)) << start << " " << width;
+        }
+    }
+}
+
 } // namespace starrocks
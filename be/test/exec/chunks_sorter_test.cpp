@@ -18,6 +18,7 @@
 
 #include <cstdio>
 #include <memory>
+#include <random>
 #include <string_view>
 
 #include "column/column_helper.h"
@@ -1141,6 +1142,58 @@ TEST_F(ChunksSorterTest, stable_sort) {
     ASSERT_EQ(expect, result);
 }
 
+TEST_F(ChunksSorterTest, sort_by_normalized_key) {
+    constexpr int N = 4096;
+    std::mt19937 rng(0);
+    ColumnPtr col1 = ColumnHelper::create_column(TypeDescriptor(TYPE_TINYINT), true);
+    ColumnPtr col2 = ColumnHelper::create_column(TypeDescriptor(TYPE_INT), false);
+    ColumnPtr col3 = ColumnHelper::create_column(TypeDescriptor(TYPE_BIGINT), true);
+    ColumnPtr col4 = ColumnHelper::create_column(TypeDescriptor(TYPE_DATE), false);
+    for (int i = 0; i < N; i++) {
+        if (rng() % 10 == 0) {
+            col1->append_nulls(1);
+        } else {
+            col1->append_datum(Datum(static_cast<int8_t>(rng() % 16 - 8)));
+        }
+        col2->append_datum(Datum(static_cast<int32_t>(rng() % 64) - 32));
+        if (rng() % 10 == 0) {
+            col3->append_nulls(1);
+        } else {
+            col3->append_datum(Datum(static_cast<int64_t>(rng()) - (1LL << 31)));
+        }
+        col4->append_datum(Datum(DateValue::create(2000 + rng() % 3, 1 + rng() % 12, 1)));
+    }
+
+    std::vector<Columns> columns_list{{col1, col2}, {col1, col2, col3}, {col2, col1, col3, col4}};
+    for (const auto& columns : columns_list) {
+        for (bool asc : {true, false}) {
+            for (bool null_first : {true, false}) {
+                std::vector<bool> orders(columns.size(), asc);
+                std::vector<bool> null_firsts(columns.size(), null_first);
+                orders[0] = !asc;
+                SortDescs sort_desc(orders, null_firsts);
+
+                Permutation expected;
+                config::enable_sort_normalized_key = false;
+                ASSERT_OK(sort_and_tie_columns(false, columns, sort_desc, &expected));
+                Permutation actual;
+                config::enable_sort_normalized_key = true;
+                ASSERT_OK(sort_and_tie_columns(false, columns, sort_desc, &actual));
+                config::enable_sort_normalized_key = false;
+
+                // Rows with equal sort keys may be permuted differently, so compare the sort keys
+                ASSERT_EQ(expected.size(), actual.size());
+                for (size_t i = 0; i < actual.size(); i++) {
+                    for (const auto& column : columns) {
+                        ASSERT_EQ(0, column->compare_at(expected[i].index_in_chunk, actual[i].index_in_chunk,
+                                                        *column, 1));
+                    }
+                }
+            }
+        }
+    }
+}
+
 void pack_nullable(Chunk* chunk) {
     for (auto& col : chunk->columns()) {
         col = NullableColumn::create(col, NullColumn::create(col->size()));
@@ -0,0 +1,236 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/hash_join_components.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <tuple>
+
+#include "column/chunk.h"
+#include "column/fixed_length_column.h"
+#include "common/config.h"
+#include "common/object_pool.h"
+#include "exec/hash_joiner.h"
+#include "exprs/column_ref.h"
+#include "exprs/expr_context.h"
+#include "runtime/descriptor_helper.h"
+#include "runtime/runtime_state.h"
+#include "testutil/assert.h"
+#include "util/cpu_info.h"
+#include "util/runtime_profile.h"
+
+namespace starrocks {
+
+class HashJoinComponentsTest : public ::testing::Test {
+public:
+    void SetUp() override {
+        TUniqueId fragment_id;
+        TQueryOptions query_options;
+        query_options.batch_size = kChunkSize;
+        TQueryGlobals query_globals;
+        _runtime_state = std::make_shared<RuntimeState>(fragment_id, query_options, query_globals, nullptr);
+        _runtime_state->init_instance_mem_tracker();
+
+        // probe tuple: slot 0 (key), slot 1 (value); build tuple: slot 2 (key), slot 3 (value)
+        TDescriptorTableBuilder desc_builder;
+        for (int tuple = 0; tuple < 2; tuple++) {
+            TTupleDescriptorBuilder tuple_builder;
+            for (int i = 0; i < 2; i++) {
+                tuple_builder.add_slot(TSlotDescriptorBuilder()
+                                               .type(TYPE_INT)
+                                               .column_name("c" + std::to_string(i))
+                                               .column_pos(i)
+                                               .nullable(false)
+                                               .build());
+            }
+            tuple_builder.build(&desc_builder);
+        }
+        DescriptorTbl* tbl = nullptr;
+        ASSERT_OK(DescriptorTbl::create(_runtime_state.get(), &_pool, desc_builder.desc_tbl(), &tbl, kChunkSize));
+        _probe_row_desc = std::make_unique<RowDescriptor>(*tbl, std::vector<TTupleId>{0});
+        _build_row_desc = std::make_unique<RowDescriptor>(*tbl, std::vector<TTupleId>{1});
+
+        _probe_expr_ctxs.push_back(_pool.add(new ExprContext(_pool.add(new ColumnRef(_int_type, kProbeKeySlot)))));
+        _build_expr_ctxs.push_back(_pool.add(new ExprContext(_pool.add(new ColumnRef(_int_type, kBuildKeySlot)))));
+        ASSERT_OK(Expr::prepare(_probe_expr_ctxs, _runtime_state.get()));
+        ASSERT_OK(Expr::prepare(_build_expr_ctxs, _runtime_state.get()));
+        ASSERT_OK(Expr::open(_probe_expr_ctxs, _runtime_state.get()));
+        ASSERT_OK(Expr::open(_build_expr_ctxs, _runtime_state.get()));
+
+        _join_node.join_op = TJoinOp::INNER_JOIN;
+
+        _cache_sizes = *CpuInfo::TEST_mutable_cache_sizes();
+        _max_partitions = config::partition_hash_join_max_partitions;
+    }
+
+    void TearDown() override {
+        *CpuInfo::TEST_mutable_cache_sizes() = _cache_sizes;
+        config::partition_hash_join_max_partitions = _max_partitions;
+        Expr::close(_probe_expr_ctxs, _runtime_state.get());
+        Expr::close(_build_expr_ctxs, _runtime_state.get());
+    }
+
+protected:
+    using JoinRow = std::tuple<int32_t, int32_t, int32_t, int32_t>;
+
+    static constexpr int32_t kChunkSize = 1024;
+    static constexpr int32_t kBuildRows = 64 * kChunkSize;
+    static constexpr SlotId kProbeKeySlot = 0;
+    static constexpr SlotId kProbeValueSlot = 1;
+    static constexpr SlotId kBuildKeySlot = 2;
+    static constexpr SlotId kBuildValueSlot = 3;
+
+    static ChunkPtr make_chunk(const std::vector<int32_t>& keys, SlotId key_slot, SlotId value_slot, int32_t factor) {
+        auto key_column = Int32Column::create();
+        auto value_column = Int32Column::create();
+        for (int32_t key : keys) {
+            key_column->append(key);
+            value_column->append(key * factor);
+        }
+        auto chunk = std::make_shared<Chunk>();
+        chunk->append_column(std::move(key_column), key_slot);
+        chunk->append_column(std::move(value_column), value_slot);
+        return chunk;
+    }
+
+    // Builds keys [0, kBuildRows) and probes keys [-kChunkSize, kBuildRows + kChunkSize) with step 3,
+    // returns the sorted output rows of the inner join, and the PartitionNums of the build side.
+    std::vector<JoinRow> run_join(bool enable_partition_hash_join, int64_t* partition_nums) {
+        HashJoinerParam param(&_pool, _join_node, {false}, _build_expr_ctxs, _probe_expr_ctxs, {}, {},
+                              *_build_row_desc, *_probe_row_desc, TPlanNodeType::EXCHANGE_NODE,
+                              TPlanNodeType::EXCHANGE_NODE, true, {}, {}, {}, TJoinDistributionMode::NONE,
+                              false, enable_partition_hash_join, false);
+        auto joiner = std::make_shared<HashJoiner>(param);
+        RuntimeProfile build_profile("build");
+        RuntimeProfile probe_profile("probe");
+        std::vector<JoinRow> rows;
+
+        EXPECT_OK(joiner->prepare_builder(_runtime_state.get(), &build_profile));
+        for (int32_t begin = 0; begin < kBuildRows; begin += kChunkSize) {
+            std::vector<int32_t> keys;
+            for (int32_t key = begin; key < begin + kChunkSize; key++) {
+                keys.push_back(key);
+            }
+            EXPECT_OK(joiner->append_chunk_to_ht(make_chunk(keys, kBuildKeySlot, kBuildValueSlot, 3)));
+        }
+        EXPECT_OK(joiner->build_ht(_runtime_state.get()));
+        *partition_nums = build_profile.get_counter("PartitionNums")->value();
+        joiner->enter_probe_phase();
+
+        EXPECT_OK(joiner->prepare_prober(_runtime_state.get(), &probe_profile));
+        joiner->reference_hash_table(joiner.get());
+
+        auto pull = [&]() {
+            auto chunk_or = joiner->pull_chunk(_runtime_state.get());
+            EXPECT_OK(chunk_or.status());
+            if (!chunk_or.ok()) {
+                return;
+            }
+            const auto& chunk = chunk_or.value();
+            for (size_t i = 0; i < chunk->num_rows(); i++) {
+                rows.emplace_back(chunk->get_column_by_slot_id(kProbeKeySlot)->get(i).get_int32(),
+                                  chunk->get_column_by_slot_id(kProbeValueSlot)->get(i).get_int32(),
+                                  chunk->get_column_by_slot_id(kBuildKeySlot)->get(i).get_int32(),
+                                  chunk->get_column_by_slot_id(kBuildValueSlot)->get(i).get_int32());
+            }
+        };
+
+        std::vector<int32_t> keys;
+        for (int32_t key = -kChunkSize; key < kBuildRows + kChunkSize; key += 3) {
+            keys.push_back(key);
+            if (keys.size() == static_cast<size_t>(kChunkSize)) {
+                EXPECT_TRUE(joiner->need_input());
+                EXPECT_OK(joiner->push_chunk(_runtime_state.get(),
+                                             make_chunk(keys, kProbeKeySlot, kProbeValueSlot, 2)));
+                keys.clear();
+                while (joiner->has_output()) {
+                    pull();
+                }
+            }
+        }
+        if (!keys.empty()) {
+            EXPECT_OK(joiner->push_chunk(_runtime_state.get(), make_chunk(keys, kProbeKeySlot, kProbeValueSlot, 2)));
+        }
+        EXPECT_OK(joiner->probe_input_finished(_runtime_state.get()));
+        joiner->enter_post_probe_phase();
+        while (!joiner->is_done() && joiner->has_output()) {
+            pull();
+        }
+        EXPECT_TRUE(joiner->is_done());
+
+        std::sort(rows.begin(), rows.end());
+        return rows;
+    }
+
+    static std::vector<JoinRow> expected_rows() {
+        std::vector<JoinRow> rows;
+        for (int32_t key = -kChunkSize; key < kBuildRows + kChunkSize; key += 3) {
+            if (key >= 0 && key < kBuildRows) {
+                rows.emplace_back(key, key * 2, key, key * 3);
+            }
+        }
+        return rows;
+    }
+
+    ObjectPool _pool;
+    std::shared_ptr<RuntimeState> _runtime_state;
+    std::unique_ptr<RowDescriptor> _probe_row_desc;
+    std::unique_ptr<RowDescriptor> _build_row_desc;
+    std::vector<ExprContext*> _probe_expr_ctxs;
+    std::vector<ExprContext*> _build_expr_ctxs;
+    THashJoinNode _join_node;
+    TypeDescriptor _int_type = TypeDescriptor(TYPE_INT);
+
+    std::vector<long> _cache_sizes;
+    int32_t _max_partitions = 0;
+};
+
+// With a tiny L3 cache the build side outgrows the 16 initial partitions, so the partitions are split
+// while the build chunks are appended, and the join result must be the same as without partitioning.
+TEST_F(HashJoinComponentsTest, test_expand_partitions) {
+    auto* cache_sizes = CpuInfo::TEST_mutable_cache_sizes();
+    (*cache_sizes)[CpuInfo::L2_CACHE] = 1024;
+    (*cache_sizes)[CpuInfo::L3_CACHE] = 16 * 1024;
+    config::partition_hash_join_max_partitions = 256;
+
+    auto expected = expected_rows();
+
+    int64_t partition_nums = 0;
+    auto single_rows = run_join(false, &partition_nums);
+    ASSERT_EQ(expected, single_rows);
+
+    auto partitioned_rows = run_join(true, &partition_nums);
+    ASSERT_GT(partition_nums, 16);
+    ASSERT_LE(partition_nums, 256);
+    // partition ids are the low bits of the hash, the partition number must stay a power of two
+    ASSERT_EQ(0, partition_nums & (partition_nums - 1));
+    ASSERT_EQ(expected, partitioned_rows);
+}
+
+// Without room to split, the partitions are collapsed into a single hash table as before.
+TEST_F(HashJoinComponentsTest, test_expand_partitions_over_limit) {
+    auto* cache_sizes = CpuInfo::TEST_mutable_cache_sizes();
+    (*cache_sizes)[CpuInfo::L2_CACHE] = 1024;
+    (*cache_sizes)[CpuInfo::L3_CACHE] = 16 * 1024;
+    config::partition_hash_join_max_partitions = 16;
+
+    int64_t partition_nums = 0;
+    auto rows = run_join(true, &partition_nums);
+    ASSERT_EQ(1, partition_nums);
+    ASSERT_EQ(expected_rows(), rows);
+}
+
+} // namespace starrocks
@@ -16,6 +16,7 @@
 
 #include <gtest/gtest.h>
 
+#include <filesystem>
 #include <memory>
 
 #include "cache/block_cache/block_cache.h"
@@ -682,6 +683,105 @@ TEST_F(HdfsScannerTest, TestOrcGetNextWithMinMaxFilterRows2) {
     scanner->close();
 }
 
+// The runtime filter arrives after the scanner is opened, so it is not in the search argument and only
+// OrcRowReaderFilter::filterRuntimeFilter can skip the row groups out of its min/max range.
+TEST_F(HdfsScannerTest, TestOrcRuntimeFilterSkipRowGroups) {
+    const int64_t num_rows = 10000;
+    const int64_t row_index_stride = 1000;
+    const std::string orc_file = std::filesystem::temp_directory_path() / "hdfs_scanner_orc_runtime_filter.orc";
+    {
+        orc::WriterOptions writer_options;
+        writer_options.setRowIndexStride(row_index_stride);
+        ORC_UNIQUE_PTR<orc::Type> schema(orc::Type::buildTypeFromString("struct<c1:bigint>"));
+        ORC_UNIQUE_PTR<orc::OutputStream> output = orc::writeLocalFile(orc_file);
+        ORC_UNIQUE_PTR<orc::Writer> writer = orc::createWriter(*schema, output.get(), writer_options);
+        ORC_UNIQUE_PTR<orc::ColumnVectorBatch> batch = writer->createRowBatch(row_index_stride);
+        auto* root = dynamic_cast<orc::StructVectorBatch*>(batch.get());
+        auto* c1 = dynamic_cast<orc::LongVectorBatch*>(root->fields[0]);
+        for (int64_t begin = 0; begin < num_rows; begin += row_index_stride) {
+            for (int64_t i = 0; i < row_index_stride; i++) {
+                c1->data[i] = begin + i;
+            }
+            c1->numElements = row_index_stride;
+            root->numElements = row_index_stride;
+            writer->add(*batch);
+        }
+        writer->close();
+    }
+
+    SlotDesc slot_descs[] = {{"c1", TypeDescriptor::from_logical_type(LogicalType::TYPE_BIGINT)}, {""}};
+
+    struct Case {
+        int64_t min_value;
+        int64_t max_value;
+        // rows of the row groups overlapping [min_value, max_value]
+        int64_t exp_raw_rows;
+    };
+    Case cases[] = {{.min_value = 2500, .max_value = 4200, .exp_raw_rows = 3000},
+                    {.min_value = 0, .max_value = 999, .exp_raw_rows = 1000},
+                    {.min_value = 9999, .max_value = 20000, .exp_raw_rows = 1000},
+                    {.min_value = 20000, .max_value = 30000, .exp_raw_rows = 0},
+                    {.min_value = -10, .max_value = 20000, .exp_raw_rows = num_rows}};
+
+    for (const Case& tc : cases) {
+        auto* range = _create_scan_range(orc_file, 0, 0);
+        auto* tuple_desc = _create_tuple_desc(slot_descs);
+        auto* param = _create_param(orc_file, range, tuple_desc);
+
+        RuntimeFilterProbeCollector rf_collector;
+        RuntimeFilterProbeDescriptor rf_probe_desc;
+        ColumnRef c1ref(tuple_desc->slots()[0]);
+        ExprContext probe_expr_ctx(&c1ref);
+        ASSERT_OK(probe_expr_ctx.prepare(_runtime_state));
+        ASSERT_OK(probe_expr_ctx.open(_runtime_state));
+        ASSERT_OK(rf_probe_desc.init(0, &probe_expr_ctx));
+        rf_collector.add_descriptor(&rf_probe_desc);
+        param->runtime_filter_collector = &rf_collector;
+
+        auto scanner = std::make_shared<HdfsOrcScanner>();
+        Status status = scanner->init(_runtime_state, *param);
+        ASSERT_TRUE(status.ok()) << status.message();
+        status = scanner->open(_runtime_state);
+        ASSERT_TRUE(status.ok()) << status.message();
+
+        RuntimeFilter* f = RuntimeFilterHelper::create_runtime_bloom_filter(&_pool, LogicalType::TYPE_BIGINT, 0);
+        f->get_membership_filter()->init(10);
+        ColumnPtr column = ColumnHelper::create_column(tuple_desc->slots()[0]->type(), false);
+        auto c = ColumnHelper::cast_to_raw<LogicalType::TYPE_BIGINT>(column);
+        c->append(tc.max_value);
+        c->append(tc.min_value);
+        ASSERT_OK(RuntimeFilterHelper::fill_runtime_filter(column, LogicalType::TYPE_BIGINT, f, 0, false));
+        rf_probe_desc.set_runtime_filter(f);
+
+        // the skipped row groups have no row in the filter range, so all the matched rows are still returned
+        int64_t records = 0;
+        int64_t matched_rows = 0;
+        ChunkPtr chunk = ChunkHelper::new_chunk(*tuple_desc, 0);
+        for (;;) {
+            chunk->reset();
+            status = scanner->get_next(_runtime_state, &chunk);
+            ASSERT_TRUE(status.ok() || status.is_end_of_file()) << status.message();
+            const auto& values = chunk->get_column_by_index(0);
+            for (size_t i = 0; i < chunk->num_rows(); i++) {
+                int64_t value = values->get(i).get_int64();
+                matched_rows += value >= tc.min_value && value <= tc.max_value;
+            }
+            records += chunk->num_rows();
+            if (status.is_end_of_file()) {
+                break;
+            }
+        }
+        EXPECT_EQ(tc.exp_raw_rows, records);
+        EXPECT_EQ(tc.exp_raw_rows, scanner->raw_rows_read());
+        EXPECT_EQ(std::max<int64_t>(0, std::min(tc.max_value, num_rows - 1) - std::max<int64_t>(tc.min_value, 0) + 1),
+                  matched_rows);
+
+        scanner->close();
+        probe_expr_ctx.close(_runtime_state);
+    }
+    std::filesystem::remove(orc_file);
+}
+
 // ====================================================================================================
 
 /**
@@ -313,4 +313,96 @@ TEST_F(WorkGroupDriverQueueTest, test_take_close) {
     consumer_thread->join();
 }
 
+PARALLEL_TEST(WorkStealingDriverQueueTest, test_take_local) {
+    PipelineExecutorMetrics metrics;
+    auto* queue_metrics = metrics.get_driver_queue_metrics();
+    WorkStealingDriverQueue queue(queue_metrics, std::make_unique<QuerySharedDriverQueue>(queue_metrics));
+    queue.attach_worker();
+
+    QueryContext query_context;
+    auto driver1 = std::make_shared<PipelineDriver>(_gen_operators(), &query_context, nullptr, nullptr, -1);
+    auto driver2 = std::make_shared<PipelineDriver>(_gen_operators(), &query_context, nullptr, nullptr, -1);
+
+    // driver1 is yielded by this thread, so it is put to the local queue and taken first.
+    queue.put_back(driver2.get());
+    queue.put_back_from_executor(driver1.get());
+    ASSERT_EQ(2, queue.size());
+
+    auto maybe_driver = queue.take(false);
+    ASSERT_TRUE(maybe_driver.ok());
+    ASSERT_EQ(driver1.get(), maybe_driver.value());
+    ASSERT_EQ(1, queue_metrics->driver_queue_local_take_count.value());
+
+    maybe_driver = queue.take(false);
+    ASSERT_TRUE(maybe_driver.ok());
+    ASSERT_EQ(driver2.get(), maybe_driver.value());
+    ASSERT_EQ(0, queue.size());
+
+    queue.detach_worker();
+}
+
+PARALLEL_TEST(WorkStealingDriverQueueTest, test_steal) {
+    PipelineExecutorMetrics metrics;
+    auto* queue_metrics = metrics.get_driver_queue_metrics();
+    WorkStealingDriverQueue queue(queue_metrics, std::make_unique<QuerySharedDriverQueue>(queue_metrics));
+    queue.attach_worker();
+
+    QueryContext query_context;
+    auto driver1 = std::make_shared<PipelineDriver>(_gen_operators(), &query_context, nullptr, nullptr, -1);
+    queue.put_back_from_executor(driver1.get());
+
+    auto stealer_thread = std::make_shared<std::thread>([&queue, &driver1] {
+        queue.attach_worker();
+        auto maybe_driver = queue.take(false);
+        ASSERT_TRUE(maybe_driver.ok());
+        ASSERT_EQ(driver1.get(), maybe_driver.value());
+        queue.detach_worker();
+    });
+    stealer_thread->join();
+
+    ASSERT_EQ(1, queue_metrics->driver_queue_steal_count.value());
+    ASSERT_EQ(0, queue.size());
+    queue.detach_worker();
+}
+
+PARALLEL_TEST(WorkStealingDriverQueueTest, test_detach_worker) {
+    PipelineExecutorMetrics metrics;
+    auto* queue_metrics = metrics.get_driver_queue_metrics();
+    WorkStealingDriverQueue queue(queue_metrics, std::make_unique<QuerySharedDriverQueue>(queue_metrics));
+    queue.attach_worker();
+
+    QueryContext query_context;
+    auto driver1 = std::make_shared<PipelineDriver>(_gen_operators(), &query_context, nullptr, nullptr, -1);
+    queue.put_back_from_executor(driver1.get());
+    // The remaining drivers of the local queue are handed over to the global queue.
+    queue.detach_worker();
+    ASSERT_EQ(1, queue.size());
+
+    auto consumer_thread = std::make_shared<std::thread>([&queue, &driver1] {
+        auto maybe_driver = queue.take(true);
+        ASSERT_TRUE(maybe_driver.ok());
+        ASSERT_EQ(driver1.get(), maybe_driver.value());
+    });
+    consumer_thread->join();
+    ASSERT_EQ(0, queue_metrics->driver_queue_steal_count.value());
+}
+
+PARALLEL_TEST(WorkStealingDriverQueueTest, test_take_close) {
+    PipelineExecutorMetrics metrics;
+    auto* queue_metrics = metrics.get_driver_queue_metrics();
+    WorkStealingDriverQueue queue(queue_metrics, std::make_unique<QuerySharedDriverQueue>(queue_metrics));
+
+    auto consumer_thread = std::make_shared<std::thread>([&queue] {
+        queue.attach_worker();
+        auto maybe_driver = queue.take(true);
+        ASSERT_TRUE(maybe_driver.status().is_cancelled());
+        queue.detach_worker();
+    });
+
+    sleep(1);
+    queue.close();
+
+    consumer_thread->join();
+}
+
 } // namespace starrocks::pipeline
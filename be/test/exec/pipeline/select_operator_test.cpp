@@ -0,0 +1,218 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/select_operator.h"
+
+#include <gtest/gtest.h>
+
+#include <functional>
+
+#include "column/chunk.h"
+#include "column/fixed_length_column.h"
+#include "common/object_pool.h"
+#include "exprs/column_ref.h"
+#include "exprs/expr_context.h"
+#include "runtime/runtime_state.h"
+#include "testutil/assert.h"
+
+namespace starrocks::pipeline {
+
+class SelectOperatorTest : public ::testing::Test {
+public:
+    void SetUp() override { _runtime_state.set_chunk_size(kChunkSize); }
+
+    void TearDown() override { _close_operator(); }
+
+protected:
+    static constexpr size_t kChunkSize = 16;
+    static constexpr SlotId kPredicateSlot = 0;
+    // Chunks with at most 5 columns are pruned while evaluating the conjuncts, wider ones defer the filter.
+    static constexpr size_t kNarrowColumns = 3;
+    static constexpr size_t kWideColumns = 7;
+
+    // Rows [begin, end) with the predicate in slot 0 and the row number in every other column.
+    static ChunkPtr make_chunk(int32_t begin, int32_t end, size_t num_columns,
+                               const std::function<bool(int32_t)>& keep) {
+        auto chunk = std::make_shared<Chunk>();
+        auto predicate = BooleanColumn::create();
+        for (int32_t v = begin; v < end; v++) {
+            predicate->append(keep(v));
+        }
+        chunk->append_column(std::move(predicate), kPredicateSlot);
+        for (size_t slot = 1; slot < num_columns; slot++) {
+            auto col = Int32Column::create();
+            for (int32_t v = begin; v < end; v++) {
+                col->append(v);
+            }
+            chunk->append_column(std::move(col), slot);
+        }
+        return chunk;
+    }
+
+    static std::vector<int32_t> range(int32_t begin, int32_t end, const std::function<bool(int32_t)>& keep) {
+        std::vector<int32_t> rows;
+        for (int32_t v = begin; v < end; v++) {
+            if (keep(v)) {
+                rows.push_back(v);
+            }
+        }
+        return rows;
+    }
+
+    void create_operator() {
+        _close_operator();
+        auto* expr = _pool.add(new ColumnRef(TypeDescriptor(TYPE_BOOLEAN), kPredicateSlot));
+        std::vector<ExprContext*> conjuncts{_pool.add(new ExprContext(expr))};
+        _factory = std::make_unique<SelectOperatorFactory>(1, 1, std::move(conjuncts),
+                                                           std::map<SlotId, ExprContext*>());
+        ASSERT_OK(_factory->prepare(&_runtime_state));
+        _op = _factory->create(1, 0);
+        ASSERT_OK(_op->prepare(&_runtime_state));
+    }
+
+    // Pushes the chunks one by one and pulls after each of them like the driver does,
+    // returns the non-empty output chunks.
+    std::vector<ChunkPtr> run(const std::vector<ChunkPtr>& inputs) {
+        std::vector<ChunkPtr> outputs;
+        auto pull = [&]() {
+            auto chunk_or = _op->pull_chunk(&_runtime_state);
+            EXPECT_OK(chunk_or.status());
+            if (chunk_or.ok() && !chunk_or.value()->is_empty()) {
+                outputs.push_back(std::move(chunk_or.value()));
+            }
+        };
+        for (const auto& chunk : inputs) {
+            EXPECT_TRUE(_op->need_input());
+            EXPECT_OK(_op->push_chunk(&_runtime_state, chunk));
+            EXPECT_TRUE(_op->has_output());
+            pull();
+        }
+        EXPECT_OK(_op->set_finishing(&_runtime_state));
+        while (_op->has_output()) {
+            pull();
+        }
+        EXPECT_TRUE(_op->is_finished());
+        return outputs;
+    }
+
+    static void check_outputs(const std::vector<ChunkPtr>& outputs, size_t num_columns,
+                              const std::vector<std::vector<int32_t>>& expected) {
+        ASSERT_EQ(expected.size(), outputs.size());
+        for (size_t i = 0; i < outputs.size(); i++) {
+            const auto& chunk = outputs[i];
+            ASSERT_EQ(num_columns, chunk->num_columns());
+            ASSERT_EQ(expected[i].size(), chunk->num_rows());
+            const auto& predicate = chunk->get_column_by_slot_id(kPredicateSlot);
+            for (size_t slot = 1; slot < num_columns; slot++) {
+                const auto& col = chunk->get_column_by_slot_id(slot);
+                for (size_t row = 0; row < chunk->num_rows(); row++) {
+                    ASSERT_TRUE(predicate->get(row).get_uint8());
+                    ASSERT_EQ(expected[i][row], col->get(row).get_int32());
+                }
+            }
+        }
+    }
+
+    int64_t counter_value(const std::string& name) {
+        return _op->runtime_profile()->get_child("CommonMetrics")->get_counter(name)->value();
+    }
+
+    ObjectPool _pool;
+    RuntimeState _runtime_state;
+    std::unique_ptr<SelectOperatorFactory> _factory;
+    OperatorPtr _op;
+
+private:
+    void _close_operator() {
+        if (_op != nullptr) {
+            _op->close(&_runtime_state);
+            _op.reset();
+        }
+        if (_factory != nullptr) {
+            _factory->close(&_runtime_state);
+            _factory.reset();
+        }
+    }
+};
+
+// Small chunks are merged into the pending output chunk with their selected rows.
+TEST_F(SelectOperatorTest, test_merge_filtered_chunks) {
+    auto even = [](int32_t v) { return v % 2 == 0; };
+    auto all = [](int32_t) { return true; };
+    for (size_t num_columns : {kNarrowColumns, kWideColumns}) {
+        SCOPED_TRACE(num_columns);
+        create_operator();
+        auto outputs = run({make_chunk(0, 10, num_columns, even), make_chunk(10, 20, num_columns, even),
+                            make_chunk(20, 30, num_columns, all)});
+        // the first two chunks have 10 selected rows together, the third one does not fit
+        auto merged = range(0, 10, even);
+        auto second = range(10, 20, even);
+        merged.insert(merged.end(), second.begin(), second.end());
+        check_outputs(outputs, num_columns, {merged, range(20, 30, all)});
+
+        ASSERT_EQ(30, counter_value("ConjunctsInputRows"));
+        ASSERT_EQ(20, counter_value("ConjunctsOutputRows"));
+    }
+}
+
+// A chunk with no selected rows adds nothing to the pending output chunk.
+TEST_F(SelectOperatorTest, test_all_rows_filtered) {
+    auto none = [](int32_t) { return false; };
+    auto tail = [](int32_t v) { return v % 10 >= 5; };
+    for (size_t num_columns : {kNarrowColumns, kWideColumns}) {
+        SCOPED_TRACE(num_columns);
+        create_operator();
+        auto outputs = run({make_chunk(0, 10, num_columns, none), make_chunk(10, 20, num_columns, none),
+                            make_chunk(20, 30, num_columns, tail)});
+        check_outputs(outputs, num_columns, {range(20, 30, tail)});
+
+        ASSERT_EQ(30, counter_value("ConjunctsInputRows"));
+        ASSERT_EQ(5, counter_value("ConjunctsOutputRows"));
+
+        create_operator();
+        outputs = run({make_chunk(0, 10, num_columns, none), make_chunk(10, 30, num_columns, none)});
+        check_outputs(outputs, num_columns, {});
+        ASSERT_EQ(30, counter_value("ConjunctsInputRows"));
+        ASSERT_EQ(0, counter_value("ConjunctsOutputRows"));
+    }
+}
+
+// The pending output chunk is flushed once the selected rows of the next chunk do not fit in chunk_size,
+// and a chunk with enough selected rows is passed through on its own.
+TEST_F(SelectOperatorTest, test_flush_over_chunk_size) {
+    auto not_seven = [](int32_t v) { return v % 10 != 7; };
+    auto small = [](int32_t v) { return v % 4 == 0; };
+    for (size_t num_columns : {kNarrowColumns, kWideColumns}) {
+        SCOPED_TRACE(num_columns);
+        create_operator();
+        auto outputs = run({make_chunk(0, 20, num_columns, small), make_chunk(20, 40, num_columns, not_seven),
+                            make_chunk(40, 60, num_columns, small), make_chunk(60, 80, num_columns, not_seven)});
+        // every chunk has 5 or 18 selected rows, so each one flushes the pending rows of the previous chunk
+        check_outputs(outputs, num_columns,
+                      {range(0, 20, small), range(20, 40, not_seven), range(40, 60, small), range(60, 80, not_seven)});
+
+        ASSERT_EQ(80, counter_value("ConjunctsInputRows"));
+        ASSERT_EQ(46, counter_value("ConjunctsOutputRows"));
+
+        // the first chunk has more than chunk_size / 2 selected rows and is returned at once
+        create_operator();
+        auto chunk = make_chunk(0, 20, num_columns, not_seven);
+        ASSERT_OK(_op->push_chunk(&_runtime_state, chunk));
+        ASSIGN_OR_ABORT(auto output, _op->pull_chunk(&_runtime_state));
+        check_outputs({output}, num_columns, {range(0, 20, not_seven)});
+        ASSERT_FALSE(_op->has_output());
+    }
+}
+
+} // namespace starrocks::pipeline
@@ -561,6 +561,48 @@ void test_framework_force_populate_and_passthrough(query_cache::CacheManagerPtr
                                      post_passthrough_actions, std::move(validate_func));
 }
 
+TEST_F(QueryCacheTest, testCompressedCacheManager) {
+    // the first tier is too small to keep any entry, so all the probes are served by the compressed tier.
+    auto cache_mgr = std::make_shared<query_cache::CacheManager>(2048, 1024 * 1024);
+
+    auto create_cache_value = [](size_t num_rows, int64_t version) {
+        auto chk = std::make_shared<Chunk>();
+        auto col = Int32Column::create();
+        for (auto i = 0; i < num_rows; ++i) {
+            col->append(i);
+        }
+        chk->append_column(std::move(col), 0);
+        query_cache::CacheValue value(0, version, {chk});
+        return value;
+    };
+
+    for (auto i = 0; i < 10; ++i) {
+        cache_mgr->populate(strings::Substitute("key_$0", i), create_cache_value(1000 + i, i));
+    }
+    ASSERT_GT(cache_mgr->compressed_memory_usage(), 0);
+
+    for (auto i = 0; i < 10; ++i) {
+        auto status = cache_mgr->probe(strings::Substitute("key_$0", i));
+        ASSERT_TRUE(status.ok());
+        auto& value = status.value();
+        ASSERT_EQ(value.version, i);
+        ASSERT_EQ(value.result.size(), 1);
+        auto& chk = value.result[0];
+        ASSERT_EQ(chk->num_rows(), 1000 + i);
+        ASSERT_TRUE(chk->is_slot_exist(0));
+        const auto* col = down_cast<const Int32Column*>(chk->get_column_by_slot_id(0).get());
+        for (auto j = 0; j < chk->num_rows(); ++j) {
+            ASSERT_EQ(col->get_data()[j], j);
+        }
+    }
+    ASSERT_GT(cache_mgr->compressed_hit_count(), 0);
+    ASSERT_FALSE(cache_mgr->probe("key_10").ok());
+
+    cache_mgr->invalidate_all();
+    ASSERT_EQ(cache_mgr->compressed_memory_usage(), 0);
+    ASSERT_FALSE(cache_mgr->probe("key_0").ok());
+}
+
 TEST_F(QueryCacheTest, testMultilane) {
     Actions actions = {
             Action::cache_miss_and_emit_first_chunk(1, 0, 10, 1, false, false),
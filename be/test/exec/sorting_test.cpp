@@ -233,6 +233,18 @@ TEST(SortingTest, materialize_by_permutation_binary) {
     ASSERT_EQ("rock", merged->get(1).get_slice());
 }
 
+TEST(SortingTest, prefix_slice_compare) {
+    std::vector<std::string> values = {"",    "a",     "ab",     std::string("ab\0", 3), "abc",    "abcd", "abcde",
+                                       "abcf", "abd",  "b",      "\xff",                 "\xff\x01", "zzzz", "zzzzz"};
+    for (const auto& lhs : values) {
+        for (const auto& rhs : values) {
+            int expected = SorterComparator<Slice>::compare(Slice(lhs), Slice(rhs));
+            int actual = PrefixSlice(Slice(lhs)).compare(PrefixSlice(Slice(rhs)));
+            EXPECT_EQ(expected, actual) << "lhs=" << lhs << " rhs=" << rhs;
+        }
+    }
+}
+
 TEST(SortingTest, materialize_by_permutation_int) {
     Int32Column::Ptr input1 = Int32Column::create();
     Int32Column::Ptr input2 = Int32Column::create();
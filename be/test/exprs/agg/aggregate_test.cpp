@@ -1553,6 +1553,38 @@ TEST_F(AggregateTest, test_percentile_cont_2) {
     ASSERT_EQ(3, result_column->get_data()[0]);
 }
 
+TEST_F(AggregateTest, test_percentile_approx_merge) {
+    std::vector<TypeDescriptor> arg_types = {TypeDescriptor::from_logical_type(TYPE_DOUBLE),
+                                             TypeDescriptor::from_logical_type(TYPE_DOUBLE)};
+    auto return_type = TypeDescriptor::from_logical_type(TYPE_DOUBLE);
+    std::unique_ptr<FunctionContext> local_ctx(FunctionContext::create_test_context(std::move(arg_types), return_type));
+
+    const AggregateFunction* func = get_aggregate_function("percentile_approx", TYPE_DOUBLE, TYPE_DOUBLE, false);
+    auto quantile_column = ColumnHelper::create_const_column<TYPE_DOUBLE>(0.5, 1);
+
+    // both partial states are serialized into the same column
+    ColumnPtr serde_column = BinaryColumn::create();
+    for (int part = 0; part < 2; part++) {
+        DoubleColumn::Ptr data_column = DoubleColumn::create();
+        for (int i = 1; i <= 500; i++) {
+            data_column->append(part * 500 + i);
+        }
+        auto state = ManagedAggrState::create(local_ctx.get(), func);
+        std::vector<const Column*> raw_columns{data_column.get(), quantile_column.get()};
+        func->update_batch_single_state(local_ctx.get(), data_column->size(), raw_columns.data(), state->state());
+        func->serialize_to_column(local_ctx.get(), state->state(), serde_column.get());
+    }
+    ASSERT_EQ(2, serde_column->size());
+
+    auto merged = ManagedAggrState::create(local_ctx.get(), func);
+    func->merge(local_ctx.get(), serde_column.get(), merged->state(), 0);
+    func->merge(local_ctx.get(), serde_column.get(), merged->state(), 1);
+
+    DoubleColumn::Ptr result_column = DoubleColumn::create();
+    func->finalize_to_column(local_ctx.get(), merged->state(), result_column.get());
+    ASSERT_NEAR(500, result_column->get_data()[0], 5);
+}
+
 TEST_F(AggregateTest, test_percentile_disc) {
     std::vector<TypeDescriptor> arg_types = {TypeDescriptor::from_logical_type(TYPE_DOUBLE),
                                              TypeDescriptor::from_logical_type(TYPE_DOUBLE)};
@@ -2794,4 +2826,43 @@ TEST_F(AggregateTest, test_ds_theta_count_distinct) {
     ASSERT_EQ(5, result_column->get_data()[0]);
 }
 
+TEST_F(AggregateTest, test_agg_state_block_cache) {
+    AggStateBlockCache cache(_allocator.get());
+    ASSERT_EQ(16, AggStateBlockCache::block_size(1));
+    ASSERT_EQ(32, AggStateBlockCache::block_size(17));
+    ASSERT_EQ(4096, AggStateBlockCache::block_size(4096));
+
+    void* p1 = cache.allocate(32);
+    void* p2 = cache.allocate(64);
+    cache.deallocate(p1, 32);
+    cache.deallocate(p2, 64);
+    ASSERT_EQ(96, cache.cached_bytes());
+    // blocks are recycled within their size class
+    ASSERT_EQ(p1, cache.allocate(32));
+    ASSERT_EQ(p2, cache.allocate(64));
+    ASSERT_EQ(0, cache.cached_bytes());
+    cache.deallocate(p1, 32);
+    cache.deallocate(p2, 64);
+
+    // containers grow and shrink through the cache while it is set
+    {
+        SCOPED_THREAD_LOCAL_AGG_STATE_ALLOCATOR_SETTER(_allocator.get(), &cache);
+        HashSetWithAggStateAllocator<int64_t> set;
+        VectorWithAggStateAllocator<int64_t> vec;
+        for (int64_t i = 0; i < 1000; i++) {
+            set.insert(i);
+            vec.push_back(i);
+        }
+        ASSERT_EQ(1000, set.size());
+        ASSERT_EQ(999, vec.back());
+    }
+    ASSERT_GT(cache.cached_bytes(), 0);
+    // the setter restores the outer allocator and no cache
+    ASSERT_EQ(_allocator.get(), tls_agg_state_allocator);
+    ASSERT_EQ(nullptr, tls_agg_state_block_cache);
+
+    cache.release();
+    ASSERT_EQ(0, cache.cached_bytes());
+}
+
 } // namespace starrocks
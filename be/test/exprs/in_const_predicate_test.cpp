@@ -53,4 +53,57 @@ TEST_F(InConstPredicateTest, clone) {
     ASSERT_EQ(new_values.size(), 5);
 }
 
+TEST_F(InConstPredicateTest, dense_array) {
+    ColumnRef* col_ref = _pool.add(new ColumnRef(TYPE_INT_DESC, 1));
+    VectorizedInConstPredicateBuilder builder(&_runtime_state, &_pool, col_ref);
+    ASSERT_TRUE(builder.create().ok());
+
+    std::vector<int32_t> values{100, 103, 105, -5};
+    builder.add_values(ColumnTestHelper::build_column(values), 0);
+
+    ExprContext* expr_ctx = builder.get_in_const_predicate();
+    auto* in_pred = (VectorizedInConstPredicate<TYPE_INT>*)expr_ctx->root();
+    ASSERT_FALSE(in_pred->is_use_array());
+    ASSERT_TRUE(in_pred->open(&_runtime_state, expr_ctx, FunctionContext::FRAGMENT_LOCAL).ok());
+    // [-5, 105] is dense enough
+    ASSERT_TRUE(in_pred->is_use_array());
+    ASSERT_EQ(in_pred->hash_set().size(), 4);
+    ASSERT_EQ(in_pred->get_all_values()->size(), 4);
+
+    std::vector<int32_t> probe{-6, -5, 0, 100, 101, 103, 105, 106, std::numeric_limits<int32_t>::max(),
+                               std::numeric_limits<int32_t>::lowest()};
+    std::vector<uint8_t> expected{0, 1, 0, 1, 0, 1, 1, 0, 0, 0};
+    auto chunk = std::make_shared<Chunk>();
+    chunk->append_column(ColumnTestHelper::build_column(probe), 1);
+    auto result = in_pred->evaluate_checked(expr_ctx, chunk.get());
+    ASSERT_TRUE(result.ok());
+    auto* res = ColumnHelper::cast_to_raw<TYPE_BOOLEAN>(result.value());
+    ASSERT_EQ(std::vector<uint8_t>(res->get_data().begin(), res->get_data().end()), expected);
+
+    // values added later fall back to the hash set
+    in_pred->insert(1000000);
+    ASSERT_FALSE(in_pred->is_use_array());
+    std::vector<int32_t> probe2{1000000, 103, 104};
+    auto chunk2 = std::make_shared<Chunk>();
+    chunk2->append_column(ColumnTestHelper::build_column(probe2), 1);
+    result = in_pred->evaluate_checked(expr_ctx, chunk2.get());
+    ASSERT_TRUE(result.ok());
+    res = ColumnHelper::cast_to_raw<TYPE_BOOLEAN>(result.value());
+    ASSERT_EQ(std::vector<uint8_t>(res->get_data().begin(), res->get_data().end()), (std::vector<uint8_t>{1, 1, 0}));
+}
+
+TEST_F(InConstPredicateTest, sparse_values_use_hash_set) {
+    ColumnRef* col_ref = _pool.add(new ColumnRef(TYPE_BIGINT_DESC, 1));
+    VectorizedInConstPredicateBuilder builder(&_runtime_state, &_pool, col_ref);
+    ASSERT_TRUE(builder.create().ok());
+
+    std::vector<int64_t> values{std::numeric_limits<int64_t>::lowest(), 0, std::numeric_limits<int64_t>::max()};
+    builder.add_values(ColumnTestHelper::build_column(values), 0);
+
+    ExprContext* expr_ctx = builder.get_in_const_predicate();
+    auto* in_pred = (VectorizedInConstPredicate<TYPE_BIGINT>*)expr_ctx->root();
+    ASSERT_TRUE(in_pred->open(&_runtime_state, expr_ctx, FunctionContext::FRAGMENT_LOCAL).ok());
+    ASSERT_FALSE(in_pred->is_use_array());
+}
+
 } // namespace starrocks
\ No newline at end of file
@@ -159,6 +159,42 @@ TEST_F(LikeTest, substringConstPatternLike) {
                         .ok());
 }
 
+TEST_F(LikeTest, percentOnlyConstPatternLike) {
+    std::vector<std::string> values = {"foobar", "barfoo", "foo_bar", "xfooybarz", "fobar", "", "foo", "afoobarb"};
+    // pattern -> expected result of each value
+    std::vector<std::pair<std::string, std::vector<bool>>> cases = {
+            {"%foo%bar%", {true, false, true, true, false, false, false, true}},
+            {"foo%bar", {true, false, true, false, false, false, false, false}},
+            {"foo%", {true, false, true, false, false, false, true, false}},
+            {"%o%o%", {true, true, true, true, false, false, true, true}},
+            {"a%b", {false, false, false, false, false, false, false, true}},
+            {"%foo\\_bar", {false, false, true, false, false, false, false, false}},
+    };
+
+    for (const auto& [pattern_str, expected] : cases) {
+        auto context = FunctionContext::create_test_context();
+        std::unique_ptr<FunctionContext> ctx(context);
+        Columns columns;
+
+        auto str = BinaryColumn::create();
+        for (const auto& value : values) {
+            str->append(value);
+        }
+        auto pattern = ColumnHelper::create_const_column<TYPE_VARCHAR>(pattern_str, 1);
+        columns.emplace_back(std::move(str));
+        columns.emplace_back(std::move(pattern));
+        context->set_constant_columns(columns);
+
+        ASSERT_TRUE(LikePredicate::like_prepare(context, FunctionContext::FunctionStateScope::THREAD_LOCAL).ok());
+        auto result = LikePredicate::like(context, columns).value();
+        auto v = ColumnHelper::cast_to<TYPE_BOOLEAN>(result);
+        for (size_t i = 0; i < values.size(); ++i) {
+            ASSERT_EQ(expected[i], v->get_data()[i]) << pattern_str << " like " << values[i];
+        }
+        ASSERT_TRUE(LikePredicate::like_close(context, FunctionContext::FunctionStateScope::THREAD_LOCAL).ok());
+    }
+}
+
 TEST_F(LikeTest, haystackConstantLike) {
     auto context = FunctionContext::create_test_context();
     std::unique_ptr<FunctionContext> ctx(context);
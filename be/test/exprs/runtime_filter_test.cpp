@@ -264,6 +264,31 @@ TEST_F(RuntimeFilterTest, TestSimdBlockFilter) {
     }
 }
 
+TEST_F(RuntimeFilterTest, TestSimdBlockFilterBatch) {
+    SimdBlockFilter bf0;
+    bf0.init(1000);
+    std::mt19937_64 rng(0);
+    std::vector<uint64_t> hashes(1001);
+    for (size_t i = 0; i < hashes.size(); i++) {
+        hashes[i] = rng();
+        if (i % 3 == 0) {
+            bf0.insert_hash(hashes[i]);
+        }
+    }
+
+    std::vector<uint8_t> selection(hashes.size());
+    for (size_t i = 0; i < selection.size(); i++) {
+        selection[i] = i % 7 != 0;
+    }
+    bf0.test_hash_batch(hashes.data(), hashes.size(), selection.data());
+    for (size_t i = 0; i < hashes.size(); i++) {
+        EXPECT_EQ(selection[i], i % 7 != 0 && bf0.test_hash(hashes[i])) << i;
+        if (i % 3 == 0 && i % 7 != 0) {
+            EXPECT_TRUE(selection[i]);
+        }
+    }
+}
+
 TEST_F(RuntimeFilterTest, TestSimdBlockFilterSerialize) {
     SimdBlockFilter bf0;
     bf0.init(100);
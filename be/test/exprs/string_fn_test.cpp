@@ -1427,6 +1427,30 @@ PARALLEL_TEST(VecStringFunctionsTest, utf8LengthChineseTest) {
     }
 }
 
+PARALLEL_TEST(VecStringFunctionsTest, utf8LengthNullableAsciiTest) {
+    std::unique_ptr<FunctionContext> ctx(FunctionContext::create_test_context());
+    Columns columns;
+    auto str = NullableColumn::create(BinaryColumn::create(), NullColumn::create());
+    for (int j = 0; j < 20; ++j) {
+        if (j % 3 == 0) {
+            str->append_nulls(1);
+        } else {
+            str->append_datum(Datum(Slice(std::string(j, 'a'))));
+        }
+    }
+    columns.emplace_back(str);
+
+    ColumnPtr result = StringFunctions::utf8_length(ctx.get(), columns).value();
+    ASSERT_EQ(20, result->size());
+    for (int k = 0; k < 20; ++k) {
+        if (k % 3 == 0) {
+            ASSERT_TRUE(result->is_null(k));
+        } else {
+            ASSERT_EQ(k, result->get(k).get_int32());
+        }
+    }
+}
+
 PARALLEL_TEST(VecStringFunctionsTest, upperTest) {
     std::unique_ptr<FunctionContext> ctx(FunctionContext::create_test_context());
     std::unique_ptr<RuntimeState> runtime_state(new RuntimeState());
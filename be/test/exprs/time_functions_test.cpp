@@ -38,6 +38,7 @@
 #include "testutil/function_utils.h"
 #include "types/date_value.h"
 #include "types/logical_type.h"
+#include "util/timezone_utils.h"
 
 namespace starrocks {
 
@@ -1916,6 +1917,66 @@ TEST_F(TimeFunctionsTest, date_format) {
     }
 }
 
+// Patterns without names or weeks are formatted from a compiled token list, the output must be the same
+// as DateTimeValue::to_format_string.
+TEST_F(TimeFunctionsTest, compiledDateFormat) {
+    FunctionContext* ctx = FunctionContext::create_test_context();
+    auto ptr = std::unique_ptr<FunctionContext>(ctx);
+
+    std::vector<TimestampValue> values = {
+            TimestampValue::create(2020, 6, 25, 15, 58, 21), TimestampValue::create(1, 1, 1, 0, 0, 0),
+            TimestampValue::create(2023, 12, 9, 0, 5, 7, 12), TimestampValue::create(9999, 12, 31, 23, 59, 59, 999999),
+            TimestampValue::create(2000, 2, 29, 12, 0, 0)};
+    TimestampColumn::Ptr dt_col = TimestampColumn::create();
+    for (auto& v : values) {
+        dt_col->append(v);
+    }
+
+    std::vector<std::string> fmts = {"%Y/%m/%d %H:%i:%s.%f", "%y%c%e %k-%l %h %I %p", "%T %S", "[%%]%Y%",
+                                     "date:%d.%m", "%Y-%m-%d %T"};
+    for (const auto& fmt : fmts) {
+        auto fmt_col = ColumnHelper::create_const_column<TYPE_VARCHAR>(Slice(fmt), 1);
+        Columns columns;
+        columns.emplace_back(dt_col);
+        columns.emplace_back(std::move(fmt_col));
+        ctx->set_constant_columns(columns);
+        ASSERT_TRUE(TimeFunctions::format_prepare(ctx, FunctionContext::FunctionStateScope::FRAGMENT_LOCAL).ok());
+        auto* fc = reinterpret_cast<TimeFunctions::FormatCtx*>(
+                ctx->get_function_state(FunctionContext::FRAGMENT_LOCAL));
+        ASSERT_TRUE(fc->is_compiled) << fmt;
+        ColumnPtr result = TimeFunctions::datetime_format(ctx, columns).value();
+        ASSERT_TRUE(TimeFunctions::format_close(ctx, FunctionContext::FunctionStateScope::FRAGMENT_LOCAL).ok());
+
+        auto v = ColumnHelper::cast_to<TYPE_VARCHAR>(result);
+        ASSERT_EQ(values.size(), v->size());
+        for (size_t i = 0; i < values.size(); i++) {
+            int year, month, day, hour, minute, second, usec;
+            values[i].to_timestamp(&year, &month, &day, &hour, &minute, &second, &usec);
+            DateTimeValue dt(TIME_DATETIME, year, month, day, hour, minute, second, usec);
+            char buf[128];
+            ASSERT_TRUE(dt.to_format_string(fmt.c_str(), fmt.size(), buf));
+            ASSERT_EQ(std::string(buf), v->get_slice(i).to_string()) << fmt;
+        }
+    }
+
+    // names and weeks still go through DateTimeValue
+    {
+        auto fmt_col = ColumnHelper::create_const_column<TYPE_VARCHAR>(Slice("%W %M %D"), 1);
+        Columns columns;
+        columns.emplace_back(dt_col);
+        columns.emplace_back(std::move(fmt_col));
+        ctx->set_constant_columns(columns);
+        ASSERT_TRUE(TimeFunctions::format_prepare(ctx, FunctionContext::FunctionStateScope::FRAGMENT_LOCAL).ok());
+        auto* fc = reinterpret_cast<TimeFunctions::FormatCtx*>(
+                ctx->get_function_state(FunctionContext::FRAGMENT_LOCAL));
+        ASSERT_FALSE(fc->is_compiled);
+        ColumnPtr result = TimeFunctions::datetime_format(ctx, columns).value();
+        ASSERT_TRUE(TimeFunctions::format_close(ctx, FunctionContext::FunctionStateScope::FRAGMENT_LOCAL).ok());
+        auto v = ColumnHelper::cast_to<TYPE_VARCHAR>(result);
+        ASSERT_EQ("Thursday June 25th", v->get_slice(0).to_string());
+    }
+}
+
 TEST_F(TimeFunctionsTest, jodatime_format) {
     FunctionContext* ctx = FunctionContext::create_test_context();
     auto ptr = std::unique_ptr<FunctionContext>(ctx);
@@ -2470,6 +2531,83 @@ TEST_F(TimeFunctionsTest, convertTzConstTest) {
                     .ok());
 }
 
+TEST_F(TimeFunctionsTest, convertTzFixedOffsetTest) {
+    ASSERT_TRUE(TimezoneUtils::is_fixed_offset(cctz::utc_time_zone()));
+    ASSERT_TRUE(TimezoneUtils::is_fixed_offset(cctz::fixed_time_zone(cctz::seconds(8 * 60 * 60))));
+
+    TimestampColumn::Ptr tc = TimestampColumn::create();
+    tc->append(TimestampValue::create(2019, 4, 7, 21, 21, 3));
+    tc->append(TimestampValue::create(2019, 1, 1, 5, 8, 7, 123456));
+    auto tc_from = ColumnHelper::create_const_column<TYPE_VARCHAR>("+08:00", 2);
+    auto tc_to = ColumnHelper::create_const_column<TYPE_VARCHAR>("UTC", 2);
+
+    TimestampValue res[] = {TimestampValue::create(2019, 4, 7, 13, 21, 3),
+                            TimestampValue::create(2018, 12, 31, 21, 8, 7, 123456)};
+    Columns columns;
+    columns.emplace_back(tc);
+    columns.emplace_back(tc_from);
+    columns.emplace_back(tc_to);
+
+    _utils->get_fn_ctx()->set_constant_columns(columns);
+    _utils->get_fn_ctx()->_arg_types.emplace_back(FunctionContext::TypeDesc{TYPE_DATETIME});
+    _utils->get_fn_ctx()->_arg_types.emplace_back(FunctionContext::TypeDesc{TYPE_VARCHAR});
+    _utils->get_fn_ctx()->_arg_types.emplace_back(FunctionContext::TypeDesc{TYPE_VARCHAR});
+
+    ASSERT_TRUE(
+            TimeFunctions::convert_tz_prepare(_utils->get_fn_ctx(), FunctionContext::FunctionStateScope::FRAGMENT_LOCAL)
+                    .ok());
+
+    ColumnPtr result = TimeFunctions::convert_tz(_utils->get_fn_ctx(), columns).value();
+
+    auto timestamps = ColumnHelper::cast_to<TYPE_DATETIME>(result);
+    for (int i = 0; i < sizeof(res) / sizeof(res[0]); ++i) ASSERT_EQ(res[i], timestamps->get_data()[i]);
+
+    ASSERT_TRUE(
+            TimeFunctions::convert_tz_close(_utils->get_fn_ctx(), FunctionContext::FunctionStateScope::FRAGMENT_LOCAL)
+                    .ok());
+}
+
+// Asia/Shanghai observed DST in 1986-1991, which a single cached offset between the zones can't express.
+TEST_F(TimeFunctionsTest, convertTzHistoricalDstTest) {
+    // load the cached offsets between timezones, they must not be used for region zones
+    TimezoneUtils::init_time_zones();
+    cctz::time_zone shanghai;
+    ASSERT_TRUE(TimezoneUtils::find_cctz_time_zone("Asia/Shanghai", shanghai));
+    ASSERT_FALSE(TimezoneUtils::is_fixed_offset(shanghai));
+
+    TimestampColumn::Ptr tc = TimestampColumn::create();
+    tc->append(TimestampValue::create(1988, 6, 1, 12, 0, 0));
+    tc->append(TimestampValue::create(1988, 12, 1, 12, 0, 0));
+    tc->append(TimestampValue::create(2019, 6, 1, 12, 0, 0, 123456));
+    auto tc_from = ColumnHelper::create_const_column<TYPE_VARCHAR>("Asia/Shanghai", 3);
+    auto tc_to = ColumnHelper::create_const_column<TYPE_VARCHAR>("UTC", 3);
+
+    TimestampValue res[] = {TimestampValue::create(1988, 6, 1, 3, 0, 0), TimestampValue::create(1988, 12, 1, 4, 0, 0),
+                            TimestampValue::create(2019, 6, 1, 4, 0, 0, 123456)};
+    Columns columns;
+    columns.emplace_back(tc);
+    columns.emplace_back(tc_from);
+    columns.emplace_back(tc_to);
+
+    _utils->get_fn_ctx()->set_constant_columns(columns);
+    _utils->get_fn_ctx()->_arg_types.emplace_back(FunctionContext::TypeDesc{TYPE_DATETIME});
+    _utils->get_fn_ctx()->_arg_types.emplace_back(FunctionContext::TypeDesc{TYPE_VARCHAR});
+    _utils->get_fn_ctx()->_arg_types.emplace_back(FunctionContext::TypeDesc{TYPE_VARCHAR});
+
+    ASSERT_TRUE(
+            TimeFunctions::convert_tz_prepare(_utils->get_fn_ctx(), FunctionContext::FunctionStateScope::FRAGMENT_LOCAL)
+                    .ok());
+
+    ColumnPtr result = TimeFunctions::convert_tz(_utils->get_fn_ctx(), columns).value();
+
+    auto timestamps = ColumnHelper::cast_to<TYPE_DATETIME>(result);
+    for (int i = 0; i < sizeof(res) / sizeof(res[0]); ++i) ASSERT_EQ(res[i], timestamps->get_data()[i]);
+
+    ASSERT_TRUE(
+            TimeFunctions::convert_tz_close(_utils->get_fn_ctx(), FunctionContext::FunctionStateScope::FRAGMENT_LOCAL)
+                    .ok());
+}
+
 TEST_F(TimeFunctionsTest, utctimestampTest) {
     {
         ColumnPtr ptr = TimeFunctions::utc_timestamp(_utils->get_fn_ctx(), Columns()).value();
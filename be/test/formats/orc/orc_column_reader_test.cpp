@@ -90,4 +90,76 @@ TEST(OrcColumnReaderTest, TestDateColumn) {
     }
 }
 
+TEST(OrcColumnReaderTest, TestDirectStringColumn) {
+    const static size_t batchSize = 5;
+    std::vector<std::string> values = {"a", "", "bcd", "efgh", "ij"};
+
+    MemoryOutputStream buffer(bufferSize);
+    ORC_UNIQUE_PTR<orc::Type> schema(orc::Type::buildTypeFromString("struct<c0:string>"));
+    const orc::Type* orcType = schema->getSubtype(0);
+
+    // prepare data, disable the dictionary encoding so that the values are read from a contiguous blob.
+    {
+        orc::WriterOptions writerOptions;
+        writerOptions.setDictionaryKeySizeThreshold(0);
+        ORC_UNIQUE_PTR<orc::Writer> writer = createWriter(*schema, &buffer, writerOptions);
+
+        ORC_UNIQUE_PTR<orc::ColumnVectorBatch> batch = writer->createRowBatch(batchSize);
+        auto* root = dynamic_cast<orc::StructVectorBatch*>(batch.get());
+        auto* c0 = dynamic_cast<orc::StringVectorBatch*>(root->fields[0]);
+
+        for (size_t i = 0; i < batchSize; i++) {
+            c0->data[i] = values[i].data();
+            c0->length[i] = values[i].size();
+            c0->notNull[i] = 1;
+        }
+        c0->notNull[3] = 0;
+        c0->length[3] = 0;
+        c0->hasNulls = true;
+
+        c0->numElements = batchSize;
+        root->numElements = batchSize;
+        writer->add(*batch);
+        writer->close();
+    }
+
+    // read
+    {
+        orc::ReaderOptions readerOptions;
+        ORC_UNIQUE_PTR<orc::InputStream> inputStream(new MemoryInputStream(buffer.getData(), buffer.getLength()));
+        ORC_UNIQUE_PTR<orc::Reader> reader = createReader(std::move(inputStream), readerOptions);
+
+        orc::RowReaderOptions options;
+        std::list<std::string> columns = {"c0"};
+        options.include(columns);
+        ORC_UNIQUE_PTR<orc::RowReader> rr = reader->createRowReader(options);
+
+        const OrcMappingPtr orcMapping = nullptr;
+        OrcChunkReader orcChunkReader(batchSize, {});
+        orcChunkReader.disable_broker_load_mode();
+
+        TypeDescriptor c0Type = TypeDescriptor::create_varchar_type(32);
+
+        std::unique_ptr<ORCColumnReader> orcColumnReader =
+                ORCColumnReader::create(c0Type, orcType, true, orcMapping, &orcChunkReader).value();
+
+        ORC_UNIQUE_PTR<orc::ColumnVectorBatch> batch = rr->createRowBatch(batchSize);
+        auto* root = dynamic_cast<orc::StructVectorBatch*>(batch.get());
+        auto* c0 = dynamic_cast<orc::StringVectorBatch*>(root->fields[0]);
+        orc::RowReader::ReadPosition pos;
+        EXPECT_TRUE(rr->next(*batch, &pos));
+        ColumnPtr column = ColumnHelper::create_column(c0Type, true);
+        // read in two parts to cover a range starting in the middle of the batch
+        EXPECT_TRUE(orcColumnReader->get_next(c0, column, 0, 2).ok());
+        EXPECT_TRUE(orcColumnReader->get_next(c0, column, 2, batchSize - 2).ok());
+        EXPECT_EQ(batchSize, column->size());
+
+        EXPECT_EQ("'a'", column->debug_item(0));
+        EXPECT_EQ("''", column->debug_item(1));
+        EXPECT_EQ("'bcd'", column->debug_item(2));
+        EXPECT_EQ("NULL", column->debug_item(3));
+        EXPECT_EQ("'ij'", column->debug_item(4));
+    }
+}
+
 } // namespace starrocks
\ No newline at end of file
@@ -25,6 +25,7 @@
 #include "column/map_column.h"
 #include "column/nullable_column.h"
 #include "column/struct_column.h"
+#include "common/config.h"
 #include "common/statusor.h"
 #include "formats/parquet/file_reader.h"
 #include "formats/parquet/parquet_test_util/util.h"
@@ -1067,6 +1068,85 @@ TEST_F(ParquetFileWriterTest, TestFlushRowgroup) {
     ASSERT_EQ(result.file_statistics.record_count, 8);
 }
 
+// The struct column owns three leaf columns, so the columns after it start from a shifted leaf column index when
+// they are encoded in parallel. The file must read back the same with parallel encoding on and off.
+TEST_F(ParquetFileWriterTest, TestWriteParallelEncode) {
+    auto type_int = TypeDescriptor::from_logical_type(TYPE_INT);
+    auto type_struct = TypeDescriptor::from_logical_type(TYPE_STRUCT);
+    type_struct.children = {TypeDescriptor::from_logical_type(TYPE_SMALLINT), type_int,
+                            TypeDescriptor::from_logical_type(TYPE_BIGINT)};
+    type_struct.field_names = {"a", "b", "c"};
+    auto type_varchar = TypeDescriptor::from_logical_type(TYPE_VARCHAR);
+    auto type_bigint = TypeDescriptor::from_logical_type(TYPE_BIGINT);
+    std::vector<TypeDescriptor> type_descs{type_int, type_struct, type_varchar, type_bigint};
+
+    const int num_rows = 1000;
+    auto make_nulls = [&](int step) {
+        auto null_column = UInt8Column::create();
+        for (int i = 0; i < num_rows; i++) {
+            null_column->append(i % step == 0);
+        }
+        return null_column;
+    };
+    auto chunk = std::make_shared<Chunk>();
+    {
+        auto int_column = Int32Column::create();
+        auto a_column = Int16Column::create();
+        auto b_column = Int32Column::create();
+        auto c_column = Int64Column::create();
+        auto varchar_column = BinaryColumn::create();
+        auto bigint_column = Int64Column::create();
+        for (int i = 0; i < num_rows; i++) {
+            int_column->append(i);
+            a_column->append(static_cast<int16_t>(i % 100));
+            b_column->append(i * 3);
+            c_column->append(static_cast<int64_t>(i) * 1000000007);
+            varchar_column->append("value_" + std::to_string(i % 37));
+            bigint_column->append(-static_cast<int64_t>(i));
+        }
+        Columns fields{NullableColumn::create(std::move(a_column), make_nulls(5)),
+                       NullableColumn::create(std::move(b_column), make_nulls(7)),
+                       NullableColumn::create(std::move(c_column), make_nulls(11))};
+        auto struct_column = StructColumn::create(std::move(fields), type_struct.field_names);
+        chunk->append_column(NullableColumn::create(std::move(int_column), make_nulls(3)), chunk->num_columns());
+        chunk->append_column(NullableColumn::create(std::move(struct_column), make_nulls(13)), chunk->num_columns());
+        chunk->append_column(NullableColumn::create(std::move(varchar_column), make_nulls(17)), chunk->num_columns());
+        chunk->append_column(NullableColumn::create(std::move(bigint_column), make_nulls(19)), chunk->num_columns());
+    }
+
+    auto write_and_read = [&](bool parallel_encode) -> ChunkPtr {
+        config::parquet_writer_parallel_encode_enable = parallel_encode;
+        auto column_names = _make_type_names(type_descs);
+        auto output_file = _fs.new_writable_file(_file_path).value();
+        auto output_stream = std::make_unique<parquet::ParquetOutputStream>(std::move(output_file));
+        auto column_evaluators = ColumnSlotIdEvaluator::from_types(type_descs);
+        auto writer_options = std::make_shared<formats::ParquetWriterOptions>();
+        auto writer = std::make_unique<formats::ParquetFileWriter>(
+                _file_path, std::move(output_stream), column_names, type_descs, std::move(column_evaluators),
+                TCompressionType::NO_COMPRESSION, writer_options, []() {});
+        EXPECT_OK(writer->init());
+        EXPECT_OK(writer->write(chunk.get()));
+        auto result = writer->commit();
+        EXPECT_OK(result.io_status);
+        EXPECT_EQ(result.file_statistics.record_count, num_rows);
+        return _read_chunk(type_descs);
+    };
+
+    bool parallel_encode_enable = config::parquet_writer_parallel_encode_enable;
+    int32_t parallel_encode_min_columns = config::parquet_writer_parallel_encode_min_columns;
+    config::parquet_writer_parallel_encode_min_columns = 4;
+    auto serial_chunk = write_and_read(false);
+    auto parallel_chunk = write_and_read(true);
+    config::parquet_writer_parallel_encode_enable = parallel_encode_enable;
+    config::parquet_writer_parallel_encode_min_columns = parallel_encode_min_columns;
+
+    ASSERT_TRUE(serial_chunk != nullptr);
+    ASSERT_TRUE(parallel_chunk != nullptr);
+    ASSERT_EQ(parallel_chunk->num_rows(), num_rows);
+    parquet::Utils::assert_equal_chunk(serial_chunk.get(), parallel_chunk.get());
+    parquet::Utils::assert_equal_chunk(chunk.get(), parallel_chunk.get());
+}
+
 TEST_F(ParquetFileWriterTest, TestWriteWithFieldID) {
     auto type_bool = TypeDescriptor::from_logical_type(TYPE_BOOLEAN);
     std::vector<TypeDescriptor> type_descs{type_bool};
@@ -18,7 +18,9 @@
 
 #include <filesystem>
 
+#include "common/config.h"
 #include "fs/fs_util.h"
+#include "fs/hdfs/hdfs_fs_cache.h"
 #include "testutil/sync_point.h"
 #include "util/defer_op.h"
 
@@ -126,4 +128,38 @@ TEST_F(HdfsFileSystemTest, create_file_with_open_truncate) {
     (*wfile_2).reset();
 }
 
+TEST_F(HdfsFileSystemTest, reuse_cached_file_handle) {
+    auto old_cache_size = config::hdfs_client_file_handle_cache_size;
+    config::hdfs_client_file_handle_cache_size = 4;
+    DeferOp defer([&]() { config::hdfs_client_file_handle_cache_size = old_cache_size; });
+
+    auto fs = new_fs_hdfs(FSOptions());
+    const std::string filepath = "file://" + _root_path + "/reuse_cached_file_handle";
+    {
+        auto wfile = fs->new_writable_file(filepath);
+        ASSERT_TRUE(wfile.ok());
+        ASSERT_TRUE((*wfile)->append("123456").ok());
+        ASSERT_TRUE((*wfile)->close().ok());
+    }
+
+    auto* cache = HdfsFileHandleCache::instance();
+    size_t cached = cache->size();
+    for (int i = 0; i < 3; i++) {
+        auto rfile = fs->new_random_access_file(filepath);
+        ASSERT_TRUE(rfile.ok());
+        auto res = (*rfile)->read_all();
+        ASSERT_TRUE(res.ok());
+        ASSERT_EQ("123456", res.value());
+        (*rfile).reset();
+        // the handle is given back on close and taken again by the next reader
+        ASSERT_EQ(cached + 1, cache->size());
+    }
+
+    config::hdfs_client_file_handle_cache_size = 0;
+    // a disabled cache neither returns nor keeps handles
+    auto rfile = fs->new_random_access_file(filepath);
+    ASSERT_TRUE(rfile.ok());
+    ASSERT_TRUE((*rfile)->read_all().ok());
+}
+
 } // namespace starrocks
@@ -22,6 +22,7 @@
 #include "fs/fs_util.h"
 #include "runtime/exec_env.h"
 #include "testutil/assert.h"
+#include "util/defer_op.h"
 
 namespace starrocks::io {
 
@@ -149,6 +150,41 @@ TEST_F(CacheInputStreamTest, test_aligned_read) {
     ASSERT_EQ(stats.read_cache_count, block_count);
 }
 
+TEST_F(CacheInputStreamTest, test_populate_on_second_access) {
+    const int64_t block_count = 3;
+
+    int64_t data_size = block_size * block_count;
+    char data[data_size + 1];
+    gen_test_data(data, data_size, block_size);
+
+    config::datacache_populate_on_second_access = true;
+    DeferOp defer([]() { config::datacache_populate_on_second_access = false; });
+
+    const std::string file_name = "test_populate_on_second_access";
+    std::shared_ptr<io::SeekableInputStream> stream(new MockSeekableInputStream(data, data_size));
+    for (int round = 0; round < 2; ++round) {
+        std::shared_ptr<io::SharedBufferedInputStream> sb_stream(
+                new io::SharedBufferedInputStream(stream, file_name, data_size));
+        io::CacheInputStream cache_stream(sb_stream, file_name, data_size, 1000000);
+        cache_stream.set_enable_populate_cache(true);
+        auto& stats = cache_stream.stats();
+
+        for (int i = 0; i < block_count; ++i) {
+            char buffer[block_size];
+            read_stream_data(&cache_stream, i * block_size, block_size, buffer);
+            ASSERT_TRUE(check_data_content(buffer, block_size, 'a' + i));
+        }
+        ASSERT_EQ(stats.read_cache_count, 0);
+        if (round == 0) {
+            // the first miss of every block is only remembered
+            ASSERT_EQ(stats.write_cache_count, 0);
+            ASSERT_EQ(stats.skip_write_cache_count, block_count);
+        } else {
+            ASSERT_EQ(stats.write_cache_count, block_count);
+        }
+    }
+}
+
 TEST_F(CacheInputStreamTest, test_random_read) {
     const int64_t block_count = 3;
 
@@ -497,6 +533,9 @@ TEST_F(CacheInputStreamTest, test_try_peer_cache) {
     }
     ASSERT_EQ(stats.read_cache_count, 0);
     ASSERT_EQ(stats.write_cache_count, block_count);
+    // the unreachable peer is not tried again for the following blocks
+    ASSERT_TRUE(cache_stream._peer_host.empty());
+    ASSERT_EQ(cache_stream._peer_port, 0);
 
     // first read from local cache
     for (int i = 0; i < block_count; ++i) {
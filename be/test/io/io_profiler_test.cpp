@@ -146,4 +146,31 @@ TEST(IOProfilerTest, test_profile_and_get_topn_stats) {
     ASSERT_TRUE(IOProfiler::is_empty());
 }
 
+TEST(IOProfilerTest, test_latency_stats) {
+    IOProfiler::reset_latency_stats();
+    ASSERT_OK(IOProfiler::start(IOProfiler::IOMode::IOMODE_ALL));
+    {
+        auto scope = IOProfiler::scope(IOProfiler::TAG_COMPACTION, 10086);
+        IOProfiler::add_read(4096, 50000);
+        // slower than io_profiler_slow_io_threshold_ms
+        IOProfiler::add_write(1024, 2000000000L);
+    }
+    IOProfiler::stop();
+    IOProfiler::reset();
+
+    auto str = IOProfiler::get_latency_stats_str();
+    auto slow_pos = str.find("slow io");
+    ASSERT_NE(std::string::npos, slow_pos);
+    // both ops have a histogram row
+    ASSERT_NE(std::string::npos, str.substr(0, slow_pos).find("read"));
+    ASSERT_NE(std::string::npos, str.substr(0, slow_pos).find("write"));
+    // only the write is sampled as slow io, attributed to its tablet
+    auto samples = str.substr(slow_pos);
+    ASSERT_NE(std::string::npos, samples.find("10086"));
+    ASSERT_EQ(std::string::npos, samples.find("read"));
+
+    IOProfiler::reset_latency_stats();
+    ASSERT_EQ(std::string::npos, IOProfiler::get_latency_stats_str().find("10086"));
+}
+
 } // namespace starrocks
\ No newline at end of file
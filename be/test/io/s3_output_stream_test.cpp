@@ -155,6 +155,30 @@ TEST_F(S3OutputStreamTest, test_multipart_upload) {
     delete_object(kObjectName);
 }
 
+TEST_F(S3OutputStreamTest, test_concurrent_multipart_upload) {
+    const char* kObjectName = "test_concurrent_multipart_upload";
+    delete_object(kObjectName);
+    const int64_t kPartSize = 5 * 1024 * 1024;
+    const int kParts = 5;
+    S3OutputStream os(g_s3client, kBucketName, kObjectName, 12, kPartSize, /*max_inflight_parts=*/3);
+    S3InputStream is(g_s3client, kBucketName, kObjectName, kPartSize);
+
+    std::string part(kPartSize, ' ');
+    for (int i = 0; i < kParts; i++) {
+        memset(part.data(), 'a' + i, part.size());
+        ASSERT_OK(os.write(part.data(), part.size()));
+    }
+    ASSERT_OK(os.close());
+
+    std::string buff(kPartSize, ' ');
+    for (int i = 0; i < kParts; i++) {
+        ASSERT_OK(is.read_at_fully(i * kPartSize, buff.data(), buff.size()));
+        ASSERT_EQ(std::string(kPartSize, 'a' + i), buff);
+    }
+
+    delete_object(kObjectName);
+}
+
 TEST_F(S3OutputStreamTest, test_skip) {
     char buff[32];
     const char* kObjectName = "test_multipart_upload";
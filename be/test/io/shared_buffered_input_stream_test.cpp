@@ -19,6 +19,7 @@
 #include "io_test_base.h"
 #include "testutil/assert.h"
 #include "testutil/parallel_test.h"
+#include "util/threadpool.h"
 
 namespace starrocks::io {
 
@@ -48,6 +49,34 @@ PARALLEL_TEST(SharedBufferedInputStreamTest, test_release) {
     ASSERT_OK(sb.status());
 }
 
+TEST_F(SharedBufferedInputStreamTest, test_prefetch) {
+    size_t len = 1 * 1024 * 1024; // 1MB
+    const std::string rand_string = random_string(len);
+    auto in = std::make_shared<TestInputStream>(rand_string, len);
+    std::unique_ptr<ThreadPool> pool;
+    ASSERT_OK(ThreadPoolBuilder("test_prefetch").set_min_threads(1).set_max_threads(4).build(&pool));
+
+    auto sb_stream = std::make_shared<io::SharedBufferedInputStream>(in, "test", len);
+    sb_stream->set_coalesce_options({.max_dist_size = 0, .max_buffer_size = 64 * 1024});
+    sb_stream->set_prefetch_options(pool.get(), 2, 64 * 1024);
+    std::vector<io::SharedBufferedInputStream::IORange> ranges;
+    // 8 ranges which could not be merged
+    for (int i = 0; i < 8; i++) {
+        ranges.emplace_back(i * 100 * 1024, 32 * 1024);
+    }
+    ASSERT_OK(sb_stream->set_io_ranges(ranges));
+
+    std::string buf(32 * 1024, 0);
+    for (const auto& r : ranges) {
+        ASSERT_OK(sb_stream->read_at_fully(r.offset, buf.data(), r.size));
+        ASSERT_EQ(rand_string.substr(r.offset, r.size), buf);
+    }
+    // only the first buffer is read by the reader, and the others are read ahead
+    ASSERT_EQ(1, sb_stream->shared_io_count());
+    ASSERT_EQ(7, sb_stream->prefetch_io_count());
+    ASSERT_EQ(0, sb_stream->direct_io_count());
+}
+
 TEST_F(SharedBufferedInputStreamTest, test_orc) {
     size_t len = 100 * 1024 * 1024; // 1MB
     const std::string rand_string = random_string(len);
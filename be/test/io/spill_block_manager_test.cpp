@@ -163,6 +163,21 @@ TEST_F(SpillBlockManagerTest, dir_choose_strategy) {
     }
 }
 
+TEST_F(SpillBlockManagerTest, dir_available_size) {
+    // the quota of remote_dir is unlimited, but the disk is not
+    ASSERT_LT(remote_dir->get_available_size(), INT64_MAX);
+    ASSERT_EQ(100, local_dir->get_available_size());
+
+    auto dir_mgr = create_spill_dir_manager({local_dir, remote_dir});
+    spill::AcquireDirOptions opts{.data_size = 10};
+    for (int i = 0; i < 4; i++) {
+        auto res = dir_mgr->acquire_writable_dir(opts);
+        ASSERT_TRUE(res.ok());
+        // always prefer the dir with most available space
+        ASSERT_EQ(remote_path, res.value()->dir());
+    }
+}
+
 TEST_F(SpillBlockManagerTest, log_block_allocation_test) {
     auto log_block_mgr = std::make_shared<spill::LogBlockManager>(dummy_query_id, local_dir_mgr.get());
     ASSERT_OK(log_block_mgr->open());
@@ -0,0 +1,77 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/spill/memory_arbitrator.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "common/config.h"
+#include "exec/spill/query_spill_manager.h"
+
+namespace starrocks::spill {
+
+static TUniqueId make_query_id(int64_t lo) {
+    TUniqueId id;
+    id.hi = 1;
+    id.lo = lo;
+    return id;
+}
+
+TEST(MemoryArbitratorTest, register_on_create) {
+    auto* arbitrator = MemoryArbitrator::instance();
+    size_t num_queries = arbitrator->num_queries();
+    {
+        QuerySpillManager query(make_query_id(1));
+        ASSERT_EQ(num_queries + 1, arbitrator->num_queries());
+    }
+    ASSERT_EQ(num_queries, arbitrator->num_queries());
+}
+
+TEST(MemoryArbitratorTest, pick_most_revocable) {
+    auto* arbitrator = MemoryArbitrator::instance();
+    auto q1 = std::make_unique<QuerySpillManager>(make_query_id(1));
+    auto q2 = std::make_unique<QuerySpillManager>(make_query_id(2));
+    auto q3 = std::make_unique<QuerySpillManager>(make_query_id(3));
+    q1->update_revocable_bytes(100);
+    q2->update_revocable_bytes(300);
+    q3->update_revocable_bytes(200);
+
+    double ratio = config::spill_arbitrate_query_pool_mem_ratio;
+    config::spill_arbitrate_query_pool_mem_ratio = 0.9;
+
+    // no memory pressure
+    ASSERT_EQ(nullptr, arbitrator->arbitrate(800, 1000));
+    ASSERT_FALSE(q2->revoke_requested());
+
+    // revoke the query with the most revocable memory first
+    ASSERT_EQ(q2.get(), arbitrator->arbitrate(950, 1000));
+    ASSERT_TRUE(q2->revoke_requested());
+    ASSERT_EQ(q3.get(), arbitrator->arbitrate(950, 1000));
+    ASSERT_TRUE(q3->revoke_requested());
+
+    // a query without revocable memory is never a victim
+    q1->update_revocable_bytes(-100);
+    ASSERT_EQ(nullptr, arbitrator->arbitrate(950, 1000));
+    ASSERT_FALSE(q1->revoke_requested());
+
+    // disabled
+    config::spill_arbitrate_query_pool_mem_ratio = 0;
+    q1->update_revocable_bytes(100);
+    ASSERT_EQ(nullptr, arbitrator->arbitrate(1000, 1000));
+    config::spill_arbitrate_query_pool_mem_ratio = ratio;
+}
+
+} // namespace starrocks::spill
@@ -16,6 +16,13 @@
 
 #include <gtest/gtest.h>
 
+#include "column/chunk.h"
+#include "column/fixed_length_column.h"
+#include "gen_cpp/internal_service.pb.h"
+#include "runtime/data_stream_recvr.h"
+#include "runtime/runtime_state.h"
+#include "testutil/assert.h"
+
 namespace starrocks {
 
 TEST(DataStreamMgr, pass_through_buffer_test) {
@@ -39,4 +46,99 @@ TEST(DataStreamMgr, pass_through_buffer_test) {
     mgr.reset();
 }
 
+static ChunkPtr make_int_chunk(int32_t value) {
+    auto column = Int32Column::create();
+    column->append(value);
+    auto chunk = std::make_shared<Chunk>();
+    chunk->append_column(std::move(column), 0);
+    return chunk;
+}
+
+static PTransmitChunkParams make_pass_through_request(const TUniqueId& finst_id, PlanNodeId node_id,
+                                                      int32_t sender_id, int64_t sequence, bool eos) {
+    PTransmitChunkParams request;
+    request.mutable_finst_id()->set_hi(finst_id.hi);
+    request.mutable_finst_id()->set_lo(finst_id.lo);
+    request.set_node_id(node_id);
+    request.set_sender_id(sender_id);
+    request.set_be_number(sender_id);
+    request.set_sequence(sequence);
+    request.set_eos(eos);
+    request.set_use_pass_through(true);
+    return request;
+}
+
+// A pass through request of a merging receiver pulls all the chunks appended by its sender so far, which
+// may include the chunks of later requests. The requests arrive out of sequence order and one arrives after
+// EOS, the chunks of each sender must still come out in the order they were appended.
+TEST(DataStreamMgr, keep_order_pass_through_test) {
+    auto mgr = std::make_unique<DataStreamMgr>();
+
+    TUniqueId query_id;
+    query_id.lo = 1121;
+    query_id.hi = 2024;
+    TUniqueId finst_id;
+    finst_id.lo = 1122;
+    finst_id.hi = 2024;
+    const PlanNodeId node_id = 1;
+    mgr->prepare_pass_through_chunk_buffer(query_id);
+
+    RuntimeState state(query_id, finst_id, TQueryOptions(), TQueryGlobals(), nullptr);
+    state.init_instance_mem_tracker();
+    RowDescriptor row_desc;
+    auto recvr = mgr->create_recvr(&state, row_desc, finst_id, node_id, 2, 1024 * 1024, true, nullptr, true, 1, true);
+    recvr->bind_profile(0, std::make_shared<RuntimeProfile>("recvr"));
+
+    PassThroughContext context(mgr->get_pass_through_chunk_buffer(query_id), finst_id, node_id);
+    context.init();
+    auto append = [&](int32_t sender_id, int32_t value) {
+        auto chunk = make_int_chunk(value);
+        context.append_chunk(sender_id, chunk.get(), chunk->bytes_usage(), -1);
+    };
+    auto transmit = [&](int32_t sender_id, int64_t sequence, bool eos) {
+        auto request = make_pass_through_request(finst_id, node_id, sender_id, sequence, eos);
+        google::protobuf::Closure* done = nullptr;
+        ASSERT_OK(mgr->transmit_chunk(request, &done));
+    };
+
+    // request 1 of sender 0 arrives first and pulls chunk 0, request 0 pulls the chunks 1 and 2 appended later
+    append(0, 0);
+    append(1, 100);
+    transmit(0, 1, false);
+    append(0, 1);
+    append(1, 101);
+    append(0, 2);
+    transmit(0, 0, false);
+    transmit(1, 0, false);
+    // EOS of sender 0 arrives before its request 2 and pulls the last chunk, request 2 finds nothing
+    append(0, 3);
+    transmit(0, 3, true);
+    transmit(0, 2, false);
+    append(1, 102);
+    transmit(1, 2, true);
+    transmit(1, 1, false);
+
+    auto providers = recvr->create_merge_path_chunk_providers();
+    ASSERT_EQ(2, providers.size());
+    for (int32_t sender_id = 0; sender_id < 2; sender_id++) {
+        std::vector<int32_t> values;
+        bool eos = false;
+        while (!eos) {
+            ChunkPtr chunk;
+            ASSERT_TRUE(providers[sender_id](false, &chunk, &eos));
+            if (chunk != nullptr) {
+                values.push_back(chunk->get_column_by_slot_id(0)->get(0).get_int32());
+            }
+        }
+        std::vector<int32_t> expected =
+                sender_id == 0 ? std::vector<int32_t>{0, 1, 2, 3} : std::vector<int32_t>{100, 101, 102};
+        ASSERT_EQ(expected, values);
+    }
+
+    recvr->close();
+    recvr.reset();
+    mgr->destroy_pass_through_chunk_buffer(query_id);
+    mgr->close();
+}
+
 } // namespace starrocks
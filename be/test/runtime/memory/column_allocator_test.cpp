@@ -0,0 +1,109 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "runtime/memory/column_allocator.h"
+
+#include <gtest/gtest.h>
+
+#include "column/vectorized_fwd.h"
+#include "runtime/memory/counting_allocator.h"
+
+namespace starrocks {
+
+TEST(ColumnBufferRecyclerTest, recycle_and_reuse) {
+    ColumnBufferRecycler recycler(64 * 1024);
+    ThreadLocalColumnBufferRecyclerSetter setter(&recycler);
+
+    const int32_t* first_data = nullptr;
+    {
+        Buffer<int32_t> buffer;
+        buffer.reserve(4096);
+        first_data = buffer.data();
+    }
+    ASSERT_EQ(16384, recycler.cached_bytes());
+
+    {
+        // same size, reuse the cached buffer
+        Buffer<int32_t> buffer;
+        buffer.reserve(4096);
+        ASSERT_EQ(first_data, buffer.data());
+        ASSERT_EQ(0, recycler.cached_bytes());
+        ASSERT_EQ(1, recycler.num_reused());
+
+        // not a power of two, or too small, never cached
+        Buffer<int32_t> odd;
+        odd.reserve(4095);
+        Buffer<uint8_t> small;
+        small.reserve(1024);
+    }
+    ASSERT_EQ(16384, recycler.cached_bytes());
+
+    {
+        // not cached once the cache is full
+        std::vector<Buffer<int64_t>> buffers(5);
+        for (auto& buffer : buffers) {
+            buffer.reserve(2048);
+        }
+    }
+    ASSERT_EQ(65536, recycler.cached_bytes());
+    ASSERT_EQ(65536, recycler.peak_cached_bytes());
+
+    recycler.release();
+    ASSERT_EQ(0, recycler.cached_bytes());
+}
+
+TEST(ColumnBufferRecyclerTest, shared_capacity) {
+    // the capacity bounds the cached bytes of all the recyclers together
+    ColumnBufferRecycler recycler1(32 * 1024);
+    ColumnBufferRecycler recycler2(32 * 1024);
+    {
+        ThreadLocalColumnBufferRecyclerSetter setter(&recycler1);
+        std::vector<Buffer<int32_t>> buffers(3);
+        for (auto& buffer : buffers) {
+            buffer.reserve(4096);
+        }
+    }
+    ASSERT_EQ(32768, recycler1.cached_bytes());
+    ASSERT_EQ(32768, ColumnBufferRecycler::total_cached_bytes());
+    {
+        ThreadLocalColumnBufferRecyclerSetter setter(&recycler2);
+        Buffer<int32_t> buffer;
+        buffer.reserve(4096);
+    }
+    ASSERT_EQ(0, recycler2.cached_bytes());
+
+    recycler1.release();
+    ASSERT_EQ(0, ColumnBufferRecycler::total_cached_bytes());
+    {
+        ThreadLocalColumnBufferRecyclerSetter setter(&recycler2);
+        Buffer<int32_t> buffer;
+        buffer.reserve(4096);
+    }
+    ASSERT_EQ(16384, recycler2.cached_bytes());
+    recycler2.release();
+}
+
+TEST(ColumnBufferRecyclerTest, non_default_allocator) {
+    ColumnBufferRecycler recycler(64 * 1024);
+    ThreadLocalColumnBufferRecyclerSetter setter(&recycler);
+    CountingAllocator<MemHookAllocator> allocator;
+    ThreadLocalColumnAllocatorSetter allocator_setter(&allocator);
+    {
+        Buffer<int32_t> buffer;
+        buffer.reserve(4096);
+    }
+    ASSERT_EQ(0, recycler.cached_bytes());
+}
+
+} // namespace starrocks
@@ -66,4 +66,25 @@ TEST(SystemAllocatorTest, TestNormal) {
     test_normal<false>();
 }
 
+TEST(SystemAllocatorTest, TestAdviseHugePages) {
+    constexpr size_t kLength = 8 * SystemAllocator::kHugePageSize;
+    void* ptr = nullptr;
+    ASSERT_EQ(0, posix_memalign(&ptr, SystemAllocator::kHugePageSize, kLength));
+
+    config::madvise_huge_pages = false;
+    ASSERT_EQ(0, SystemAllocator::advise_huge_pages(ptr, kLength));
+
+    config::madvise_huge_pages = true;
+    // too small
+    ASSERT_EQ(0, SystemAllocator::advise_huge_pages(ptr, config::huge_page_min_alloc_bytes - 1));
+    // no complete huge page in the range
+    ASSERT_EQ(0, SystemAllocator::advise_huge_pages((uint8_t*)ptr + 1, SystemAllocator::kHugePageSize + 1));
+    // only the aligned part is advised, it may fail if the kernel doesn't support transparent huge pages
+    size_t advised = SystemAllocator::advise_huge_pages((uint8_t*)ptr + 4096, kLength - 4096);
+    ASSERT_TRUE(advised == 0 || advised == kLength - SystemAllocator::kHugePageSize);
+    config::madvise_huge_pages = false;
+
+    ::free(ptr);
+}
+
 } // namespace starrocks
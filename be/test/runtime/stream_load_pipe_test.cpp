@@ -217,6 +217,44 @@ PARALLEL_TEST(StreamLoadPipeTest, append_and_read_buffer) {
     ASSERT_EQ(64, pipe.append_buffer_bytes());
 }
 
+PARALLEL_TEST(StreamLoadPipeTest, buffered_bytes_of_sliced_buffer) {
+    StreamLoadPipe pipe(1024, 64);
+
+    auto make_slice = [] {
+        auto buf = ByteBuffer::allocate_with_tracker(64).value();
+        for (int j = 0; j < 64; ++j) {
+            char c = '0' + (j % 10);
+            buf->put_bytes(&c, sizeof(c));
+        }
+        buf->flip();
+        // the first 16 bytes are already consumed by the producer
+        buf->pos = 16;
+        return buf;
+    };
+
+    ASSERT_OK(pipe.append(make_slice()));
+    ASSERT_EQ(48, pipe.buffered_bytes());
+    auto buf = pipe.read();
+    ASSERT_TRUE(buf.ok());
+    ASSERT_EQ(48, buf.value()->remaining());
+    ASSERT_EQ(0, pipe.buffered_bytes());
+
+    ASSERT_OK(pipe.append(make_slice()));
+    ASSERT_EQ(48, pipe.buffered_bytes());
+    char data[32];
+    size_t data_size = sizeof(data);
+    bool eof = false;
+    ASSERT_OK(pipe.read((uint8_t*)data, &data_size, &eof));
+    ASSERT_EQ(32, data_size);
+    ASSERT_EQ('6', data[0]);
+    ASSERT_EQ(48, pipe.buffered_bytes());
+    ASSERT_OK(pipe.finish());
+    data_size = sizeof(data);
+    ASSERT_OK(pipe.read((uint8_t*)data, &data_size, &eof));
+    ASSERT_EQ(16, data_size);
+    ASSERT_EQ(0, pipe.buffered_bytes());
+}
+
 PARALLEL_TEST(StreamLoadPipeTest, append_large_chunk) {
     StreamLoadPipe pipe(/*max_buffered_bytes=*/6, /*min_chunk_size=*/4);
 
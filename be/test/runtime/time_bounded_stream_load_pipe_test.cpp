@@ -106,6 +106,41 @@ PARALLEL_TEST(TimeBoundedStreamLoadPipeTest, read_data_finish) {
     ASSERT_TRUE(eof);
 }
 
+PARALLEL_TEST(TimeBoundedStreamLoadPipeTest, read_window_full) {
+    SyncPoint::GetInstance()->EnableProcessing();
+    DeferOp defer([]() {
+        SyncPoint::GetInstance()->ClearCallBack("TimeBoundedStreamLoadPipe::get_current_ns");
+        SyncPoint::GetInstance()->DisableProcessing();
+    });
+
+    SyncPoint::GetInstance()->SetCallBack("TimeBoundedStreamLoadPipe::get_current_ns",
+                                          [&](void* arg) { *((int64_t*)arg) = 0; });
+    TimeBoundedStreamLoadPipe pipe("p", 1000, DEFAULT_STREAM_LOAD_PIPE_NON_BLOCKING_WAIT_US,
+                                   DEFAULT_STREAM_LOAD_PIPE_BUFFERED_BYTES, 100);
+
+    for (int i = 0; i < 2; i++) {
+        auto buf = ByteBuffer::allocate_with_tracker(64).value();
+        for (int j = 0; j < 64; ++j) {
+            char c = '0' + j;
+            buf->put_bytes(&c, sizeof(c));
+        }
+        buf->flip();
+        ASSERT_OK(pipe.append(std::move(buf)));
+    }
+
+    // the window is full before the active time elapses
+    ASSERT_GT(pipe.left_active_ns(), 0);
+    for (int i = 0; i < 2; i++) {
+        auto ret = pipe.read();
+        ASSERT_TRUE(ret.ok());
+        ASSERT_EQ(64, ret.value()->limit);
+    }
+    ASSERT_TRUE(pipe.read().status().is_end_of_file());
+
+    auto buf = ByteBuffer::allocate_with_tracker(64).value();
+    ASSERT_FALSE(pipe.append(std::move(buf)).ok());
+}
+
 PARALLEL_TEST(TimeBoundedStreamLoadPipeTest, not_support_appending_char_array) {
     TimeBoundedStreamLoadPipe pipe("p", 50);
     char ch = '0';
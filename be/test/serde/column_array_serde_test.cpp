@@ -215,6 +215,38 @@ PARALLEL_TEST(ColumnArraySerdeTest, nullable_int32_column) {
     }
 }
 
+// NOLINTNEXTLINE
+PARALLEL_TEST(ColumnArraySerdeTest, nullable_column_null_bitmap) {
+    auto c1 = NullableColumn::create(Int32Column::create(), NullColumn::create());
+    for (int32_t i = 0; i < 1003; i++) {
+        if (i % 3 == 0) {
+            c1->append_nulls(1);
+        } else {
+            c1->append_datum(Datum(i));
+        }
+    }
+
+    for (auto level : {8, 10, 14, 15}) {
+        auto c2 = NullableColumn::create(Int32Column::create(), NullColumn::create());
+        ASSERT_EQ(sizeof(uint32_t) + (c1->size() + 7) / 8 +
+                          ColumnArraySerde::max_serialized_size(*c1->data_column(), level),
+                  ColumnArraySerde::max_serialized_size(*c1, level));
+
+        std::vector<uint8_t> buffer;
+        buffer.resize(ColumnArraySerde::max_serialized_size(*c1, level));
+        const uint8_t* end = ColumnArraySerde::serialize(*c1, buffer.data(), false, level);
+        ASSERT_EQ(end, ColumnArraySerde::deserialize(buffer.data(), c2.get(), false, level));
+        ASSERT_EQ(c1->size(), c2->size());
+        ASSERT_TRUE(c2->has_null());
+        for (size_t i = 0; i < c1->size(); i++) {
+            ASSERT_EQ(c1->is_null(i), c2->is_null(i));
+            if (!c1->is_null(i)) {
+                ASSERT_EQ(c1->get(i).get_int32(), c2->get(i).get_int32());
+            }
+        }
+    }
+}
+
 // NOLINTNEXTLINE
 PARALLEL_TEST(ColumnArraySerdeTest, binary_column) {
     std::vector<Slice> strings{{"bbb"}, {"bbc"}, {"ccc"}};
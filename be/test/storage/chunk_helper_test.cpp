@@ -19,6 +19,7 @@
 #include "column/column_helper.h"
 #include "column/nullable_column.h"
 #include "column/vectorized_fwd.h"
+#include "common/config.h"
 #include "common/object_pool.h"
 #include "gtest/gtest.h"
 #include "runtime/descriptor_helper.h"
@@ -378,6 +379,45 @@ TEST_F(ChunkPipelineAccumulatorTest, test_push) {
     ASSERT_FALSE(accumulator.has_output());
 }
 
+TEST_F(ChunkPipelineAccumulatorTest, test_bytes_budget) {
+    ChunkPipelineAccumulator accumulator;
+    accumulator.set_bytes_budget(10000);
+
+    // each chunk is 4000 bytes
+    for (size_t i = 0; i < 2; i++) {
+        accumulator.push(_generate_chunk(1000, 4));
+        ASSERT_FALSE(accumulator.has_output());
+    }
+    accumulator.push(_generate_chunk(1000, 4));
+    ASSERT_TRUE(accumulator.has_output());
+    auto result_chunk = std::move(accumulator.pull());
+    ASSERT_EQ(result_chunk->num_rows(), 3000);
+    ASSERT_EQ(accumulator.num_coalesced_chunks(), 2);
+    ASSERT_EQ(accumulator.num_budget_limited_chunks(), 1);
+
+    // rows reach limit before the budget
+    accumulator.push(_generate_chunk(4093, 1));
+    ASSERT_TRUE(accumulator.has_output());
+    result_chunk = std::move(accumulator.pull());
+    ASSERT_EQ(result_chunk->num_rows(), 4093);
+    ASSERT_EQ(accumulator.num_budget_limited_chunks(), 1);
+}
+
+TEST(ChunkHelperTest, adaptive_chunk_size) {
+    const int64_t prev_budget = config::adaptive_chunk_cache_budget_bytes;
+    config::adaptive_chunk_cache_budget_bytes = 0;
+    ASSERT_EQ(4096, ChunkHelper::adaptive_chunk_size(4096, 100000));
+
+    config::adaptive_chunk_cache_budget_bytes = 1024 * 1024;
+    // narrow rows
+    ASSERT_EQ(4096, ChunkHelper::adaptive_chunk_size(4096, 100));
+    ASSERT_EQ(1024, ChunkHelper::adaptive_chunk_size(4096, 1024));
+    // too wide rows
+    ASSERT_EQ(ChunkHelper::kMinAdaptiveChunkSize, ChunkHelper::adaptive_chunk_size(4096, 100000));
+    ASSERT_EQ(100, ChunkHelper::adaptive_chunk_size(100, 100000));
+    config::adaptive_chunk_cache_budget_bytes = prev_budget;
+}
+
 TEST_F(ChunkPipelineAccumulatorTest, test_owner_info) {
     constexpr size_t kDesiredSize = 4096;
 
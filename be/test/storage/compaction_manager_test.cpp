@@ -32,6 +32,7 @@
 #include "storage/tablet.h"
 #include "storage/tablet_updates.h"
 #include "testutil/assert.h"
+#include "util/defer_op.h"
 
 namespace starrocks {
 
@@ -519,4 +520,33 @@ TEST_F(CompactionManagerTest, test_get_compaction_status) {
     ASSERT_EQ(0, _engine->compaction_manager()->running_tasks_num());
 }
 
+TEST_F(CompactionManagerTest, test_compaction_score_read_amp_bonus) {
+    auto tablet_meta = std::make_shared<TabletMeta>();
+    TabletSchemaPB schema_pb;
+    schema_pb.set_keys_type(KeysType::DUP_KEYS);
+    auto schema = std::make_shared<const TabletSchema>(schema_pb);
+    tablet_meta->set_tablet_schema(schema);
+    DataDir data_dir("./data_dir");
+    auto tablet = Tablet::create_tablet_from_meta(tablet_meta, &data_dir);
+
+    auto old_enable = config::enable_compaction_read_amp_bonus;
+    DeferOp defer([&]() { config::enable_compaction_read_amp_bonus = old_enable; });
+    config::enable_compaction_read_amp_bonus = true;
+    // never queried, keep the score
+    ASSERT_DOUBLE_EQ(10.0, tablet->adjust_compaction_score_by_reads(10.0));
+    // queries reading a single segment pay no read amplification
+    for (int i = 0; i < 100; i++) {
+        tablet->update_query_read_stats(1);
+    }
+    ASSERT_DOUBLE_EQ(10.0, tablet->adjust_compaction_score_by_reads(10.0));
+    for (int i = 0; i < 100; i++) {
+        tablet->update_query_read_stats(100);
+    }
+    double boosted = tablet->adjust_compaction_score_by_reads(10.0);
+    ASSERT_GT(boosted, 10.0);
+    ASSERT_LE(boosted, 10.0 * (1 + config::compaction_read_amp_max_bonus));
+    config::enable_compaction_read_amp_bonus = false;
+    ASSERT_DOUBLE_EQ(10.0, tablet->adjust_compaction_score_by_reads(10.0));
+}
+
 } // namespace starrocks
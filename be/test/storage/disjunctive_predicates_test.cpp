@@ -23,6 +23,7 @@
 #include "common/object_pool.h"
 #include "simd/simd.h"
 #include "storage/column_predicate.h"
+#include "testutil/assert.h"
 #include "types/logical_type.h"
 #include "util/value_generator.h"
 
@@ -82,4 +83,49 @@ TEST(DisjunctivePredicatesTest, TwoPredicateTest) {
     ASSERT_EQ(sz, 3096);
 }
 
+TEST(DisjunctivePredicatesTest, AllSelectedByFirstPredicateTest) {
+    constexpr const int chunk_size = 4096;
+    constexpr LogicalType TYPE0 = TYPE_INT;
+    constexpr LogicalType TYPE1 = TYPE_INT;
+
+    auto column0 = RunTimeColumnType<TYPE0>::create(chunk_size);
+    auto column1 = RunTimeColumnType<TYPE1>::create(chunk_size);
+    ContainerIniter<SegDataGeneratorWithRange<1000>, RunTimeColumnType<TYPE0>::Container, chunk_size>::init(
+            column0->get_data());
+    ContainerIniter<SegDataGeneratorWithRange<4>, RunTimeColumnType<TYPE1>::Container, chunk_size>::init(
+            column1->get_data());
+    Columns columns = {std::move(column0), std::move(column1)};
+    Chunk::SlotHashMap hash_map;
+    hash_map[0] = 0;
+    hash_map[1] = 1;
+    auto chunk = std::make_shared<Chunk>(columns, hash_map);
+    chunk->_cid_to_index[0] = 0;
+    chunk->_cid_to_index[1] = 1;
+
+    ObjectPool pool;
+    ConjunctivePredicates conjuncts0;
+    conjuncts0.vec_preds().push_back(pool.add(new_column_ge_predicate(get_type_info(TYPE_INT), 0, "0")));
+    ConjunctivePredicates conjuncts1;
+    conjuncts1.vec_preds().push_back(pool.add(new_column_ge_predicate(get_type_info(TYPE_INT), 1, "2")));
+
+    DisjunctivePredicates predicates;
+    predicates.predicate_list().push_back(conjuncts0);
+    predicates.predicate_list().push_back(conjuncts1);
+
+    std::vector<uint8_t> selection(chunk_size, 0);
+    ASSERT_OK(predicates.evaluate(chunk.get(), selection.data()));
+    ASSERT_EQ(chunk_size, SIMD::count_nonzero(selection));
+
+    // the first disjunct rejects every row, so the second one decides the result
+    DisjunctivePredicates predicates2;
+    ConjunctivePredicates conjuncts2;
+    conjuncts2.vec_preds().push_back(pool.add(new_column_ge_predicate(get_type_info(TYPE_INT), 0, "1000")));
+    predicates2.predicate_list().push_back(conjuncts2);
+    predicates2.predicate_list().push_back(conjuncts1);
+
+    std::fill(selection.begin(), selection.end(), 0);
+    ASSERT_OK(predicates2.evaluate(chunk.get(), selection.data(), 100, 200));
+    ASSERT_EQ(50, SIMD::count_nonzero(selection));
+}
+
 } // namespace starrocks
@@ -193,6 +193,35 @@ TEST_F(TestHll, Normal) {
     }
 }
 
+TEST_F(TestHll, UpdateBatch) {
+    std::vector<uint64_t> hash_values;
+    for (uint64_t i = 0; i < 10000; ++i) {
+        hash_values.push_back(hash(i));
+        // zero hash values should be skipped
+        hash_values.push_back(0);
+    }
+
+    HyperLogLog expected;
+    for (auto value : hash_values) {
+        if (value != 0) {
+            expected.update(value);
+        }
+    }
+
+    // the batch crosses the explicit -> register conversion
+    HyperLogLog actual;
+    actual.update_batch(hash_values.data(), 100);
+    actual.update_batch(hash_values.data() + 100, hash_values.size() - 100);
+    ASSERT_EQ(expected.estimate_cardinality(), actual.estimate_cardinality());
+
+    uint8_t expected_buf[HLL_REGISTERS_COUNT + 1];
+    uint8_t actual_buf[HLL_REGISTERS_COUNT + 1];
+    size_t expected_len = expected.serialize(expected_buf);
+    size_t actual_len = actual.serialize(actual_buf);
+    ASSERT_EQ(expected_len, actual_len);
+    ASSERT_EQ(0, memcmp(expected_buf, actual_buf, expected_len));
+}
+
 TEST_F(TestHll, InvalidPtr) {
     {
         HyperLogLog hll(Slice((char*)nullptr, 0));
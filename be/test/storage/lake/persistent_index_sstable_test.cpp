@@ -25,6 +25,7 @@
 #include "storage/lake/join_path.h"
 #include "storage/lake/utils.h"
 #include "storage/persistent_index.h"
+#include "storage/sstable/filter_policy.h"
 #include "storage/sstable/iterator.h"
 #include "storage/sstable/merger.h"
 #include "storage/sstable/options.h"
@@ -109,6 +110,51 @@ TEST_F(PersistentIndexSstableTest, test_generate_sst_seek_and_check) {
     delete sstable;
 }
 
+TEST_F(PersistentIndexSstableTest, test_open_with_tail_prefetch) {
+    const int N = 10000;
+    std::unique_ptr<sstable::FilterPolicy> filter_policy;
+    filter_policy.reset(const_cast<sstable::FilterPolicy*>(sstable::NewBloomFilterPolicy(10)));
+    sstable::Options options;
+    options.filter_policy = filter_policy.get();
+    const std::string filename = "test_tail_prefetch.sst";
+    ASSIGN_OR_ABORT(auto file, fs::new_writable_file(lake::join_path(kTestDir, filename)));
+    sstable::TableBuilder builder(options, file.get());
+    for (int i = 0; i < N; i++) {
+        std::string str = fmt::format("test_key_{:016X}", i);
+        IndexValue val(i);
+        builder.Add(Slice(str), Slice(val.v, 8));
+    }
+    CHECK_OK(builder.Finish());
+    uint64_t filesz = builder.FileSize();
+    size_t expected_memory_usage = 0;
+    // no prefetch, a prefetch covering only part of the tail, and one covering the whole file
+    for (size_t prefetch_bytes : {(size_t)0, (size_t)100, (size_t)(filesz * 2)}) {
+        options.open_prefetch_bytes = prefetch_bytes;
+        sstable::Table* sstable = nullptr;
+        ASSIGN_OR_ABORT(auto read_file, fs::new_random_access_file(lake::join_path(kTestDir, filename)));
+        CHECK_OK(sstable::Table::Open(options, read_file.get(), filesz, &sstable));
+        // the filter block must be loaded no matter where it was read from
+        if (prefetch_bytes == 0) {
+            expected_memory_usage = sstable->memory_usage();
+        } else {
+            ASSERT_EQ(expected_memory_usage, sstable->memory_usage());
+        }
+        sstable::ReadOptions read_options;
+        sstable::Iterator* iter = sstable->NewIterator(read_options);
+        for (int i = 0; i < 100; i++) {
+            int r = rand() % N;
+            iter->Seek(fmt::format("test_key_{:016X}", r));
+            ASSERT_TRUE(iter->Valid() && iter->status().ok());
+            ASSERT_TRUE(iter->key().to_string() == fmt::format("test_key_{:016X}", r));
+            IndexValue exp_val(r);
+            IndexValue cur_val(UNALIGNED_LOAD64(iter->value().get_data()));
+            ASSERT_TRUE(exp_val == cur_val);
+        }
+        delete iter;
+        delete sstable;
+    }
+}
+
 TEST_F(PersistentIndexSstableTest, test_merge) {
     std::vector<sstable::Iterator*> list;
     std::vector<std::unique_ptr<RandomAccessFile>> read_files;
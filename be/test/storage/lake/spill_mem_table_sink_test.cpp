@@ -33,6 +33,7 @@
 #include "storage/lake/test_util.h"
 #include "storage/tablet_schema.h"
 #include "testutil/assert.h"
+#include "util/defer_op.h"
 #include "util/raw_container.h"
 #include "util/runtime_profile.h"
 
@@ -253,6 +254,43 @@ TEST_F(SpillMemTableSinkTest, test_merge) {
     ASSERT_EQ(1, tablet_writer->files().size());
 }
 
+TEST_F(SpillMemTableSinkTest, test_merge_vertically) {
+    int64_t old_min_columns = config::load_spill_vertical_merge_min_columns;
+    int64_t old_columns_per_group = config::load_spill_vertical_merge_max_columns_per_group;
+    config::load_spill_vertical_merge_min_columns = 1;
+    config::load_spill_vertical_merge_max_columns_per_group = 1;
+    DeferOp defer([&]() {
+        config::load_spill_vertical_merge_min_columns = old_min_columns;
+        config::load_spill_vertical_merge_max_columns_per_group = old_columns_per_group;
+    });
+
+    int64_t tablet_id = 1;
+    int64_t txn_id = 1;
+    auto tablet_schema = TabletSchema::create(generate_simple_tablet_metadata(DUP_KEYS)->schema());
+    auto schema = std::make_shared<Schema>(ChunkHelper::convert_schema(tablet_schema));
+    std::unique_ptr<LoadSpillBlockManager> block_manager =
+            std::make_unique<LoadSpillBlockManager>(TUniqueId(), tablet_id, txn_id, kTestDir);
+    ASSERT_OK(block_manager->init());
+    std::unique_ptr<TabletWriter> tablet_writer = std::make_unique<HorizontalGeneralTabletWriter>(
+            _tablet_mgr.get(), tablet_id, tablet_schema, txn_id, false);
+    SpillMemTableSink sink(block_manager.get(), tablet_writer.get(), &_dummy_runtime_profile);
+    for (int i = 0; i < 3; i++) {
+        // keys of the flushes interleave: i, i + 3, i + 6, ...
+        auto c0 = Int32Column::create();
+        auto c1 = Int32Column::create();
+        for (int j = 0; j < kChunkSize; j++) {
+            c0->append(j * 3 + i);
+            c1->append((j * 3 + i) * 3);
+        }
+        auto chunk = std::make_shared<Chunk>(Columns{std::move(c0), std::move(c1)}, schema);
+        starrocks::SegmentPB segment;
+        ASSERT_OK(sink.flush_chunk(*chunk, &segment, false));
+    }
+    ASSERT_OK(sink.merge_blocks_to_segments());
+    ASSERT_EQ(1, tablet_writer->files().size());
+    ASSERT_EQ(3 * kChunkSize, tablet_writer->num_rows());
+}
+
 TEST_F(SpillMemTableSinkTest, test_out_of_disk_space) {
     TEST_ENABLE_ERROR_POINT("PosixFileSystem::pre_allocate",
                             Status::CapacityLimitExceed("injected pre_allocate error"));
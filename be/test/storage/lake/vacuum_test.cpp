@@ -31,6 +31,7 @@
 #include "test_util.h"
 #include "testutil/assert.h"
 #include "testutil/sync_point.h"
+#include "util/time.h"
 #include "util/uid_util.h"
 
 namespace starrocks::lake {
@@ -1513,6 +1514,34 @@ TEST(LakeVacuumTest2, test_delete_files_thread_pool_full) {
     delete_files_async({"any_non_exist_file"});
 }
 
+TEST(LakeVacuumTest2, test_delete_files_throttle) {
+    std::vector<std::string> paths;
+    for (int i = 0; i < 4; i++) {
+        paths.emplace_back(fmt::format("test_vacuum_delete_files_throttle{}.txt", i));
+        ASSIGN_OR_ABORT(auto f, fs::new_writable_file(paths.back()));
+        ASSERT_OK(f->append("111"));
+        ASSERT_OK(f->close());
+    }
+
+    auto old_rate = config::lake_vacuum_max_deleted_files_per_second;
+    auto old_batch_size = config::lake_vacuum_min_batch_delete_size;
+    config::lake_vacuum_max_deleted_files_per_second = 10;
+    config::lake_vacuum_min_batch_delete_size = 2;
+    DeferOp defer([&]() {
+        config::lake_vacuum_max_deleted_files_per_second = old_rate;
+        config::lake_vacuum_min_batch_delete_size = old_batch_size;
+    });
+
+    // two batches of 2 files at 10 files/s, the second batch must wait for the 200ms taken by the first one
+    auto t0 = MonotonicMillis();
+    ASSERT_OK(delete_files(paths));
+    auto t1 = MonotonicMillis();
+    EXPECT_GE(t1 - t0, 150);
+    for (const auto& path : paths) {
+        ASSERT_FALSE(fs::path_exist(path));
+    }
+}
+
 TEST(LakeVacuumTest2, test_delete_files_retry) {
     WritableFileOptions options;
     options.mode = FileSystem::CREATE_OR_OPEN_WITH_TRUNCATE;
@@ -339,6 +339,130 @@ TEST_F(MemTableTest, testUniqKeysInsertFlushRead) {
     ASSERT_EQ(n, pkey_read);
 }
 
+TEST_F(MemTableTest, testUniqKeysIncrementalSort) {
+    const string path = "./MemTableTest_testUniqKeysIncrementalSort";
+    config::enable_memtable_incremental_sort = true;
+    MySetUp(create_tablet_schema("pk int,name varchar,pv int", 1, KeysType::UNIQUE_KEYS), "pk int,name varchar,pv int",
+            path);
+    config::enable_memtable_incremental_sort = false;
+    const size_t n = 10000;
+    auto pchunk = gen_chunk(*_slots, n);
+    vector<uint32_t> indexes;
+    indexes.reserve(2 * n);
+    for (int i = 0; i < n; i++) {
+        indexes.emplace_back(i);
+    }
+    for (int i = 0; i < n; i++) {
+        indexes.emplace_back(i);
+    }
+    std::shuffle(indexes.begin(), indexes.end(), std::mt19937(std::random_device()()));
+    // small batches are sorted into several runs which are merged at flush
+    const size_t batch_size = 1000;
+    for (size_t from = 0; from < indexes.size(); from += batch_size) {
+        auto res = _mem_table->insert(*pchunk, indexes.data(), from, batch_size);
+        ASSERT_TRUE(res.ok());
+    }
+    ASSERT_TRUE(_mem_table->finalize().ok());
+    ASSERT_OK(_mem_table->flush());
+    RowsetSharedPtr rowset = *_writer->build();
+    unique_ptr<Schema> read_schema = create_schema("pk int", 1);
+    OlapReaderStatistics stats;
+    RowsetReadOptions rs_opts;
+    rs_opts.sorted = false;
+    rs_opts.use_page_cache = false;
+    rs_opts.stats = &stats;
+    auto itr = rowset->new_iterator(*read_schema, rs_opts);
+    ASSERT_TRUE(itr.ok()) << itr.status().to_string();
+    std::shared_ptr<Chunk> chunk = ChunkHelper::new_chunk(*read_schema, 4096);
+    size_t pkey_read = 0;
+    int last_value = -1;
+    while (true) {
+        Status st = (*itr)->get_next(chunk.get());
+        if (st.is_end_of_file()) {
+            break;
+        }
+        auto column = chunk->get_column_by_name("pk");
+        for (size_t i = 0; i < column->size(); i++) {
+            int new_value = column->get(i).get_int32();
+            ASSERT_LT(last_value, new_value);
+            last_value = new_value;
+        }
+        pkey_read += chunk->num_rows();
+        chunk->reset();
+    }
+    ASSERT_EQ(n, pkey_read);
+}
+
+TEST_F(MemTableTest, testDupKeysPresortedInsert) {
+    const string path = "./MemTableTest_testDupKeysPresortedInsert";
+    MySetUp(create_tablet_schema("pk int,name varchar,pv int", 1, KeysType::DUP_KEYS), "pk int,name varchar,pv int",
+            path);
+    const size_t n = 3000;
+    auto pchunk = gen_chunk(*_slots, n);
+    vector<uint32_t> indexes;
+    indexes.reserve(n);
+    for (int i = 0; i < n; i++) {
+        indexes.emplace_back(i);
+    }
+    // rows inserted in sort key order over several batches are not sorted again
+    const size_t batch_size = 1000;
+    for (size_t from = 0; from < indexes.size(); from += batch_size) {
+        auto res = _mem_table->insert(*pchunk, indexes.data(), from, batch_size);
+        ASSERT_TRUE(res.ok());
+    }
+    ASSERT_TRUE(_mem_table->finalize().ok());
+    ASSERT_EQ(0, _mem_table->get_stat().sort_count);
+    ASSERT_EQ(1, _mem_table->get_stat().presorted_count);
+    ASSERT_OK(_mem_table->flush());
+    RowsetSharedPtr rowset = *_writer->build();
+    unique_ptr<Schema> read_schema = create_schema("pk int", 1);
+    OlapReaderStatistics stats;
+    RowsetReadOptions rs_opts;
+    rs_opts.sorted = false;
+    rs_opts.use_page_cache = false;
+    rs_opts.stats = &stats;
+    auto itr = rowset->new_iterator(*read_schema, rs_opts);
+    ASSERT_TRUE(itr.ok()) << itr.status().to_string();
+    std::shared_ptr<Chunk> chunk = ChunkHelper::new_chunk(*read_schema, 4096);
+    size_t pkey_read = 0;
+    int last_value = -1;
+    while (true) {
+        Status st = (*itr)->get_next(chunk.get());
+        if (st.is_end_of_file()) {
+            break;
+        }
+        auto column = chunk->get_column_by_name("pk");
+        for (size_t i = 0; i < column->size(); i++) {
+            int new_value = column->get(i).get_int32();
+            ASSERT_LT(last_value, new_value);
+            last_value = new_value;
+        }
+        pkey_read += chunk->num_rows();
+        chunk->reset();
+    }
+    ASSERT_EQ(n, pkey_read);
+}
+
+TEST_F(MemTableTest, testDupKeysUnsortedInsert) {
+    const string path = "./MemTableTest_testDupKeysUnsortedInsert";
+    MySetUp(create_tablet_schema("pk int,name varchar,pv int", 1, KeysType::DUP_KEYS), "pk int,name varchar,pv int",
+            path);
+    const size_t n = 2000;
+    auto pchunk = gen_chunk(*_slots, n);
+    vector<uint32_t> indexes;
+    indexes.reserve(n);
+    for (int i = 0; i < n; i++) {
+        indexes.emplace_back(i);
+    }
+    // a batch out of sort key order falls back to sorting
+    const size_t batch_size = 1000;
+    ASSERT_TRUE(_mem_table->insert(*pchunk, indexes.data(), batch_size, batch_size).ok());
+    ASSERT_TRUE(_mem_table->insert(*pchunk, indexes.data(), 0, batch_size).ok());
+    ASSERT_TRUE(_mem_table->finalize().ok());
+    ASSERT_EQ(1, _mem_table->get_stat().sort_count);
+    ASSERT_EQ(0, _mem_table->get_stat().presorted_count);
+}
+
 TEST_F(MemTableTest, testPrimaryKeysWithDeletes) {
     const string path = "./MemTableTest_testPrimaryKeysWithDeletes";
     MySetUp(create_tablet_schema("pk bigint,v1 int", 1, KeysType::PRIMARY_KEYS), "pk bigint,v1 int,__op tinyint", path);
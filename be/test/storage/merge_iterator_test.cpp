@@ -128,6 +128,60 @@ TEST_F(MergeIteratorTest, heap_merge_no_overlapping) {
     ASSERT_TRUE(iter->get_next(chunk.get()).is_end_of_file());
 }
 
+// The rows of each child come in runs whose lengths fall on, just before and just after the gallop steps of
+// last_row_less_than, so a run may end at row 0, at the last row of a child chunk or on a power of two step.
+// The merged rows and sources must equal the (key, source) order, which is what the linear scan returned.
+// NOLINTNEXTLINE
+TEST_F(MergeIteratorTest, heap_merge_gallop_boundary) {
+    std::vector<size_t> run_lengths{1, 2, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 32, 33, 64, 1, 1};
+    std::vector<int32_t> v1;
+    std::vector<int32_t> v2;
+    std::vector<std::pair<int32_t, uint16_t>> expected;
+    int32_t key = 0;
+    for (size_t i = 0; i < run_lengths.size(); i++) {
+        for (size_t j = 0; j < run_lengths[i]; j++) {
+            v1.push_back(key);
+            expected.emplace_back(key++, 0);
+        }
+        // every other run of the second child starts with the same key as the last row of the first child
+        if (i % 2 == 0) {
+            key--;
+        }
+        for (size_t j = 0; j < run_lengths[run_lengths.size() - 1 - i]; j++) {
+            v2.push_back(key);
+            expected.emplace_back(key++, 1);
+        }
+    }
+    std::sort(expected.begin(), expected.end());
+
+    for (size_t child_chunk_size : {4096, 16, 8, 5}) {
+        auto sub1 = std::make_shared<VectorChunkIterator>(_schema, COL_INT(v1));
+        auto sub2 = std::make_shared<VectorChunkIterator>(_schema, COL_INT(v2));
+        sub1->chunk_size(child_chunk_size);
+        sub2->chunk_size(child_chunk_size);
+        auto iter = new_heap_merge_iterator(std::vector<ChunkIteratorPtr>{sub1, sub2});
+        ASSERT_TRUE(iter->init_encoded_schema(EMPTY_GLOBAL_DICTMAPS).ok());
+
+        std::vector<RowSourceMask> source_masks;
+        std::vector<int32_t> real;
+        ChunkPtr chunk = ChunkHelper::new_chunk(iter->schema(), config::vector_chunk_size);
+        while (iter->get_next(chunk.get(), &source_masks).ok()) {
+            ColumnPtr& c = chunk->get_column_by_index(0);
+            for (size_t i = 0; i < c->size(); i++) {
+                real.push_back(c->get(i).get_int32());
+            }
+            chunk->reset();
+        }
+        ASSERT_EQ(expected.size(), real.size()) << "child chunk size " << child_chunk_size;
+        ASSERT_EQ(expected.size(), source_masks.size()) << "child chunk size " << child_chunk_size;
+        for (size_t i = 0; i < expected.size(); i++) {
+            ASSERT_EQ(expected[i].first, real[i]) << "child chunk size " << child_chunk_size << ", row " << i;
+            ASSERT_EQ(expected[i].second, source_masks[i].get_source_num())
+                    << "child chunk size " << child_chunk_size << ", row " << i;
+        }
+    }
+}
+
 // NOLINTNEXTLINE
 TEST_F(MergeIteratorTest, merge_one) {
     auto sub1 = std::make_shared<VectorChunkIterator>(_schema, COL_INT({1, 1, 2, 3, 4, 5}));
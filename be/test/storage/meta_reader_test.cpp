@@ -18,11 +18,14 @@
 
 #include <memory>
 
+#include "column/column_helper.h"
 #include "column/fixed_length_column.h"
 #include "fs/fs_util.h"
 #include "fs/key_cache.h"
+#include "storage/chunk_helper.h"
 #include "storage/rowset/segment_writer.h"
 #include "testutil/assert.h"
+#include "util/defer_op.h"
 
 namespace starrocks {
 
@@ -110,4 +113,54 @@ TEST_F(SegmentMetaCollecterTest, test_open_and_collect) {
     EXPECT_EQ(0, col->get(0).get_int64());
 }
 
+TEST(SegmentMetaCollecterMinMaxTest, test_min_max_with_nulls) {
+    TabletSchemaPB schema_pb;
+    auto col = schema_pb.add_column();
+    col->set_name("c0");
+    col->set_type("INT");
+    col->set_is_key(true);
+    col->set_is_nullable(true);
+    auto tablet_schema = TabletSchema::create(schema_pb);
+
+    std::string segment_name = "segment_meta_collector_min_max_test.dat";
+    DeferOp defer([&]() { (void)fs::delete_file(segment_name); });
+    ASSIGN_OR_ABORT(auto segment_fs, FileSystem::CreateSharedFromString(segment_name));
+    auto encryption_pair = KeyCache::instance().create_plain_random_encryption_meta_pair().value();
+    WritableFileOptions options{.mode = FileSystem::CREATE_OR_OPEN_WITH_TRUNCATE,
+                                .encryption_info = encryption_pair.info};
+    ASSIGN_OR_ABORT(auto wf, segment_fs->new_writable_file(options, segment_name));
+    SegmentWriter writer(std::move(wf), 0, tablet_schema, SegmentWriterOptions());
+    ASSERT_OK(writer.init());
+    auto schema = ChunkHelper::convert_schema(tablet_schema);
+    auto chunk = ChunkHelper::new_chunk(schema, 3);
+    chunk->columns()[0]->append_datum(Datum());
+    chunk->columns()[0]->append_datum(Datum(static_cast<int32_t>(3)));
+    chunk->columns()[0]->append_datum(Datum(static_cast<int32_t>(5)));
+    ASSERT_OK(writer.append_chunk(*chunk));
+    uint64_t file_size, index_size, footer_pos;
+    ASSERT_OK(writer.finalize(&file_size, &index_size, &footer_pos));
+
+    FileInfo file_info{.path = segment_name, .encryption_meta = encryption_pair.encryption_meta};
+    ASSIGN_OR_ABORT(auto segment, Segment::open(segment_fs, file_info, 0, tablet_schema));
+
+    SegmentMetaCollecter collecter(segment);
+    SegmentMetaCollecterParams params;
+    params.fields = {"min", "max"};
+    params.field_type = {LogicalType::TYPE_INT, LogicalType::TYPE_INT};
+    params.cids = {0, 0};
+    params.read_page = {false, false};
+    params.tablet_schema = tablet_schema;
+    ASSERT_OK(collecter.init(&params));
+    ASSERT_OK(collecter.open());
+
+    auto min_col = ColumnHelper::create_column(TypeDescriptor(TYPE_INT), true);
+    auto max_col = ColumnHelper::create_column(TypeDescriptor(TYPE_INT), true);
+    std::vector<Column*> columns{min_col.get(), max_col.get()};
+    ASSERT_OK(collecter.collect(&columns));
+    ASSERT_EQ(1, min_col->size());
+    ASSERT_EQ(1, max_col->size());
+    EXPECT_EQ(3, min_col->get(0).get_int32());
+    EXPECT_EQ(5, max_col->get(0).get_int32());
+}
+
 } // namespace starrocks
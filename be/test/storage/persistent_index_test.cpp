@@ -1359,6 +1359,58 @@ TEST_P(PersistentIndexTest, test_flush_fixlen_to_immutable) {
     ASSERT_TRUE(fs::remove_all("./index.l1.1.1").ok());
 }
 
+TEST_P(PersistentIndexTest, test_mmap_immutable_index) {
+    using Key = uint64_t;
+    const int N = 100000;
+    vector<Key> keys(N);
+    vector<IndexValue> values(N);
+    vector<Slice> key_slices;
+    vector<size_t> idxes;
+    key_slices.reserve(N);
+    idxes.reserve(N);
+    for (int i = 0; i < N; i++) {
+        keys[i] = i;
+        values[i] = i * 2;
+        key_slices.emplace_back((uint8_t*)(&keys[i]), sizeof(Key));
+        idxes.push_back(i);
+    }
+    ASSIGN_OR_ABORT(auto idx, MutableIndex::create(sizeof(Key)));
+    ASSERT_TRUE(idx->insert(key_slices.data(), values.data(), idxes).ok());
+
+    auto writer = std::make_unique<ImmutableIndexWriter>();
+    ASSERT_TRUE(writer->init("./index.l1.2.1", EditVersion(2, 1), false).ok());
+    auto [nshard, npage_hint, page_size] = MutableIndex::estimate_nshard_and_npage((sizeof(Key) + 8) * N, N);
+    auto nbucket = MutableIndex::estimate_nbucket(sizeof(Key), N, nshard, npage_hint);
+    ASSERT_TRUE(idx->flush_to_immutable_index(writer, nshard, npage_hint, page_size, nbucket, true).ok());
+    ASSERT_TRUE(writer->finish().ok());
+
+    bool old_enable_mmap = config::enable_pindex_mmap_read;
+    config::enable_pindex_mmap_read = true;
+    DeferOp defer([&]() { config::enable_pindex_mmap_read = old_enable_mmap; });
+    ASSIGN_OR_ABORT(auto fs, FileSystem::CreateSharedFromString("posix://"));
+    ASSIGN_OR_ABORT(auto rf, fs->new_random_access_file("./index.l1.2.1"));
+    ASSIGN_OR_ABORT(auto idx_loaded, ImmutableIndex::load(std::move(rf), true));
+
+    KeysInfo keys_info;
+    for (size_t i = 0; i < N; i++) {
+        keys_info.key_infos.emplace_back(i, key_index_hash(&keys[i], sizeof(Key)));
+    }
+    vector<IndexValue> get_values(N);
+    KeysInfo found_keys_info;
+    ASSERT_TRUE(
+            idx_loaded->get(N, key_slices.data(), keys_info, get_values.data(), &found_keys_info, sizeof(Key)).ok());
+    ASSERT_EQ(N, found_keys_info.size());
+    for (size_t i = 0; i < N; i++) {
+        ASSERT_EQ(values[i], get_values[i]);
+    }
+    // the probes above have faulted in pages of the mapping
+    ASSERT_GT(idx_loaded->mmap_resident_bytes(), 0);
+    ASSERT_LE(idx_loaded->mmap_resident_bytes(), idx_loaded->file_size());
+    idx_loaded->clear();
+    ASSERT_EQ(0, idx_loaded->mmap_resident_bytes());
+    ASSERT_TRUE(fs::remove_all("./index.l1.2.1").ok());
+}
+
 TEST_P(PersistentIndexTest, test_flush_varlen_to_immutable) {
     const std::string kPersistentIndexDir = "./PersistentIndexTest_test_flush_varlen_to_immutable";
     ASSIGN_OR_ABORT(auto fs, FileSystem::CreateSharedFromString("posix://"));
@@ -3222,6 +3274,23 @@ TEST_P(PersistentIndexTest, pindex_compaction_disk_limit) {
     ASSERT_FALSE(mgr.disk_limit(tablet3->data_dir()));
 }
 
+TEST_P(PersistentIndexTest, pindex_compaction_io_busy) {
+    auto old_limit = config::pindex_major_compaction_max_disk_io_util_percent;
+    auto old_io_util = StarRocksMetrics::instance()->max_disk_io_util_percent.value();
+    DeferOp defer([&]() {
+        config::pindex_major_compaction_max_disk_io_util_percent = old_limit;
+        StarRocksMetrics::instance()->max_disk_io_util_percent.set_value(old_io_util);
+    });
+    PersistentIndexCompactionManager mgr;
+    config::pindex_major_compaction_max_disk_io_util_percent = 90;
+    StarRocksMetrics::instance()->max_disk_io_util_percent.set_value(50);
+    ASSERT_FALSE(mgr.io_busy());
+    StarRocksMetrics::instance()->max_disk_io_util_percent.set_value(95);
+    ASSERT_TRUE(mgr.io_busy());
+    config::pindex_major_compaction_max_disk_io_util_percent = 0;
+    ASSERT_FALSE(mgr.io_busy());
+}
+
 TEST_P(PersistentIndexTest, pindex_compaction_schedule) {
     config::pindex_major_compaction_schedule_interval_seconds = 0;
     TabletSharedPtr tablet = create_tablet(rand(), rand());
@@ -40,6 +40,7 @@
 #include <iostream>
 
 #include "column/column.h"
+#include "common/config.h"
 #include "common/logging.h"
 #include "gen_cpp/segment.pb.h"
 #include "runtime/mem_pool.h"
@@ -299,4 +300,39 @@ TEST_F(BinaryDictPageTest, TestEncodingRatio) {
     test_with_large_data_size(slices);
 }
 
+// NOLINTNEXTLINE
+TEST_F(BinaryDictPageTest, TestFallbackOnNewValues) {
+    double old_ratio = config::dictionary_page_fallback_new_value_ratio;
+    std::vector<std::string> src_strings;
+    std::vector<Slice> slices;
+    for (int i = 0; i < 100; ++i) {
+        src_strings.emplace_back("value_" + std::to_string(i));
+    }
+    for (const auto& src_string : src_strings) {
+        slices.emplace_back(src_string);
+    }
+
+    for (double ratio : {1.0, 0.5}) {
+        config::dictionary_page_fallback_new_value_ratio = ratio;
+        PageBuilderOptions options;
+        options.data_page_size = 256 * 1024;
+        options.dict_page_size = 256 * 1024;
+        BinaryDictPageBuilder page_builder(options);
+        // every value of the first page is new to the dictionary
+        ASSERT_EQ(slices.size(), page_builder.add(reinterpret_cast<const uint8_t*>(slices.data()), slices.size()));
+        page_builder.finish();
+        ASSERT_TRUE(page_builder.all_dict_encoded());
+        page_builder.reset();
+        ASSERT_EQ(ratio == 1.0, page_builder.all_dict_encoded());
+
+        // the second page is still readable after the switch
+        ASSERT_EQ(slices.size(), page_builder.add(reinterpret_cast<const uint8_t*>(slices.data()), slices.size()));
+        OwnedSlice page = page_builder.finish()->build();
+        Slice encoded_data = page.slice();
+        EncodingTypePB expected = ratio == 1.0 ? DICT_ENCODING : PLAIN_ENCODING;
+        ASSERT_EQ(expected, static_cast<EncodingTypePB>(decode_fixed32_le((const uint8_t*)encoded_data.data)));
+    }
+    config::dictionary_page_fallback_new_value_ratio = old_ratio;
+}
+
 } // namespace starrocks
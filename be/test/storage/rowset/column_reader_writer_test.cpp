@@ -798,4 +798,67 @@ TEST_F(ColumnReaderWriterTest, test_large_varchar_column_writer) {
     }
 }
 
+TEST_F(ColumnReaderWriterTest, test_speculate_prefix_encoding) {
+    auto fs = std::make_shared<MemoryFileSystem>();
+    ASSERT_TRUE(fs->create_dir(TEST_DIR).ok());
+    const std::string fname = strings::Substitute("$0/test_speculate_prefix_encoding.data", TEST_DIR);
+    double old_ratio = config::string_prefix_encoding_min_shared_ratio;
+
+    const int TEST_N = 1000;
+    std::vector<std::string> col_strs(TEST_N);
+    std::vector<Slice> col_slices;
+    for (int i = 0; i < TEST_N; i++) {
+        col_strs[i] = strings::Substitute("https://www.starrocks.io/docs/introduction/page_$0", i);
+        col_slices.emplace_back(col_strs[i]);
+    }
+
+    for (double ratio : {0.0, 0.5}) {
+        config::string_prefix_encoding_min_shared_ratio = ratio;
+        fs->delete_file(fname);
+        ASSIGN_OR_ABORT(auto wfile, fs->new_writable_file(fname));
+        ColumnMetaPB meta;
+        ColumnWriterOptions writer_opts;
+        writer_opts.page_format = 2;
+        writer_opts.meta = &meta;
+        writer_opts.meta->set_column_id(0);
+        writer_opts.meta->set_unique_id(0);
+        writer_opts.meta->set_type(TYPE_VARCHAR);
+        writer_opts.meta->set_length(1024);
+        writer_opts.meta->set_encoding(DEFAULT_ENCODING);
+        writer_opts.meta->set_compression(starrocks::LZ4_FRAME);
+        writer_opts.meta->set_is_nullable(false);
+
+        TabletColumn column = create_varchar_key(1, false, 1024);
+        ASSIGN_OR_ABORT(auto writer, ColumnWriter::create(writer_opts, &column, wfile.get()));
+        ASSERT_OK(writer->init());
+        auto col = ChunkHelper::column_from_field_type(TYPE_VARCHAR, false);
+        col->append_strings(col_slices);
+        ASSERT_OK(writer->append(*col));
+        ASSERT_OK(writer->finish());
+        ASSERT_OK(writer->write_data());
+        ASSERT_OK(writer->write_ordinal_index());
+        ASSERT_OK(wfile->close());
+        ASSERT_EQ(ratio > 0 ? PREFIX_ENCODING : PLAIN_ENCODING, meta.encoding());
+
+        auto segment = create_dummy_segment(fs, fname);
+        ASSIGN_OR_ABORT(auto reader, ColumnReader::create(&meta, segment.get(), nullptr));
+        ASSIGN_OR_ABORT(auto iter, reader->new_iterator());
+        ASSIGN_OR_ABORT(auto read_file, fs->new_random_access_file(fname));
+        ColumnIteratorOptions iter_opts;
+        OlapReaderStatistics stats;
+        iter_opts.stats = &stats;
+        iter_opts.read_file = read_file.get();
+        ASSERT_OK(iter->init(iter_opts));
+        ASSERT_OK(iter->seek_to_first());
+        ColumnPtr dst = ChunkHelper::column_from_field_type(TYPE_VARCHAR, false);
+        size_t rows_read = TEST_N;
+        ASSERT_OK(iter->next_batch(&rows_read, dst.get()));
+        ASSERT_EQ(TEST_N, dst->size());
+        for (int i = 0; i < TEST_N; i++) {
+            ASSERT_EQ(col_slices[i], dst->get(i).get_slice());
+        }
+    }
+    config::string_prefix_encoding_min_shared_ratio = old_ratio;
+}
+
 } // namespace starrocks
@@ -216,6 +216,24 @@ protected:
                 ASSERT_EQ("{CONST: NULL:CONST: NULL,CONST: NULL:CONST: NULL,CONST: NULL:CONST: NULL}",
                           dst_column->debug_item(3));
             }
+
+            // random read
+            {
+                auto dst_offsets = UInt32Column::create();
+                auto dst_keys = NullableColumn::create(Int32Column::create(), NullColumn::create());
+                auto dst_values = NullableColumn::create(Int32Column::create(), NullColumn::create());
+                auto dst_column = MapColumn::create(std::move(dst_keys), std::move(dst_values), std::move(dst_offsets));
+                std::vector<rowid_t> rowids{1, 3};
+                auto st = iter->fetch_values_by_rowid(rowids.data(), rowids.size(), dst_column.get());
+                ASSERT_TRUE(st.ok()) << st.to_string();
+
+                ASSERT_EQ(2, dst_column->size());
+                ASSERT_EQ(3, dst_column->keys_column()->size());
+                ASSERT_EQ(3, dst_column->values_column()->size());
+                ASSERT_EQ("{}", dst_column->debug_item(0));
+                ASSERT_EQ("{CONST: NULL:CONST: NULL,CONST: NULL:CONST: NULL,CONST: NULL:CONST: NULL}",
+                          dst_column->debug_item(1));
+            }
         }
 
         {
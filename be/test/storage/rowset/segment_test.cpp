@@ -285,6 +285,79 @@ TEST_F(SegmentReaderWriterTest, TestHorizontalWrite) {
     }
 }
 
+// NOLINTNEXTLINE
+TEST_F(SegmentReaderWriterTest, TestWriteWithColumnEncodings) {
+    std::shared_ptr<TabletSchema> tablet_schema = TabletSchemaHelper::create_tablet_schema(
+            {create_int_key_pb(1), create_int_value_pb(2), create_int_value_pb(3)});
+
+    // an encoding not supported by the type is rejected
+    {
+        SegmentWriterOptions opts;
+        opts.column_encodings[1] = PREFIX_ENCODING;
+        ASSIGN_OR_ABORT(auto wfile, _fs->new_writable_file(kSegmentDir + "/invalid_column_encoding"));
+        SegmentWriter writer(std::move(wfile), 0, tablet_schema, opts);
+        ASSERT_FALSE(writer.init().ok());
+    }
+
+    SegmentWriterOptions opts;
+    opts.num_rows_per_block = 10;
+    opts.column_encodings[1] = FOR_ENCODING;
+    opts.column_encodings[2] = PLAIN_ENCODING;
+
+    std::string file_name = kSegmentDir + "/column_encodings";
+    ASSIGN_OR_ABORT(auto wfile, _fs->new_writable_file(file_name));
+    SegmentWriter writer(std::move(wfile), 0, tablet_schema, opts);
+    ASSERT_OK(writer.init());
+
+    int32_t chunk_size = config::vector_chunk_size;
+    size_t num_rows = chunk_size * 2;
+    auto schema = ChunkHelper::convert_schema(tablet_schema);
+    auto chunk = ChunkHelper::new_chunk(schema, chunk_size);
+    for (auto i = 0; i < num_rows / chunk_size; ++i) {
+        chunk->reset();
+        auto& cols = chunk->columns();
+        for (auto j = 0; j < chunk_size; ++j) {
+            cols[0]->append_datum(Datum(static_cast<int32_t>(i * chunk_size + j)));
+            cols[1]->append_datum(Datum(static_cast<int32_t>((i * chunk_size + j) % 7)));
+            cols[2]->append_datum(Datum(static_cast<int32_t>((i * chunk_size + j) % 7)));
+        }
+        ASSERT_OK(writer.append_chunk(*chunk));
+    }
+
+    uint64_t file_size = 0;
+    uint64_t index_size;
+    uint64_t footer_position;
+    ASSERT_OK(writer.finalize(&file_size, &index_size, &footer_position));
+
+    auto segment = *Segment::open(_fs, FileInfo{file_name}, 0, tablet_schema);
+    ASSERT_EQ(segment->num_rows(), num_rows);
+    ASSERT_EQ(FOR_ENCODING, segment->column(1)->encoding_info()->encoding());
+    ASSERT_EQ(PLAIN_ENCODING, segment->column(2)->encoding_info()->encoding());
+
+    SegmentReadOptions seg_options;
+    seg_options.fs = _fs;
+    OlapReaderStatistics stats;
+    seg_options.stats = &stats;
+    ASSIGN_OR_ABORT(auto seg_iterator, segment->new_iterator(schema, seg_options));
+
+    size_t count = 0;
+    while (true) {
+        chunk->reset();
+        auto st = seg_iterator->get_next(chunk.get());
+        if (st.is_end_of_file()) {
+            break;
+        }
+        ASSERT_OK(st);
+        for (auto i = 0; i < chunk->num_rows(); ++i) {
+            EXPECT_EQ(count, chunk->get(i)[0].get_int32());
+            EXPECT_EQ(count % 7, chunk->get(i)[1].get_int32());
+            EXPECT_EQ(count % 7, chunk->get(i)[2].get_int32());
+            ++count;
+        }
+    }
+    EXPECT_EQ(count, num_rows);
+}
+
 // NOLINTNEXTLINE
 TEST_F(SegmentReaderWriterTest, TestVerticalWrite) {
     std::shared_ptr<TabletSchema> tablet_schema = TabletSchemaHelper::create_tablet_schema(
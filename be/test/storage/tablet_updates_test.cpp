@@ -394,6 +394,90 @@ TEST_F(TabletUpdatesTest, writeread_with_persistent_index) {
     test_writeread(true);
 }
 
+TEST_F(TabletUpdatesTest, writeread_with_parallel_delvec) {
+    auto old_min_segments = config::pk_apply_parallel_delvec_min_segments;
+    config::pk_apply_parallel_delvec_min_segments = 1;
+    DeferOp defer([&]() { config::pk_apply_parallel_delvec_min_segments = old_min_segments; });
+    srand(GetCurrentTimeMicros());
+    _tablet = create_tablet(rand(), rand());
+    // each rowset holds a disjoint key range
+    const int kNumRowsets = 5;
+    const int N = 1000;
+    std::vector<int64_t> all_keys;
+    for (int r = 0; r < kNumRowsets; r++) {
+        std::vector<int64_t> keys;
+        for (int i = 0; i < N; i++) {
+            keys.push_back(r * N + i);
+        }
+        all_keys.insert(all_keys.end(), keys.begin(), keys.end());
+        ASSERT_TRUE(_tablet->rowset_commit(r + 2, create_rowset(_tablet, keys)).ok());
+    }
+    // the last apply updates all previous segments at once
+    auto version = kNumRowsets + 2;
+    ASSERT_TRUE(_tablet->rowset_commit(version, create_rowset(_tablet, all_keys)).ok());
+    ASSERT_EQ(version, _tablet->updates()->max_version());
+    ASSERT_EQ(kNumRowsets * N, read_tablet(_tablet, version));
+    ASSERT_EQ(kNumRowsets * N, read_tablet(_tablet, version - 1));
+}
+
+TEST_F(TabletUpdatesTest, parallel_delvec_with_many_segments) {
+    auto old_min_segments = config::pk_apply_parallel_delvec_min_segments;
+    DeferOp defer([&]() { config::pk_apply_parallel_delvec_min_segments = old_min_segments; });
+    const int kNumSegments = 16;
+    const int N = 100;
+    srand(GetCurrentTimeMicros());
+    // Segment s of the second rowset updates the even keys and keys 1, 3, 5 of segment s of the first rowset,
+    // and keys 1, 3, 5 of segment s + 1 which the next segment updates again. So the apply touches the delvecs
+    // of every segment of both rowsets, returns them serialized in rssid order.
+    auto apply_and_get_delvecs = [&](int32_t min_segments, std::vector<std::string>* delvecs) {
+        config::pk_apply_parallel_delvec_min_segments = min_segments;
+        _tablet = create_tablet(rand(), rand());
+        std::vector<std::vector<int64_t>> keys_by_segment(kNumSegments);
+        std::vector<std::vector<int64_t>> update_keys_by_segment(kNumSegments);
+        for (int s = 0; s < kNumSegments; s++) {
+            for (int i = 0; i < N; i++) {
+                keys_by_segment[s].push_back(s * N + i);
+                if (i % 2 == 0 || i <= 5) {
+                    update_keys_by_segment[s].push_back(s * N + i);
+                }
+            }
+            if (s + 1 < kNumSegments) {
+                for (int i : {1, 3, 5}) {
+                    update_keys_by_segment[s].push_back((s + 1) * N + i);
+                }
+            }
+        }
+        auto rs0 = create_rowset_with_mutiple_segments(_tablet, keys_by_segment);
+        ASSERT_TRUE(_tablet->rowset_commit(2, rs0).ok());
+        auto rs1 = create_rowset_with_mutiple_segments(_tablet, update_keys_by_segment);
+        ASSERT_TRUE(_tablet->rowset_commit(3, rs1).ok());
+        std::vector<RowsetSharedPtr> rowsets;
+        ASSERT_TRUE(_tablet->updates()->get_applied_rowsets(3, &rowsets).ok());
+        ASSERT_EQ(kNumSegments * N, read_tablet(_tablet, 3));
+
+        auto* manager = StorageEngine::instance()->update_manager();
+        for (const auto& rs : {rs0, rs1}) {
+            ASSERT_EQ(kNumSegments, rs->num_segments());
+            for (int s = 0; s < kNumSegments; s++) {
+                TabletSegmentId tsid(_tablet->tablet_id(), rs->rowset_meta()->get_rowset_seg_id() + s);
+                DelVectorPtr delvec;
+                ASSERT_TRUE(manager->get_del_vec(_tablet->data_dir()->get_meta(), tsid, 3, &delvec).ok());
+                size_t expected = rs == rs0 ? N / 2 + 3 : (s + 1 < kNumSegments ? 3 : 0);
+                ASSERT_EQ(expected, delvec->cardinality());
+                delvecs->emplace_back();
+                delvec->save_to(&delvecs->back());
+            }
+        }
+    };
+
+    std::vector<std::string> serial_delvecs;
+    apply_and_get_delvecs(0, &serial_delvecs);
+    std::vector<std::string> parallel_delvecs;
+    apply_and_get_delvecs(kNumSegments, &parallel_delvecs);
+    ASSERT_EQ(2 * kNumSegments, serial_delvecs.size());
+    ASSERT_EQ(serial_delvecs, parallel_delvecs);
+}
+
 TEST_F(TabletUpdatesTest, test_pk_index_write_amp_score) {
     srand(GetCurrentTimeMicros());
     _tablet = create_tablet(rand(), rand());
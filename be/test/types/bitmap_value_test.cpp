@@ -385,6 +385,46 @@ TEST_F(BitmapValueTest, bitmap_intersect) {
     check_bitmap(BitmapDataType::SET, bitmap_23, 10, 14);
 }
 
+TEST_F(BitmapValueTest, bitmap_fast_union) {
+    // fallback to operator|= when there is at most one roaring bitmap.
+    BitmapValue bitmap_1;
+    bitmap_1.fast_union({&_single_bitmap, &_medium_bitmap});
+    check_bitmap(BitmapDataType::SET, bitmap_1, 0, 14);
+
+    // mix of every type, including 64-bit values.
+    auto bitmap_2 = gen_bitmap(100, 200);
+    auto bitmap_3 = gen_bitmap(150, 300);
+    BitmapValue bitmap_4((1ull << 40) + 1);
+    BitmapValue bitmap_5(5);
+    bitmap_5.fast_union({&bitmap_2, &_empty_bitmap, &_medium_bitmap, &bitmap_3, &bitmap_4, &_large_bitmap});
+    ASSERT_EQ(bitmap_5.type(), BitmapDataType::BITMAP);
+    ASSERT_EQ(bitmap_5.cardinality(), 64 + 200 + 1);
+    ASSERT_TRUE(bitmap_5.contains((1ull << 40) + 1));
+    ASSERT_EQ(bitmap_5.mem_usage(), bitmap_5.serialize_size());
+
+    // the inputs are not modified.
+    check_bitmap(BitmapDataType::BITMAP, bitmap_2, 100, 200);
+    check_bitmap(BitmapDataType::BITMAP, _large_bitmap, 0, 64);
+
+    // union into a shared bitmap must not modify the other owner.
+    BitmapValue bitmap_6(_large_bitmap);
+    bitmap_6.fast_union({&bitmap_2, &bitmap_3});
+    check_bitmap(BitmapDataType::BITMAP, bitmap_6, 0, 64, 100, 300);
+    check_bitmap(BitmapDataType::BITMAP, _large_bitmap, 0, 64);
+}
+
+TEST_F(BitmapValueTest, bitmap_fast_intersect) {
+    auto bitmap_1 = gen_bitmap(0, 200);
+    auto bitmap_2 = gen_bitmap(50, 300);
+    auto bitmap_3 = gen_bitmap(10, 100);
+    bitmap_1.fast_intersect({&bitmap_2, &bitmap_3});
+    check_bitmap(BitmapDataType::BITMAP, bitmap_1, 50, 100);
+
+    auto bitmap_4 = gen_bitmap(0, 200);
+    bitmap_4.fast_intersect({&bitmap_2, &_single_bitmap, &bitmap_3});
+    check_bitmap(BitmapDataType::EMPTY, bitmap_4, 0, 0);
+}
+
 TEST_F(BitmapValueTest, test_remove) {
     BitmapValue bitmap_1;
     bitmap_1.remove(1);
@@ -14,7 +14,10 @@
 
 #include "util/cpu_info.h"
 
+#include <set>
+
 #include "gtest/gtest.h"
+#include "util/cpu_util.h"
 
 namespace starrocks {
 
@@ -55,4 +58,19 @@ TEST_F(CpuInfoTest, test_fail_cpu_flags_check) {
     GTEST_SKIP() << "avx2 is not supported, skip the test!";
 #endif
 }
+
+TEST_F(CpuInfoTest, test_numa_local_cpuids) {
+    CpuUtil::CpuIds cpuids = CpuInfo::get_core_ids();
+    std::set<size_t> covered_cpuids;
+    for (int i = 0; i < CpuInfo::get_max_num_numa_nodes(); i++) {
+        auto local_cpuids = CpuUtil::numa_local_cpuids(cpuids, i);
+        ASSERT_FALSE(local_cpuids.empty());
+        const int numa_node = CpuInfo::get_numa_node_of_core(local_cpuids[0]);
+        for (const auto cpuid : local_cpuids) {
+            ASSERT_EQ(numa_node, CpuInfo::get_numa_node_of_core(cpuid));
+            covered_cpuids.insert(cpuid);
+        }
+    }
+    ASSERT_EQ(cpuids.size(), covered_cpuids.size());
+}
 } // namespace starrocks
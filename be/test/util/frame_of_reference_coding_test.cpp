@@ -19,6 +19,8 @@
 
 #include <gtest/gtest.h>
 
+#include <random>
+
 namespace starrocks {
 class TestForCoding : public testing::Test {
 public:
@@ -114,6 +116,30 @@ TEST_F(TestForCoding, TestInt64) {
     ASSERT_EQ(data, actual_result);
 }
 
+TEST_F(TestForCoding, TestAllBitWidths) {
+    std::mt19937_64 rng(0);
+    // unordered values with a bounded range cover every delta bit width, the full range keeps original values
+    for (int bit_width = 1; bit_width <= 64; ++bit_width) {
+        faststring buffer(1);
+        ForEncoder<int64_t> encoder(&buffer);
+
+        std::vector<int64_t> data;
+        for (int i = 0; i < 300; ++i) {
+            uint64_t value = bit_width == 64 ? rng() : rng() & ((1ULL << bit_width) - 1);
+            data.push_back(static_cast<int64_t>(value));
+        }
+        encoder.put_batch(data.data(), data.size());
+        encoder.flush();
+
+        ForDecoder<int64_t> decoder(buffer.data(), buffer.length());
+        decoder.init();
+        std::vector<int64_t> actual_result(data.size());
+        decoder.get_batch(actual_result.data(), data.size());
+
+        ASSERT_EQ(data, actual_result) << "bit width " << bit_width;
+    }
+}
+
 TEST_F(TestForCoding, TestOneMinValue) {
     faststring buffer(1);
     ForEncoder<int32_t> encoder(&buffer);
@@ -44,6 +44,7 @@
 #include "testutil/assert.h"
 #include "types/logical_type.h"
 #include "util/compression/block_compression.h"
+#include "util/defer_op.h"
 #include "util/json.h"
 #include "util/json_flattener.h"
 #include "util/slice.h"
@@ -385,6 +386,52 @@ TEST_F(JsonFlattenerTest, testSortHitNums) {
     }
 }
 
+TEST_F(JsonFlattenerTest, testQueriedPathsFirst) {
+    // clang-format off
+    std::vector<std::string> jsons = {
+        R"({"qa": 1, "qb": 2, "qc": 3})",
+        R"({"qa": 4, "qb": 5, "qc": 6})",
+        R"({"qa": 7, "qb": 8})",
+        R"({"qa": 9})"
+    };
+    // clang-format on
+
+    ColumnPtr input = JsonColumn::create();
+    JsonColumn* json_input = down_cast<JsonColumn*>(input.get());
+    for (const auto& json : jsons) {
+        ASSIGN_OR_ABORT(auto json_value, JsonValue::parse(json));
+        json_input->append(&json_value);
+    }
+
+    auto old_sparsity_factor = config::json_flat_sparsity_factor;
+    auto old_column_max = config::json_flat_column_max;
+    config::json_flat_sparsity_factor = 0;
+    config::json_flat_column_max = 2;
+    DeferOp defer([&]() {
+        config::json_flat_sparsity_factor = old_sparsity_factor;
+        config::json_flat_column_max = old_column_max;
+    });
+
+    {
+        // "qa" is always kept as it hits all rows, then "qb" by hits
+        JsonPathDeriver jf;
+        jf.derived({json_input});
+        std::vector<std::string> paths = {"qa", "qb"};
+        EXPECT_EQ(paths, jf.flat_paths());
+        EXPECT_TRUE(jf.has_remain_json());
+    }
+
+    JsonPathAccessStats::instance()->record({"qc"});
+    {
+        // "qc" is queried, it takes the flat column of "qb"
+        JsonPathDeriver jf;
+        jf.derived({json_input});
+        std::vector<std::string> paths = {"qa", "qc"};
+        EXPECT_EQ(paths, jf.flat_paths());
+        EXPECT_TRUE(jf.has_remain_json());
+    }
+}
+
 TEST_F(JsonFlattenerTest, testRemainFilter) {
     // clang-format off
     std::vector<std::string> jsons = {
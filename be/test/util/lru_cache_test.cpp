@@ -36,6 +36,8 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <thread>
 #include <vector>
 
 using namespace starrocks;
@@ -280,6 +282,55 @@ TEST_F(CacheTest, Usage) {
     ASSERT_EQ(900 + key_mem_usage, cache.get_usage());
 }
 
+TEST_F(CacheTest, TinyLFUAdmission) {
+    LRUCache cache;
+    cache.set_admission(CacheAdmission::TINY_LFU);
+    CacheKey key1("100");
+    size_t key_mem_usage = sizeof(LRUHandle) - 1 + key1.size();
+    cache.set_capacity(2 * (100 + key_mem_usage));
+
+    // fill the cache with two hot entries
+    for (int i = 1; i <= 2; i++) {
+        std::string key_str = std::to_string(i * 100);
+        CacheKey key(key_str);
+        for (int j = 0; j < 5; j++) {
+            cache.release(cache.lookup(key, key.hash(key.data(), key.size(), 0)));
+        }
+        insert_LRUCache(cache, key, 100, CachePriority::NORMAL);
+    }
+    ASSERT_EQ(2 * (100 + key_mem_usage), cache.get_usage());
+
+    // a key seen once does not displace the hot entries
+    CacheKey cold_key("300");
+    uint32_t cold_hash = cold_key.hash(cold_key.data(), cold_key.size(), 0);
+    cache.release(cache.lookup(cold_key, cold_hash));
+    auto* handle = cache.insert(cold_key, cold_hash, EncodeValue(100), 100, &deleter);
+    ASSERT_NE(nullptr, handle);
+    ASSERT_EQ(100, DecodeValue(reinterpret_cast<LRUHandle*>(handle)->value));
+    cache.release(handle);
+    ASSERT_EQ(1, cache.get_rejected_count());
+    ASSERT_EQ(nullptr, cache.lookup(cold_key, cold_hash));
+    ASSERT_EQ(2 * (100 + key_mem_usage), cache.get_usage());
+    for (int i = 1; i <= 2; i++) {
+        std::string key_str = std::to_string(i * 100);
+        CacheKey key(key_str);
+        auto* hot = cache.lookup(key, key.hash(key.data(), key.size(), 0));
+        ASSERT_NE(nullptr, hot);
+        cache.release(hot);
+    }
+
+    // once it becomes hotter than the victim it is admitted
+    for (int j = 0; j < 10; j++) {
+        cache.release(cache.lookup(cold_key, cold_hash));
+    }
+    insert_LRUCache(cache, cold_key, 100, CachePriority::NORMAL);
+    ASSERT_EQ(1, cache.get_rejected_count());
+    handle = cache.lookup(cold_key, cold_hash);
+    ASSERT_NE(nullptr, handle);
+    cache.release(handle);
+    ASSERT_EQ(2 * (100 + key_mem_usage), cache.get_usage());
+}
+
 TEST_F(CacheTest, HeavyEntries) {
     // Add a bunch of light and heavy entries and then count the combined
     // size of items still in the cache, which must be approximately the
@@ -311,6 +362,150 @@ TEST_F(CacheTest, HeavyEntries) {
     ASSERT_LE(cached_weight, kCacheSize + kCacheSize / 10);
 }
 
+static Cache::Handle* lookup_LRUCache(LRUCache& cache, const CacheKey& key) {
+    return cache.lookup(key, key.hash(key.data(), key.size(), 0));
+}
+
+TEST_F(CacheTest, LRUEvictionOrder) {
+    LRUCache cache;
+    CacheKey key1("100");
+    size_t charge = 100 + LRUCache::key_handle_size(key1);
+    cache.set_capacity(3 * charge);
+    for (int i = 1; i <= 3; i++) {
+        insert_LRUCache(cache, CacheKey(std::to_string(i * 100)), 100, CachePriority::NORMAL);
+    }
+
+    // a hit moves 100 to the newest end, so 200 is the oldest one
+    cache.release(lookup_LRUCache(cache, CacheKey("100")));
+    insert_LRUCache(cache, CacheKey("400"), 100, CachePriority::NORMAL);
+    ASSERT_EQ(nullptr, lookup_LRUCache(cache, CacheKey("200")));
+
+    insert_LRUCache(cache, CacheKey("500"), 100, CachePriority::NORMAL);
+    ASSERT_EQ(nullptr, lookup_LRUCache(cache, CacheKey("300")));
+    for (const char* key : {"100", "400", "500"}) {
+        auto* handle = lookup_LRUCache(cache, CacheKey(key));
+        ASSERT_NE(nullptr, handle);
+        cache.release(handle);
+    }
+    ASSERT_EQ(3 * charge, cache.get_usage());
+}
+
+TEST_F(CacheTest, ClockSecondChance) {
+    LRUCache cache;
+    cache.set_eviction(CacheEviction::CLOCK);
+    CacheKey key1("100");
+    size_t charge = 100 + LRUCache::key_handle_size(key1);
+    cache.set_capacity(3 * charge);
+    for (int i = 1; i <= 3; i++) {
+        insert_LRUCache(cache, CacheKey(std::to_string(i * 100)), 100, CachePriority::NORMAL);
+    }
+
+    // 100 is visited twice and 200 once, each pass of the eviction takes one visit
+    cache.release(lookup_LRUCache(cache, CacheKey("100")));
+    cache.release(lookup_LRUCache(cache, CacheKey("100")));
+    cache.release(lookup_LRUCache(cache, CacheKey("200")));
+
+    auto check_evicted = [&](const std::string& inserted, const std::string& evicted) {
+        insert_LRUCache(cache, CacheKey(inserted), 100, CachePriority::NORMAL);
+        ASSERT_EQ(3 * charge, cache.get_usage());
+        // look up the evicted key only, the others would get another visit
+        ASSERT_EQ(nullptr, lookup_LRUCache(cache, CacheKey(evicted)));
+    };
+    check_evicted("400", "300");
+    check_evicted("500", "200");
+    check_evicted("600", "400");
+    check_evicted("700", "100");
+}
+
+TEST_F(CacheTest, InsertWithPinnedEntries) {
+    for (auto eviction : {CacheEviction::LRU, CacheEviction::CLOCK}) {
+        LRUCache cache;
+        cache.set_eviction(eviction);
+        CacheKey key1("100");
+        size_t charge = 100 + LRUCache::key_handle_size(key1);
+        cache.set_capacity(4 * charge);
+        for (int i = 1; i <= 4; i++) {
+            insert_LRUCache(cache, CacheKey(std::to_string(i * 100)), 100, CachePriority::NORMAL);
+        }
+        std::vector<Cache::Handle*> pinned;
+        for (int i = 1; i <= 3; i++) {
+            pinned.push_back(lookup_LRUCache(cache, CacheKey(std::to_string(i * 100))));
+            ASSERT_NE(nullptr, pinned.back());
+        }
+
+        // only the unpinned entry makes room, the pinned ones are kept out of the LRU list
+        insert_LRUCache(cache, CacheKey("500"), 100, CachePriority::NORMAL);
+        ASSERT_EQ(4 * charge, cache.get_usage());
+        for (auto* handle : pinned) {
+            ASSERT_TRUE(reinterpret_cast<LRUHandle*>(handle)->unlinked());
+        }
+        for (int i = 0; i < 100; i++) {
+            insert_LRUCache(cache, CacheKey(std::to_string(600 + i)), 100, CachePriority::NORMAL);
+            ASSERT_EQ(4 * charge, cache.get_usage());
+        }
+        ASSERT_EQ(nullptr, lookup_LRUCache(cache, CacheKey("400")));
+        ASSERT_EQ(nullptr, lookup_LRUCache(cache, CacheKey("500")));
+
+        // released entries join the LRU list again, so prune reaches them
+        for (auto* handle : pinned) {
+            ASSERT_EQ(100, DecodeValue(reinterpret_cast<LRUHandle*>(handle)->value));
+            cache.release(handle);
+        }
+        ASSERT_EQ(4 * charge, cache.get_usage());
+        ASSERT_EQ(4, cache.prune());
+        ASSERT_EQ(0, cache.get_usage());
+    }
+}
+
+TEST_F(CacheTest, ConcurrentLookup) {
+    static std::atomic<int> s_deleted;
+    s_deleted = 0;
+    auto deleter = [](const CacheKey&, void*) { s_deleted++; };
+    ShardedLRUCache cache(kCacheSize, CacheAdmission::ALWAYS, CacheEviction::CLOCK);
+    for (int i = 0; i < 100; i++) {
+        std::string result;
+        cache.release(cache.insert(EncodeKey(&result, i), EncodeValue(1000 + i), 1, deleter));
+    }
+
+    // lookups run under the shared lock and mix with inserts, evictions and erases of other keys
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++) {
+        threads.emplace_back([&cache] {
+            for (int i = 0; i < 10000; i++) {
+                int key = i % 100;
+                std::string result;
+                Cache::Handle* handle = cache.lookup(EncodeKey(&result, key));
+                if (handle != nullptr) {
+                    ASSERT_EQ(1000 + key, DecodeValue(cache.value(handle)));
+                    cache.release(handle);
+                }
+            }
+        });
+    }
+    threads.emplace_back([&cache] {
+        for (int i = 0; i < 10000; i++) {
+            std::string result;
+            auto* handle = cache.insert(EncodeKey(&result, 100 + i % 1000), EncodeValue(0), 1,
+                                        [](const CacheKey&, void*) {});
+            cache.release(handle);
+            if (i % 3 == 0) {
+                cache.erase(EncodeKey(&result, 100 + i % 1000));
+            }
+        }
+    });
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    // every entry is accounted and freed exactly once
+    for (int i = 0; i < 1100; i++) {
+        std::string result;
+        cache.erase(EncodeKey(&result, i));
+    }
+    ASSERT_EQ(0, cache.get_memory_usage());
+    ASSERT_EQ(100, s_deleted);
+}
+
 TEST_F(CacheTest, NewId) {
     uint64_t a = _cache->new_id();
     uint64_t b = _cache->new_id();
@@ -0,0 +1,49 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "util/perf_event_counters.h"
+
+#include <gtest/gtest.h>
+
+namespace starrocks {
+
+TEST(PerfEventCountersTest, scoped_counters) {
+    auto* perf = PerfEventCounters::thread_local_instance();
+    ASSERT_EQ(perf, PerfEventCounters::thread_local_instance());
+    if (perf == nullptr) {
+        GTEST_SKIP() << "perf events are not available";
+    }
+
+    RuntimeProfile profile("test");
+    RuntimeProfile::Counter* counters[PerfEventCounters::NUM_EVENTS];
+    for (int i = 0; i < PerfEventCounters::NUM_EVENTS; ++i) {
+        counters[i] = ADD_COUNTER(&profile, PerfEventCounters::kEventNames[i], TUnit::UNIT);
+    }
+    {
+        SCOPED_PERF_EVENT_COUNTERS(perf, counters, 2);
+        volatile int64_t sum = 0;
+        for (int i = 0; i < 100000; ++i) {
+            sum += i;
+        }
+    }
+    ASSERT_GT(counters[PerfEventCounters::INSTRUCTIONS]->value(), 100000);
+    ASSERT_GT(counters[PerfEventCounters::CPU_CYCLES]->value(), 0);
+
+    // not sampled
+    int64_t instructions = counters[PerfEventCounters::INSTRUCTIONS]->value();
+    { SCOPED_PERF_EVENT_COUNTERS(nullptr, counters, 2); }
+    ASSERT_EQ(instructions, counters[PerfEventCounters::INSTRUCTIONS]->value());
+}
+
+} // namespace starrocks
@@ -21,6 +21,7 @@
 #include <future>
 #include <utility>
 
+#include "runtime/current_thread.h"
 #include "testutil/sync_point.h"
 #include "util/defer_op.h"
 
@@ -107,4 +108,45 @@ TEST(StackUtilTest, get_stack_trace_for_thread) {
     ASSERT_TRUE(stack_trace.find("mock_frame_") != std::string::npos);
 }
 
+TEST(StackUtilTest, get_collapsed_stacks_for_query) {
+    TUniqueId query_id;
+    query_id.hi = 1;
+    query_id.lo = 2;
+    std::atomic_bool stop = false;
+    std::promise<pid_t> tid_promise;
+    std::thread thread([&]() {
+        CurrentThread::current().set_query_id(query_id);
+        tid_promise.set_value(syscall(SYS_gettid));
+        while (!stop) {
+            usleep(1000);
+        }
+        CurrentThread::current().set_query_id({});
+    });
+
+    SyncPoint::GetInstance()->EnableProcessing();
+    DeferOp defer([&]() {
+        SyncPoint::GetInstance()->ClearCallBack("StackTraceTask::symbolize");
+        SyncPoint::GetInstance()->DisableProcessing();
+        stop.store(true);
+        thread.join();
+    });
+
+    SyncPoint::GetInstance()->SetCallBack("StackTraceTask::symbolize", [&](void* arg) {
+        SymbolizeTuple* tuple = (SymbolizeTuple*)arg;
+        std::snprintf(std::get<1>(*tuple), std::get<2>(*tuple), "mock_frame");
+    });
+    auto tid_future = tid_promise.get_future();
+    ASSERT_EQ(std::future_status::ready, tid_future.wait_for(std::chrono::seconds(60)));
+    std::vector<int> tids{tid_future.get()};
+
+    std::string stacks = get_collapsed_stacks_for_query(tids, query_id, 200, 100);
+    ASSERT_TRUE(stacks.find("mock_frame;mock_frame") != std::string::npos) << stacks;
+
+    // the thread is not running the query
+    TUniqueId other_query_id;
+    other_query_id.hi = 3;
+    other_query_id.lo = 4;
+    ASSERT_TRUE(get_collapsed_stacks_for_query(tids, other_query_id, 100, 100).empty());
+}
+
 } // namespace starrocks
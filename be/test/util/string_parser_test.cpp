@@ -251,6 +251,28 @@ TEST(StringToInt, Limit) {
                             StringParser::PARSE_SUCCESS);
 }
 
+// Values long enough to be parsed 8 digits at a time, mixed with trailing garbage and whitespace.
+TEST(StringToInt, LongDigits) {
+    test_int_value<int32_t>("123456789", 123456789, StringParser::PARSE_SUCCESS);
+    test_int_value<int32_t>("-987654321", -987654321, StringParser::PARSE_SUCCESS);
+    test_int_value<int64_t>("1234567890123456789", 1234567890123456789L, StringParser::PARSE_SUCCESS);
+    test_int_value<int64_t>("000000000000000001", 1, StringParser::PARSE_SUCCESS);
+    test_int_value<int64_t>("12345678901234  ", 12345678901234, StringParser::PARSE_SUCCESS);
+    test_int_value<int64_t>("1234567890 23456", 0, StringParser::PARSE_FAILURE);
+    test_int_value<int64_t>("123456789a123456", 0, StringParser::PARSE_FAILURE);
+    test_int_value<int64_t>("12345678:1234567", 0, StringParser::PARSE_FAILURE);
+    test_int_value<int64_t>("12345678/1234567", 0, StringParser::PARSE_FAILURE);
+
+    std::mt19937_64 gen(0);
+    for (int i = 0; i < 10000; ++i) {
+        int64_t v = static_cast<int64_t>(gen() >> (gen() % 64));
+        if (i % 2 == 1) {
+            v = -v;
+        }
+        test_int_value<int64_t>(std::to_string(v).c_str(), v, StringParser::PARSE_SUCCESS);
+    }
+}
+
 TEST(StringToUnsignedInt, Basic) {
     test_unsigned_int_value<uint8_t>("123", 123, StringParser::PARSE_SUCCESS);
     test_unsigned_int_value<uint16_t>("123", 123, StringParser::PARSE_SUCCESS);
@@ -485,6 +485,26 @@ TEST_F(ThreadPoolTest, TestTokenSubmitsProcessedSerially) {
     ASSERT_EQ("abcde", result);
 }
 
+TEST_F(ThreadPoolTest, TestTokenPriority) {
+    ASSERT_TRUE(rebuild_pool_with_min_max(1, 1).ok());
+    std::unique_ptr<ThreadPoolToken> blocker = _pool->new_token(ThreadPool::ExecutionMode::SERIAL);
+    std::unique_ptr<ThreadPoolToken> low = _pool->new_token(ThreadPool::ExecutionMode::SERIAL);
+    std::unique_ptr<ThreadPoolToken> high = _pool->new_token(ThreadPool::ExecutionMode::SERIAL);
+    high->set_priority(ThreadPool::HIGH_PRIORITY);
+
+    // occupy the only thread, so that the following tasks are queued
+    CountDownLatch latch(1);
+    ASSERT_TRUE(blocker->submit_func([&latch]() { latch.wait(); }).ok());
+    string result;
+    ASSERT_TRUE(low->submit_func([&result]() { result += 'a'; }).ok());
+    ASSERT_TRUE(low->submit_func([&result]() { result += 'b'; }).ok());
+    ASSERT_TRUE(high->submit_func([&result]() { result += 'c'; }).ok());
+    ASSERT_TRUE(high->submit_func([&result]() { result += 'd'; }).ok());
+    latch.count_down();
+    _pool->wait();
+    ASSERT_EQ("cdab", result);
+}
+
 TEST_P(ThreadPoolTestTokenTypes, TestTokenSubmitsProcessedConcurrently) {
     const int kNumTokens = 5;
     ASSERT_TRUE(rebuild_pool_with_builder(ThreadPoolBuilder(kDefaultPoolName).set_max_threads(kNumTokens)).ok());